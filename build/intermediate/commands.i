@@ -0,0 +1,9191 @@
+# 0 "src/commands.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/commands.c"
+# 9 "src/commands.c"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 39 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 909 "/usr/include/stdio.h" 3 4
+
+# 10 "src/commands.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 59 "/usr/include/stdlib.h" 3 4
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+# 114 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 11 "src/commands.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 1 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 203 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/include/limits.h" 1 3 4
+# 26 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/limits.h" 2 3 4
+# 195 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+# 161 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+# 1 "/usr/include/linux/limits.h" 1 3 4
+# 39 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+# 81 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 2 3 4
+# 82 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+# 162 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+# 196 "/usr/include/limits.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h" 1 3 4
+# 200 "/usr/include/limits.h" 2 3 4
+# 204 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 2 3 4
+# 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 12 "src/commands.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 13 "src/commands.c" 2
+# 1 "/usr/include/unistd.h" 1 3 4
+# 27 "/usr/include/unistd.h" 3 4
+
+# 202 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h" 1 3 4
+# 203 "/usr/include/unistd.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/environments.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/environments.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/environments.h" 2 3 4
+# 207 "/usr/include/unistd.h" 2 3 4
+# 226 "/usr/include/unistd.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 227 "/usr/include/unistd.h" 2 3 4
+# 255 "/usr/include/unistd.h" 3 4
+typedef __useconds_t useconds_t;
+# 267 "/usr/include/unistd.h" 3 4
+typedef __intptr_t intptr_t;
+
+
+
+
+
+
+typedef __socklen_t socklen_t;
+# 287 "/usr/include/unistd.h" 3 4
+extern int access (const char *__name, int __type) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 309 "/usr/include/unistd.h" 3 4
+extern int faccessat (int __fd, const char *__file, int __type, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+# 339 "/usr/include/unistd.h" 3 4
+extern __off_t lseek (int __fd, __off_t __offset, int __whence) __attribute__ ((__nothrow__ , __leaf__));
+# 358 "/usr/include/unistd.h" 3 4
+extern int close (int __fd);
+
+
+
+
+extern void closefrom (int __lowfd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern ssize_t read (int __fd, void *__buf, size_t __nbytes)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern ssize_t write (int __fd, const void *__buf, size_t __n)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 389 "/usr/include/unistd.h" 3 4
+extern ssize_t pread (int __fd, void *__buf, size_t __nbytes,
+        __off_t __offset)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+
+extern ssize_t pwrite (int __fd, const void *__buf, size_t __n,
+         __off_t __offset)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 437 "/usr/include/unistd.h" 3 4
+extern int pipe (int __pipedes[2]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 452 "/usr/include/unistd.h" 3 4
+extern unsigned int alarm (unsigned int __seconds) __attribute__ ((__nothrow__ , __leaf__));
+# 464 "/usr/include/unistd.h" 3 4
+extern unsigned int sleep (unsigned int __seconds);
+
+
+
+
+
+
+
+extern __useconds_t ualarm (__useconds_t __value, __useconds_t __interval)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int usleep (__useconds_t __useconds);
+# 489 "/usr/include/unistd.h" 3 4
+extern int pause (void);
+
+
+
+extern int chown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchown (int __fd, __uid_t __owner, __gid_t __group) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int lchown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int fchownat (int __fd, const char *__file, __uid_t __owner,
+       __gid_t __group, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+extern int chdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchdir (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 531 "/usr/include/unistd.h" 3 4
+extern char *getcwd (char *__buf, size_t __size) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 545 "/usr/include/unistd.h" 3 4
+extern char *getwd (char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__))
+    __attribute__ ((__access__ (__write_only__, 1)));
+
+
+
+
+extern int dup (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern int dup2 (int __fd, int __fd2) __attribute__ ((__nothrow__ , __leaf__));
+# 564 "/usr/include/unistd.h" 3 4
+extern char **__environ;
+
+
+
+
+
+
+
+extern int execve (const char *__path, char *const __argv[],
+     char *const __envp[]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int fexecve (int __fd, char *const __argv[], char *const __envp[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+extern int execv (const char *__path, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execle (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execl (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execvp (const char *__file, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int execlp (const char *__file, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 619 "/usr/include/unistd.h" 3 4
+extern int nice (int __inc) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void _exit (int __status) __attribute__ ((__noreturn__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/confname.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/confname.h" 3 4
+enum
+  {
+    _PC_LINK_MAX,
+
+    _PC_MAX_CANON,
+
+    _PC_MAX_INPUT,
+
+    _PC_NAME_MAX,
+
+    _PC_PATH_MAX,
+
+    _PC_PIPE_BUF,
+
+    _PC_CHOWN_RESTRICTED,
+
+    _PC_NO_TRUNC,
+
+    _PC_VDISABLE,
+
+    _PC_SYNC_IO,
+
+    _PC_ASYNC_IO,
+
+    _PC_PRIO_IO,
+
+    _PC_SOCK_MAXBUF,
+
+    _PC_FILESIZEBITS,
+
+    _PC_REC_INCR_XFER_SIZE,
+
+    _PC_REC_MAX_XFER_SIZE,
+
+    _PC_REC_MIN_XFER_SIZE,
+
+    _PC_REC_XFER_ALIGN,
+
+    _PC_ALLOC_SIZE_MIN,
+
+    _PC_SYMLINK_MAX,
+
+    _PC_2_SYMLINKS
+
+  };
+
+
+enum
+  {
+    _SC_ARG_MAX,
+
+    _SC_CHILD_MAX,
+
+    _SC_CLK_TCK,
+
+    _SC_NGROUPS_MAX,
+
+    _SC_OPEN_MAX,
+
+    _SC_STREAM_MAX,
+
+    _SC_TZNAME_MAX,
+
+    _SC_JOB_CONTROL,
+
+    _SC_SAVED_IDS,
+
+    _SC_REALTIME_SIGNALS,
+
+    _SC_PRIORITY_SCHEDULING,
+
+    _SC_TIMERS,
+
+    _SC_ASYNCHRONOUS_IO,
+
+    _SC_PRIORITIZED_IO,
+
+    _SC_SYNCHRONIZED_IO,
+
+    _SC_FSYNC,
+
+    _SC_MAPPED_FILES,
+
+    _SC_MEMLOCK,
+
+    _SC_MEMLOCK_RANGE,
+
+    _SC_MEMORY_PROTECTION,
+
+    _SC_MESSAGE_PASSING,
+
+    _SC_SEMAPHORES,
+
+    _SC_SHARED_MEMORY_OBJECTS,
+
+    _SC_AIO_LISTIO_MAX,
+
+    _SC_AIO_MAX,
+
+    _SC_AIO_PRIO_DELTA_MAX,
+
+    _SC_DELAYTIMER_MAX,
+
+    _SC_MQ_OPEN_MAX,
+
+    _SC_MQ_PRIO_MAX,
+
+    _SC_VERSION,
+
+    _SC_PAGESIZE,
+
+
+    _SC_RTSIG_MAX,
+
+    _SC_SEM_NSEMS_MAX,
+
+    _SC_SEM_VALUE_MAX,
+
+    _SC_SIGQUEUE_MAX,
+
+    _SC_TIMER_MAX,
+
+
+
+
+    _SC_BC_BASE_MAX,
+
+    _SC_BC_DIM_MAX,
+
+    _SC_BC_SCALE_MAX,
+
+    _SC_BC_STRING_MAX,
+
+    _SC_COLL_WEIGHTS_MAX,
+
+    _SC_EQUIV_CLASS_MAX,
+
+    _SC_EXPR_NEST_MAX,
+
+    _SC_LINE_MAX,
+
+    _SC_RE_DUP_MAX,
+
+    _SC_CHARCLASS_NAME_MAX,
+
+
+    _SC_2_VERSION,
+
+    _SC_2_C_BIND,
+
+    _SC_2_C_DEV,
+
+    _SC_2_FORT_DEV,
+
+    _SC_2_FORT_RUN,
+
+    _SC_2_SW_DEV,
+
+    _SC_2_LOCALEDEF,
+
+
+    _SC_PII,
+
+    _SC_PII_XTI,
+
+    _SC_PII_SOCKET,
+
+    _SC_PII_INTERNET,
+
+    _SC_PII_OSI,
+
+    _SC_POLL,
+
+    _SC_SELECT,
+
+    _SC_UIO_MAXIOV,
+
+    _SC_IOV_MAX = _SC_UIO_MAXIOV,
+
+    _SC_PII_INTERNET_STREAM,
+
+    _SC_PII_INTERNET_DGRAM,
+
+    _SC_PII_OSI_COTS,
+
+    _SC_PII_OSI_CLTS,
+
+    _SC_PII_OSI_M,
+
+    _SC_T_IOV_MAX,
+
+
+
+    _SC_THREADS,
+
+    _SC_THREAD_SAFE_FUNCTIONS,
+
+    _SC_GETGR_R_SIZE_MAX,
+
+    _SC_GETPW_R_SIZE_MAX,
+
+    _SC_LOGIN_NAME_MAX,
+
+    _SC_TTY_NAME_MAX,
+
+    _SC_THREAD_DESTRUCTOR_ITERATIONS,
+
+    _SC_THREAD_KEYS_MAX,
+
+    _SC_THREAD_STACK_MIN,
+
+    _SC_THREAD_THREADS_MAX,
+
+    _SC_THREAD_ATTR_STACKADDR,
+
+    _SC_THREAD_ATTR_STACKSIZE,
+
+    _SC_THREAD_PRIORITY_SCHEDULING,
+
+    _SC_THREAD_PRIO_INHERIT,
+
+    _SC_THREAD_PRIO_PROTECT,
+
+    _SC_THREAD_PROCESS_SHARED,
+
+
+    _SC_NPROCESSORS_CONF,
+
+    _SC_NPROCESSORS_ONLN,
+
+    _SC_PHYS_PAGES,
+
+    _SC_AVPHYS_PAGES,
+
+    _SC_ATEXIT_MAX,
+
+    _SC_PASS_MAX,
+
+
+    _SC_XOPEN_VERSION,
+
+    _SC_XOPEN_XCU_VERSION,
+
+    _SC_XOPEN_UNIX,
+
+    _SC_XOPEN_CRYPT,
+
+    _SC_XOPEN_ENH_I18N,
+
+    _SC_XOPEN_SHM,
+
+
+    _SC_2_CHAR_TERM,
+
+    _SC_2_C_VERSION,
+
+    _SC_2_UPE,
+
+
+    _SC_XOPEN_XPG2,
+
+    _SC_XOPEN_XPG3,
+
+    _SC_XOPEN_XPG4,
+
+
+    _SC_CHAR_BIT,
+
+    _SC_CHAR_MAX,
+
+    _SC_CHAR_MIN,
+
+    _SC_INT_MAX,
+
+    _SC_INT_MIN,
+
+    _SC_LONG_BIT,
+
+    _SC_WORD_BIT,
+
+    _SC_MB_LEN_MAX,
+
+    _SC_NZERO,
+
+    _SC_SSIZE_MAX,
+
+    _SC_SCHAR_MAX,
+
+    _SC_SCHAR_MIN,
+
+    _SC_SHRT_MAX,
+
+    _SC_SHRT_MIN,
+
+    _SC_UCHAR_MAX,
+
+    _SC_UINT_MAX,
+
+    _SC_ULONG_MAX,
+
+    _SC_USHRT_MAX,
+
+
+    _SC_NL_ARGMAX,
+
+    _SC_NL_LANGMAX,
+
+    _SC_NL_MSGMAX,
+
+    _SC_NL_NMAX,
+
+    _SC_NL_SETMAX,
+
+    _SC_NL_TEXTMAX,
+
+
+    _SC_XBS5_ILP32_OFF32,
+
+    _SC_XBS5_ILP32_OFFBIG,
+
+    _SC_XBS5_LP64_OFF64,
+
+    _SC_XBS5_LPBIG_OFFBIG,
+
+
+    _SC_XOPEN_LEGACY,
+
+    _SC_XOPEN_REALTIME,
+
+    _SC_XOPEN_REALTIME_THREADS,
+
+
+    _SC_ADVISORY_INFO,
+
+    _SC_BARRIERS,
+
+    _SC_BASE,
+
+    _SC_C_LANG_SUPPORT,
+
+    _SC_C_LANG_SUPPORT_R,
+
+    _SC_CLOCK_SELECTION,
+
+    _SC_CPUTIME,
+
+    _SC_THREAD_CPUTIME,
+
+    _SC_DEVICE_IO,
+
+    _SC_DEVICE_SPECIFIC,
+
+    _SC_DEVICE_SPECIFIC_R,
+
+    _SC_FD_MGMT,
+
+    _SC_FIFO,
+
+    _SC_PIPE,
+
+    _SC_FILE_ATTRIBUTES,
+
+    _SC_FILE_LOCKING,
+
+    _SC_FILE_SYSTEM,
+
+    _SC_MONOTONIC_CLOCK,
+
+    _SC_MULTI_PROCESS,
+
+    _SC_SINGLE_PROCESS,
+
+    _SC_NETWORKING,
+
+    _SC_READER_WRITER_LOCKS,
+
+    _SC_SPIN_LOCKS,
+
+    _SC_REGEXP,
+
+    _SC_REGEX_VERSION,
+
+    _SC_SHELL,
+
+    _SC_SIGNALS,
+
+    _SC_SPAWN,
+
+    _SC_SPORADIC_SERVER,
+
+    _SC_THREAD_SPORADIC_SERVER,
+
+    _SC_SYSTEM_DATABASE,
+
+    _SC_SYSTEM_DATABASE_R,
+
+    _SC_TIMEOUTS,
+
+    _SC_TYPED_MEMORY_OBJECTS,
+
+    _SC_USER_GROUPS,
+
+    _SC_USER_GROUPS_R,
+
+    _SC_2_PBS,
+
+    _SC_2_PBS_ACCOUNTING,
+
+    _SC_2_PBS_LOCATE,
+
+    _SC_2_PBS_MESSAGE,
+
+    _SC_2_PBS_TRACK,
+
+    _SC_SYMLOOP_MAX,
+
+    _SC_STREAMS,
+
+    _SC_2_PBS_CHECKPOINT,
+
+
+    _SC_V6_ILP32_OFF32,
+
+    _SC_V6_ILP32_OFFBIG,
+
+    _SC_V6_LP64_OFF64,
+
+    _SC_V6_LPBIG_OFFBIG,
+
+
+    _SC_HOST_NAME_MAX,
+
+    _SC_TRACE,
+
+    _SC_TRACE_EVENT_FILTER,
+
+    _SC_TRACE_INHERIT,
+
+    _SC_TRACE_LOG,
+
+
+    _SC_LEVEL1_ICACHE_SIZE,
+
+    _SC_LEVEL1_ICACHE_ASSOC,
+
+    _SC_LEVEL1_ICACHE_LINESIZE,
+
+    _SC_LEVEL1_DCACHE_SIZE,
+
+    _SC_LEVEL1_DCACHE_ASSOC,
+
+    _SC_LEVEL1_DCACHE_LINESIZE,
+
+    _SC_LEVEL2_CACHE_SIZE,
+
+    _SC_LEVEL2_CACHE_ASSOC,
+
+    _SC_LEVEL2_CACHE_LINESIZE,
+
+    _SC_LEVEL3_CACHE_SIZE,
+
+    _SC_LEVEL3_CACHE_ASSOC,
+
+    _SC_LEVEL3_CACHE_LINESIZE,
+
+    _SC_LEVEL4_CACHE_SIZE,
+
+    _SC_LEVEL4_CACHE_ASSOC,
+
+    _SC_LEVEL4_CACHE_LINESIZE,
+
+
+
+    _SC_IPV6 = _SC_LEVEL1_ICACHE_SIZE + 50,
+
+    _SC_RAW_SOCKETS,
+
+
+    _SC_V7_ILP32_OFF32,
+
+    _SC_V7_ILP32_OFFBIG,
+
+    _SC_V7_LP64_OFF64,
+
+    _SC_V7_LPBIG_OFFBIG,
+
+
+    _SC_SS_REPL_MAX,
+
+
+    _SC_TRACE_EVENT_NAME_MAX,
+
+    _SC_TRACE_NAME_MAX,
+
+    _SC_TRACE_SYS_MAX,
+
+    _SC_TRACE_USER_EVENT_MAX,
+
+
+    _SC_XOPEN_STREAMS,
+
+
+    _SC_THREAD_ROBUST_PRIO_INHERIT,
+
+    _SC_THREAD_ROBUST_PRIO_PROTECT,
+
+
+    _SC_MINSIGSTKSZ,
+
+
+    _SC_SIGSTKSZ
+
+  };
+
+
+enum
+  {
+    _CS_PATH,
+
+
+    _CS_V6_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_GNU_LIBC_VERSION,
+
+    _CS_GNU_LIBPTHREAD_VERSION,
+
+
+    _CS_V5_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_V7_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_LFS_CFLAGS = 1000,
+
+    _CS_LFS_LDFLAGS,
+
+    _CS_LFS_LIBS,
+
+    _CS_LFS_LINTFLAGS,
+
+    _CS_LFS64_CFLAGS,
+
+    _CS_LFS64_LDFLAGS,
+
+    _CS_LFS64_LIBS,
+
+    _CS_LFS64_LINTFLAGS,
+
+
+    _CS_XBS5_ILP32_OFF32_CFLAGS = 1100,
+
+    _CS_XBS5_ILP32_OFF32_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFF32_LIBS,
+
+    _CS_XBS5_ILP32_OFF32_LINTFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_CFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LIBS,
+
+    _CS_XBS5_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_XBS5_LP64_OFF64_CFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LDFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LIBS,
+
+    _CS_XBS5_LP64_OFF64_LINTFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LIBS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V6_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V6_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V7_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V7_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_V6_ENV,
+
+    _CS_V7_ENV
+
+  };
+# 631 "/usr/include/unistd.h" 2 3 4
+
+
+extern long int pathconf (const char *__path, int __name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int fpathconf (int __fd, int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long int sysconf (int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t confstr (int __name, char *__buf, size_t __len) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern __pid_t getpid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getppid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t __getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+extern __pid_t getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int setpgid (__pid_t __pid, __pid_t __pgid) __attribute__ ((__nothrow__ , __leaf__));
+# 682 "/usr/include/unistd.h" 3 4
+extern int setpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern __pid_t setsid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __pid_t getsid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __uid_t getuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __uid_t geteuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getgid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getegid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int getgroups (int __size, __gid_t __list[]) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 1)));
+# 722 "/usr/include/unistd.h" 3 4
+extern int setuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setreuid (__uid_t __ruid, __uid_t __euid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int seteuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int setgid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setregid (__gid_t __rgid, __gid_t __egid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setegid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 778 "/usr/include/unistd.h" 3 4
+extern __pid_t fork (void) __attribute__ ((__nothrow__));
+
+
+
+
+
+
+
+extern __pid_t vfork (void) __attribute__ ((__nothrow__ , __leaf__));
+# 799 "/usr/include/unistd.h" 3 4
+extern char *ttyname (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ttyname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+extern int isatty (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int ttyslot (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int link (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern int linkat (int __fromfd, const char *__from, int __tofd,
+     const char *__to, int __flags)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4))) ;
+
+
+
+
+extern int symlink (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern ssize_t readlink (const char *__restrict __path,
+    char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern int symlinkat (const char *__from, int __tofd,
+        const char *__to) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3))) ;
+
+
+extern ssize_t readlinkat (int __fd, const char *__restrict __path,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)))
+     __attribute__ ((__access__ (__write_only__, 3, 4)));
+
+
+
+extern int unlink (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int unlinkat (int __fd, const char *__name, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern int rmdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __pid_t tcgetpgrp (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int tcsetpgrp (int __fd, __pid_t __pgrp_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern char *getlogin (void);
+
+
+
+
+
+
+
+extern int getlogin_r (char *__name, size_t __name_len) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+extern int setlogin (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+
+
+
+
+
+
+
+
+extern char *optarg;
+# 50 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int optind;
+
+
+
+
+extern int opterr;
+
+
+
+extern int optopt;
+# 91 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int getopt (int ___argc, char *const *___argv, const char *__shortopts)
+       __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 2 3 4
+
+
+# 49 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+
+# 904 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+
+
+extern int gethostname (char *__name, size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+
+
+extern int sethostname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+extern int sethostid (long int __id) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern int getdomainname (char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+extern int setdomainname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+
+extern int vhangup (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int revoke (const char *__file) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+
+extern int profil (unsigned short int *__sample_buffer, size_t __size,
+     size_t __offset, unsigned int __scale)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int acct (const char *__name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *getusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void endusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void setusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int daemon (int __nochdir, int __noclose) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int chroot (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern char *getpass (const char *__prompt) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int fsync (int __fd);
+# 1002 "/usr/include/unistd.h" 3 4
+extern long int gethostid (void);
+
+
+extern void sync (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int getpagesize (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int getdtablesize (void) __attribute__ ((__nothrow__ , __leaf__));
+# 1026 "/usr/include/unistd.h" 3 4
+extern int truncate (const char *__file, __off_t __length)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 1049 "/usr/include/unistd.h" 3 4
+extern int ftruncate (int __fd, __off_t __length) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 1070 "/usr/include/unistd.h" 3 4
+extern int brk (void *__addr) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern void *sbrk (intptr_t __delta) __attribute__ ((__nothrow__ , __leaf__));
+# 1091 "/usr/include/unistd.h" 3 4
+extern long int syscall (long int __sysno, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 1114 "/usr/include/unistd.h" 3 4
+extern int lockf (int __fd, int __cmd, __off_t __len) ;
+# 1150 "/usr/include/unistd.h" 3 4
+extern int fdatasync (int __fildes);
+# 1159 "/usr/include/unistd.h" 3 4
+extern char *crypt (const char *__key, const char *__salt)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1198 "/usr/include/unistd.h" 3 4
+int getentropy (void *__buffer, size_t __length)
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 1218 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h" 1 3 4
+# 1219 "/usr/include/unistd.h" 2 3 4
+
+
+# 14 "src/commands.c" 2
+
+
+# 1 "include/commands.h" 1
+# 10 "include/commands.h"
+# 1 "include/debug.h" 1
+# 14 "include/debug.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 15 "include/debug.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 90 "/usr/include/stdint.h" 3 4
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 16 "include/debug.h" 2
+# 1 "/usr/include/pthread.h" 1 3 4
+# 22 "/usr/include/pthread.h" 3 4
+# 1 "/usr/include/sched.h" 1 3 4
+# 29 "/usr/include/sched.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/sched.h" 2 3 4
+# 43 "/usr/include/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/sched.h" 1 3 4
+# 80 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+struct sched_param
+{
+  int sched_priority;
+};
+# 81 "/usr/include/x86_64-linux-gnu/bits/sched.h" 2 3 4
+
+
+# 102 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+
+# 44 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+typedef unsigned long int __cpu_mask;
+
+
+
+
+
+
+typedef struct
+{
+  __cpu_mask __bits[1024 / (8 * sizeof (__cpu_mask))];
+} cpu_set_t;
+# 115 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+
+
+extern int __sched_cpucount (size_t __setsize, const cpu_set_t *__setp)
+     __attribute__ ((__nothrow__ , __leaf__));
+extern cpu_set_t *__sched_cpualloc (size_t __count) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern void __sched_cpufree (cpu_set_t *__set) __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 45 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+
+
+
+
+extern int sched_setparam (__pid_t __pid, const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getparam (__pid_t __pid, struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_setscheduler (__pid_t __pid, int __policy,
+          const struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getscheduler (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_max (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_min (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int sched_rr_get_interval (__pid_t __pid, struct timespec *__t) __attribute__ ((__nothrow__ , __leaf__));
+# 138 "/usr/include/sched.h" 3 4
+
+# 23 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/time.h" 1 3 4
+# 29 "/usr/include/time.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
+# 34 "/usr/include/time.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h" 1 3 4
+
+
+
+
+
+
+struct tm
+{
+  int tm_sec;
+  int tm_min;
+  int tm_hour;
+  int tm_mday;
+  int tm_mon;
+  int tm_year;
+  int tm_wday;
+  int tm_yday;
+  int tm_isdst;
+
+
+  long int tm_gmtoff;
+  const char *tm_zone;
+
+
+
+
+};
+# 40 "/usr/include/time.h" 2 3 4
+# 48 "/usr/include/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h" 1 3 4
+
+
+
+
+
+
+
+struct itimerspec
+  {
+    struct timespec it_interval;
+    struct timespec it_value;
+  };
+# 49 "/usr/include/time.h" 2 3 4
+struct sigevent;
+# 68 "/usr/include/time.h" 3 4
+
+
+
+
+extern clock_t clock (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern time_t time (time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double difftime (time_t __time1, time_t __time0)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern time_t mktime (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 100 "/usr/include/time.h" 3 4
+extern size_t strftime (char *__restrict __s, size_t __maxsize,
+   const char *__restrict __format,
+   const struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 116 "/usr/include/time.h" 3 4
+extern size_t strftime_l (char *__restrict __s, size_t __maxsize,
+     const char *__restrict __format,
+     const struct tm *__restrict __tp,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+# 132 "/usr/include/time.h" 3 4
+extern struct tm *gmtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 154 "/usr/include/time.h" 3 4
+extern struct tm *gmtime_r (const time_t *__restrict __timer,
+       struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime_r (const time_t *__restrict __timer,
+          struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 179 "/usr/include/time.h" 3 4
+extern char *asctime (const struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 197 "/usr/include/time.h" 3 4
+extern char *asctime_r (const struct tm *__restrict __tp,
+   char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime_r (const time_t *__restrict __timer,
+        char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+# 217 "/usr/include/time.h" 3 4
+extern char *__tzname[2];
+extern int __daylight;
+extern long int __timezone;
+
+
+
+
+extern char *tzname[2];
+
+
+
+extern void tzset (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int daylight;
+extern long int timezone;
+# 246 "/usr/include/time.h" 3 4
+extern time_t timegm (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 263 "/usr/include/time.h" 3 4
+extern time_t timelocal (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int dysize (int __year) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 281 "/usr/include/time.h" 3 4
+extern int nanosleep (const struct timespec *__requested_time,
+        struct timespec *__remaining);
+
+
+extern int clock_getres (clockid_t __clock_id, struct timespec *__res) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int clock_gettime (clockid_t __clock_id, struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int clock_settime (clockid_t __clock_id, const struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 323 "/usr/include/time.h" 3 4
+extern int clock_nanosleep (clockid_t __clock_id, int __flags,
+       const struct timespec *__req,
+       struct timespec *__rem);
+# 338 "/usr/include/time.h" 3 4
+extern int clock_getcpuclockid (pid_t __pid, clockid_t *__clock_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int timer_create (clockid_t __clock_id,
+    struct sigevent *__restrict __evp,
+    timer_t *__restrict __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_delete (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int timer_settime (timer_t __timerid, int __flags,
+     const struct itimerspec *__restrict __value,
+     struct itimerspec *__restrict __ovalue) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_gettime (timer_t __timerid, struct itimerspec *__value)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 376 "/usr/include/time.h" 3 4
+extern int timer_getoverrun (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int timespec_get (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 452 "/usr/include/time.h" 3 4
+
+# 24 "/usr/include/pthread.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 2 3 4
+
+
+
+
+typedef long int __jmp_buf[8];
+# 28 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 29 "/usr/include/pthread.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 3 4
+struct __jmp_buf_tag
+  {
+
+
+
+
+    __jmp_buf __jmpbuf;
+    int __mask_was_saved;
+    __sigset_t __saved_mask;
+  };
+# 32 "/usr/include/pthread.h" 2 3 4
+
+
+
+
+
+enum
+{
+  PTHREAD_CREATE_JOINABLE,
+
+  PTHREAD_CREATE_DETACHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_ADAPTIVE_NP
+
+  ,
+  PTHREAD_MUTEX_NORMAL = PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE = PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK = PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_DEFAULT = PTHREAD_MUTEX_NORMAL
+
+
+
+
+
+};
+
+
+
+
+enum
+{
+  PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_STALLED_NP = PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_ROBUST,
+  PTHREAD_MUTEX_ROBUST_NP = PTHREAD_MUTEX_ROBUST
+};
+
+
+
+
+
+enum
+{
+  PTHREAD_PRIO_NONE,
+  PTHREAD_PRIO_INHERIT,
+  PTHREAD_PRIO_PROTECT
+};
+# 104 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_RWLOCK_PREFER_READER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP,
+  PTHREAD_RWLOCK_DEFAULT_NP = PTHREAD_RWLOCK_PREFER_READER_NP
+};
+# 124 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_INHERIT_SCHED,
+
+  PTHREAD_EXPLICIT_SCHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_SCOPE_SYSTEM,
+
+  PTHREAD_SCOPE_PROCESS
+
+};
+
+
+
+enum
+{
+  PTHREAD_PROCESS_PRIVATE,
+
+  PTHREAD_PROCESS_SHARED
+
+};
+# 159 "/usr/include/pthread.h" 3 4
+struct _pthread_cleanup_buffer
+{
+  void (*__routine) (void *);
+  void *__arg;
+  int __canceltype;
+  struct _pthread_cleanup_buffer *__prev;
+};
+
+
+enum
+{
+  PTHREAD_CANCEL_ENABLE,
+
+  PTHREAD_CANCEL_DISABLE
+
+};
+enum
+{
+  PTHREAD_CANCEL_DEFERRED,
+
+  PTHREAD_CANCEL_ASYNCHRONOUS
+
+};
+# 197 "/usr/include/pthread.h" 3 4
+
+
+
+
+
+extern int pthread_create (pthread_t *__restrict __newthread,
+      const pthread_attr_t *__restrict __attr,
+      void *(*__start_routine) (void *),
+      void *__restrict __arg) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+
+extern void pthread_exit (void *__retval) __attribute__ ((__noreturn__));
+
+
+
+
+
+
+
+extern int pthread_join (pthread_t __th, void **__thread_return);
+# 269 "/usr/include/pthread.h" 3 4
+extern int pthread_detach (pthread_t __th) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern pthread_t pthread_self (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern int pthread_equal (pthread_t __thread1, pthread_t __thread2)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+
+
+extern int pthread_attr_init (pthread_attr_t *__attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_destroy (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getdetachstate (const pthread_attr_t *__attr,
+     int *__detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setdetachstate (pthread_attr_t *__attr,
+     int __detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getguardsize (const pthread_attr_t *__attr,
+          size_t *__guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setguardsize (pthread_attr_t *__attr,
+          size_t __guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getschedparam (const pthread_attr_t *__restrict __attr,
+           struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedparam (pthread_attr_t *__restrict __attr,
+           const struct sched_param *__restrict
+           __param) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_getschedpolicy (const pthread_attr_t *__restrict
+     __attr, int *__restrict __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedpolicy (pthread_attr_t *__attr, int __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getinheritsched (const pthread_attr_t *__restrict
+      __attr, int *__restrict __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setinheritsched (pthread_attr_t *__attr,
+      int __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getscope (const pthread_attr_t *__restrict __attr,
+      int *__restrict __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setscope (pthread_attr_t *__attr, int __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getstackaddr (const pthread_attr_t *__restrict
+          __attr, void **__restrict __stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__deprecated__));
+
+
+
+
+
+extern int pthread_attr_setstackaddr (pthread_attr_t *__attr,
+          void *__stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__));
+
+
+extern int pthread_attr_getstacksize (const pthread_attr_t *__restrict
+          __attr, size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_attr_setstacksize (pthread_attr_t *__attr,
+          size_t __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getstack (const pthread_attr_t *__restrict __attr,
+      void **__restrict __stackaddr,
+      size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+
+extern int pthread_attr_setstack (pthread_attr_t *__attr, void *__stackaddr,
+      size_t __stacksize) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 441 "/usr/include/pthread.h" 3 4
+extern int pthread_setschedparam (pthread_t __target_thread, int __policy,
+      const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getschedparam (pthread_t __target_thread,
+      int *__restrict __policy,
+      struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+extern int pthread_setschedprio (pthread_t __target_thread, int __prio)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 509 "/usr/include/pthread.h" 3 4
+extern int pthread_once (pthread_once_t *__once_control,
+    void (*__init_routine) (void)) __attribute__ ((__nonnull__ (1, 2)));
+# 521 "/usr/include/pthread.h" 3 4
+extern int pthread_setcancelstate (int __state, int *__oldstate);
+
+
+
+extern int pthread_setcanceltype (int __type, int *__oldtype);
+
+
+extern int pthread_cancel (pthread_t __th);
+
+
+
+
+extern void pthread_testcancel (void);
+
+
+
+
+struct __cancel_jmp_buf_tag
+{
+  __jmp_buf __cancel_jmp_buf;
+  int __mask_was_saved;
+};
+
+typedef struct
+{
+  struct __cancel_jmp_buf_tag __cancel_jmp_buf[1];
+  void *__pad[4];
+} __pthread_unwind_buf_t __attribute__ ((__aligned__));
+# 557 "/usr/include/pthread.h" 3 4
+struct __pthread_cleanup_frame
+{
+  void (*__cancel_routine) (void *);
+  void *__cancel_arg;
+  int __do_it;
+  int __cancel_type;
+};
+# 697 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel (__pthread_unwind_buf_t *__buf)
+     ;
+# 709 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel (__pthread_unwind_buf_t *__buf)
+  ;
+# 750 "/usr/include/pthread.h" 3 4
+extern void __pthread_unwind_next (__pthread_unwind_buf_t *__buf)
+     __attribute__ ((__noreturn__))
+
+     __attribute__ ((__weak__))
+
+     ;
+# 766 "/usr/include/pthread.h" 3 4
+extern int __sigsetjmp_cancel (struct __cancel_jmp_buf_tag __env[1], int __savemask) __asm__ ("" "__sigsetjmp") __attribute__ ((__nothrow__))
+
+
+                     __attribute__ ((__returns_twice__));
+# 781 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_init (pthread_mutex_t *__mutex,
+          const pthread_mutexattr_t *__mutexattr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_destroy (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_trylock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_lock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_mutex_timedlock (pthread_mutex_t *__restrict __mutex,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 835 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_unlock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutex_getprioceiling (const pthread_mutex_t *
+      __restrict __mutex,
+      int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutex_setprioceiling (pthread_mutex_t *__restrict __mutex,
+      int __prioceiling,
+      int *__restrict __old_ceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+extern int pthread_mutex_consistent (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 874 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_init (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_destroy (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getpshared (const pthread_mutexattr_t *
+      __restrict __attr,
+      int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setpshared (pthread_mutexattr_t *__attr,
+      int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_gettype (const pthread_mutexattr_t *__restrict
+          __attr, int *__restrict __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_mutexattr_settype (pthread_mutexattr_t *__attr, int __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getprotocol (const pthread_mutexattr_t *
+       __restrict __attr,
+       int *__restrict __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutexattr_setprotocol (pthread_mutexattr_t *__attr,
+       int __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getprioceiling (const pthread_mutexattr_t *
+          __restrict __attr,
+          int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setprioceiling (pthread_mutexattr_t *__attr,
+          int __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getrobust (const pthread_mutexattr_t *__attr,
+     int *__robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 946 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_setrobust (pthread_mutexattr_t *__attr,
+     int __robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 967 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_init (pthread_rwlock_t *__restrict __rwlock,
+    const pthread_rwlockattr_t *__restrict
+    __attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_destroy (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_rdlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_tryrdlock (pthread_rwlock_t *__rwlock)
+  __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedrdlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1023 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_wrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_trywrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedwrlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1071 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_unlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_rwlockattr_init (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_destroy (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getpshared (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setpshared (pthread_rwlockattr_t *__attr,
+       int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getkind_np (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pref)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setkind_np (pthread_rwlockattr_t *__attr,
+       int __pref) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int pthread_cond_init (pthread_cond_t *__restrict __cond,
+         const pthread_condattr_t *__restrict __cond_attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_destroy (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_signal (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_broadcast (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_cond_wait (pthread_cond_t *__restrict __cond,
+         pthread_mutex_t *__restrict __mutex)
+     __attribute__ ((__nonnull__ (1, 2)));
+# 1145 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_timedwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 3)));
+# 1194 "/usr/include/pthread.h" 3 4
+extern int pthread_condattr_init (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_destroy (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_getpshared (const pthread_condattr_t *
+     __restrict __attr,
+     int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setpshared (pthread_condattr_t *__attr,
+     int __pshared) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_condattr_getclock (const pthread_condattr_t *
+          __restrict __attr,
+          __clockid_t *__restrict __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setclock (pthread_condattr_t *__attr,
+          __clockid_t __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1230 "/usr/include/pthread.h" 3 4
+extern int pthread_spin_init (pthread_spinlock_t *__lock, int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_destroy (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_lock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_trylock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_unlock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_barrier_init (pthread_barrier_t *__restrict __barrier,
+     const pthread_barrierattr_t *__restrict
+     __attr, unsigned int __count)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_destroy (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_wait (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_barrierattr_init (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_destroy (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_getpshared (const pthread_barrierattr_t *
+        __restrict __attr,
+        int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_barrierattr_setpshared (pthread_barrierattr_t *__attr,
+        int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1297 "/usr/include/pthread.h" 3 4
+extern int pthread_key_create (pthread_key_t *__key,
+          void (*__destr_function) (void *))
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_key_delete (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void *pthread_getspecific (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setspecific (pthread_key_t __key,
+    const void *__pointer)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__access__ (__none__, 2)));
+
+
+
+
+extern int pthread_getcpuclockid (pthread_t __thread_id,
+      __clockid_t *__clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 1332 "/usr/include/pthread.h" 3 4
+extern int pthread_atfork (void (*__prepare) (void),
+      void (*__parent) (void),
+      void (*__child) (void)) __attribute__ ((__nothrow__ , __leaf__));
+# 1346 "/usr/include/pthread.h" 3 4
+
+# 17 "include/debug.h" 2
+
+
+# 1 "include/dwarf.h" 1
+# 20 "include/debug.h" 2
+# 1 "include/ranges.h" 1
+# 21 "include/ranges.h"
+
+# 21 "include/ranges.h"
+typedef struct
+{
+    uint64_t start;
+    uint64_t end;
+    uint64_t payload;
+
+} range_t;
+# 39 "include/ranges.h"
+typedef enum
+{
+    RANGES_KEEP_FIRST,
+    RANGES_MERGE
+
+} range_overlap_t;
+# 55 "include/ranges.h"
+typedef struct
+{
+    uint64_t num_ranges;
+
+
+    uint64_t *starts;
+
+
+    uint64_t *ends;
+
+
+    uint64_t *payloads;
+
+} range_index_t;
+
+
+
+void sort_ranges(range_t *ranges, uint64_t num_ranges);
+range_index_t *build_range_index(const range_t *ranges, uint64_t num_ranges, range_overlap_t overlap);
+void release_range_index(range_index_t *index);
+int64_t find_range(range_index_t *index, uint64_t address);
+# 21 "include/debug.h" 2
+# 29 "include/debug.h"
+typedef enum
+{
+    DBG_CMD_DUMP_ABBREV,
+    DBG_CMD_DUMP_ADDR,
+    DBG_CMD_DUMP_FRAMES,
+    DBG_CMD_DUMP_NAMES,
+    DBG_CMD_DUMP_INFO,
+    DBG_CMD_DUMP_ARANGES
+
+} debug_command_subtype;
+# 48 "include/debug.h"
+typedef struct
+{
+    uint32_t name;
+    uint32_t form;
+    int64_t implicit_const;
+
+} abbrev_attribute_t;
+
+
+
+
+
+
+
+typedef struct
+{
+    uint64_t code;
+    uint32_t tag;
+    
+# 66 "include/debug.h" 3 4
+   _Bool 
+# 66 "include/debug.h"
+        has_children;
+
+    uint32_t num_attributes;
+    abbrev_attribute_t *attributes;
+
+} abbrev_t;
+# 85 "include/debug.h"
+typedef struct
+{
+
+    uint64_t offset;
+    uint64_t end_offset;
+
+
+    uint64_t num_abbrevs;
+    abbrev_t *abbrevs;
+
+
+    abbrev_attribute_t *attributes;
+
+
+    uint64_t num_codes;
+    abbrev_t **by_code;
+
+
+    abbrev_t **slots;
+    uint64_t slot_mask;
+
+} abbrev_table_t;
+# 117 "include/debug.h"
+typedef struct
+{
+    pthread_mutex_t lock;
+
+
+    const unsigned char *section;
+    uint64_t section_size;
+
+
+    uint64_t num_tables;
+    abbrev_table_t **slots;
+    uint64_t slot_mask;
+
+} abbrev_cache_t;
+# 139 "include/debug.h"
+typedef struct
+{
+
+    uint64_t offset;
+    uint64_t die_offset;
+    uint64_t end_offset;
+
+    uint64_t length;
+    uint16_t version;
+    uint8_t unit_type;
+    uint8_t address_size;
+
+
+    uint8_t offset_size;
+
+    uint64_t abbrev_offset;
+
+
+    uint64_t type_signature;
+    uint64_t type_offset;
+    uint64_t dwo_id;
+
+} unit_header_t;
+# 184 "include/debug.h"
+typedef struct
+{
+    const unsigned char *section;
+    const unsigned char *position;
+    const unsigned char *end;
+
+    unit_header_t *unit;
+    abbrev_table_t *abbrevs;
+
+
+    int depth;
+
+
+    int8_t form_sizes[(0x2c + 1)];
+
+} die_reader_t;
+
+
+
+
+
+
+
+typedef struct
+{
+    uint64_t offset;
+    int depth;
+    abbrev_t *abbrev;
+
+} die_t;
+# 225 "include/debug.h"
+typedef struct
+{
+    uint32_t name;
+    uint32_t form;
+
+    uint64_t value;
+    const unsigned char *data;
+
+} attribute_value_t;
+# 245 "include/debug.h"
+typedef struct
+{
+    const unsigned char *str;
+    uint64_t str_size;
+
+    const unsigned char *line_str;
+    uint64_t line_str_size;
+
+    const unsigned char *str_offsets;
+    uint64_t str_offsets_size;
+
+    const unsigned char *addr;
+    uint64_t addr_size;
+
+
+    uint64_t str_offsets_base;
+    uint64_t addr_base;
+    uint8_t offset_size;
+    uint8_t address_size;
+
+} debug_strings_t;
+
+
+
+
+
+
+
+typedef struct
+{
+
+    uint64_t offset;
+    uint64_t ranges_offset;
+    uint64_t end_offset;
+
+    uint64_t length;
+    uint16_t version;
+    uint8_t offset_size;
+
+    uint64_t info_offset;
+    uint8_t address_size;
+    uint8_t segment_size;
+
+} aranges_header_t;
+
+
+
+typedef enum
+{
+    DIE_OK,
+    DIE_END_OF_UNIT,
+    DIE_CORRUPT
+
+} die_status_t;
+
+
+
+
+# 302 "include/debug.h" 3 4
+_Bool 
+# 302 "include/debug.h"
+    read_uleb128(const unsigned char **position, const unsigned char *end, uint64_t *value);
+
+# 303 "include/debug.h" 3 4
+_Bool 
+# 303 "include/debug.h"
+    read_sleb128(const unsigned char **position, const unsigned char *end, int64_t *value);
+
+# 304 "include/debug.h" 3 4
+_Bool 
+# 304 "include/debug.h"
+    read_unsigned(const unsigned char **position, const unsigned char *end, int size, uint64_t *value);
+
+abbrev_table_t *parse_abbrev_table(const unsigned char *section, uint64_t section_size, uint64_t offset);
+void release_abbrev_table(abbrev_table_t *table);
+abbrev_t *find_abbrev(abbrev_table_t *table, uint64_t code);
+
+abbrev_cache_t *create_abbrev_cache(const unsigned char *section, uint64_t section_size);
+void release_abbrev_cache(abbrev_cache_t *cache);
+abbrev_table_t *get_abbrev_table(abbrev_cache_t *cache, uint64_t offset);
+
+
+# 314 "include/debug.h" 3 4
+_Bool 
+# 314 "include/debug.h"
+    read_aranges_header(const unsigned char *section, uint64_t section_size, uint64_t offset, aranges_header_t *header);
+
+# 315 "include/debug.h" 3 4
+_Bool 
+# 315 "include/debug.h"
+    read_arange(const unsigned char **position, const unsigned char *end, aranges_header_t *header, uint64_t *address, uint64_t *length);
+range_index_t *build_unit_address_index(const unsigned char *section, uint64_t section_size);
+
+
+# 318 "include/debug.h" 3 4
+_Bool 
+# 318 "include/debug.h"
+    read_unit_header(const unsigned char *section, uint64_t section_size, uint64_t offset, unit_header_t *unit);
+uint64_t read_unit_headers(const unsigned char *section, uint64_t section_size, unit_header_t **units);
+void init_die_reader(die_reader_t *reader, const unsigned char *section, unit_header_t *unit, abbrev_table_t *abbrevs);
+die_status_t read_die(die_reader_t *reader, die_t *die);
+
+# 322 "include/debug.h" 3 4
+_Bool 
+# 322 "include/debug.h"
+    read_attribute(die_reader_t *reader, abbrev_attribute_t *attribute, attribute_value_t *value);
+
+# 323 "include/debug.h" 3 4
+_Bool 
+# 323 "include/debug.h"
+    skip_attributes(die_reader_t *reader, abbrev_attribute_t *attributes, uint32_t num_attributes);
+const char *get_attribute_string(attribute_value_t *value, debug_strings_t *strings, uint64_t *length);
+void read_unit_bases(const unsigned char *section, unit_header_t *unit, abbrev_table_t *abbrevs, debug_strings_t *strings);
+
+# 326 "include/debug.h" 3 4
+_Bool 
+# 326 "include/debug.h"
+    get_indexed_string_offset(debug_strings_t *strings, uint64_t index, uint64_t *offset);
+
+# 327 "include/debug.h" 3 4
+_Bool 
+# 327 "include/debug.h"
+    get_indexed_address(debug_strings_t *strings, uint64_t index, uint64_t *address);
+# 11 "include/commands.h" 2
+# 1 "include/session.h" 1
+# 16 "include/session.h"
+# 1 "include/elf.h" 1
+# 20 "include/elf.h"
+typedef uint8_t BYTE;
+# 40 "include/elf.h"
+typedef uint32_t ELF32_Addr_t;
+
+
+
+typedef uint16_t ELF32_Half_t;
+
+
+
+typedef uint32_t ELF32_Off_t;
+
+
+typedef int32_t ELF32_Sword_t;
+
+typedef uint32_t ELF32_Word_t;
+
+
+
+
+
+
+
+typedef struct
+{
+
+
+
+
+
+    unsigned char e_ident[16];
+
+
+
+
+
+
+    ELF32_Half_t e_type;
+
+
+
+
+
+    ELF32_Half_t e_machine;
+
+
+
+
+
+    ELF32_Word_t e_version;
+# 96 "include/elf.h"
+    ELF32_Addr_t e_entry;
+
+
+
+
+
+
+
+    ELF32_Off_t e_phoff;
+
+
+
+
+
+
+
+    ELF32_Off_t e_shoff;
+
+
+
+
+
+    ELF32_Word_t e_flags;
+
+
+
+
+
+    ELF32_Half_t e_ehsize;
+
+
+
+
+
+
+
+    ELF32_Half_t e_phentsize;
+# 142 "include/elf.h"
+    ELF32_Half_t e_phnum;
+
+
+
+
+
+
+
+    ELF32_Half_t e_shentsize;
+# 160 "include/elf.h"
+    ELF32_Half_t e_shnum;
+
+
+
+
+
+
+
+    ELF32_Half_t e_shstrndx;
+
+
+
+} ELF32_Header_t;
+# 193 "include/elf.h"
+typedef uint64_t ELF64_Addr_t;
+
+
+
+typedef uint16_t ELF64_Half_t;
+
+
+
+typedef uint64_t ELF64_Off_t;
+
+
+typedef int32_t ELF64_Sword_t;
+
+typedef uint32_t ELF64_Word_t;
+
+
+
+typedef uint64_t ELF64_Xword_t;
+
+typedef int64_t ELF64_Sxword_t;
+
+
+
+
+
+
+typedef struct
+{
+
+
+
+
+
+    unsigned char e_ident[16];
+
+
+
+
+
+
+    ELF64_Half_t e_type;
+
+
+
+
+
+    ELF64_Half_t e_machine;
+
+
+
+
+
+    ELF64_Word_t e_version;
+# 254 "include/elf.h"
+    ELF64_Addr_t e_entry;
+
+
+
+
+
+
+
+    ELF64_Off_t e_phoff;
+
+
+
+
+
+
+
+    ELF64_Off_t e_shoff;
+
+
+
+
+
+    ELF64_Word_t e_flags;
+
+
+
+
+
+    ELF64_Half_t e_ehsize;
+
+
+
+
+
+
+
+    ELF64_Half_t e_phentsize;
+# 300 "include/elf.h"
+    ELF64_Half_t e_phnum;
+
+
+
+
+
+
+
+    ELF64_Half_t e_shentsize;
+# 318 "include/elf.h"
+    ELF64_Half_t e_shnum;
+
+
+
+
+
+
+
+    ELF64_Half_t e_shstrndx;
+
+
+
+} ELF64_Header_t;
+# 497 "include/elf.h"
+typedef struct
+{
+# 508 "include/elf.h"
+    ELF32_Word_t sh_name;
+
+
+
+
+
+
+    ELF32_Word_t sh_type;
+# 524 "include/elf.h"
+    ELF32_Word_t sh_flags;
+# 535 "include/elf.h"
+    ELF32_Addr_t sh_addr;
+# 546 "include/elf.h"
+    ELF32_Off_t sh_offset;
+# 556 "include/elf.h"
+    ELF32_Word_t sh_size;
+
+
+
+
+
+
+
+    ELF32_Word_t sh_link;
+
+
+
+
+
+
+    ELF32_Word_t sh_info;
+# 583 "include/elf.h"
+    ELF32_Word_t sh_addralign;
+# 593 "include/elf.h"
+    ELF32_Word_t sh_entsize;
+
+
+
+} ELF32_Section_Header_t;
+# 607 "include/elf.h"
+typedef struct
+{
+# 618 "include/elf.h"
+    ELF64_Word_t sh_name;
+
+
+
+
+
+
+    ELF64_Word_t sh_type;
+# 634 "include/elf.h"
+    ELF64_Xword_t sh_flags;
+# 645 "include/elf.h"
+    ELF64_Addr_t sh_addr;
+# 656 "include/elf.h"
+    ELF64_Off_t sh_offset;
+# 666 "include/elf.h"
+    ELF64_Xword_t sh_size;
+
+
+
+
+
+
+
+    ELF64_Word_t sh_link;
+
+
+
+
+
+
+    ELF64_Word_t sh_info;
+# 693 "include/elf.h"
+    ELF64_Xword_t sh_addralign;
+# 703 "include/elf.h"
+    ELF64_Xword_t sh_entsize;
+
+
+
+} ELF64_Section_Header_t;
+# 849 "include/elf.h"
+typedef struct
+{
+# 859 "include/elf.h"
+    ELF32_Word_t st_name;
+# 877 "include/elf.h"
+    ELF32_Addr_t st_value;
+
+
+
+
+
+
+
+    ELF32_Word_t st_size;
+# 894 "include/elf.h"
+    unsigned char st_info;
+
+
+
+
+
+
+    unsigned char st_other;
+# 911 "include/elf.h"
+    ELF32_Half_t st_shndx;
+
+
+} ELF32_Sym_t;
+
+
+
+typedef struct
+{
+# 934 "include/elf.h"
+    ELF64_Word_t st_name;
+# 943 "include/elf.h"
+    unsigned char st_info;
+
+
+
+
+
+
+    unsigned char st_other;
+# 960 "include/elf.h"
+    ELF64_Half_t st_shndx;
+# 978 "include/elf.h"
+    ELF64_Addr_t st_value;
+
+
+
+
+
+
+
+    ELF64_Xword_t st_size;
+
+
+} ELF64_Sym_t;
+# 1196 "include/elf.h"
+typedef struct
+{
+# 1208 "include/elf.h"
+    ELF32_Addr_t r_offset;
+# 1217 "include/elf.h"
+    ELF32_Word_t r_info;
+
+
+} ELF32_Rel_t;
+
+
+
+
+
+
+typedef struct
+{
+
+
+
+
+    ELF32_Addr_t r_offset;
+
+
+
+
+
+    ELF32_Word_t r_info;
+
+
+
+
+
+
+    ELF32_Sword_t r_addend;
+
+
+} ELF32_Rela_t;
+# 1276 "include/elf.h"
+typedef struct
+{
+# 1288 "include/elf.h"
+    ELF64_Addr_t r_offset;
+# 1297 "include/elf.h"
+    ELF64_Xword_t r_info;
+
+
+} ELF64_Rel_t;
+
+
+
+
+
+
+typedef struct
+{
+
+
+
+
+    ELF64_Addr_t r_offset;
+
+
+
+
+
+    ELF64_Xword_t r_info;
+
+
+
+
+
+
+    ELF64_Sxword_t r_addend;
+
+
+} ELF64_Rela_t;
+# 1363 "include/elf.h"
+typedef struct
+{
+
+
+
+
+
+
+    ELF32_Word_t p_type;
+
+
+
+
+
+
+    ELF32_Off_t p_offset;
+
+
+
+
+
+
+    ELF32_Addr_t p_vaddr;
+
+
+
+
+
+
+
+    ELF32_Addr_t p_paddr;
+
+
+
+
+
+
+    ELF32_Word_t p_filesz;
+
+
+
+
+
+
+
+    ELF32_Word_t p_memsz;
+
+
+
+
+
+    ELF32_Word_t p_flags;
+
+
+
+
+
+    ELF32_Word_t p_align;
+
+
+} ELF32_Program_Header_t;
+
+
+
+
+typedef struct
+{
+
+
+
+
+
+
+    ELF64_Word_t p_type;
+
+
+
+
+
+    ELF64_Word_t p_flags;
+
+
+
+
+
+
+    ELF64_Off_t p_offset;
+
+
+
+
+
+
+    ELF64_Addr_t p_vaddr;
+
+
+
+
+
+
+
+    ELF64_Addr_t p_paddr;
+
+
+
+
+
+
+    ELF64_Xword_t p_filesz;
+
+
+
+
+
+
+
+    ELF64_Xword_t p_memsz;
+
+
+
+
+
+    ELF64_Xword_t p_align;
+
+
+} ELF64_Program_Header_t;
+# 1568 "include/elf.h"
+typedef struct
+{
+
+    ELF32_Sword_t d_tag;
+
+
+
+
+
+    union
+    {
+        ELF32_Word_t d_val;
+        ELF32_Addr_t d_ptr;
+    } d_un;
+
+} ELF32_Dyn_t;
+
+
+
+typedef struct
+{
+
+    ELF64_Sxword_t d_tag;
+
+
+
+
+
+    union
+    {
+        ELF64_Xword_t d_val;
+        ELF64_Addr_t d_ptr;
+    } d_un;
+
+} ELF64_Dyn_t;
+# 17 "include/session.h" 2
+# 1 "include/readelf.h" 1
+# 13 "include/readelf.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 14 "include/readelf.h" 2
+# 32 "include/readelf.h"
+
+# 32 "include/readelf.h"
+typedef struct
+{
+
+    int file_descriptor;
+
+
+    size_t size;
+
+
+    unsigned char *data;
+
+} elf_image_t;
+# 53 "include/readelf.h"
+typedef struct
+{
+    char *string;
+    size_t length;
+
+} string_view_t;
+# 68 "include/readelf.h"
+typedef struct
+{
+
+    int num_names;
+
+
+    size_t max_length;
+
+
+    string_view_t *names;
+
+} section_name_table_t;
+# 94 "include/readelf.h"
+typedef struct
+{
+    int num_segments;
+    int *segment_start;
+    int *section_indices;
+
+} section_to_segment_mapping_t;
+# 111 "include/readelf.h"
+typedef struct
+{
+
+    void *symbols;
+    uint64_t num_symbols;
+
+    char *string_table;
+    uint64_t string_table_size;
+
+} symbol_table_t;
+# 129 "include/readelf.h"
+typedef struct
+{
+
+    void *entries;
+    uint64_t num_entries;
+
+
+    
+# 136 "include/readelf.h" 3 4
+   _Bool 
+# 136 "include/readelf.h"
+        has_addends;
+
+
+    
+# 139 "include/readelf.h" 3 4
+   _Bool 
+# 139 "include/readelf.h"
+        has_symbols;
+    symbol_table_t symbols;
+
+} relocation_table_t;
+
+
+
+int open_elf_image(elf_image_t *image, const char *filename);
+void close_elf_image(elf_image_t *image);
+void *get_image_range(elf_image_t *image, uint64_t offset, uint64_t size);
+void *get_aligned_image_range(elf_image_t *image, uint64_t offset, uint64_t size, uint64_t alignment);
+
+# 150 "include/readelf.h" 3 4
+_Bool 
+# 150 "include/readelf.h"
+    is_aligned(const void *pointer, uint64_t alignment);
+
+
+
+string_view_t get_string_table_entry(char *string_table, uint64_t string_table_size, uint64_t offset);
+void release_section_name_table(section_name_table_t *section_names);
+void release_section_to_segment_mapping(section_to_segment_mapping_t *mapping);
+
+
+
+int read_ELF_identification(elf_image_t *image, unsigned char *buffer);
+
+# 161 "include/readelf.h" 3 4
+_Bool 
+# 161 "include/readelf.h"
+    has_ELF_magic(elf_image_t *image);
+int get_file_class(elf_image_t *image);
+
+
+
+ELF32_Header_t *get_ELF32_header(elf_image_t *image);
+
+ELF32_Section_Header_t *get_ELF32_section_header(elf_image_t *image, int index);
+ELF32_Section_Header_t *get_ELF32_section_header_table(elf_image_t *image);
+int get_ELF32_num_sections(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+uint32_t get_ELF32_section_string_table_index(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+
+ELF32_Program_Header_t *get_ELF32_program_header(elf_image_t *image, int index);
+ELF32_Program_Header_t *get_ELF32_program_header_table(elf_image_t *image);
+
+section_name_table_t *get_ELF32_section_names(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+section_to_segment_mapping_t *get_ELF32_section_to_segment_mapping(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                                                                   ELF32_Program_Header_t *program_header_table);
+
+int get_ELF32_symbol_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                           int section_index, symbol_table_t *symbol_table);
+int get_ELF32_relocation_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                               int section_index, relocation_table_t *relocation_table);
+
+void *get_ELF32_address_range(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Program_Header_t *program_header_table,
+                              uint64_t address, uint64_t size);
+ELF32_Dyn_t *get_ELF32_dynamic_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Program_Header_t *program_header_table,
+                                     uint64_t *num_entries);
+
+# 189 "include/readelf.h" 3 4
+_Bool 
+# 189 "include/readelf.h"
+    *get_ELF32_relocated_sections(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+
+
+
+ELF64_Header_t *get_ELF64_header(elf_image_t *image);
+
+ELF64_Section_Header_t *get_ELF64_section_header(elf_image_t *image, int index);
+ELF64_Section_Header_t *get_ELF64_section_header_table(elf_image_t *image);
+int get_ELF64_num_sections(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+uint32_t get_ELF64_section_string_table_index(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+
+ELF64_Program_Header_t *get_ELF64_program_header(elf_image_t *image, int index);
+ELF64_Program_Header_t *get_ELF64_program_header_table(elf_image_t *image);
+
+section_name_table_t *get_ELF64_section_names(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+section_to_segment_mapping_t *get_ELF64_section_to_segment_mapping(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                                                                   ELF64_Program_Header_t *program_header_table);
+
+int get_ELF64_symbol_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                           int section_index, symbol_table_t *symbol_table);
+int get_ELF64_relocation_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                               int section_index, relocation_table_t *relocation_table);
+
+void *get_ELF64_address_range(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Program_Header_t *program_header_table,
+                              uint64_t address, uint64_t size);
+ELF64_Dyn_t *get_ELF64_dynamic_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Program_Header_t *program_header_table,
+                                     uint64_t *num_entries);
+
+# 216 "include/readelf.h" 3 4
+_Bool 
+# 216 "include/readelf.h"
+    *get_ELF64_relocated_sections(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+# 18 "include/session.h" 2
+# 1 "include/lookup.h" 1
+# 12 "include/lookup.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 13 "include/lookup.h" 2
+# 25 "include/lookup.h"
+typedef enum
+{
+
+    LOOKUP_GNU_HASH,
+
+
+    LOOKUP_SYSV_HASH,
+
+
+    LOOKUP_BUILT_HASH
+
+} lookup_method_t;
+# 49 "include/lookup.h"
+typedef struct
+{
+    lookup_method_t method;
+
+
+    int file_class;
+
+
+    symbol_table_t symbols;
+    string_view_t table_name;
+
+
+    uint16_t *versions;
+
+
+
+
+
+
+    uint32_t num_gnu_buckets;
+    uint32_t symbol_offset;
+    uint32_t bloom_size;
+    uint32_t bloom_shift;
+    void *bloom;
+    uint32_t *gnu_buckets;
+    uint32_t *gnu_chain;
+
+
+
+    uint32_t num_sysv_buckets;
+    uint32_t *sysv_buckets;
+    uint32_t *sysv_chain;
+# 89 "include/lookup.h"
+    uint32_t *slot_symbols;
+    uint32_t *slot_hashes;
+    uint64_t slot_mask;
+
+} symbol_index_t;
+# 103 "include/lookup.h"
+typedef struct
+{
+    range_index_t *ranges;
+
+
+    string_view_t *names;
+
+} address_index_t;
+# 122 "include/lookup.h"
+typedef struct
+{
+    section_name_table_t *section_names;
+
+
+    int *sections;
+
+
+
+
+
+
+    uint32_t *slot_starts;
+    uint32_t *slot_counts;
+    uint32_t *slot_hashes;
+    uint64_t slot_mask;
+
+} section_name_index_t;
+
+
+
+symbol_index_t *build_ELF32_symbol_index(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                                         ELF32_Program_Header_t *program_header_table, section_name_table_t *section_names);
+symbol_index_t *build_ELF64_symbol_index(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                                         ELF64_Program_Header_t *program_header_table, section_name_table_t *section_names);
+void release_symbol_index(symbol_index_t *index);
+
+address_index_t *build_ELF32_address_index(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+address_index_t *build_ELF64_address_index(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+void release_address_index(address_index_t *index);
+
+section_name_index_t *build_section_name_index(section_name_table_t *section_names);
+void release_section_name_index(section_name_index_t *index);
+
+
+int64_t find_symbol(symbol_index_t *index, const char *name, size_t length);
+int find_sections(section_name_index_t *index, const char *name, size_t length, const int **sections);
+# 19 "include/session.h" 2
+
+# 1 "include/frame.h" 1
+# 29 "include/frame.h"
+typedef struct
+{
+    const unsigned char *data;
+    uint64_t size;
+    uint64_t address;
+
+    
+# 35 "include/frame.h" 3 4
+   _Bool 
+# 35 "include/frame.h"
+        is_eh_frame;
+
+
+    int address_size;
+
+} frame_section_t;
+# 49 "include/frame.h"
+typedef struct
+{
+    uint64_t offset;
+    uint64_t length;
+    uint64_t end_offset;
+
+
+    uint64_t id;
+
+    uint8_t version;
+    const char *augmentation;
+
+    uint64_t code_alignment;
+    int64_t data_alignment;
+    uint64_t return_address_register;
+
+
+    
+# 66 "include/frame.h" 3 4
+   _Bool 
+# 66 "include/frame.h"
+        has_augmentation_data;
+    const unsigned char *augmentation_data;
+    uint64_t augmentation_data_length;
+
+
+    uint8_t fde_encoding;
+    uint8_t lsda_encoding;
+    uint8_t personality_encoding;
+    uint64_t personality;
+    
+# 75 "include/frame.h" 3 4
+   _Bool 
+# 75 "include/frame.h"
+        is_signal_frame;
+
+
+    uint8_t address_size;
+    uint8_t segment_size;
+
+    const unsigned char *instructions;
+    uint64_t instructions_length;
+
+} cie_t;
+
+
+
+
+
+
+
+typedef struct
+{
+    uint64_t offset;
+    uint64_t length;
+    uint64_t end_offset;
+
+
+    uint64_t cie_pointer;
+    uint64_t cie_offset;
+
+    uint64_t pc_begin;
+    uint64_t pc_range;
+
+    const unsigned char *augmentation_data;
+    uint64_t augmentation_data_length;
+
+    const unsigned char *instructions;
+    uint64_t instructions_length;
+
+} fde_t;
+
+
+
+typedef enum
+{
+    FRAME_ENTRY_CIE,
+    FRAME_ENTRY_FDE,
+
+
+    FRAME_ENTRY_TERMINATOR,
+
+    FRAME_ENTRY_CORRUPT
+
+} frame_entry_type_t;
+# 135 "include/frame.h"
+typedef struct
+{
+
+    uint8_t opcode;
+
+    uint64_t register_number;
+    uint64_t second_register;
+    int64_t offset;
+    uint64_t address;
+
+    const unsigned char *expression;
+    uint64_t expression_length;
+
+} cfa_instruction_t;
+# 160 "include/frame.h"
+typedef struct
+{
+
+    frame_section_t section;
+
+    uint64_t eh_frame_address;
+
+    uint8_t table_encoding;
+    int field_size;
+
+    uint64_t num_entries;
+    const unsigned char *table;
+
+} eh_frame_hdr_t;
+
+
+
+
+# 177 "include/frame.h" 3 4
+_Bool 
+# 177 "include/frame.h"
+    read_encoded_pointer(frame_section_t *section, const unsigned char **position, const unsigned char *end,
+                          uint8_t encoding, uint64_t *value);
+
+frame_entry_type_t read_frame_entry_type(frame_section_t *section, uint64_t offset, uint64_t *end_offset);
+
+# 181 "include/frame.h" 3 4
+_Bool 
+# 181 "include/frame.h"
+    read_cie(frame_section_t *section, uint64_t offset, cie_t *cie);
+
+# 182 "include/frame.h" 3 4
+_Bool 
+# 182 "include/frame.h"
+    read_fde(frame_section_t *section, uint64_t offset, cie_t *cie, fde_t *fde);
+
+
+# 184 "include/frame.h" 3 4
+_Bool 
+# 184 "include/frame.h"
+    read_cfa_instruction(frame_section_t *section, cie_t *cie, const unsigned char **position, const unsigned char *end,
+                          uint64_t *location, cfa_instruction_t *instruction);
+
+range_index_t *build_fde_index(frame_section_t *section);
+
+
+# 189 "include/frame.h" 3 4
+_Bool 
+# 189 "include/frame.h"
+    read_eh_frame_hdr(frame_section_t *section, eh_frame_hdr_t *header);
+int64_t find_eh_frame_hdr_entry(eh_frame_hdr_t *header, uint64_t address, uint64_t *fde_address);
+# 21 "include/session.h" 2
+# 1 "include/names.h" 1
+# 13 "include/names.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 14 "include/names.h" 2
+# 28 "include/names.h"
+typedef struct
+{
+    uint64_t code;
+    uint32_t tag;
+
+    uint32_t num_attributes;
+    abbrev_attribute_t *attributes;
+
+} names_abbrev_t;
+# 49 "include/names.h"
+typedef struct
+{
+
+    uint64_t offset;
+    uint64_t end_offset;
+
+    uint64_t length;
+    uint16_t version;
+    uint8_t offset_size;
+
+    uint32_t comp_unit_count;
+    uint32_t local_type_unit_count;
+    uint32_t foreign_type_unit_count;
+    uint32_t bucket_count;
+    uint32_t name_count;
+    uint32_t abbrev_table_size;
+
+    const char *augmentation;
+    uint32_t augmentation_size;
+
+
+    const unsigned char *comp_units;
+    const unsigned char *local_type_units;
+    const unsigned char *foreign_type_units;
+
+
+    const unsigned char *buckets;
+    const unsigned char *hashes;
+    const unsigned char *string_offsets;
+    const unsigned char *entry_offsets;
+
+
+    const unsigned char *entry_pool;
+    const unsigned char *end;
+
+    uint64_t num_abbrevs;
+    names_abbrev_t *abbrevs;
+    abbrev_attribute_t *attributes;
+
+} names_table_t;
+
+
+
+
+
+
+
+typedef struct
+{
+    uint64_t num_tables;
+    names_table_t *tables;
+
+} names_index_t;
+# 110 "include/names.h"
+typedef struct
+{
+
+    uint64_t offset;
+
+    uint64_t code;
+    names_abbrev_t *abbrev;
+
+    
+# 118 "include/names.h" 3 4
+   _Bool 
+# 118 "include/names.h"
+        has_compile_unit;
+    
+# 119 "include/names.h" 3 4
+   _Bool 
+# 119 "include/names.h"
+        has_type_unit;
+    
+# 120 "include/names.h" 3 4
+   _Bool 
+# 120 "include/names.h"
+        has_die_offset;
+    
+# 121 "include/names.h" 3 4
+   _Bool 
+# 121 "include/names.h"
+        has_parent;
+
+    uint64_t compile_unit;
+    uint64_t type_unit;
+    uint64_t die_offset;
+
+
+    uint64_t parent;
+
+} names_entry_t;
+
+
+
+
+# 134 "include/names.h" 3 4
+_Bool 
+# 134 "include/names.h"
+    read_names_table(const unsigned char *section, uint64_t section_size, uint64_t offset, names_table_t *table);
+void release_names_table(names_table_t *table);
+
+names_index_t *build_names_index(const unsigned char *section, uint64_t section_size);
+void release_names_index(names_index_t *index);
+
+uint32_t hash_debug_name(const char *name, size_t length);
+uint64_t get_names_table_value(names_table_t *table, const unsigned char *array, uint64_t number, int size);
+int64_t find_debug_name(names_table_t *table, const unsigned char *str, uint64_t str_size, const char *name, size_t length);
+
+# 143 "include/names.h" 3 4
+_Bool 
+# 143 "include/names.h"
+    read_names_entry(names_table_t *table, const unsigned char **position, names_entry_t *entry);
+
+# 144 "include/names.h" 3 4
+_Bool 
+# 144 "include/names.h"
+    get_names_entry_die(names_table_t *table, names_entry_t *entry, uint64_t *die_offset);
+# 22 "include/session.h" 2
+# 45 "include/session.h"
+typedef struct
+{
+
+    elf_image_t image;
+
+
+    int file_class;
+
+
+
+
+
+
+    void *file_header;
+    void *section_header_table;
+    void *program_header_table;
+    section_name_table_t *section_names;
+    section_to_segment_mapping_t *section_to_segment_mapping;
+    symbol_index_t *symbol_index;
+    address_index_t *address_index;
+    section_name_index_t *section_name_index;
+    
+# 66 "include/session.h" 3 4
+   _Bool 
+# 66 "include/session.h"
+        *relocated_sections;
+    abbrev_cache_t *abbrev_cache;
+    range_index_t *unit_address_index;
+    range_index_t *eh_frame_index;
+    range_index_t *debug_frame_index;
+    names_index_t *names_index;
+# 80 "include/session.h"
+    
+# 80 "include/session.h" 3 4
+   _Bool 
+# 80 "include/session.h"
+        file_header_parsed;
+    
+# 81 "include/session.h" 3 4
+   _Bool 
+# 81 "include/session.h"
+        section_header_table_parsed;
+    
+# 82 "include/session.h" 3 4
+   _Bool 
+# 82 "include/session.h"
+        program_header_table_parsed;
+    
+# 83 "include/session.h" 3 4
+   _Bool 
+# 83 "include/session.h"
+        section_names_parsed;
+    
+# 84 "include/session.h" 3 4
+   _Bool 
+# 84 "include/session.h"
+        section_to_segment_mapping_parsed;
+    
+# 85 "include/session.h" 3 4
+   _Bool 
+# 85 "include/session.h"
+        symbol_index_parsed;
+    
+# 86 "include/session.h" 3 4
+   _Bool 
+# 86 "include/session.h"
+        address_index_parsed;
+    
+# 87 "include/session.h" 3 4
+   _Bool 
+# 87 "include/session.h"
+        section_name_index_parsed;
+    
+# 88 "include/session.h" 3 4
+   _Bool 
+# 88 "include/session.h"
+        relocated_sections_parsed;
+    
+# 89 "include/session.h" 3 4
+   _Bool 
+# 89 "include/session.h"
+        abbrev_cache_parsed;
+    
+# 90 "include/session.h" 3 4
+   _Bool 
+# 90 "include/session.h"
+        unit_address_index_parsed;
+    
+# 91 "include/session.h" 3 4
+   _Bool 
+# 91 "include/session.h"
+        eh_frame_index_parsed;
+    
+# 92 "include/session.h" 3 4
+   _Bool 
+# 92 "include/session.h"
+        debug_frame_index_parsed;
+    
+# 93 "include/session.h" 3 4
+   _Bool 
+# 93 "include/session.h"
+        names_index_parsed;
+
+
+
+    pthread_mutex_t lock;
+
+} elf_session_t;
+
+
+
+int open_session(elf_session_t *session, const char *filename);
+void close_session(elf_session_t *session);
+
+
+
+ELF32_Header_t *get_session_ELF32_header(elf_session_t *session);
+ELF32_Section_Header_t *get_session_ELF32_section_header_table(elf_session_t *session);
+ELF32_Program_Header_t *get_session_ELF32_program_header_table(elf_session_t *session);
+
+
+ELF64_Header_t *get_session_ELF64_header(elf_session_t *session);
+ELF64_Section_Header_t *get_session_ELF64_section_header_table(elf_session_t *session);
+ELF64_Program_Header_t *get_session_ELF64_program_header_table(elf_session_t *session);
+
+int get_session_num_sections(elf_session_t *session);
+uint32_t get_session_section_string_table_index(elf_session_t *session);
+
+
+section_name_table_t *get_session_section_names(elf_session_t *session);
+section_to_segment_mapping_t *get_session_section_to_segment_mapping(elf_session_t *session);
+symbol_index_t *get_session_symbol_index(elf_session_t *session);
+address_index_t *get_session_address_index(elf_session_t *session);
+section_name_index_t *get_session_section_name_index(elf_session_t *session);
+
+# 126 "include/session.h" 3 4
+_Bool 
+# 126 "include/session.h"
+    *get_session_relocated_sections(elf_session_t *session);
+
+unsigned char *get_session_named_section(elf_session_t *session, const char *name, uint64_t *size, uint64_t *address);
+abbrev_cache_t *get_session_abbrev_cache(elf_session_t *session);
+range_index_t *get_session_unit_address_index(elf_session_t *session);
+
+# 131 "include/session.h" 3 4
+_Bool 
+# 131 "include/session.h"
+    get_session_frame_section(elf_session_t *session, 
+# 131 "include/session.h" 3 4
+                                                      _Bool 
+# 131 "include/session.h"
+                                                           is_eh_frame, frame_section_t *section);
+range_index_t *get_session_fde_index(elf_session_t *session, 
+# 132 "include/session.h" 3 4
+                                                            _Bool 
+# 132 "include/session.h"
+                                                                 is_eh_frame);
+names_index_t *get_session_names_index(elf_session_t *session);
+# 12 "include/commands.h" 2
+# 1 "include/output.h" 1
+# 13 "include/output.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 14 "include/output.h" 2
+# 52 "include/output.h"
+typedef struct
+{
+
+    int file_descriptor;
+
+    char *buffer;
+
+
+    size_t capacity;
+
+
+    size_t size;
+
+
+    
+# 66 "include/output.h" 3 4
+   _Bool 
+# 66 "include/output.h"
+        error;
+
+} output_t;
+
+
+
+void init_output(output_t *output, int file_descriptor);
+void init_memory_output(output_t *output, size_t capacity);
+int flush_output(output_t *output);
+int release_output(output_t *output);
+
+
+void append_bytes(output_t *output, const char *bytes, size_t length);
+void append_string(output_t *output, const char *string);
+void append_char(output_t *output, char character);
+void append_padding(output_t *output, int num_spaces);
+void append_format(output_t *output, const char *format, ...);
+
+char *reserve_output(output_t *output, size_t length);
+
+void append_hex(output_t *output, uint64_t value, int min_width);
+void append_decimal(output_t *output, uint64_t value);
+void append_signed_decimal(output_t *output, int64_t value);
+# 13 "include/commands.h" 2
+# 1 "include/pool.h" 1
+# 14 "include/pool.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 15 "include/pool.h" 2
+# 27 "include/pool.h"
+typedef void (*job_function_t)(void *context, int job_number, output_t *output);
+# 37 "include/pool.h"
+typedef int (*job_finish_function_t)(void *context, int job_number);
+# 53 "include/pool.h"
+typedef struct
+{
+    job_function_t function;
+
+
+    job_finish_function_t finish;
+
+    void *context;
+    int num_jobs;
+
+    size_t output_size;
+
+
+    const 
+# 66 "include/pool.h" 3 4
+         _Bool 
+# 66 "include/pool.h"
+              *run_by_caller;
+
+} ordered_jobs_t;
+# 78 "include/pool.h"
+typedef enum
+{
+    JOB_WAITING,
+    JOB_RUNNING,
+    JOB_FINISHED
+
+} job_state_t;
+# 101 "include/pool.h"
+typedef struct job_batch
+{
+    ordered_jobs_t *jobs;
+
+
+    output_t *outputs;
+    job_state_t *states;
+
+
+    int next_job;
+
+
+    int oldest_job;
+
+
+    int max_ahead;
+
+
+    int num_running;
+
+
+    
+# 122 "include/pool.h" 3 4
+   _Bool 
+# 122 "include/pool.h"
+        stopping;
+
+
+    struct job_batch *next;
+
+} job_batch_t;
+# 140 "include/pool.h"
+typedef struct
+{
+    pthread_t *threads;
+    int num_threads;
+
+
+    job_batch_t *batches;
+
+
+    
+# 149 "include/pool.h" 3 4
+   _Bool 
+# 149 "include/pool.h"
+        stopping;
+
+    pthread_mutex_t lock;
+
+
+    pthread_cond_t job_finished;
+
+
+    pthread_cond_t work_available;
+
+} thread_pool_t;
+
+
+
+int start_thread_pool(thread_pool_t *pool, int num_threads);
+void join_thread_pool(thread_pool_t *pool);
+
+int run_ordered_jobs(thread_pool_t *pool, output_t *output, ordered_jobs_t *jobs);
+# 14 "include/commands.h" 2
+# 24 "include/commands.h"
+typedef enum
+{
+    CMD_DUMP_ELF_HEADER,
+    CMD_DUMP_SECTION_HEADERS,
+    CMD_DUMP_PROGRAM_HEADERS,
+    CMD_DUMP_ALL_HEADERS,
+    CMD_DUMP_SYMBOL_TABLE,
+    CMD_DUMP_RELOCATION_INFO,
+    CMD_HEX_DUMP_SECTION,
+    CMD_STRING_DUMP_SECTION,
+    CMD_DUMP_DEBUG_INFO,
+    CMD_LOOKUP_SYMBOL,
+    CMD_ADDRESS_TO_SYMBOL,
+    CMD_ADDRESS_TO_UNIT,
+    CMD_FIND_FDE,
+    CMD_FIND_NAME
+
+} command_type;
+
+
+
+
+
+typedef struct
+{
+
+    command_type type;
+
+
+
+
+
+
+    debug_command_subtype subtype;
+
+
+
+
+
+
+    int section_number;
+    char *section_name;
+
+
+
+
+
+
+    thread_pool_t *pool;
+    uint64_t parallel_dump_threshold;
+
+
+
+
+
+
+    int dwarf_depth;
+
+
+
+
+
+
+    char *symbol_names;
+
+
+
+
+
+
+    char *fde_addresses;
+
+
+
+
+
+
+    char *debug_names;
+# 112 "include/commands.h"
+    char *invoking_option;
+
+} command_t;
+
+
+
+
+
+
+
+typedef struct
+{
+
+    int num_commands;
+    int array_size;
+
+    command_t **command_array;
+
+} command_list_t;
+
+
+
+
+
+
+void init_command_list(command_list_t *list, int max_size);
+void add_command(command_list_t *list, command_t *command);
+command_t *remove_command(command_list_t *list, int index);
+void release_command(command_t *command);
+void release_command_list(command_list_t *list);
+
+
+
+
+
+
+int dump_elf_header(elf_session_t *session, output_t *output);
+int dump_section_headers(elf_session_t *session, output_t *output);
+int dump_program_headers(elf_session_t *session, output_t *output);
+int dump_symbol_table(elf_session_t *session, output_t *output);
+int dump_relocation_info(elf_session_t *session, output_t *output);
+int hex_dump_section(elf_session_t *session, output_t *output, int section_number, char *section_name,
+                     thread_pool_t *pool, uint64_t parallel_dump_threshold);
+int string_dump_section(elf_session_t *session, output_t *output, int section_number, char *section_name,
+                        thread_pool_t *pool, uint64_t parallel_dump_threshold);
+int dump_debug_info(elf_session_t *session, output_t *output, debug_command_subtype subtype, int dwarf_depth,
+                    thread_pool_t *pool, uint64_t parallel_dump_threshold);
+int lookup_symbols(elf_session_t *session, output_t *output, char *symbol_names);
+int resolve_addresses(elf_session_t *session, output_t *output);
+int resolve_unit_addresses(elf_session_t *session, output_t *output);
+int find_fdes(elf_session_t *session, output_t *output, char *addresses);
+int find_debug_names(elf_session_t *session, output_t *output, char *names);
+# 17 "src/commands.c" 2
+# 1 "include/readelf.h" 1
+# 18 "src/commands.c" 2
+# 1 "include/session.h" 1
+# 19 "src/commands.c" 2
+# 1 "include/stringify.h" 1
+# 24 "include/stringify.h"
+int stringify_ELF32_header(output_t *output, ELF32_Header_t *elf_header, ELF32_Section_Header_t *section_header_table);
+int stringify_ELF32_section_header_table(output_t *output, ELF32_Section_Header_t *section_header_table, ELF32_Header_t *file_header, section_name_table_t *section_header_names);
+int stringify_ELF32_program_header_table(output_t *output, ELF32_Program_Header_t *program_header_table, ELF32_Header_t *file_header,
+                                         section_to_segment_mapping_t *section_to_segment_mapping, section_name_table_t *section_names);
+int stringify_ELF32_symbol_table(output_t *output, symbol_table_t *symbol_table, string_view_t section_name);
+void stringify_ELF32_symbol(output_t *output, symbol_table_t *symbol_table, uint64_t symbol_number);
+int stringify_ELF32_relocation_table(output_t *output, relocation_table_t *relocation_table, ELF32_Section_Header_t *section_header,
+                                      string_view_t section_name, int machine, section_name_table_t *section_names);
+
+
+
+int stringify_ELF64_header(output_t *output, ELF64_Header_t *elf_header, ELF64_Section_Header_t *section_header_table);
+int stringify_ELF64_section_header_table(output_t *output, ELF64_Section_Header_t *section_header_table, ELF64_Header_t *file_header, section_name_table_t *section_header_names);
+int stringify_ELF64_program_header_table(output_t *output, ELF64_Program_Header_t *program_header_table, ELF64_Header_t *file_header,
+                                         section_to_segment_mapping_t *section_to_segment_mapping, section_name_table_t *section_names);
+int stringify_ELF64_symbol_table(output_t *output, symbol_table_t *symbol_table, string_view_t section_name);
+void stringify_ELF64_symbol(output_t *output, symbol_table_t *symbol_table, uint64_t symbol_number);
+int stringify_ELF64_relocation_table(output_t *output, relocation_table_t *relocation_table, ELF64_Section_Header_t *section_header,
+                                      string_view_t section_name, int machine, section_name_table_t *section_names);
+
+
+
+void stringify_symbol_lookup_title(output_t *output, symbol_index_t *index);
+void stringify_missing_symbol(output_t *output, const char *name, size_t length);
+
+void stringify_debug_abbrev_table(output_t *output, abbrev_table_t *table);
+void stringify_debug_unit_header(output_t *output, unit_header_t *unit);
+void stringify_debug_die(output_t *output, die_t *die);
+void stringify_debug_attribute(output_t *output, uint64_t offset, attribute_value_t *value, debug_strings_t *strings);
+void stringify_debug_aranges_header(output_t *output, aranges_header_t *header);
+void stringify_debug_arange(output_t *output, uint64_t address, uint64_t length, int address_size);
+void stringify_debug_cie(output_t *output, cie_t *cie, int address_size);
+void stringify_debug_fde(output_t *output, fde_t *fde, int address_size);
+void stringify_debug_cfa_instruction(output_t *output, cfa_instruction_t *instruction, int address_size, int machine);
+void stringify_fde_index(output_t *output, range_index_t *index, const char *section_name, int address_size);
+void stringify_debug_names_header(output_t *output, names_table_t *table);
+void stringify_debug_names_buckets(output_t *output, names_table_t *table, uint64_t buckets_used, uint64_t longest_bucket);
+void stringify_debug_name(output_t *output, uint64_t number, uint32_t hash, 
+# 61 "include/stringify.h" 3 4
+                                                                           _Bool 
+# 61 "include/stringify.h"
+                                                                                has_hash, const char *name, uint64_t length);
+void stringify_debug_names_entry(output_t *output, names_entry_t *entry);
+void stringify_debug_name_match(output_t *output, const char *name, size_t length, uint64_t die_offset, uint32_t tag);
+# 20 "src/commands.c" 2
+# 1 "include/input.h" 1
+# 13 "include/input.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 14 "include/input.h" 2
+# 30 "include/input.h"
+typedef struct
+{
+    int file_descriptor;
+
+    char *buffer;
+
+
+    size_t size;
+
+
+    size_t position;
+
+    
+# 42 "include/input.h" 3 4
+   _Bool 
+# 42 "include/input.h"
+        end_of_input;
+
+} input_t;
+
+
+
+void init_input(input_t *input, int file_descriptor);
+void release_input(input_t *input);
+
+
+# 51 "include/input.h" 3 4
+_Bool 
+# 51 "include/input.h"
+    read_token(input_t *input, string_view_t *token);
+
+# 52 "include/input.h" 3 4
+_Bool 
+# 52 "include/input.h"
+    parse_address(string_view_t token, uint64_t *address);
+# 21 "src/commands.c" 2
+# 1 "include/dump.h" 1
+# 11 "include/dump.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 12 "include/dump.h" 2
+# 37 "include/dump.h"
+void hex_dump(output_t *output, const unsigned char *data, uint64_t size, uint64_t address);
+uint64_t string_dump(output_t *output, const unsigned char *data, uint64_t size);
+
+void hex_dump_in_parallel(output_t *output, const unsigned char *data, uint64_t size, uint64_t address, thread_pool_t *pool);
+uint64_t string_dump_in_parallel(output_t *output, const unsigned char *data, uint64_t size, thread_pool_t *pool);
+# 22 "src/commands.c" 2
+# 1 "include/pool.h" 1
+# 23 "src/commands.c" 2
+# 32 "src/commands.c"
+void init_command_list(command_list_t *list, int max_size)
+{
+
+    list->command_array = (command_t**) malloc(sizeof(command_t*)*max_size);
+    list->array_size = max_size;
+    list->num_commands = 0;
+}
+
+
+
+
+
+void add_command(command_list_t *list, command_t *command)
+{
+    list->command_array[list->num_commands] = command;
+    list->num_commands++;
+}
+# 57 "src/commands.c"
+command_t *remove_command(command_list_t *list, int index)
+{
+    command_t *removed_command;
+    removed_command = list->command_array[index];
+
+
+    for(int i = index+1; i < list->num_commands; i++)
+    {
+        list->command_array[i-1] = list->command_array[i];
+    }
+
+
+
+
+
+    list->command_array[list->num_commands-1] = 0;
+
+    list->num_commands--;
+
+    return removed_command;
+}
+
+
+
+
+
+
+void release_command(command_t *command)
+{
+    if(command->invoking_option != 0)
+        free(command->invoking_option);
+
+    if(command->section_name != 0)
+        free(command->section_name);
+
+    free(command);
+}
+
+
+
+
+
+
+void release_command_list(command_list_t *list)
+{
+    for(int i = 0; i < list->array_size; i++)
+    {
+        if(list->command_array[i] != 0)
+            release_command(list->command_array[i]);
+    }
+
+    free(list->command_array);
+}
+# 123 "src/commands.c"
+static int dump_ELF32_header(elf_session_t *session, output_t *output)
+{
+    ELF32_Header_t *file_header;
+
+    if((file_header = get_session_ELF32_header(session)) == 
+# 127 "src/commands.c" 3 4
+                                                           ((void *)0)
+# 127 "src/commands.c"
+                                                               )
+    {
+        fprintf(
+# 129 "src/commands.c" 3 4
+               stderr
+# 129 "src/commands.c"
+                     , "Unable to read ELF32 file header.\n");
+        return -1;
+    }
+
+
+
+
+
+
+
+    return stringify_ELF32_header(output, file_header, get_session_ELF32_section_header_table(session));
+}
+
+
+
+static int dump_ELF64_header(elf_session_t *session, output_t *output)
+{
+    ELF64_Header_t *file_header;
+
+    if((file_header = get_session_ELF64_header(session)) == 
+# 148 "src/commands.c" 3 4
+                                                           ((void *)0)
+# 148 "src/commands.c"
+                                                               )
+    {
+        fprintf(
+# 150 "src/commands.c" 3 4
+               stderr
+# 150 "src/commands.c"
+                     , "Unable to read ELF64 file header.\n");
+        return -1;
+    }
+
+
+
+
+
+
+
+    return stringify_ELF64_header(output, file_header, get_session_ELF64_section_header_table(session));
+}
+
+
+int dump_elf_header(elf_session_t *session, output_t *output)
+{
+    switch (session->file_class)
+    {
+    case 1:
+        return dump_ELF32_header(session, output);
+
+    case 2:
+        return dump_ELF64_header(session, output);
+
+    default:
+        append_string(output, "ELF file has no class.\n");
+        return -1;
+    }
+}
+
+
+
+
+
+static int dump_ELF32_section_headers(elf_session_t *session, output_t *output)
+{
+    ELF32_Header_t *file_header;
+    ELF32_Section_Header_t *section_header_table;
+    section_name_table_t *section_names;
+
+
+
+
+
+
+    if((file_header = get_session_ELF32_header(session)) == 
+# 195 "src/commands.c" 3 4
+                                                           ((void *)0)
+# 195 "src/commands.c"
+                                                               )
+    {
+        fprintf(
+# 197 "src/commands.c" 3 4
+               stderr
+# 197 "src/commands.c"
+                     , "Unable to read ELF32 section headers.\n");
+        return -1;
+    }
+
+
+
+
+
+
+
+    if((section_header_table = get_session_ELF32_section_header_table(session)) == 
+# 207 "src/commands.c" 3 4
+                                                                                  ((void *)0)
+# 207 "src/commands.c"
+                                                                                      )
+    {
+        fprintf(
+# 209 "src/commands.c" 3 4
+               stderr
+# 209 "src/commands.c"
+                     , "Unable to read ELF32 section headers.\n");
+        return -1;
+    }
+# 220 "src/commands.c"
+    if((section_names = get_session_section_names(session)) == 
+# 220 "src/commands.c" 3 4
+                                                              ((void *)0)
+# 220 "src/commands.c"
+                                                                  )
+    {
+        fprintf(
+# 222 "src/commands.c" 3 4
+               stderr
+# 222 "src/commands.c"
+                     , "Unable to find section names.\n");
+        return -1;
+    }
+
+
+
+
+
+
+    return stringify_ELF32_section_header_table(output, section_header_table, file_header, section_names);
+}
+
+
+static int dump_ELF64_section_headers(elf_session_t *session, output_t *output)
+{
+    ELF64_Header_t *file_header;
+    ELF64_Section_Header_t *section_header_table;
+    section_name_table_t *section_names;
+
+
+
+
+
+
+    if((file_header = get_session_ELF64_header(session)) == 
+# 246 "src/commands.c" 3 4
+                                                           ((void *)0)
+# 246 "src/commands.c"
+                                                               )
+    {
+        fprintf(
+# 248 "src/commands.c" 3 4
+               stderr
+# 248 "src/commands.c"
+                     , "Unable to read ELF64 section header table.\n");
+        return -1;
+    }
+
+
+
+
+
+
+
+    if((section_header_table = get_session_ELF64_section_header_table(session)) == 
+# 258 "src/commands.c" 3 4
+                                                                                  ((void *)0)
+# 258 "src/commands.c"
+                                                                                      )
+    {
+        fprintf(
+# 260 "src/commands.c" 3 4
+               stderr
+# 260 "src/commands.c"
+                     , "Unable to read ELF64 section header table.\n");
+        return -1;
+    }
+# 271 "src/commands.c"
+    if((section_names = get_session_section_names(session)) == 
+# 271 "src/commands.c" 3 4
+                                                              ((void *)0)
+# 271 "src/commands.c"
+                                                                  )
+    {
+        fprintf(
+# 273 "src/commands.c" 3 4
+               stderr
+# 273 "src/commands.c"
+                     , "Unable to get section names.\n");
+        return -1;
+    }
+
+
+
+
+
+
+    return stringify_ELF64_section_header_table(output, section_header_table, file_header, section_names);
+}
+
+
+
+int dump_section_headers(elf_session_t *session, output_t *output)
+{
+# 297 "src/commands.c"
+    switch (session->file_class)
+    {
+    case 1:
+        return dump_ELF32_section_headers(session, output);
+
+    case 2:
+        return dump_ELF64_section_headers(session, output);
+
+    default:
+        append_string(output, "ELF file has no class.\n");
+        return -1;
+    }
+}
+
+
+
+static int dump_ELF32_program_headers(elf_session_t *session, output_t *output)
+{
+    ELF32_Header_t *file_header;
+    ELF32_Program_Header_t *program_header_table;
+    section_to_segment_mapping_t *section_to_segment_mapping;
+
+
+
+
+
+
+    if((file_header = get_session_ELF32_header(session)) == 
+# 324 "src/commands.c" 3 4
+                                                           ((void *)0)
+# 324 "src/commands.c"
+                                                               )
+    {
+        fprintf(
+# 326 "src/commands.c" 3 4
+               stderr
+# 326 "src/commands.c"
+                     , "Unable to read ELF32 program header table.\n");
+        return -1;
+    }
+
+
+
+
+
+
+    if((program_header_table = get_session_ELF32_program_header_table(session)) == 
+# 335 "src/commands.c" 3 4
+                                                                                  ((void *)0)
+# 335 "src/commands.c"
+                                                                                      )
+    {
+        fprintf(
+# 337 "src/commands.c" 3 4
+               stderr
+# 337 "src/commands.c"
+                     , "Unable to read ELF32 program header table.\n");
+        return -1;
+    }
+
+
+    section_to_segment_mapping = get_session_section_to_segment_mapping(session);
+
+
+
+
+
+
+    return stringify_ELF32_program_header_table(output, program_header_table, file_header, section_to_segment_mapping,
+                                                get_session_section_names(session));
+}
+
+
+
+static int dump_ELF64_program_headers(elf_session_t *session, output_t *output)
+{
+    ELF64_Header_t *file_header;
+    ELF64_Program_Header_t *program_header_table;
+    section_to_segment_mapping_t *section_to_segment_mapping;
+
+
+
+
+
+
+    if((file_header = get_session_ELF64_header(session)) == 
+# 366 "src/commands.c" 3 4
+                                                           ((void *)0)
+# 366 "src/commands.c"
+                                                               )
+    {
+        fprintf(
+# 368 "src/commands.c" 3 4
+               stderr
+# 368 "src/commands.c"
+                     , "Unable to read ELF64 program header table.\n");
+        return -1;
+    }
+
+
+    if((program_header_table = get_session_ELF64_program_header_table(session)) == 
+# 373 "src/commands.c" 3 4
+                                                                                  ((void *)0)
+# 373 "src/commands.c"
+                                                                                      )
+    {
+        fprintf(
+# 375 "src/commands.c" 3 4
+               stderr
+# 375 "src/commands.c"
+                     , "Unable to read ELF64 program header table.\n");
+        return -1;
+    }
+
+
+
+
+
+
+
+    section_to_segment_mapping = get_session_section_to_segment_mapping(session);
+
+
+    return stringify_ELF64_program_header_table(output, program_header_table, file_header, section_to_segment_mapping,
+                                                get_session_section_names(session));
+}
+
+
+
+int dump_program_headers(elf_session_t *session, output_t *output)
+{
+    switch(session->file_class)
+    {
+        case 1:
+            return dump_ELF32_program_headers(session, output);
+
+        case 2:
+            return dump_ELF64_program_headers(session, output);
+
+        default:
+            append_string(output, "ELF file has no class.\n");
+            return -1;
+    }
+}
+
+
+
+static int dump_ELF32_symbol_tables(elf_session_t *session, output_t *output)
+{
+    ELF32_Header_t *file_header;
+    ELF32_Section_Header_t *section_header_table;
+    section_name_table_t *section_names;
+    int num_sections;
+    int num_symbol_tables = 0;
+
+
+    if((file_header = get_session_ELF32_header(session)) == 
+# 421 "src/commands.c" 3 4
+                                                           ((void *)0) 
+# 421 "src/commands.c"
+                                                                ||
+       (section_header_table = get_session_ELF32_section_header_table(session)) == 
+# 422 "src/commands.c" 3 4
+                                                                                  ((void *)0)
+# 422 "src/commands.c"
+                                                                                      )
+    {
+        fprintf(
+# 424 "src/commands.c" 3 4
+               stderr
+# 424 "src/commands.c"
+                     , "Unable to read ELF32 section header table.\n");
+        return -1;
+    }
+
+    if((section_names = get_session_section_names(session)) == 
+# 428 "src/commands.c" 3 4
+                                                              ((void *)0)
+# 428 "src/commands.c"
+                                                                  )
+    {
+        fprintf(
+# 430 "src/commands.c" 3 4
+               stderr
+# 430 "src/commands.c"
+                     , "Unable to get section names.\n");
+        return -1;
+    }
+
+    num_sections = get_session_num_sections(session);
+
+
+
+
+
+
+    for(int i = 0; i < num_sections; i++)
+    {
+        symbol_table_t symbol_table;
+
+        if(section_header_table[i].sh_type != 2 && section_header_table[i].sh_type != 11)
+        {
+            continue;
+        }
+
+        num_symbol_tables++;
+
+        if(get_ELF32_symbol_table(&session->image, file_header, section_header_table, i, &symbol_table) != 0)
+        {
+            continue;
+        }
+
+        stringify_ELF32_symbol_table(output, &symbol_table, section_names->names[i]);
+    }
+
+
+    if(num_symbol_tables == 0)
+    {
+        append_string(output, "\nThere are no symbol tables in this file.\n");
+    }
+
+    return 0;
+}
+
+
+
+static int dump_ELF64_symbol_tables(elf_session_t *session, output_t *output)
+{
+    ELF64_Header_t *file_header;
+    ELF64_Section_Header_t *section_header_table;
+    section_name_table_t *section_names;
+    int num_sections;
+    int num_symbol_tables = 0;
+
+
+    if((file_header = get_session_ELF64_header(session)) == 
+# 480 "src/commands.c" 3 4
+                                                           ((void *)0) 
+# 480 "src/commands.c"
+                                                                ||
+       (section_header_table = get_session_ELF64_section_header_table(session)) == 
+# 481 "src/commands.c" 3 4
+                                                                                  ((void *)0)
+# 481 "src/commands.c"
+                                                                                      )
+    {
+        fprintf(
+# 483 "src/commands.c" 3 4
+               stderr
+# 483 "src/commands.c"
+                     , "Unable to read ELF64 section header table.\n");
+        return -1;
+    }
+
+    if((section_names = get_session_section_names(session)) == 
+# 487 "src/commands.c" 3 4
+                                                              ((void *)0)
+# 487 "src/commands.c"
+                                                                  )
+    {
+        fprintf(
+# 489 "src/commands.c" 3 4
+               stderr
+# 489 "src/commands.c"
+                     , "Unable to get section names.\n");
+        return -1;
+    }
+
+    num_sections = get_session_num_sections(session);
+
+
+
+
+
+
+    for(int i = 0; i < num_sections; i++)
+    {
+        symbol_table_t symbol_table;
+
+        if(section_header_table[i].sh_type != 2 && section_header_table[i].sh_type != 11)
+        {
+            continue;
+        }
+
+        num_symbol_tables++;
+
+        if(get_ELF64_symbol_table(&session->image, file_header, section_header_table, i, &symbol_table) != 0)
+        {
+            continue;
+        }
+
+        stringify_ELF64_symbol_table(output, &symbol_table, section_names->names[i]);
+    }
+
+
+    if(num_symbol_tables == 0)
+    {
+        append_string(output, "\nThere are no symbol tables in this file.\n");
+    }
+
+    return 0;
+}
+
+
+
+int dump_symbol_table(elf_session_t *session, output_t *output)
+{
+    switch (session->file_class)
+    {
+    case 1:
+        return dump_ELF32_symbol_tables(session, output);
+
+    case 2:
+        return dump_ELF64_symbol_tables(session, output);
+
+    default:
+        append_string(output, "ELF file has no class.\n");
+        return -1;
+    }
+}
+
+
+
+static int dump_ELF32_relocations(elf_session_t *session, output_t *output)
+{
+    ELF32_Header_t *file_header;
+    ELF32_Section_Header_t *section_header_table;
+    section_name_table_t *section_names;
+    int num_sections;
+    int num_relocation_sections = 0;
+
+
+    if((file_header = get_session_ELF32_header(session)) == 
+# 557 "src/commands.c" 3 4
+                                                           ((void *)0) 
+# 557 "src/commands.c"
+                                                                ||
+       (section_header_table = get_session_ELF32_section_header_table(session)) == 
+# 558 "src/commands.c" 3 4
+                                                                                  ((void *)0)
+# 558 "src/commands.c"
+                                                                                      )
+    {
+        fprintf(
+# 560 "src/commands.c" 3 4
+               stderr
+# 560 "src/commands.c"
+                     , "Unable to read ELF32 section header table.\n");
+        return -1;
+    }
+
+    if((section_names = get_session_section_names(session)) == 
+# 564 "src/commands.c" 3 4
+                                                              ((void *)0)
+# 564 "src/commands.c"
+                                                                  )
+    {
+        fprintf(
+# 566 "src/commands.c" 3 4
+               stderr
+# 566 "src/commands.c"
+                     , "Unable to get section names.\n");
+        return -1;
+    }
+
+    num_sections = get_session_num_sections(session);
+
+
+    for(int i = 0; i < num_sections; i++)
+    {
+        relocation_table_t relocation_table;
+
+        if(section_header_table[i].sh_type != 9 && section_header_table[i].sh_type != 4)
+        {
+            continue;
+        }
+
+        num_relocation_sections++;
+
+        if(get_ELF32_relocation_table(&session->image, file_header, section_header_table, i, &relocation_table) != 0)
+        {
+            continue;
+        }
+
+        stringify_ELF32_relocation_table(output, &relocation_table, &section_header_table[i], section_names->names[i],
+                                          file_header->e_machine, section_names);
+    }
+
+
+    if(num_relocation_sections == 0)
+    {
+        append_string(output, "\nThere are no relocations in this file.\n");
+    }
+
+    return 0;
+}
+
+
+
+static int dump_ELF64_relocations(elf_session_t *session, output_t *output)
+{
+    ELF64_Header_t *file_header;
+    ELF64_Section_Header_t *section_header_table;
+    section_name_table_t *section_names;
+    int num_sections;
+    int num_relocation_sections = 0;
+
+
+    if((file_header = get_session_ELF64_header(session)) == 
+# 613 "src/commands.c" 3 4
+                                                           ((void *)0) 
+# 613 "src/commands.c"
+                                                                ||
+       (section_header_table = get_session_ELF64_section_header_table(session)) == 
+# 614 "src/commands.c" 3 4
+                                                                                  ((void *)0)
+# 614 "src/commands.c"
+                                                                                      )
+    {
+        fprintf(
+# 616 "src/commands.c" 3 4
+               stderr
+# 616 "src/commands.c"
+                     , "Unable to read ELF64 section header table.\n");
+        return -1;
+    }
+
+    if((section_names = get_session_section_names(session)) == 
+# 620 "src/commands.c" 3 4
+                                                              ((void *)0)
+# 620 "src/commands.c"
+                                                                  )
+    {
+        fprintf(
+# 622 "src/commands.c" 3 4
+               stderr
+# 622 "src/commands.c"
+                     , "Unable to get section names.\n");
+        return -1;
+    }
+
+    num_sections = get_session_num_sections(session);
+
+
+    for(int i = 0; i < num_sections; i++)
+    {
+        relocation_table_t relocation_table;
+
+        if(section_header_table[i].sh_type != 9 && section_header_table[i].sh_type != 4)
+        {
+            continue;
+        }
+
+        num_relocation_sections++;
+
+        if(get_ELF64_relocation_table(&session->image, file_header, section_header_table, i, &relocation_table) != 0)
+        {
+            continue;
+        }
+
+        stringify_ELF64_relocation_table(output, &relocation_table, &section_header_table[i], section_names->names[i],
+                                          file_header->e_machine, section_names);
+    }
+
+
+    if(num_relocation_sections == 0)
+    {
+        append_string(output, "\nThere are no relocations in this file.\n");
+    }
+
+    return 0;
+}
+
+
+
+int dump_relocation_info(elf_session_t *session, output_t *output)
+{
+    switch (session->file_class)
+    {
+    case 1:
+        return dump_ELF32_relocations(session, output);
+
+    case 2:
+        return dump_ELF64_relocations(session, output);
+
+    default:
+        append_string(output, "ELF file has no class.\n");
+        return -1;
+    }
+}
+
+
+
+
+
+
+typedef struct
+{
+    string_view_t name;
+    unsigned char *data;
+    uint64_t size;
+    uint64_t address;
+    
+# 687 "src/commands.c" 3 4
+   _Bool 
+# 687 "src/commands.c"
+        has_relocations;
+
+} section_contents_t;
+# 700 "src/commands.c"
+static int find_dump_sections(elf_session_t *session, int *section_number, char *section_name, const int **sections)
+{
+    section_name_table_t *section_names;
+    section_name_index_t *index;
+    int num_sections;
+
+
+    if((section_names = get_session_section_names(session)) == 
+# 707 "src/commands.c" 3 4
+                                                              ((void *)0)
+# 707 "src/commands.c"
+                                                                  )
+    {
+        fprintf(
+# 709 "src/commands.c" 3 4
+               stderr
+# 709 "src/commands.c"
+                     , "Unable to get section names.\n");
+        return 0;
+    }
+
+    if(section_name == 
+# 713 "src/commands.c" 3 4
+                      ((void *)0)
+# 713 "src/commands.c"
+                          )
+    {
+        if(*section_number >= 0 && *section_number < section_names->num_names)
+        {
+            *sections = section_number;
+            return 1;
+        }
+
+        fprintf(
+# 721 "src/commands.c" 3 4
+               stderr
+# 721 "src/commands.c"
+                     , "Section %d was not dumped because it does not exist.\n", *section_number);
+        return 0;
+    }
+
+
+    if((index = get_session_section_name_index(session)) == 
+# 726 "src/commands.c" 3 4
+                                                           ((void *)0)
+# 726 "src/commands.c"
+                                                               )
+    {
+        fprintf(
+# 728 "src/commands.c" 3 4
+               stderr
+# 728 "src/commands.c"
+                     , "Unable to build section name index.\n");
+        return 0;
+    }
+
+    if((num_sections = find_sections(index, section_name, strlen(section_name), sections)) == 0)
+    {
+        fprintf(
+# 734 "src/commands.c" 3 4
+               stderr
+# 734 "src/commands.c"
+                     , "Section '%s' was not dumped because it does not exist.\n", section_name);
+    }
+
+    return num_sections;
+}
+# 748 "src/commands.c"
+static int get_ELF32_section_contents(elf_session_t *session, int index, section_contents_t *contents)
+{
+    ELF32_Header_t *file_header;
+    ELF32_Section_Header_t *section_header_table;
+    ELF32_Section_Header_t *section_header;
+    section_name_table_t *section_names;
+    
+# 754 "src/commands.c" 3 4
+   _Bool 
+# 754 "src/commands.c"
+        *relocated_sections = get_session_relocated_sections(session);
+
+
+    if((file_header = get_session_ELF32_header(session)) == 
+# 757 "src/commands.c" 3 4
+                                                           ((void *)0) 
+# 757 "src/commands.c"
+                                                                ||
+       (section_header_table = get_session_ELF32_section_header_table(session)) == 
+# 758 "src/commands.c" 3 4
+                                                                                  ((void *)0)
+# 758 "src/commands.c"
+                                                                                      )
+    {
+        fprintf(
+# 760 "src/commands.c" 3 4
+               stderr
+# 760 "src/commands.c"
+                     , "Unable to read ELF32 section header table.\n");
+        return -1;
+    }
+
+    if((section_names = get_session_section_names(session)) == 
+# 764 "src/commands.c" 3 4
+                                                              ((void *)0)
+# 764 "src/commands.c"
+                                                                  )
+    {
+        fprintf(
+# 766 "src/commands.c" 3 4
+               stderr
+# 766 "src/commands.c"
+                     , "Unable to get section names.\n");
+        return -1;
+    }
+
+
+    section_header = &section_header_table[index];
+
+    contents->name = section_names->names[index];
+    contents->address = section_header->sh_addr;
+    contents->size = (section_header->sh_type == 8) ? 0 : section_header->sh_size;
+    contents->has_relocations = (relocated_sections != 
+# 776 "src/commands.c" 3 4
+                                                      ((void *)0) 
+# 776 "src/commands.c"
+                                                           && relocated_sections[index]);
+
+    if((contents->data = get_image_range(&session->image, section_header->sh_offset, contents->size)) == 
+# 778 "src/commands.c" 3 4
+                                                                                                        ((void *)0)
+# 778 "src/commands.c"
+                                                                                                            )
+    {
+        fprintf(
+# 780 "src/commands.c" 3 4
+               stderr
+# 780 "src/commands.c"
+                     , "Section %d extends past the end of the file.\n", index);
+        return -1;
+    }
+
+    return 0;
+}
+# 795 "src/commands.c"
+static int get_ELF64_section_contents(elf_session_t *session, int index, section_contents_t *contents)
+{
+    ELF64_Header_t *file_header;
+    ELF64_Section_Header_t *section_header_table;
+    ELF64_Section_Header_t *section_header;
+    section_name_table_t *section_names;
+    
+# 801 "src/commands.c" 3 4
+   _Bool 
+# 801 "src/commands.c"
+        *relocated_sections = get_session_relocated_sections(session);
+
+
+    if((file_header = get_session_ELF64_header(session)) == 
+# 804 "src/commands.c" 3 4
+                                                           ((void *)0) 
+# 804 "src/commands.c"
+                                                                ||
+       (section_header_table = get_session_ELF64_section_header_table(session)) == 
+# 805 "src/commands.c" 3 4
+                                                                                  ((void *)0)
+# 805 "src/commands.c"
+                                                                                      )
+    {
+        fprintf(
+# 807 "src/commands.c" 3 4
+               stderr
+# 807 "src/commands.c"
+                     , "Unable to read ELF64 section header table.\n");
+        return -1;
+    }
+
+    if((section_names = get_session_section_names(session)) == 
+# 811 "src/commands.c" 3 4
+                                                              ((void *)0)
+# 811 "src/commands.c"
+                                                                  )
+    {
+        fprintf(
+# 813 "src/commands.c" 3 4
+               stderr
+# 813 "src/commands.c"
+                     , "Unable to get section names.\n");
+        return -1;
+    }
+
+
+    section_header = &section_header_table[index];
+
+    contents->name = section_names->names[index];
+    contents->address = section_header->sh_addr;
+    contents->size = (section_header->sh_type == 8) ? 0 : section_header->sh_size;
+    contents->has_relocations = (relocated_sections != 
+# 823 "src/commands.c" 3 4
+                                                      ((void *)0) 
+# 823 "src/commands.c"
+                                                           && relocated_sections[index]);
+
+    if((contents->data = get_image_range(&session->image, section_header->sh_offset, contents->size)) == 
+# 825 "src/commands.c" 3 4
+                                                                                                        ((void *)0)
+# 825 "src/commands.c"
+                                                                                                            )
+    {
+        fprintf(
+# 827 "src/commands.c" 3 4
+               stderr
+# 827 "src/commands.c"
+                     , "Section %d extends past the end of the file.\n", index);
+        return -1;
+    }
+
+    return 0;
+}
+
+
+
+
+
+
+
+static int get_section_contents(elf_session_t *session, output_t *output, int index, section_contents_t *contents)
+{
+    int result;
+
+
+    switch (session->file_class)
+    {
+    case 1:
+        result = get_ELF32_section_contents(session, index, contents);
+        break;
+
+    case 2:
+        result = get_ELF64_section_contents(session, index, contents);
+        break;
+
+    default:
+        append_string(output, "ELF file has no class.\n");
+        return -1;
+    }
+
+    if(result == 0 && contents->size == 0)
+    {
+        append_string(output, "Section '");
+        append_bytes(output, contents->name.string, contents->name.length);
+        append_string(output, "' has no data to dump.\n");
+    }
+
+    return result;
+}
+# 877 "src/commands.c"
+static int hex_dump_one_section(elf_session_t *session, output_t *output, int index,
+                                thread_pool_t *pool, uint64_t parallel_dump_threshold)
+{
+    section_contents_t contents;
+
+
+    if(get_section_contents(session, output, index, &contents) != 0)
+    {
+        return -1;
+    }
+
+    if(contents.size == 0)
+    {
+        return 0;
+    }
+
+
+    append_string(output, "\nHex dump of section '");
+    append_bytes(output, contents.name.string, contents.name.length);
+    append_string(output, "':\n");
+
+    if(contents.has_relocations)
+    {
+        append_string(output, " NOTE: This section has relocations against it, but these have NOT been applied to this dump.\n");
+    }
+
+    if(pool != 
+# 903 "src/commands.c" 3 4
+              ((void *)0) 
+# 903 "src/commands.c"
+                   && contents.size >= parallel_dump_threshold)
+    {
+        hex_dump_in_parallel(output, contents.data, contents.size, contents.address, pool);
+    }
+    else
+    {
+        hex_dump(output, contents.data, contents.size, contents.address);
+    }
+
+    append_char(output, '\n');
+
+    return 0;
+}
+
+
+
+
+
+
+
+static int string_dump_one_section(elf_session_t *session, output_t *output, int index,
+                                   thread_pool_t *pool, uint64_t parallel_dump_threshold)
+{
+    section_contents_t contents;
+    uint64_t num_lines;
+
+
+    if(get_section_contents(session, output, index, &contents) != 0)
+    {
+        return -1;
+    }
+
+    if(contents.size == 0)
+    {
+        return 0;
+    }
+
+
+    append_string(output, "\nString dump of section '");
+    append_bytes(output, contents.name.string, contents.name.length);
+    append_string(output, "':\n");
+
+    if(contents.has_relocations)
+    {
+        append_string(output, "  Note: This section has relocations against it, but these have NOT been applied to this dump.\n");
+    }
+
+    if(pool != 
+# 950 "src/commands.c" 3 4
+              ((void *)0) 
+# 950 "src/commands.c"
+                   && contents.size >= parallel_dump_threshold)
+    {
+        num_lines = string_dump_in_parallel(output, contents.data, contents.size, pool);
+    }
+    else
+    {
+        num_lines = string_dump(output, contents.data, contents.size);
+    }
+
+    if(num_lines == 0)
+    {
+        append_string(output, "  No strings found in this section.");
+    }
+
+    append_char(output, '\n');
+
+    return 0;
+}
+
+
+
+int hex_dump_section(elf_session_t *session, output_t *output, int section_number, char *section_name,
+                     thread_pool_t *pool, uint64_t parallel_dump_threshold)
+{
+    const int *sections;
+    int num_sections = find_dump_sections(session, &section_number, section_name, &sections);
+    int result = (num_sections > 0) ? 0 : -1;
+
+
+    for(int i = 0; i < num_sections; i++)
+    {
+        if(hex_dump_one_section(session, output, sections[i], pool, parallel_dump_threshold) != 0)
+        {
+            result = -1;
+        }
+    }
+
+    return result;
+}
+
+
+
+int string_dump_section(elf_session_t *session, output_t *output, int section_number, char *section_name,
+                        thread_pool_t *pool, uint64_t parallel_dump_threshold)
+{
+    const int *sections;
+    int num_sections = find_dump_sections(session, &section_number, section_name, &sections);
+    int result = (num_sections > 0) ? 0 : -1;
+
+
+    for(int i = 0; i < num_sections; i++)
+    {
+        if(string_dump_one_section(session, output, sections[i], pool, parallel_dump_threshold) != 0)
+        {
+            result = -1;
+        }
+    }
+
+    return result;
+}
+
+
+
+
+
+
+
+static 
+# 1017 "src/commands.c" 3 4
+      _Bool 
+# 1017 "src/commands.c"
+           has_relocations(elf_session_t *session, const char *name)
+{
+    section_name_index_t *index = get_session_section_name_index(session);
+    
+# 1020 "src/commands.c" 3 4
+   _Bool 
+# 1020 "src/commands.c"
+        *relocated_sections = get_session_relocated_sections(session);
+    const int *sections;
+
+
+    if(index == 
+# 1024 "src/commands.c" 3 4
+               ((void *)0) 
+# 1024 "src/commands.c"
+                    || relocated_sections == 
+# 1024 "src/commands.c" 3 4
+                                             ((void *)0) 
+# 1024 "src/commands.c"
+                                                  || find_sections(index, name, strlen(name), &sections) == 0)
+    {
+        return 
+# 1026 "src/commands.c" 3 4
+              0
+# 1026 "src/commands.c"
+                   ;
+    }
+
+    return relocated_sections[sections[0]];
+}
+# 1042 "src/commands.c"
+static void get_debug_strings(elf_session_t *session, debug_strings_t *strings)
+{
+    strings->str = get_session_named_section(session, ".debug_str", &strings->str_size, 
+# 1044 "src/commands.c" 3 4
+                                                                                       ((void *)0)
+# 1044 "src/commands.c"
+                                                                                           );
+    strings->line_str = get_session_named_section(session, ".debug_line_str", &strings->line_str_size, 
+# 1045 "src/commands.c" 3 4
+                                                                                                      ((void *)0)
+# 1045 "src/commands.c"
+                                                                                                          );
+    strings->str_offsets = 
+# 1046 "src/commands.c" 3 4
+                          ((void *)0)
+# 1046 "src/commands.c"
+                              ;
+    strings->str_offsets_size = 0;
+    strings->addr = 
+# 1048 "src/commands.c" 3 4
+                   ((void *)0)
+# 1048 "src/commands.c"
+                       ;
+    strings->addr_size = 0;
+
+    if(has_relocations(session, ".debug_info") || has_relocations(session, ".debug_str_offsets") ||
+       has_relocations(session, ".debug_addr"))
+    {
+        return;
+    }
+
+    strings->str_offsets = get_session_named_section(session, ".debug_str_offsets", &strings->str_offsets_size, 
+# 1057 "src/commands.c" 3 4
+                                                                                                               ((void *)0)
+# 1057 "src/commands.c"
+                                                                                                                   );
+    strings->addr = get_session_named_section(session, ".debug_addr", &strings->addr_size, 
+# 1058 "src/commands.c" 3 4
+                                                                                          ((void *)0)
+# 1058 "src/commands.c"
+                                                                                              );
+}
+# 1069 "src/commands.c"
+static int dump_debug_abbrev(elf_session_t *session, output_t *output)
+{
+    abbrev_cache_t *cache = get_session_abbrev_cache(session);
+    uint64_t offset = 0;
+
+
+    if(cache == 
+# 1075 "src/commands.c" 3 4
+               ((void *)0)
+# 1075 "src/commands.c"
+                   )
+    {
+        return 0;
+    }
+
+    append_string(output, "Contents of the .debug_abbrev section:\n\n");
+
+    while(offset < cache->section_size)
+    {
+        abbrev_table_t *table = get_abbrev_table(cache, offset);
+
+        if(table == 
+# 1086 "src/commands.c" 3 4
+                   ((void *)0)
+# 1086 "src/commands.c"
+                       )
+        {
+            fprintf(
+# 1088 "src/commands.c" 3 4
+                   stderr
+# 1088 "src/commands.c"
+                         , "Error: corrupt abbreviations at offset 0x%lx of .debug_abbrev.\n", (unsigned long) offset);
+            return -1;
+        }
+
+        stringify_debug_abbrev_table(output, table);
+        offset = table->end_offset;
+    }
+
+    append_char(output, '\n');
+
+    return 0;
+}
+
+
+
+
+
+
+
+typedef enum
+{
+    UNIT_OK,
+    UNIT_CORRUPT_ABBREVS,
+    UNIT_CORRUPT_DIE
+
+} unit_status_t;
+
+
+typedef struct
+{
+    unit_status_t status;
+    uint64_t offset;
+
+} unit_result_t;
+
+
+
+
+
+
+
+static int report_debug_unit_error(unit_result_t *result)
+{
+    switch(result->status)
+    {
+        case UNIT_CORRUPT_ABBREVS:
+            fprintf(
+# 1134 "src/commands.c" 3 4
+                   stderr
+# 1134 "src/commands.c"
+                         , "Error: corrupt abbreviations at offset 0x%lx of .debug_abbrev.\n", (unsigned long) result->offset);
+            return -1;
+
+        case UNIT_CORRUPT_DIE:
+            fprintf(
+# 1138 "src/commands.c" 3 4
+                   stderr
+# 1138 "src/commands.c"
+                         , "Error: corrupt DIE at offset 0x%lx of .debug_info.\n", (unsigned long) result->offset);
+            return -1;
+
+        default:
+            return 0;
+    }
+}
+# 1159 "src/commands.c"
+static void dump_debug_unit(output_t *output, const unsigned char *section, unit_header_t *unit,
+                            abbrev_cache_t *abbrevs, debug_strings_t *strings, int dwarf_depth,
+                            unit_result_t *result)
+{
+    abbrev_table_t *table = get_abbrev_table(abbrevs, unit->abbrev_offset);
+    debug_strings_t unit_strings = *strings;
+    
+# 1165 "src/commands.c" 3 4
+   _Bool 
+# 1165 "src/commands.c"
+        printing = 
+# 1165 "src/commands.c" 3 4
+                   1
+# 1165 "src/commands.c"
+                       ;
+    die_reader_t reader;
+    die_status_t status;
+    die_t die;
+
+
+    stringify_debug_unit_header(output, unit);
+
+    result->status = UNIT_OK;
+
+    if(table == 
+# 1175 "src/commands.c" 3 4
+               ((void *)0)
+# 1175 "src/commands.c"
+                   )
+    {
+        result->status = UNIT_CORRUPT_ABBREVS;
+        result->offset = unit->abbrev_offset;
+        return;
+    }
+
+
+    read_unit_bases(section, unit, table, &unit_strings);
+    init_die_reader(&reader, section, unit, table);
+
+    while((status = read_die(&reader, &die)) == DIE_OK)
+    {
+        if(dwarf_depth >= 0 && die.depth >= dwarf_depth)
+        {
+            if(printing && die.depth > 0)
+            {
+                append_string(output, " <");
+                append_decimal(output, die.depth);
+                append_string(output, "><");
+                append_hex(output, die.offset, 0);
+                append_string(output, ">: ...\n");
+            }
+
+            printing = 
+# 1199 "src/commands.c" 3 4
+                      0
+# 1199 "src/commands.c"
+                           ;
+
+            if(die.abbrev != 
+# 1201 "src/commands.c" 3 4
+                            ((void *)0) 
+# 1201 "src/commands.c"
+                                 && !skip_attributes(&reader, die.abbrev->attributes, die.abbrev->num_attributes))
+            {
+                status = DIE_CORRUPT;
+                break;
+            }
+
+            continue;
+        }
+
+        printing = 
+# 1210 "src/commands.c" 3 4
+                  1
+# 1210 "src/commands.c"
+                      ;
+        stringify_debug_die(output, &die);
+
+        if(die.abbrev == 
+# 1213 "src/commands.c" 3 4
+                        ((void *)0)
+# 1213 "src/commands.c"
+                            )
+        {
+            continue;
+        }
+
+        for(uint32_t i = 0; i < die.abbrev->num_attributes; i++)
+        {
+            uint64_t offset = reader.position - section;
+            attribute_value_t value;
+
+            if(!read_attribute(&reader, &die.abbrev->attributes[i], &value))
+            {
+                status = DIE_CORRUPT;
+                break;
+            }
+
+            stringify_debug_attribute(output, offset, &value, &unit_strings);
+        }
+
+        if(status == DIE_CORRUPT)
+        {
+            break;
+        }
+    }
+
+    if(status == DIE_CORRUPT)
+    {
+        result->status = UNIT_CORRUPT_DIE;
+        result->offset = die.offset;
+    }
+}
+
+
+
+
+
+
+
+typedef struct
+{
+    const unsigned char *section;
+    unit_header_t *units;
+    abbrev_cache_t *abbrevs;
+    debug_strings_t *strings;
+    int dwarf_depth;
+
+
+    unit_result_t *results;
+
+} debug_unit_jobs_t;
+# 1275 "src/commands.c"
+static void dump_debug_unit_job(void *context, int job_number, output_t *output)
+{
+    debug_unit_jobs_t *jobs = (debug_unit_jobs_t*) context;
+
+    dump_debug_unit(output, jobs->section, &jobs->units[job_number], jobs->abbrevs, jobs->strings,
+                    jobs->dwarf_depth, &jobs->results[job_number]);
+}
+# 1290 "src/commands.c"
+static int finish_debug_unit_job(void *context, int job_number)
+{
+    debug_unit_jobs_t *jobs = (debug_unit_jobs_t*) context;
+
+    return report_debug_unit_error(&jobs->results[job_number]);
+}
+# 1304 "src/commands.c"
+static int dump_debug_units_in_parallel(output_t *output, debug_unit_jobs_t *jobs, int num_units,
+                                        uint64_t size, thread_pool_t *pool)
+{
+    ordered_jobs_t list;
+    uint64_t output_size = size / num_units * 8;
+    int result;
+
+
+    jobs->results = (unit_result_t*) malloc(num_units * sizeof(unit_result_t));
+
+    list.function = dump_debug_unit_job;
+    list.finish = finish_debug_unit_job;
+    list.context = jobs;
+    list.num_jobs = num_units;
+    list.output_size = (output_size < (4*1024)) ? (4*1024) :
+                       (output_size > (256*1024)) ? (256*1024) : output_size;
+
+    list.run_by_caller = 
+# 1321 "src/commands.c" 3 4
+                        ((void *)0)
+# 1321 "src/commands.c"
+                            ;
+
+    result = run_ordered_jobs(pool, output, &list);
+
+    free(jobs->results);
+
+    return result;
+}
+# 1340 "src/commands.c"
+static int dump_debug_info_units(elf_session_t *session, output_t *output, int dwarf_depth,
+                                 thread_pool_t *pool, uint64_t parallel_dump_threshold)
+{
+    debug_unit_jobs_t jobs;
+    debug_strings_t strings;
+    unit_header_t *units;
+    unsigned char *section;
+    uint64_t size, num_units, units_end;
+    int result = 0;
+
+
+    if((section = get_session_named_section(session, ".debug_info", &size, 
+# 1351 "src/commands.c" 3 4
+                                                                          ((void *)0)
+# 1351 "src/commands.c"
+                                                                              )) == 
+# 1351 "src/commands.c" 3 4
+                                                                                    ((void *)0)
+# 1351 "src/commands.c"
+                                                                                        )
+    {
+        return 0;
+    }
+
+    if((jobs.abbrevs = get_session_abbrev_cache(session)) == 
+# 1356 "src/commands.c" 3 4
+                                                            ((void *)0)
+# 1356 "src/commands.c"
+                                                                )
+    {
+        fprintf(
+# 1358 "src/commands.c" 3 4
+               stderr
+# 1358 "src/commands.c"
+                     , "Error: .debug_info has no .debug_abbrev section to go with it.\n");
+        return -1;
+    }
+
+    get_debug_strings(session, &strings);
+
+    append_string(output, "Contents of the .debug_info section:\n\n");
+
+    if(has_relocations(session, ".debug_info"))
+    {
+        append_string(output, "  Note: This section has relocations against it, but these have NOT been applied to this dump.\n");
+    }
+
+
+    num_units = read_unit_headers(section, size, &units);
+    units_end = (num_units > 0) ? units[num_units - 1].end_offset : 0;
+
+    jobs.section = section;
+    jobs.units = units;
+    jobs.strings = &strings;
+    jobs.dwarf_depth = dwarf_depth;
+
+    if(pool != 
+# 1380 "src/commands.c" 3 4
+              ((void *)0) 
+# 1380 "src/commands.c"
+                   && num_units > 1 && num_units <= 0x7fffffff && size >= parallel_dump_threshold)
+    {
+        result = dump_debug_units_in_parallel(output, &jobs, (int) num_units, size, pool);
+    }
+    else
+    {
+        for(uint64_t i = 0; i < num_units && result == 0; i++)
+        {
+            unit_result_t unit_result;
+
+            dump_debug_unit(output, section, &units[i], jobs.abbrevs, &strings, dwarf_depth, &unit_result);
+            result = report_debug_unit_error(&unit_result);
+        }
+    }
+
+    free(units);
+
+    if(result != 0)
+    {
+        return -1;
+    }
+
+    if(units_end < size)
+    {
+        fprintf(
+# 1404 "src/commands.c" 3 4
+               stderr
+# 1404 "src/commands.c"
+                     , "Error: corrupt unit header at offset 0x%lx of .debug_info.\n", (unsigned long) units_end);
+        return -1;
+    }
+
+    append_char(output, '\n');
+
+    return 0;
+}
+
+
+
+
+
+
+
+static int dump_debug_aranges(elf_session_t *session, output_t *output)
+{
+    aranges_header_t header;
+    unsigned char *section;
+    uint64_t size;
+
+
+    if((section = get_session_named_section(session, ".debug_aranges", &size, 
+# 1426 "src/commands.c" 3 4
+                                                                             ((void *)0)
+# 1426 "src/commands.c"
+                                                                                 )) == 
+# 1426 "src/commands.c" 3 4
+                                                                                       ((void *)0)
+# 1426 "src/commands.c"
+                                                                                           )
+    {
+        return 0;
+    }
+
+    append_string(output, "Contents of the .debug_aranges section:\n\n");
+
+    for(uint64_t offset = 0; offset < size; offset = header.end_offset)
+    {
+        const unsigned char *position;
+        uint64_t address, length;
+
+        if(!read_aranges_header(section, size, offset, &header))
+        {
+            fprintf(
+# 1440 "src/commands.c" 3 4
+                   stderr
+# 1440 "src/commands.c"
+                         , "Error: corrupt set of address ranges at offset 0x%lx of .debug_aranges.\n", (unsigned long) offset);
+            return -1;
+        }
+
+        stringify_debug_aranges_header(output, &header);
+
+        position = section + header.ranges_offset;
+
+        while(read_arange(&position, section + header.end_offset, &header, &address, &length))
+        {
+            stringify_debug_arange(output, address, length, header.address_size);
+        }
+    }
+
+    append_char(output, '\n');
+
+    return 0;
+}
+
+
+
+
+
+
+
+static int get_machine(elf_session_t *session)
+{
+    switch(session->file_class)
+    {
+        case 1:
+        {
+            ELF32_Header_t *file_header = get_session_ELF32_header(session);
+            return (file_header != 
+# 1472 "src/commands.c" 3 4
+                                  ((void *)0)
+# 1472 "src/commands.c"
+                                      ) ? file_header->e_machine : 0;
+        }
+
+        case 2:
+        {
+            ELF64_Header_t *file_header = get_session_ELF64_header(session);
+            return (file_header != 
+# 1478 "src/commands.c" 3 4
+                                  ((void *)0)
+# 1478 "src/commands.c"
+                                      ) ? file_header->e_machine : 0;
+        }
+
+        default:
+            return 0;
+    }
+}
+# 1494 "src/commands.c"
+static void dump_cfa_instructions(output_t *output, frame_section_t *section, cie_t *cie, const unsigned char *instructions,
+                                  uint64_t length, uint64_t location, int machine)
+{
+    const unsigned char *position = instructions;
+    const unsigned char *end = instructions + length;
+    cfa_instruction_t instruction;
+
+
+    while(position < end)
+    {
+        const unsigned char *start = position;
+
+        if(!read_cfa_instruction(section, cie, &position, end, &location, &instruction))
+        {
+            append_string(output, "  Unknown or truncated DW_CFA value: 0x");
+            append_hex(output, *start, 2);
+            append_char(output, '\n');
+            return;
+        }
+
+        stringify_debug_cfa_instruction(output, &instruction, section->address_size, machine);
+    }
+}
+# 1525 "src/commands.c"
+static int dump_frame_section(elf_session_t *session, output_t *output, 
+# 1525 "src/commands.c" 3 4
+                                                                       _Bool 
+# 1525 "src/commands.c"
+                                                                            is_eh_frame, int machine)
+{
+    const char *name = is_eh_frame ? ".eh_frame" : ".debug_frame";
+    frame_section_t section;
+    range_index_t *index;
+    uint64_t offset = 0;
+    cie_t cie;
+    fde_t fde;
+
+
+    if(!get_session_frame_section(session, is_eh_frame, &section))
+    {
+        return 0;
+    }
+
+    append_string(output, "Contents of the ");
+    append_string(output, name);
+    append_string(output, " section:\n\n");
+
+    if(has_relocations(session, name))
+    {
+        append_string(output, "  Note: This section has relocations against it, but these have NOT been applied to this dump.\n");
+    }
+
+
+
+    cie.end_offset = 0;
+
+    while(offset < section.size)
+    {
+        uint64_t end_offset;
+
+        switch(read_frame_entry_type(&section, offset, &end_offset))
+        {
+            case FRAME_ENTRY_TERMINATOR:
+                append_char(output, '\n');
+                append_hex(output, offset, 8);
+                append_string(output, " ZERO terminator\n\n");
+                break;
+
+            case FRAME_ENTRY_CIE:
+                if(!read_cie(&section, offset, &cie))
+                {
+                    cie.end_offset = 0;
+                    fprintf(
+# 1569 "src/commands.c" 3 4
+                           stderr
+# 1569 "src/commands.c"
+                                 , "Error: corrupt CIE at offset 0x%lx of %s.\n", (unsigned long) offset, name);
+                    return -1;
+                }
+
+                stringify_debug_cie(output, &cie, section.address_size);
+                dump_cfa_instructions(output, &section, &cie, cie.instructions, cie.instructions_length, 0, machine);
+                break;
+
+            case FRAME_ENTRY_FDE:
+                if(!read_fde(&section, offset, &cie, &fde))
+                {
+                    fprintf(
+# 1580 "src/commands.c" 3 4
+                           stderr
+# 1580 "src/commands.c"
+                                 , "Error: corrupt FDE at offset 0x%lx of %s.\n", (unsigned long) offset, name);
+                    return -1;
+                }
+
+                stringify_debug_fde(output, &fde, section.address_size);
+                dump_cfa_instructions(output, &section, &cie, fde.instructions, fde.instructions_length, fde.pc_begin, machine);
+                break;
+
+            default:
+                fprintf(
+# 1589 "src/commands.c" 3 4
+                       stderr
+# 1589 "src/commands.c"
+                             , "Error: corrupt entry at offset 0x%lx of %s.\n", (unsigned long) offset, name);
+                return -1;
+        }
+
+        offset = end_offset;
+    }
+
+    append_char(output, '\n');
+
+
+    if((index = get_session_fde_index(session, is_eh_frame)) != 
+# 1599 "src/commands.c" 3 4
+                                                               ((void *)0)
+# 1599 "src/commands.c"
+                                                                   )
+    {
+        stringify_fde_index(output, index, name, section.address_size);
+    }
+
+    return 0;
+}
+
+
+
+
+
+
+
+static int dump_debug_frames(elf_session_t *session, output_t *output)
+{
+    int machine = get_machine(session);
+
+    if(dump_frame_section(session, output, 
+# 1617 "src/commands.c" 3 4
+                                          1
+# 1617 "src/commands.c"
+                                              , machine) != 0)
+    {
+        return -1;
+    }
+
+    return dump_frame_section(session, output, 
+# 1622 "src/commands.c" 3 4
+                                              0
+# 1622 "src/commands.c"
+                                                   , machine);
+}
+# 1633 "src/commands.c"
+static void count_names_buckets(names_table_t *table, uint64_t *buckets_used, uint64_t *longest_bucket)
+{
+    *buckets_used = 0;
+    *longest_bucket = 0;
+
+    for(uint32_t bucket = 0; bucket < table->bucket_count; bucket++)
+    {
+        uint64_t number = get_names_table_value(table, table->buckets, bucket, 4);
+        uint64_t length = 0;
+
+        if(number == 0)
+            continue;
+
+        for(; number <= table->name_count; number++, length++)
+        {
+            if(get_names_table_value(table, table->hashes, number - 1, 4) % table->bucket_count != bucket)
+                break;
+        }
+
+        (*buckets_used)++;
+
+        if(length > *longest_bucket)
+            *longest_bucket = length;
+    }
+}
+
+
+
+
+
+
+static void dump_debug_name(output_t *output, names_table_t *table, uint64_t number, const unsigned char *str, uint64_t str_size)
+{
+    uint64_t string_offset = get_names_table_value(table, table->string_offsets, number - 1, table->offset_size);
+    uint64_t entry_offset = get_names_table_value(table, table->entry_offsets, number - 1, table->offset_size);
+    uint32_t hash = (table->bucket_count > 0) ? (uint32_t) get_names_table_value(table, table->hashes, number - 1, 4) : 0;
+    const unsigned char *position;
+    names_entry_t entry;
+
+
+    if(str == 
+# 1673 "src/commands.c" 3 4
+             ((void *)0)
+# 1673 "src/commands.c"
+                 )
+        stringify_debug_name(output, number, hash, table->bucket_count > 0, "<no .debug_str section>", 23);
+    else if(string_offset >= str_size)
+        stringify_debug_name(output, number, hash, table->bucket_count > 0, "<offset is too big>", 19);
+    else
+        stringify_debug_name(output, number, hash, table->bucket_count > 0, (const char*) str + string_offset,
+                             strnlen((const char*) str + string_offset, str_size - string_offset));
+
+    if(entry_offset >= (uint64_t) (table->end - table->entry_pool))
+    {
+        append_string(output, " <corrupt entry offset>\n");
+        return;
+    }
+
+    position = table->entry_pool + entry_offset;
+
+    while(
+# 1689 "src/commands.c" 3 4
+         1
+# 1689 "src/commands.c"
+             )
+    {
+        if(!read_names_entry(table, &position, &entry))
+        {
+            append_string(output, " <corrupt entry>");
+            break;
+        }
+
+        if(entry.abbrev == 
+# 1697 "src/commands.c" 3 4
+                          ((void *)0)
+# 1697 "src/commands.c"
+                              )
+            break;
+
+        stringify_debug_names_entry(output, &entry);
+    }
+
+    append_char(output, '\n');
+}
+# 1713 "src/commands.c"
+static int dump_debug_names(elf_session_t *session, output_t *output)
+{
+    const unsigned char *str;
+    unsigned char *section;
+    uint64_t size, str_size;
+    names_table_t table;
+
+
+    if((section = get_session_named_section(session, ".debug_names", &size, 
+# 1721 "src/commands.c" 3 4
+                                                                           ((void *)0)
+# 1721 "src/commands.c"
+                                                                               )) == 
+# 1721 "src/commands.c" 3 4
+                                                                                     ((void *)0)
+# 1721 "src/commands.c"
+                                                                                         )
+    {
+        return 0;
+    }
+
+    str = get_session_named_section(session, ".debug_str", &str_size, 
+# 1726 "src/commands.c" 3 4
+                                                                     ((void *)0)
+# 1726 "src/commands.c"
+                                                                         );
+
+    append_string(output, "Contents of the .debug_names section:\n\n");
+
+    if(has_relocations(session, ".debug_names"))
+    {
+        append_string(output, "  Note: This section has relocations against it, but these have NOT been applied to this dump.\n");
+    }
+
+
+    for(uint64_t offset = 0; offset < size; offset = table.end_offset)
+    {
+        if(!read_names_table(section, size, offset, &table))
+        {
+            release_names_table(&table);
+            fprintf(
+# 1741 "src/commands.c" 3 4
+                   stderr
+# 1741 "src/commands.c"
+                         , "Error: corrupt name index at offset 0x%lx of .debug_names.\n", (unsigned long) offset);
+            return -1;
+        }
+
+        stringify_debug_names_header(output, &table);
+
+        if(table.bucket_count > 0)
+        {
+            uint64_t buckets_used, longest_bucket;
+
+            count_names_buckets(&table, &buckets_used, &longest_bucket);
+            stringify_debug_names_buckets(output, &table, buckets_used, longest_bucket);
+        }
+
+        append_string(output, "  Symbol table:\n");
+
+        for(uint64_t number = 1; number <= table.name_count; number++)
+        {
+            dump_debug_name(output, &table, number, str, str_size);
+        }
+
+        append_char(output, '\n');
+
+        release_names_table(&table);
+    }
+
+    return 0;
+}
+
+
+
+int dump_debug_info(elf_session_t *session, output_t *output, debug_command_subtype subtype, int dwarf_depth,
+                    thread_pool_t *pool, uint64_t parallel_dump_threshold)
+{
+    switch(subtype)
+    {
+        case DBG_CMD_DUMP_ABBREV:
+            return dump_debug_abbrev(session, output);
+
+        case DBG_CMD_DUMP_INFO:
+            return dump_debug_info_units(session, output, dwarf_depth, pool, parallel_dump_threshold);
+
+        case DBG_CMD_DUMP_ARANGES:
+            return dump_debug_aranges(session, output);
+
+        case DBG_CMD_DUMP_FRAMES:
+            return dump_debug_frames(session, output);
+
+        case DBG_CMD_DUMP_NAMES:
+            return dump_debug_names(session, output);
+
+        default:
+            fprintf(
+# 1793 "src/commands.c" 3 4
+                   stderr
+# 1793 "src/commands.c"
+                         , "TODO: Dump a section of debugging symbols.\n");
+            return -1;
+    }
+}
+# 1806 "src/commands.c"
+int lookup_symbols(elf_session_t *session, output_t *output, char *symbol_names)
+{
+    symbol_index_t *index;
+    char *name = symbol_names;
+
+
+    if(session->file_class != 1 && session->file_class != 2)
+    {
+        append_string(output, "ELF file has no class.\n");
+        return -1;
+    }
+
+    if((index = get_session_symbol_index(session)) == 
+# 1818 "src/commands.c" 3 4
+                                                     ((void *)0)
+# 1818 "src/commands.c"
+                                                         )
+    {
+        fprintf(
+# 1820 "src/commands.c" 3 4
+               stderr
+# 1820 "src/commands.c"
+                     , "Unable to build symbol index.\n");
+        return -1;
+    }
+
+
+    stringify_symbol_lookup_title(output, index);
+
+    while(*name != '\0')
+    {
+        size_t length = strcspn(name, ",");
+        int64_t symbol_number;
+
+        if(length > 0)
+        {
+            symbol_number = find_symbol(index, name, length);
+
+            if(symbol_number < 0)
+                stringify_missing_symbol(output, name, length);
+            else if(session->file_class == 2)
+                stringify_ELF64_symbol(output, &index->symbols, symbol_number);
+            else
+                stringify_ELF32_symbol(output, &index->symbols, symbol_number);
+        }
+
+        name += length;
+
+        if(*name == ',')
+            name++;
+    }
+
+
+    return 0;
+}
+# 1866 "src/commands.c"
+int resolve_addresses(elf_session_t *session, output_t *output)
+{
+    address_index_t *index;
+    input_t input;
+    string_view_t token;
+
+
+    if(session->file_class != 1 && session->file_class != 2)
+    {
+        append_string(output, "ELF file has no class.\n");
+        return -1;
+    }
+
+    if((index = get_session_address_index(session)) == 
+# 1879 "src/commands.c" 3 4
+                                                      ((void *)0)
+# 1879 "src/commands.c"
+                                                          )
+    {
+        fprintf(
+# 1881 "src/commands.c" 3 4
+               stderr
+# 1881 "src/commands.c"
+                     , "Unable to build address index.\n");
+        return -1;
+    }
+
+
+    init_input(&input, 
+# 1886 "src/commands.c" 3 4
+                      0
+# 1886 "src/commands.c"
+                                  );
+
+    while(read_token(&input, &token))
+    {
+        uint64_t address;
+        string_view_t *name;
+        int64_t range;
+
+        if(!parse_address(token, &address))
+        {
+            append_bytes(output, token.string, token.length);
+            append_string(output, "\tinvalid address\n");
+            continue;
+        }
+
+        append_string(output, "0x");
+        append_hex(output, address, 0);
+        append_char(output, '\t');
+
+        if((range = find_range(index->ranges, address)) < 0)
+        {
+            append_string(output, "??\n");
+            continue;
+        }
+
+        name = &index->names[index->ranges->payloads[range]];
+
+        append_bytes(output, name->string, name->length);
+        append_string(output, "+0x");
+        append_hex(output, address - index->ranges->starts[range], 0);
+        append_char(output, '\n');
+    }
+
+    release_input(&input);
+
+
+    return 0;
+}
+# 1934 "src/commands.c"
+static const char *get_unit_name(const unsigned char *info, uint64_t info_size, uint64_t offset,
+                                 abbrev_cache_t *abbrevs, debug_strings_t *strings, uint64_t *length)
+{
+    abbrev_table_t *table;
+    debug_strings_t unit_strings = *strings;
+    unit_header_t unit;
+    die_reader_t reader;
+    die_t die;
+
+
+    if(!read_unit_header(info, info_size, offset, &unit) || (table = get_abbrev_table(abbrevs, unit.abbrev_offset)) == 
+# 1944 "src/commands.c" 3 4
+                                                                                                                      ((void *)0)
+# 1944 "src/commands.c"
+                                                                                                                          )
+    {
+        return 
+# 1946 "src/commands.c" 3 4
+              ((void *)0)
+# 1946 "src/commands.c"
+                  ;
+    }
+
+    read_unit_bases(info, &unit, table, &unit_strings);
+    init_die_reader(&reader, info, &unit, table);
+
+    if(read_die(&reader, &die) != DIE_OK || die.abbrev == 
+# 1952 "src/commands.c" 3 4
+                                                         ((void *)0)
+# 1952 "src/commands.c"
+                                                             )
+    {
+        return 
+# 1954 "src/commands.c" 3 4
+              ((void *)0)
+# 1954 "src/commands.c"
+                  ;
+    }
+
+    for(uint32_t i = 0; i < die.abbrev->num_attributes; i++)
+    {
+        attribute_value_t value;
+
+        if(die.abbrev->attributes[i].name == 0x03)
+        {
+            return read_attribute(&reader, &die.abbrev->attributes[i], &value) ? get_attribute_string(&value, &unit_strings, length) : 
+# 1963 "src/commands.c" 3 4
+                                                                                                                                      ((void *)0)
+# 1963 "src/commands.c"
+                                                                                                                                          ;
+        }
+
+        if(!skip_attributes(&reader, &die.abbrev->attributes[i], 1))
+        {
+            return 
+# 1968 "src/commands.c" 3 4
+                  ((void *)0)
+# 1968 "src/commands.c"
+                      ;
+        }
+    }
+
+    return 
+# 1972 "src/commands.c" 3 4
+          ((void *)0)
+# 1972 "src/commands.c"
+              ;
+}
+# 1984 "src/commands.c"
+int resolve_unit_addresses(elf_session_t *session, output_t *output)
+{
+    range_index_t *index;
+    abbrev_cache_t *abbrevs;
+    debug_strings_t strings;
+    unsigned char *info;
+    uint64_t info_size;
+    input_t input;
+    string_view_t token;
+
+
+    if((index = get_session_unit_address_index(session)) == 
+# 1995 "src/commands.c" 3 4
+                                                           ((void *)0)
+# 1995 "src/commands.c"
+                                                               )
+    {
+        fprintf(
+# 1997 "src/commands.c" 3 4
+               stderr
+# 1997 "src/commands.c"
+                     , "No .debug_aranges section to find units by address with.\n");
+        return -1;
+    }
+
+    info = get_session_named_section(session, ".debug_info", &info_size, 
+# 2001 "src/commands.c" 3 4
+                                                                        ((void *)0)
+# 2001 "src/commands.c"
+                                                                            );
+    abbrevs = get_session_abbrev_cache(session);
+    get_debug_strings(session, &strings);
+
+
+    init_input(&input, 
+# 2006 "src/commands.c" 3 4
+                      0
+# 2006 "src/commands.c"
+                                  );
+
+    while(read_token(&input, &token))
+    {
+        const char *name = 
+# 2010 "src/commands.c" 3 4
+                          ((void *)0)
+# 2010 "src/commands.c"
+                              ;
+        uint64_t address, length;
+        int64_t range;
+
+        if(!parse_address(token, &address))
+        {
+            append_bytes(output, token.string, token.length);
+            append_string(output, "\tinvalid address\n");
+            continue;
+        }
+
+        append_string(output, "0x");
+        append_hex(output, address, 0);
+        append_char(output, '\t');
+
+        if((range = find_range(index, address)) < 0)
+        {
+            append_string(output, "??\n");
+            continue;
+        }
+
+        append_string(output, "0x");
+        append_hex(output, index->payloads[range], 0);
+
+        if(info != 
+# 2034 "src/commands.c" 3 4
+                  ((void *)0) 
+# 2034 "src/commands.c"
+                       && abbrevs != 
+# 2034 "src/commands.c" 3 4
+                                     ((void *)0)
+# 2034 "src/commands.c"
+                                         )
+        {
+            name = get_unit_name(info, info_size, index->payloads[range], abbrevs, &strings, &length);
+        }
+
+        if(name != 
+# 2039 "src/commands.c" 3 4
+                  ((void *)0)
+# 2039 "src/commands.c"
+                      )
+        {
+            append_char(output, '\t');
+            append_bytes(output, name, length);
+        }
+
+        append_char(output, '\n');
+    }
+
+    release_input(&input);
+
+
+    return 0;
+}
+# 2061 "src/commands.c"
+static void append_fde_match(output_t *output, uint64_t address, uint64_t fde_offset, uint64_t start, uint64_t end)
+{
+    append_string(output, "0x");
+    append_hex(output, address, 0);
+    append_string(output, "\t0x");
+    append_hex(output, fde_offset, 0);
+    append_string(output, "\t0x");
+    append_hex(output, start, 0);
+    append_string(output, "..0x");
+    append_hex(output, end, 0);
+    append_char(output, '\n');
+}
+# 2081 "src/commands.c"
+static 
+# 2081 "src/commands.c" 3 4
+      _Bool 
+# 2081 "src/commands.c"
+           find_fde_through_header(eh_frame_hdr_t *header, frame_section_t *eh_frame, cie_t *cie,
+                                    uint64_t address, fde_t *fde)
+{
+    uint64_t fde_address;
+
+
+    if(find_eh_frame_hdr_entry(header, address, &fde_address) < 0 ||
+       fde_address < eh_frame->address || fde_address - eh_frame->address >= eh_frame->size)
+    {
+        return 
+# 2090 "src/commands.c" 3 4
+              0
+# 2090 "src/commands.c"
+                   ;
+    }
+
+    if(!read_fde(eh_frame, fde_address - eh_frame->address, cie, fde))
+    {
+        return 
+# 2095 "src/commands.c" 3 4
+              0
+# 2095 "src/commands.c"
+                   ;
+    }
+
+    return address >= fde->pc_begin && address - fde->pc_begin < fde->pc_range;
+}
+# 2114 "src/commands.c"
+int find_fdes(elf_session_t *session, output_t *output, char *addresses)
+{
+    frame_section_t header_section, eh_frame;
+    eh_frame_hdr_t header;
+    range_index_t *index = 
+# 2118 "src/commands.c" 3 4
+                          ((void *)0)
+# 2118 "src/commands.c"
+                              ;
+    
+# 2119 "src/commands.c" 3 4
+   _Bool 
+# 2119 "src/commands.c"
+        use_header = 
+# 2119 "src/commands.c" 3 4
+                     0
+# 2119 "src/commands.c"
+                          ;
+    
+# 2120 "src/commands.c" 3 4
+   _Bool 
+# 2120 "src/commands.c"
+        is_eh_frame = 
+# 2120 "src/commands.c" 3 4
+                      1
+# 2120 "src/commands.c"
+                          ;
+    char *token = addresses;
+    cie_t cie;
+    fde_t fde;
+
+
+    if(session->file_class != 1 && session->file_class != 2)
+    {
+        append_string(output, "ELF file has no class.\n");
+        return -1;
+    }
+
+    header_section.is_eh_frame = 
+# 2132 "src/commands.c" 3 4
+                                1
+# 2132 "src/commands.c"
+                                    ;
+    header_section.address_size = (session->file_class == 1) ? 4 : 8;
+    header_section.data = get_session_named_section(session, ".eh_frame_hdr", &header_section.size, &header_section.address);
+
+    if(header_section.data != 
+# 2136 "src/commands.c" 3 4
+                             ((void *)0) 
+# 2136 "src/commands.c"
+                                  && get_session_frame_section(session, 
+# 2136 "src/commands.c" 3 4
+                                                                        1
+# 2136 "src/commands.c"
+                                                                            , &eh_frame))
+    {
+        use_header = read_eh_frame_hdr(&header_section, &header);
+    }
+
+    if(!use_header)
+    {
+        if((index = get_session_fde_index(session, 
+# 2143 "src/commands.c" 3 4
+                                                  1
+# 2143 "src/commands.c"
+                                                      )) == 
+# 2143 "src/commands.c" 3 4
+                                                            ((void *)0)
+# 2143 "src/commands.c"
+                                                                )
+        {
+            is_eh_frame = 
+# 2145 "src/commands.c" 3 4
+                         0
+# 2145 "src/commands.c"
+                              ;
+            index = get_session_fde_index(session, 
+# 2146 "src/commands.c" 3 4
+                                                  0
+# 2146 "src/commands.c"
+                                                       );
+        }
+
+        if(index == 
+# 2149 "src/commands.c" 3 4
+                   ((void *)0)
+# 2149 "src/commands.c"
+                       )
+        {
+            fprintf(
+# 2151 "src/commands.c" 3 4
+                   stderr
+# 2151 "src/commands.c"
+                         , "No .eh_frame or .debug_frame section to find FDEs in.\n");
+            return -1;
+        }
+    }
+
+
+    if(use_header)
+        append_string(output, "FDEs found through the search table of .eh_frame_hdr:\n");
+    else
+        append_string(output, is_eh_frame ? "FDEs found through an index of .eh_frame:\n" : "FDEs found through an index of .debug_frame:\n");
+
+    cie.end_offset = 0;
+
+    while(*token != '\0')
+    {
+        size_t length = strcspn(token, ",");
+        string_view_t address_string = {token, length};
+        uint64_t address;
+        int64_t entry;
+
+        if(length > 0)
+        {
+            if(!parse_address(address_string, &address))
+            {
+                append_bytes(output, token, length);
+                append_string(output, "\tinvalid address\n");
+            }
+            else if(use_header && find_fde_through_header(&header, &eh_frame, &cie, address, &fde))
+            {
+                append_fde_match(output, address, fde.offset, fde.pc_begin, fde.pc_begin + fde.pc_range);
+            }
+            else if(!use_header && (entry = find_range(index, address)) >= 0)
+            {
+                append_fde_match(output, address, index->payloads[entry], index->starts[entry], index->ends[entry]);
+            }
+            else
+            {
+                append_string(output, "0x");
+                append_hex(output, address, 0);
+                append_string(output, "\t??\n");
+            }
+        }
+
+        token += length;
+
+        if(*token == ',')
+            token++;
+    }
+
+
+    return 0;
+}
+# 2214 "src/commands.c"
+int find_debug_names(elf_session_t *session, output_t *output, char *names)
+{
+    names_index_t *index;
+    const unsigned char *str;
+    uint64_t str_size;
+    char *name = names;
+
+
+    if((index = get_session_names_index(session)) == 
+# 2222 "src/commands.c" 3 4
+                                                    ((void *)0)
+# 2222 "src/commands.c"
+                                                        )
+    {
+        fprintf(
+# 2224 "src/commands.c" 3 4
+               stderr
+# 2224 "src/commands.c"
+                     , "No .debug_names section to find names in.\n");
+        return -1;
+    }
+
+    str = get_session_named_section(session, ".debug_str", &str_size, 
+# 2228 "src/commands.c" 3 4
+                                                                     ((void *)0)
+# 2228 "src/commands.c"
+                                                                         );
+
+
+    while(*name != '\0')
+    {
+        size_t length = strcspn(name, ",");
+        
+# 2234 "src/commands.c" 3 4
+       _Bool 
+# 2234 "src/commands.c"
+            found = 
+# 2234 "src/commands.c" 3 4
+                    0
+# 2234 "src/commands.c"
+                         ;
+
+        for(uint64_t i = 0; i < index->num_tables && length > 0; i++)
+        {
+            names_table_t *table = &index->tables[i];
+            int64_t number = find_debug_name(table, str, str_size, name, length);
+            const unsigned char *position;
+            uint64_t entry_offset, die_offset;
+            names_entry_t entry;
+
+            if(number < 0)
+                continue;
+
+            entry_offset = get_names_table_value(table, table->entry_offsets, number - 1, table->offset_size);
+
+            if(entry_offset >= (uint64_t) (table->end - table->entry_pool))
+                continue;
+
+            position = table->entry_pool + entry_offset;
+
+            while(read_names_entry(table, &position, &entry) && entry.abbrev != 
+# 2254 "src/commands.c" 3 4
+                                                                               ((void *)0)
+# 2254 "src/commands.c"
+                                                                                   )
+            {
+                if(get_names_entry_die(table, &entry, &die_offset))
+                {
+                    stringify_debug_name_match(output, name, length, die_offset, entry.abbrev->tag);
+                    found = 
+# 2259 "src/commands.c" 3 4
+                           1
+# 2259 "src/commands.c"
+                               ;
+                }
+            }
+        }
+
+        if(length > 0 && !found)
+        {
+            append_bytes(output, name, length);
+            append_string(output, "\t??\n");
+        }
+
+        name += length;
+
+        if(*name == ',')
+            name++;
+    }
+
+
+    return 0;
+}
@@ -0,0 +1,4484 @@
+# 0 "src/lookup.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/lookup.c"
+# 12 "src/lookup.c"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 39 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 909 "/usr/include/stdio.h" 3 4
+
+# 13 "src/lookup.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 59 "/usr/include/stdlib.h" 3 4
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+# 114 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 14 "src/lookup.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 15 "src/lookup.c" 2
+
+
+# 1 "include/lookup.h" 1
+# 11 "include/lookup.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 12 "include/lookup.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 13 "include/lookup.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 14 "include/lookup.h" 2
+
+
+# 1 "include/elf.h" 1
+# 20 "include/elf.h"
+
+# 20 "include/elf.h"
+typedef uint8_t BYTE;
+# 40 "include/elf.h"
+typedef uint32_t ELF32_Addr_t;
+
+
+
+typedef uint16_t ELF32_Half_t;
+
+
+
+typedef uint32_t ELF32_Off_t;
+
+
+typedef int32_t ELF32_Sword_t;
+
+typedef uint32_t ELF32_Word_t;
+
+
+
+
+
+
+
+typedef struct
+{
+
+
+
+
+
+    unsigned char e_ident[16];
+
+
+
+
+
+
+    ELF32_Half_t e_type;
+
+
+
+
+
+    ELF32_Half_t e_machine;
+
+
+
+
+
+    ELF32_Word_t e_version;
+# 96 "include/elf.h"
+    ELF32_Addr_t e_entry;
+
+
+
+
+
+
+
+    ELF32_Off_t e_phoff;
+
+
+
+
+
+
+
+    ELF32_Off_t e_shoff;
+
+
+
+
+
+    ELF32_Word_t e_flags;
+
+
+
+
+
+    ELF32_Half_t e_ehsize;
+
+
+
+
+
+
+
+    ELF32_Half_t e_phentsize;
+# 142 "include/elf.h"
+    ELF32_Half_t e_phnum;
+
+
+
+
+
+
+
+    ELF32_Half_t e_shentsize;
+# 160 "include/elf.h"
+    ELF32_Half_t e_shnum;
+
+
+
+
+
+
+
+    ELF32_Half_t e_shstrndx;
+
+
+
+} ELF32_Header_t;
+# 193 "include/elf.h"
+typedef uint64_t ELF64_Addr_t;
+
+
+
+typedef uint16_t ELF64_Half_t;
+
+
+
+typedef uint64_t ELF64_Off_t;
+
+
+typedef int32_t ELF64_Sword_t;
+
+typedef uint32_t ELF64_Word_t;
+
+
+
+typedef uint64_t ELF64_Xword_t;
+
+typedef int64_t ELF64_Sxword_t;
+
+
+
+
+
+
+typedef struct
+{
+
+
+
+
+
+    unsigned char e_ident[16];
+
+
+
+
+
+
+    ELF64_Half_t e_type;
+
+
+
+
+
+    ELF64_Half_t e_machine;
+
+
+
+
+
+    ELF64_Word_t e_version;
+# 254 "include/elf.h"
+    ELF64_Addr_t e_entry;
+
+
+
+
+
+
+
+    ELF64_Off_t e_phoff;
+
+
+
+
+
+
+
+    ELF64_Off_t e_shoff;
+
+
+
+
+
+    ELF64_Word_t e_flags;
+
+
+
+
+
+    ELF64_Half_t e_ehsize;
+
+
+
+
+
+
+
+    ELF64_Half_t e_phentsize;
+# 300 "include/elf.h"
+    ELF64_Half_t e_phnum;
+
+
+
+
+
+
+
+    ELF64_Half_t e_shentsize;
+# 318 "include/elf.h"
+    ELF64_Half_t e_shnum;
+
+
+
+
+
+
+
+    ELF64_Half_t e_shstrndx;
+
+
+
+} ELF64_Header_t;
+# 497 "include/elf.h"
+typedef struct
+{
+# 508 "include/elf.h"
+    ELF32_Word_t sh_name;
+
+
+
+
+
+
+    ELF32_Word_t sh_type;
+# 524 "include/elf.h"
+    ELF32_Word_t sh_flags;
+# 535 "include/elf.h"
+    ELF32_Addr_t sh_addr;
+# 546 "include/elf.h"
+    ELF32_Off_t sh_offset;
+# 556 "include/elf.h"
+    ELF32_Word_t sh_size;
+
+
+
+
+
+
+
+    ELF32_Word_t sh_link;
+
+
+
+
+
+
+    ELF32_Word_t sh_info;
+# 583 "include/elf.h"
+    ELF32_Word_t sh_addralign;
+# 593 "include/elf.h"
+    ELF32_Word_t sh_entsize;
+
+
+
+} ELF32_Section_Header_t;
+# 607 "include/elf.h"
+typedef struct
+{
+# 618 "include/elf.h"
+    ELF64_Word_t sh_name;
+
+
+
+
+
+
+    ELF64_Word_t sh_type;
+# 634 "include/elf.h"
+    ELF64_Xword_t sh_flags;
+# 645 "include/elf.h"
+    ELF64_Addr_t sh_addr;
+# 656 "include/elf.h"
+    ELF64_Off_t sh_offset;
+# 666 "include/elf.h"
+    ELF64_Xword_t sh_size;
+
+
+
+
+
+
+
+    ELF64_Word_t sh_link;
+
+
+
+
+
+
+    ELF64_Word_t sh_info;
+# 693 "include/elf.h"
+    ELF64_Xword_t sh_addralign;
+# 703 "include/elf.h"
+    ELF64_Xword_t sh_entsize;
+
+
+
+} ELF64_Section_Header_t;
+# 849 "include/elf.h"
+typedef struct
+{
+# 859 "include/elf.h"
+    ELF32_Word_t st_name;
+# 877 "include/elf.h"
+    ELF32_Addr_t st_value;
+
+
+
+
+
+
+
+    ELF32_Word_t st_size;
+# 894 "include/elf.h"
+    unsigned char st_info;
+
+
+
+
+
+
+    unsigned char st_other;
+# 911 "include/elf.h"
+    ELF32_Half_t st_shndx;
+
+
+} ELF32_Sym_t;
+
+
+
+typedef struct
+{
+# 934 "include/elf.h"
+    ELF64_Word_t st_name;
+# 943 "include/elf.h"
+    unsigned char st_info;
+
+
+
+
+
+
+    unsigned char st_other;
+# 960 "include/elf.h"
+    ELF64_Half_t st_shndx;
+# 978 "include/elf.h"
+    ELF64_Addr_t st_value;
+
+
+
+
+
+
+
+    ELF64_Xword_t st_size;
+
+
+} ELF64_Sym_t;
+# 1196 "include/elf.h"
+typedef struct
+{
+# 1208 "include/elf.h"
+    ELF32_Addr_t r_offset;
+# 1217 "include/elf.h"
+    ELF32_Word_t r_info;
+
+
+} ELF32_Rel_t;
+
+
+
+
+
+
+typedef struct
+{
+
+
+
+
+    ELF32_Addr_t r_offset;
+
+
+
+
+
+    ELF32_Word_t r_info;
+
+
+
+
+
+
+    ELF32_Sword_t r_addend;
+
+
+} ELF32_Rela_t;
+# 1276 "include/elf.h"
+typedef struct
+{
+# 1288 "include/elf.h"
+    ELF64_Addr_t r_offset;
+# 1297 "include/elf.h"
+    ELF64_Xword_t r_info;
+
+
+} ELF64_Rel_t;
+
+
+
+
+
+
+typedef struct
+{
+
+
+
+
+    ELF64_Addr_t r_offset;
+
+
+
+
+
+    ELF64_Xword_t r_info;
+
+
+
+
+
+
+    ELF64_Sxword_t r_addend;
+
+
+} ELF64_Rela_t;
+# 1363 "include/elf.h"
+typedef struct
+{
+
+
+
+
+
+
+    ELF32_Word_t p_type;
+
+
+
+
+
+
+    ELF32_Off_t p_offset;
+
+
+
+
+
+
+    ELF32_Addr_t p_vaddr;
+
+
+
+
+
+
+
+    ELF32_Addr_t p_paddr;
+
+
+
+
+
+
+    ELF32_Word_t p_filesz;
+
+
+
+
+
+
+
+    ELF32_Word_t p_memsz;
+
+
+
+
+
+    ELF32_Word_t p_flags;
+
+
+
+
+
+    ELF32_Word_t p_align;
+
+
+} ELF32_Program_Header_t;
+
+
+
+
+typedef struct
+{
+
+
+
+
+
+
+    ELF64_Word_t p_type;
+
+
+
+
+
+    ELF64_Word_t p_flags;
+
+
+
+
+
+
+    ELF64_Off_t p_offset;
+
+
+
+
+
+
+    ELF64_Addr_t p_vaddr;
+
+
+
+
+
+
+
+    ELF64_Addr_t p_paddr;
+
+
+
+
+
+
+    ELF64_Xword_t p_filesz;
+
+
+
+
+
+
+
+    ELF64_Xword_t p_memsz;
+
+
+
+
+
+    ELF64_Xword_t p_align;
+
+
+} ELF64_Program_Header_t;
+# 1568 "include/elf.h"
+typedef struct
+{
+
+    ELF32_Sword_t d_tag;
+
+
+
+
+
+    union
+    {
+        ELF32_Word_t d_val;
+        ELF32_Addr_t d_ptr;
+    } d_un;
+
+} ELF32_Dyn_t;
+
+
+
+typedef struct
+{
+
+    ELF64_Sxword_t d_tag;
+
+
+
+
+
+    union
+    {
+        ELF64_Xword_t d_val;
+        ELF64_Addr_t d_ptr;
+    } d_un;
+
+} ELF64_Dyn_t;
+# 17 "include/lookup.h" 2
+# 1 "include/readelf.h" 1
+# 13 "include/readelf.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 14 "include/readelf.h" 2
+# 32 "include/readelf.h"
+typedef struct
+{
+
+    int file_descriptor;
+
+
+    size_t size;
+
+
+    unsigned char *data;
+
+} elf_image_t;
+# 53 "include/readelf.h"
+typedef struct
+{
+    char *string;
+    size_t length;
+
+} string_view_t;
+# 68 "include/readelf.h"
+typedef struct
+{
+
+    int num_names;
+
+
+    size_t max_length;
+
+
+    string_view_t *names;
+
+} section_name_table_t;
+# 94 "include/readelf.h"
+typedef struct
+{
+    int num_segments;
+    int *segment_start;
+    int *section_indices;
+
+} section_to_segment_mapping_t;
+# 111 "include/readelf.h"
+typedef struct
+{
+
+    void *symbols;
+    uint64_t num_symbols;
+
+    char *string_table;
+    uint64_t string_table_size;
+
+} symbol_table_t;
+# 129 "include/readelf.h"
+typedef struct
+{
+
+    void *entries;
+    uint64_t num_entries;
+
+
+    
+# 136 "include/readelf.h" 3 4
+   _Bool 
+# 136 "include/readelf.h"
+        has_addends;
+
+
+    
+# 139 "include/readelf.h" 3 4
+   _Bool 
+# 139 "include/readelf.h"
+        has_symbols;
+    symbol_table_t symbols;
+
+} relocation_table_t;
+
+
+
+int open_elf_image(elf_image_t *image, const char *filename);
+void close_elf_image(elf_image_t *image);
+void *get_image_range(elf_image_t *image, uint64_t offset, uint64_t size);
+void *get_aligned_image_range(elf_image_t *image, uint64_t offset, uint64_t size, uint64_t alignment);
+
+# 150 "include/readelf.h" 3 4
+_Bool 
+# 150 "include/readelf.h"
+    is_aligned(const void *pointer, uint64_t alignment);
+
+
+
+string_view_t get_string_table_entry(char *string_table, uint64_t string_table_size, uint64_t offset);
+void release_section_name_table(section_name_table_t *section_names);
+void release_section_to_segment_mapping(section_to_segment_mapping_t *mapping);
+
+
+
+int read_ELF_identification(elf_image_t *image, unsigned char *buffer);
+
+# 161 "include/readelf.h" 3 4
+_Bool 
+# 161 "include/readelf.h"
+    has_ELF_magic(elf_image_t *image);
+int get_file_class(elf_image_t *image);
+
+
+
+ELF32_Header_t *get_ELF32_header(elf_image_t *image);
+
+ELF32_Section_Header_t *get_ELF32_section_header(elf_image_t *image, int index);
+ELF32_Section_Header_t *get_ELF32_section_header_table(elf_image_t *image);
+int get_ELF32_num_sections(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+uint32_t get_ELF32_section_string_table_index(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+
+ELF32_Program_Header_t *get_ELF32_program_header(elf_image_t *image, int index);
+ELF32_Program_Header_t *get_ELF32_program_header_table(elf_image_t *image);
+
+section_name_table_t *get_ELF32_section_names(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+section_to_segment_mapping_t *get_ELF32_section_to_segment_mapping(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                                                                   ELF32_Program_Header_t *program_header_table);
+
+int get_ELF32_symbol_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                           int section_index, symbol_table_t *symbol_table);
+int get_ELF32_relocation_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                               int section_index, relocation_table_t *relocation_table);
+
+void *get_ELF32_address_range(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Program_Header_t *program_header_table,
+                              uint64_t address, uint64_t size);
+ELF32_Dyn_t *get_ELF32_dynamic_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Program_Header_t *program_header_table,
+                                     uint64_t *num_entries);
+
+# 189 "include/readelf.h" 3 4
+_Bool 
+# 189 "include/readelf.h"
+    *get_ELF32_relocated_sections(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+
+
+
+ELF64_Header_t *get_ELF64_header(elf_image_t *image);
+
+ELF64_Section_Header_t *get_ELF64_section_header(elf_image_t *image, int index);
+ELF64_Section_Header_t *get_ELF64_section_header_table(elf_image_t *image);
+int get_ELF64_num_sections(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+uint32_t get_ELF64_section_string_table_index(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+
+ELF64_Program_Header_t *get_ELF64_program_header(elf_image_t *image, int index);
+ELF64_Program_Header_t *get_ELF64_program_header_table(elf_image_t *image);
+
+section_name_table_t *get_ELF64_section_names(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+section_to_segment_mapping_t *get_ELF64_section_to_segment_mapping(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                                                                   ELF64_Program_Header_t *program_header_table);
+
+int get_ELF64_symbol_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                           int section_index, symbol_table_t *symbol_table);
+int get_ELF64_relocation_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                               int section_index, relocation_table_t *relocation_table);
+
+void *get_ELF64_address_range(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Program_Header_t *program_header_table,
+                              uint64_t address, uint64_t size);
+ELF64_Dyn_t *get_ELF64_dynamic_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Program_Header_t *program_header_table,
+                                     uint64_t *num_entries);
+
+# 216 "include/readelf.h" 3 4
+_Bool 
+# 216 "include/readelf.h"
+    *get_ELF64_relocated_sections(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+# 18 "include/lookup.h" 2
+# 1 "include/ranges.h" 1
+# 21 "include/ranges.h"
+typedef struct
+{
+    uint64_t start;
+    uint64_t end;
+    uint64_t payload;
+
+} range_t;
+# 39 "include/ranges.h"
+typedef enum
+{
+    RANGES_KEEP_FIRST,
+    RANGES_MERGE
+
+} range_overlap_t;
+# 55 "include/ranges.h"
+typedef struct
+{
+    uint64_t num_ranges;
+
+
+    uint64_t *starts;
+
+
+    uint64_t *ends;
+
+
+    uint64_t *payloads;
+
+} range_index_t;
+
+
+
+void sort_ranges(range_t *ranges, uint64_t num_ranges);
+range_index_t *build_range_index(const range_t *ranges, uint64_t num_ranges, range_overlap_t overlap);
+void release_range_index(range_index_t *index);
+int64_t find_range(range_index_t *index, uint64_t address);
+# 19 "include/lookup.h" 2
+
+
+
+
+
+
+typedef enum
+{
+
+    LOOKUP_GNU_HASH,
+
+
+    LOOKUP_SYSV_HASH,
+
+
+    LOOKUP_BUILT_HASH
+
+} lookup_method_t;
+# 49 "include/lookup.h"
+typedef struct
+{
+    lookup_method_t method;
+
+
+    int file_class;
+
+
+    symbol_table_t symbols;
+    string_view_t table_name;
+
+
+    uint16_t *versions;
+
+
+
+
+
+
+    uint32_t num_gnu_buckets;
+    uint32_t symbol_offset;
+    uint32_t bloom_size;
+    uint32_t bloom_shift;
+    void *bloom;
+    uint32_t *gnu_buckets;
+    uint32_t *gnu_chain;
+
+
+
+    uint32_t num_sysv_buckets;
+    uint32_t *sysv_buckets;
+    uint32_t *sysv_chain;
+# 89 "include/lookup.h"
+    uint32_t *slot_symbols;
+    uint32_t *slot_hashes;
+    uint64_t slot_mask;
+
+} symbol_index_t;
+# 103 "include/lookup.h"
+typedef struct
+{
+    range_index_t *ranges;
+
+
+    string_view_t *names;
+
+} address_index_t;
+# 122 "include/lookup.h"
+typedef struct
+{
+    section_name_table_t *section_names;
+
+
+    int *sections;
+
+
+
+
+
+
+    uint32_t *slot_starts;
+    uint32_t *slot_counts;
+    uint32_t *slot_hashes;
+    uint64_t slot_mask;
+
+} section_name_index_t;
+
+
+
+symbol_index_t *build_ELF32_symbol_index(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                                         ELF32_Program_Header_t *program_header_table, section_name_table_t *section_names);
+symbol_index_t *build_ELF64_symbol_index(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                                         ELF64_Program_Header_t *program_header_table, section_name_table_t *section_names);
+void release_symbol_index(symbol_index_t *index);
+
+address_index_t *build_ELF32_address_index(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+address_index_t *build_ELF64_address_index(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+void release_address_index(address_index_t *index);
+
+section_name_index_t *build_section_name_index(section_name_table_t *section_names);
+void release_section_name_index(section_name_index_t *index);
+
+
+int64_t find_symbol(symbol_index_t *index, const char *name, size_t length);
+int find_sections(section_name_index_t *index, const char *name, size_t length, const int **sections);
+# 18 "src/lookup.c" 2
+
+
+
+
+
+
+
+static uint32_t gnu_hash(const char *name, size_t length)
+{
+    uint32_t hash = 5381;
+
+    for(size_t i = 0; i < length; i++)
+    {
+        hash = hash*33 + (unsigned char) name[i];
+    }
+
+    return hash;
+}
+
+
+
+
+
+
+static uint32_t sysv_hash(const char *name, size_t length)
+{
+    uint32_t hash = 0;
+    uint32_t high;
+
+    for(size_t i = 0; i < length; i++)
+    {
+        hash = (hash << 4) + (unsigned char) name[i];
+
+        if((high = hash & 0xf0000000) != 0)
+        {
+            hash ^= high >> 24;
+        }
+
+        hash &= ~high;
+    }
+
+    return hash;
+}
+
+
+
+
+
+
+
+static void read_symbol(symbol_index_t *index, uint64_t symbol_number, uint32_t *name, uint16_t *section_index, unsigned char *info)
+{
+    if(index->file_class == 2)
+    {
+        ELF64_Sym_t *symbol = &((ELF64_Sym_t*) index->symbols.symbols)[symbol_number];
+
+        *name = symbol->st_name;
+        *section_index = symbol->st_shndx;
+        *info = symbol->st_info;
+    }
+    else
+    {
+        ELF32_Sym_t *symbol = &((ELF32_Sym_t*) index->symbols.symbols)[symbol_number];
+
+        *name = symbol->st_name;
+        *section_index = symbol->st_shndx;
+        *info = symbol->st_info;
+    }
+}
+# 98 "src/lookup.c"
+static 
+# 98 "src/lookup.c" 3 4
+      _Bool 
+# 98 "src/lookup.c"
+           symbol_matches(symbol_index_t *index, uint64_t symbol_number, const char *name, size_t length)
+{
+    uint32_t name_offset;
+    uint16_t section_index;
+    unsigned char info;
+    string_view_t symbol_name;
+
+
+    if(symbol_number >= index->symbols.num_symbols)
+    {
+        return 
+# 108 "src/lookup.c" 3 4
+              0
+# 108 "src/lookup.c"
+                   ;
+    }
+
+    read_symbol(index, symbol_number, &name_offset, &section_index, &info);
+
+    if(section_index == 0)
+    {
+        return 
+# 115 "src/lookup.c" 3 4
+              0
+# 115 "src/lookup.c"
+                   ;
+    }
+
+    if(index->versions != 
+# 118 "src/lookup.c" 3 4
+                         ((void *)0) 
+# 118 "src/lookup.c"
+                              && (index->versions[symbol_number] & 0x8000))
+    {
+        return 
+# 120 "src/lookup.c" 3 4
+              0
+# 120 "src/lookup.c"
+                   ;
+    }
+
+    symbol_name = get_string_table_entry(index->symbols.string_table, index->symbols.string_table_size, name_offset);
+
+    return symbol_name.length == length && memcmp(symbol_name.string, name, length) == 0;
+}
+# 137 "src/lookup.c"
+static void build_hash_table(symbol_index_t *index)
+{
+    uint64_t num_slots = 16;
+
+
+    while(num_slots < 2*index->symbols.num_symbols)
+    {
+        num_slots *= 2;
+    }
+
+    index->slot_mask = num_slots - 1;
+    index->slot_symbols = (uint32_t*) calloc(num_slots, sizeof(uint32_t));
+    index->slot_hashes = (uint32_t*) malloc(num_slots * sizeof(uint32_t));
+
+
+    for(int pass = 0; pass < 2; pass++)
+    {
+        for(uint64_t i = 1; i < index->symbols.num_symbols; i++)
+        {
+            uint32_t name_offset;
+            uint16_t section_index;
+            unsigned char info;
+            string_view_t name;
+            uint32_t hash;
+            uint64_t slot;
+
+            read_symbol(index, i, &name_offset, &section_index, &info);
+
+
+            if((((info)>>4) == 0) != (pass == 1))
+            {
+                continue;
+            }
+
+            name = get_string_table_entry(index->symbols.string_table, index->symbols.string_table_size, name_offset);
+
+            if(section_index == 0 || name.length == 0)
+            {
+                continue;
+            }
+
+            hash = gnu_hash(name.string, name.length);
+
+            for(slot = hash & index->slot_mask; index->slot_symbols[slot] != 0; slot = (slot + 1) & index->slot_mask)
+                ;
+
+            index->slot_symbols[slot] = (uint32_t) i + 1;
+            index->slot_hashes[slot] = hash;
+        }
+    }
+}
+# 199 "src/lookup.c"
+static int use_ELF32_dynamic_hash_table(symbol_index_t *index, elf_image_t *image, ELF32_Header_t *file_header,
+                                         ELF32_Program_Header_t *program_header_table)
+{
+    ELF32_Dyn_t *dynamic_table;
+    uint64_t num_entries;
+
+    uint64_t gnu_hash_address = 0, sysv_hash_address = 0;
+    uint64_t symbol_table_address = 0, string_table_address = 0, string_table_size = 0;
+    uint64_t versions_address = 0;
+
+    uint64_t num_symbols;
+
+
+    if((dynamic_table = get_ELF32_dynamic_table(image, file_header, program_header_table, &num_entries)) == 
+# 212 "src/lookup.c" 3 4
+                                                                                                           ((void *)0)
+# 212 "src/lookup.c"
+                                                                                                               )
+    {
+        return -1;
+    }
+
+    for(uint64_t i = 0; i < num_entries; i++)
+    {
+        switch(dynamic_table[i].d_tag)
+        {
+            case 0x6ffffef5:
+                gnu_hash_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case 4:
+                sysv_hash_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case 6:
+                symbol_table_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case 5:
+                string_table_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case 10:
+                string_table_size = dynamic_table[i].d_un.d_val;
+                break;
+            case 0x6ffffff0:
+                versions_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if(symbol_table_address == 0 || string_table_address == 0 || (gnu_hash_address == 0 && sysv_hash_address == 0))
+    {
+        return -1;
+    }
+
+
+    if(gnu_hash_address != 0)
+    {
+# 260 "src/lookup.c"
+        uint32_t *header = get_ELF32_address_range(image, file_header, program_header_table, gnu_hash_address, 4*sizeof(uint32_t));
+        uint64_t tables_size;
+        uint64_t chain_address;
+        uint32_t last_symbol = 0;
+
+
+        if(header == 
+# 266 "src/lookup.c" 3 4
+                    ((void *)0) 
+# 266 "src/lookup.c"
+                         || !is_aligned(header, _Alignof(ELF32_Addr_t)) || header[0] == 0 || header[2] == 0)
+        {
+            return -1;
+        }
+
+        index->num_gnu_buckets = header[0];
+        index->symbol_offset = header[1];
+        index->bloom_size = header[2];
+        index->bloom_shift = header[3];
+
+        tables_size = 4*sizeof(uint32_t) + (uint64_t) index->bloom_size*sizeof(ELF32_Addr_t) + (uint64_t) index->num_gnu_buckets*sizeof(uint32_t);
+
+        if((header = get_ELF32_address_range(image, file_header, program_header_table, gnu_hash_address, tables_size)) == 
+# 278 "src/lookup.c" 3 4
+                                                                                                                         ((void *)0)
+# 278 "src/lookup.c"
+                                                                                                                             )
+        {
+            return -1;
+        }
+
+        index->bloom = header + 4;
+        index->gnu_buckets = (uint32_t*) ((ELF32_Addr_t*) index->bloom + index->bloom_size);
+        chain_address = gnu_hash_address + tables_size;
+
+        for(uint32_t i = 0; i < index->num_gnu_buckets; i++)
+        {
+            if(index->gnu_buckets[i] > last_symbol)
+                last_symbol = index->gnu_buckets[i];
+        }
+
+        num_symbols = index->symbol_offset;
+
+        if(last_symbol >= index->symbol_offset)
+        {
+            while(
+# 297 "src/lookup.c" 3 4
+                 1
+# 297 "src/lookup.c"
+                     )
+            {
+                uint32_t *entry = get_ELF32_address_range(image, file_header, program_header_table,
+                                                          chain_address + (uint64_t) (last_symbol - index->symbol_offset)*sizeof(uint32_t), sizeof(uint32_t));
+
+                if(entry == 
+# 302 "src/lookup.c" 3 4
+                           ((void *)0)
+# 302 "src/lookup.c"
+                               )
+                    return -1;
+
+                if(*entry & 1)
+                    break;
+
+                last_symbol++;
+            }
+
+            num_symbols = (uint64_t) last_symbol + 1;
+        }
+
+        index->gnu_chain = get_ELF32_address_range(image, file_header, program_header_table, chain_address,
+                                                    (num_symbols - index->symbol_offset)*sizeof(uint32_t));
+        index->method = LOOKUP_GNU_HASH;
+
+        if(index->gnu_chain == 
+# 318 "src/lookup.c" 3 4
+                              ((void *)0) 
+# 318 "src/lookup.c"
+                                   && num_symbols > index->symbol_offset)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+
+        uint32_t *header = get_ELF32_address_range(image, file_header, program_header_table, sysv_hash_address, 2*sizeof(uint32_t));
+
+        if(header == 
+# 328 "src/lookup.c" 3 4
+                    ((void *)0) 
+# 328 "src/lookup.c"
+                         || !is_aligned(header, _Alignof(uint32_t)))
+        {
+            return -1;
+        }
+
+        index->num_sysv_buckets = header[0];
+        num_symbols = header[1];
+
+        if((header = get_ELF32_address_range(image, file_header, program_header_table, sysv_hash_address,
+                                             (2 + (uint64_t) index->num_sysv_buckets + num_symbols)*sizeof(uint32_t))) == 
+# 337 "src/lookup.c" 3 4
+                                                                                                                         ((void *)0)
+# 337 "src/lookup.c"
+                                                                                                                             )
+        {
+            return -1;
+        }
+
+        index->sysv_buckets = header + 2;
+        index->sysv_chain = index->sysv_buckets + index->num_sysv_buckets;
+        index->method = LOOKUP_SYSV_HASH;
+    }
+
+
+    index->symbols.num_symbols = num_symbols;
+    index->symbols.symbols = get_ELF32_address_range(image, file_header, program_header_table, symbol_table_address, num_symbols*sizeof(ELF32_Sym_t));
+    index->symbols.string_table = get_ELF32_address_range(image, file_header, program_header_table, string_table_address, string_table_size);
+    index->symbols.string_table_size = string_table_size;
+
+    if(index->symbols.symbols == 
+# 353 "src/lookup.c" 3 4
+                                ((void *)0) 
+# 353 "src/lookup.c"
+                                     || index->symbols.string_table == 
+# 353 "src/lookup.c" 3 4
+                                                                       ((void *)0) 
+# 353 "src/lookup.c"
+                                                                            || !is_aligned(index->symbols.symbols, _Alignof(ELF32_Sym_t)))
+    {
+        return -1;
+    }
+
+    if(versions_address != 0)
+    {
+        index->versions = get_ELF32_address_range(image, file_header, program_header_table, versions_address, num_symbols*sizeof(uint16_t));
+
+        if(index->versions == 
+# 362 "src/lookup.c" 3 4
+                             ((void *)0) 
+# 362 "src/lookup.c"
+                                  || !is_aligned(index->versions, _Alignof(uint16_t)))
+        {
+            return -1;
+        }
+    }
+
+    index->table_name.string = ".dynsym";
+    index->table_name.length = strlen(".dynsym");
+
+
+    return 0;
+}
+# 382 "src/lookup.c"
+symbol_index_t *build_ELF32_symbol_index(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                                         ELF32_Program_Header_t *program_header_table, section_name_table_t *section_names)
+{
+    symbol_index_t *index;
+    int symbol_table_section = -1;
+
+
+    if(file_header == 
+# 389 "src/lookup.c" 3 4
+                     ((void *)0)
+# 389 "src/lookup.c"
+                         )
+    {
+        fprintf(
+# 391 "src/lookup.c" 3 4
+               stderr
+# 391 "src/lookup.c"
+                     , "NULL pointer passed to build_ELF32_symbol_index.\n");
+        return 
+# 392 "src/lookup.c" 3 4
+              ((void *)0)
+# 392 "src/lookup.c"
+                  ;
+    }
+
+    index = (symbol_index_t*) calloc(1, sizeof(symbol_index_t));
+    index->file_class = 1;
+
+
+    if(program_header_table != 
+# 399 "src/lookup.c" 3 4
+                              ((void *)0) 
+# 399 "src/lookup.c"
+                                   && use_ELF32_dynamic_hash_table(index, image, file_header, program_header_table) == 0)
+    {
+        return index;
+    }
+
+
+
+
+
+
+    memset(index, 0, sizeof(symbol_index_t));
+    index->file_class = 1;
+
+    for(int i = 0; section_header_table != 
+# 412 "src/lookup.c" 3 4
+                                          ((void *)0) 
+# 412 "src/lookup.c"
+                                               && i < get_ELF32_num_sections(file_header, section_header_table); i++)
+    {
+        if(section_header_table[i].sh_type == 2)
+        {
+            symbol_table_section = i;
+            break;
+        }
+
+        if(section_header_table[i].sh_type == 11 && symbol_table_section < 0)
+        {
+            symbol_table_section = i;
+        }
+    }
+
+    if(symbol_table_section < 0 || get_ELF32_symbol_table(image, file_header, section_header_table, symbol_table_section, &index->symbols) != 0)
+    {
+        fprintf(
+# 428 "src/lookup.c" 3 4
+               stderr
+# 428 "src/lookup.c"
+                     , "No symbol table to search.\n");
+        free(index);
+        return 
+# 430 "src/lookup.c" 3 4
+              ((void *)0)
+# 430 "src/lookup.c"
+                  ;
+    }
+
+    if(section_names != 
+# 433 "src/lookup.c" 3 4
+                       ((void *)0)
+# 433 "src/lookup.c"
+                           )
+    {
+        index->table_name = section_names->names[symbol_table_section];
+    }
+
+    index->method = LOOKUP_BUILT_HASH;
+    build_hash_table(index);
+
+
+    return index;
+}
+# 455 "src/lookup.c"
+static int use_ELF64_dynamic_hash_table(symbol_index_t *index, elf_image_t *image, ELF64_Header_t *file_header,
+                                         ELF64_Program_Header_t *program_header_table)
+{
+    ELF64_Dyn_t *dynamic_table;
+    uint64_t num_entries;
+
+    uint64_t gnu_hash_address = 0, sysv_hash_address = 0;
+    uint64_t symbol_table_address = 0, string_table_address = 0, string_table_size = 0;
+    uint64_t versions_address = 0;
+
+    uint64_t num_symbols;
+
+
+    if((dynamic_table = get_ELF64_dynamic_table(image, file_header, program_header_table, &num_entries)) == 
+# 468 "src/lookup.c" 3 4
+                                                                                                           ((void *)0)
+# 468 "src/lookup.c"
+                                                                                                               )
+    {
+        return -1;
+    }
+
+    for(uint64_t i = 0; i < num_entries; i++)
+    {
+        switch(dynamic_table[i].d_tag)
+        {
+            case 0x6ffffef5:
+                gnu_hash_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case 4:
+                sysv_hash_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case 6:
+                symbol_table_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case 5:
+                string_table_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case 10:
+                string_table_size = dynamic_table[i].d_un.d_val;
+                break;
+            case 0x6ffffff0:
+                versions_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if(symbol_table_address == 0 || string_table_address == 0 || (gnu_hash_address == 0 && sysv_hash_address == 0))
+    {
+        return -1;
+    }
+
+
+    if(gnu_hash_address != 0)
+    {
+# 516 "src/lookup.c"
+        uint32_t *header = get_ELF64_address_range(image, file_header, program_header_table, gnu_hash_address, 4*sizeof(uint32_t));
+        uint64_t tables_size;
+        uint64_t chain_address;
+        uint32_t last_symbol = 0;
+
+
+        if(header == 
+# 522 "src/lookup.c" 3 4
+                    ((void *)0) 
+# 522 "src/lookup.c"
+                         || !is_aligned(header, _Alignof(ELF64_Addr_t)) || header[0] == 0 || header[2] == 0)
+        {
+            return -1;
+        }
+
+        index->num_gnu_buckets = header[0];
+        index->symbol_offset = header[1];
+        index->bloom_size = header[2];
+        index->bloom_shift = header[3];
+
+        tables_size = 4*sizeof(uint32_t) + (uint64_t) index->bloom_size*sizeof(ELF64_Addr_t) + (uint64_t) index->num_gnu_buckets*sizeof(uint32_t);
+
+        if((header = get_ELF64_address_range(image, file_header, program_header_table, gnu_hash_address, tables_size)) == 
+# 534 "src/lookup.c" 3 4
+                                                                                                                         ((void *)0)
+# 534 "src/lookup.c"
+                                                                                                                             )
+        {
+            return -1;
+        }
+
+        index->bloom = header + 4;
+        index->gnu_buckets = (uint32_t*) ((ELF64_Addr_t*) index->bloom + index->bloom_size);
+        chain_address = gnu_hash_address + tables_size;
+
+        for(uint32_t i = 0; i < index->num_gnu_buckets; i++)
+        {
+            if(index->gnu_buckets[i] > last_symbol)
+                last_symbol = index->gnu_buckets[i];
+        }
+
+        num_symbols = index->symbol_offset;
+
+        if(last_symbol >= index->symbol_offset)
+        {
+            while(
+# 553 "src/lookup.c" 3 4
+                 1
+# 553 "src/lookup.c"
+                     )
+            {
+                uint32_t *entry = get_ELF64_address_range(image, file_header, program_header_table,
+                                                          chain_address + (uint64_t) (last_symbol - index->symbol_offset)*sizeof(uint32_t), sizeof(uint32_t));
+
+                if(entry == 
+# 558 "src/lookup.c" 3 4
+                           ((void *)0)
+# 558 "src/lookup.c"
+                               )
+                    return -1;
+
+                if(*entry & 1)
+                    break;
+
+                last_symbol++;
+            }
+
+            num_symbols = (uint64_t) last_symbol + 1;
+        }
+
+        index->gnu_chain = get_ELF64_address_range(image, file_header, program_header_table, chain_address,
+                                                    (num_symbols - index->symbol_offset)*sizeof(uint32_t));
+        index->method = LOOKUP_GNU_HASH;
+
+        if(index->gnu_chain == 
+# 574 "src/lookup.c" 3 4
+                              ((void *)0) 
+# 574 "src/lookup.c"
+                                   && num_symbols > index->symbol_offset)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+
+        uint32_t *header = get_ELF64_address_range(image, file_header, program_header_table, sysv_hash_address, 2*sizeof(uint32_t));
+
+        if(header == 
+# 584 "src/lookup.c" 3 4
+                    ((void *)0) 
+# 584 "src/lookup.c"
+                         || !is_aligned(header, _Alignof(uint32_t)))
+        {
+            return -1;
+        }
+
+        index->num_sysv_buckets = header[0];
+        num_symbols = header[1];
+
+        if((header = get_ELF64_address_range(image, file_header, program_header_table, sysv_hash_address,
+                                             (2 + (uint64_t) index->num_sysv_buckets + num_symbols)*sizeof(uint32_t))) == 
+# 593 "src/lookup.c" 3 4
+                                                                                                                         ((void *)0)
+# 593 "src/lookup.c"
+                                                                                                                             )
+        {
+            return -1;
+        }
+
+        index->sysv_buckets = header + 2;
+        index->sysv_chain = index->sysv_buckets + index->num_sysv_buckets;
+        index->method = LOOKUP_SYSV_HASH;
+    }
+
+
+    index->symbols.num_symbols = num_symbols;
+    index->symbols.symbols = get_ELF64_address_range(image, file_header, program_header_table, symbol_table_address, num_symbols*sizeof(ELF64_Sym_t));
+    index->symbols.string_table = get_ELF64_address_range(image, file_header, program_header_table, string_table_address, string_table_size);
+    index->symbols.string_table_size = string_table_size;
+
+    if(index->symbols.symbols == 
+# 609 "src/lookup.c" 3 4
+                                ((void *)0) 
+# 609 "src/lookup.c"
+                                     || index->symbols.string_table == 
+# 609 "src/lookup.c" 3 4
+                                                                       ((void *)0) 
+# 609 "src/lookup.c"
+                                                                            || !is_aligned(index->symbols.symbols, _Alignof(ELF64_Sym_t)))
+    {
+        return -1;
+    }
+
+    if(versions_address != 0)
+    {
+        index->versions = get_ELF64_address_range(image, file_header, program_header_table, versions_address, num_symbols*sizeof(uint16_t));
+
+        if(index->versions == 
+# 618 "src/lookup.c" 3 4
+                             ((void *)0) 
+# 618 "src/lookup.c"
+                                  || !is_aligned(index->versions, _Alignof(uint16_t)))
+        {
+            return -1;
+        }
+    }
+
+    index->table_name.string = ".dynsym";
+    index->table_name.length = strlen(".dynsym");
+
+
+    return 0;
+}
+# 638 "src/lookup.c"
+symbol_index_t *build_ELF64_symbol_index(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                                         ELF64_Program_Header_t *program_header_table, section_name_table_t *section_names)
+{
+    symbol_index_t *index;
+    int symbol_table_section = -1;
+
+
+    if(file_header == 
+# 645 "src/lookup.c" 3 4
+                     ((void *)0)
+# 645 "src/lookup.c"
+                         )
+    {
+        fprintf(
+# 647 "src/lookup.c" 3 4
+               stderr
+# 647 "src/lookup.c"
+                     , "NULL pointer passed to build_ELF64_symbol_index.\n");
+        return 
+# 648 "src/lookup.c" 3 4
+              ((void *)0)
+# 648 "src/lookup.c"
+                  ;
+    }
+
+    index = (symbol_index_t*) calloc(1, sizeof(symbol_index_t));
+    index->file_class = 2;
+
+
+    if(program_header_table != 
+# 655 "src/lookup.c" 3 4
+                              ((void *)0) 
+# 655 "src/lookup.c"
+                                   && use_ELF64_dynamic_hash_table(index, image, file_header, program_header_table) == 0)
+    {
+        return index;
+    }
+
+
+
+
+
+
+    memset(index, 0, sizeof(symbol_index_t));
+    index->file_class = 2;
+
+    for(int i = 0; section_header_table != 
+# 668 "src/lookup.c" 3 4
+                                          ((void *)0) 
+# 668 "src/lookup.c"
+                                               && i < get_ELF64_num_sections(file_header, section_header_table); i++)
+    {
+        if(section_header_table[i].sh_type == 2)
+        {
+            symbol_table_section = i;
+            break;
+        }
+
+        if(section_header_table[i].sh_type == 11 && symbol_table_section < 0)
+        {
+            symbol_table_section = i;
+        }
+    }
+
+    if(symbol_table_section < 0 || get_ELF64_symbol_table(image, file_header, section_header_table, symbol_table_section, &index->symbols) != 0)
+    {
+        fprintf(
+# 684 "src/lookup.c" 3 4
+               stderr
+# 684 "src/lookup.c"
+                     , "No symbol table to search.\n");
+        free(index);
+        return 
+# 686 "src/lookup.c" 3 4
+              ((void *)0)
+# 686 "src/lookup.c"
+                  ;
+    }
+
+    if(section_names != 
+# 689 "src/lookup.c" 3 4
+                       ((void *)0)
+# 689 "src/lookup.c"
+                           )
+    {
+        index->table_name = section_names->names[symbol_table_section];
+    }
+
+    index->method = LOOKUP_BUILT_HASH;
+    build_hash_table(index);
+
+
+    return index;
+}
+# 708 "src/lookup.c"
+typedef struct
+{
+    uint64_t start;
+    uint64_t end;
+    string_view_t name;
+
+
+    int rank;
+
+
+    uint64_t order;
+
+} address_range_t;
+# 731 "src/lookup.c"
+static int compare_address_ranges(const void *first, const void *second)
+{
+    const address_range_t *range1 = (const address_range_t*) first;
+    const address_range_t *range2 = (const address_range_t*) second;
+
+    if(range1->start != range2->start)
+        return (range1->start < range2->start) ? -1 : 1;
+
+    if(range1->rank != range2->rank)
+        return (range1->rank > range2->rank) ? -1 : 1;
+
+    if(range1->end != range2->end)
+        return (range1->end > range2->end) ? -1 : 1;
+
+    if(range1->order != range2->order)
+        return (range1->order < range2->order) ? -1 : 1;
+
+    return 0;
+}
+# 758 "src/lookup.c"
+static 
+# 758 "src/lookup.c" 3 4
+      _Bool 
+# 758 "src/lookup.c"
+           symbol_has_range(unsigned char info, uint16_t section_index, uint64_t size, int *rank)
+{
+    unsigned char type = ((info)&0xf);
+
+    if(section_index == 0 || section_index == 0xfff1 || size == 0)
+        return 
+# 763 "src/lookup.c" 3 4
+              0
+# 763 "src/lookup.c"
+                   ;
+
+    if(type != 2 && type != 1 && type != 10 && type != 0)
+        return 
+# 766 "src/lookup.c" 3 4
+              0
+# 766 "src/lookup.c"
+                   ;
+
+    switch(((info)>>4))
+    {
+        case 1:
+            *rank = 2;
+            break;
+        case 2:
+            *rank = 1;
+            break;
+        default:
+            *rank = 0;
+            break;
+    }
+
+    return 
+# 781 "src/lookup.c" 3 4
+          1
+# 781 "src/lookup.c"
+              ;
+}
+# 793 "src/lookup.c"
+static address_index_t *finish_address_index(address_range_t *ranges, uint64_t num_ranges)
+{
+    address_index_t *index = (address_index_t*) malloc(sizeof(address_index_t));
+    range_t *sorted = (range_t*) malloc((num_ranges + 1) * sizeof(range_t));
+
+
+    qsort(ranges, num_ranges, sizeof(address_range_t), compare_address_ranges);
+
+    index->names = (string_view_t*) malloc((num_ranges + 1) * sizeof(string_view_t));
+
+    for(uint64_t i = 0; i < num_ranges; i++)
+    {
+        sorted[i].start = ranges[i].start;
+        sorted[i].end = ranges[i].end;
+        sorted[i].payload = i;
+        index->names[i] = ranges[i].name;
+    }
+
+    index->ranges = build_range_index(sorted, num_ranges, RANGES_KEEP_FIRST);
+
+    free(sorted);
+    free(ranges);
+
+    return index;
+}
+# 828 "src/lookup.c"
+address_index_t *build_ELF32_address_index(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table)
+{
+    address_range_t *ranges;
+    uint64_t num_ranges = 0;
+    uint64_t capacity = 0;
+    symbol_table_t tables[2];
+    int num_tables = 0;
+
+
+    if(file_header == 
+# 837 "src/lookup.c" 3 4
+                     ((void *)0) 
+# 837 "src/lookup.c"
+                          || section_header_table == 
+# 837 "src/lookup.c" 3 4
+                                                     ((void *)0)
+# 837 "src/lookup.c"
+                                                         )
+    {
+        fprintf(
+# 839 "src/lookup.c" 3 4
+               stderr
+# 839 "src/lookup.c"
+                     , "NULL pointer passed to build_ELF32_address_index.\n");
+        return 
+# 840 "src/lookup.c" 3 4
+              ((void *)0)
+# 840 "src/lookup.c"
+                  ;
+    }
+
+
+    for(int i = 0; i < get_ELF32_num_sections(file_header, section_header_table) && num_tables < 2; i++)
+    {
+        if(section_header_table[i].sh_type != 2 && section_header_table[i].sh_type != 11)
+            continue;
+
+        if(get_ELF32_symbol_table(image, file_header, section_header_table, i, &tables[num_tables]) != 0)
+            continue;
+
+        capacity += tables[num_tables].num_symbols;
+        num_tables++;
+    }
+
+    if(num_tables == 0)
+    {
+        fprintf(
+# 858 "src/lookup.c" 3 4
+               stderr
+# 858 "src/lookup.c"
+                     , "No symbol table to search.\n");
+        return 
+# 859 "src/lookup.c" 3 4
+              ((void *)0)
+# 859 "src/lookup.c"
+                  ;
+    }
+
+
+    ranges = (address_range_t*) malloc((capacity + 1) * sizeof(address_range_t));
+
+    for(int t = 0; t < num_tables; t++)
+    {
+        ELF32_Sym_t *symbols = (ELF32_Sym_t*) tables[t].symbols;
+
+        for(uint64_t i = 0; i < tables[t].num_symbols; i++)
+        {
+            int rank;
+
+            if(!symbol_has_range(symbols[i].st_info, symbols[i].st_shndx, symbols[i].st_size, &rank))
+                continue;
+
+            ranges[num_ranges].start = symbols[i].st_value;
+            ranges[num_ranges].end = symbols[i].st_value + symbols[i].st_size;
+            ranges[num_ranges].name = get_string_table_entry(tables[t].string_table, tables[t].string_table_size, symbols[i].st_name);
+            ranges[num_ranges].rank = rank;
+            ranges[num_ranges].order = num_ranges;
+            num_ranges++;
+        }
+    }
+
+
+    return finish_address_index(ranges, num_ranges);
+}
+# 898 "src/lookup.c"
+address_index_t *build_ELF64_address_index(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table)
+{
+    address_range_t *ranges;
+    uint64_t num_ranges = 0;
+    uint64_t capacity = 0;
+    symbol_table_t tables[2];
+    int num_tables = 0;
+
+
+    if(file_header == 
+# 907 "src/lookup.c" 3 4
+                     ((void *)0) 
+# 907 "src/lookup.c"
+                          || section_header_table == 
+# 907 "src/lookup.c" 3 4
+                                                     ((void *)0)
+# 907 "src/lookup.c"
+                                                         )
+    {
+        fprintf(
+# 909 "src/lookup.c" 3 4
+               stderr
+# 909 "src/lookup.c"
+                     , "NULL pointer passed to build_ELF64_address_index.\n");
+        return 
+# 910 "src/lookup.c" 3 4
+              ((void *)0)
+# 910 "src/lookup.c"
+                  ;
+    }
+
+
+    for(int i = 0; i < get_ELF64_num_sections(file_header, section_header_table) && num_tables < 2; i++)
+    {
+        if(section_header_table[i].sh_type != 2 && section_header_table[i].sh_type != 11)
+            continue;
+
+        if(get_ELF64_symbol_table(image, file_header, section_header_table, i, &tables[num_tables]) != 0)
+            continue;
+
+        capacity += tables[num_tables].num_symbols;
+        num_tables++;
+    }
+
+    if(num_tables == 0)
+    {
+        fprintf(
+# 928 "src/lookup.c" 3 4
+               stderr
+# 928 "src/lookup.c"
+                     , "No symbol table to search.\n");
+        return 
+# 929 "src/lookup.c" 3 4
+              ((void *)0)
+# 929 "src/lookup.c"
+                  ;
+    }
+
+
+    ranges = (address_range_t*) malloc((capacity + 1) * sizeof(address_range_t));
+
+    for(int t = 0; t < num_tables; t++)
+    {
+        ELF64_Sym_t *symbols = (ELF64_Sym_t*) tables[t].symbols;
+
+        for(uint64_t i = 0; i < tables[t].num_symbols; i++)
+        {
+            int rank;
+
+            if(!symbol_has_range(symbols[i].st_info, symbols[i].st_shndx, symbols[i].st_size, &rank))
+                continue;
+
+            ranges[num_ranges].start = symbols[i].st_value;
+            ranges[num_ranges].end = symbols[i].st_value + symbols[i].st_size;
+            ranges[num_ranges].name = get_string_table_entry(tables[t].string_table, tables[t].string_table_size, symbols[i].st_name);
+            ranges[num_ranges].rank = rank;
+            ranges[num_ranges].order = num_ranges;
+            num_ranges++;
+        }
+    }
+
+
+    return finish_address_index(ranges, num_ranges);
+}
+
+
+
+
+void release_symbol_index(symbol_index_t *index)
+{
+    if(index == 
+# 964 "src/lookup.c" 3 4
+               ((void *)0)
+# 964 "src/lookup.c"
+                   )
+    {
+        return;
+    }
+
+    free(index->slot_symbols);
+    free(index->slot_hashes);
+    free(index);
+}
+# 982 "src/lookup.c"
+int64_t find_symbol(symbol_index_t *index, const char *name, size_t length)
+{
+    switch(index->method)
+    {
+        case LOOKUP_GNU_HASH:
+        {
+            uint32_t hash = gnu_hash(name, length);
+            uint32_t word_bits = (index->file_class == 2) ? 64 : 32;
+            uint32_t word_index = (hash / word_bits) % index->bloom_size;
+            uint64_t word;
+            uint64_t mask;
+
+
+
+
+
+            if(index->file_class == 2)
+                word = ((uint64_t*) index->bloom)[word_index];
+            else
+                word = ((uint32_t*) index->bloom)[word_index];
+
+            mask = ((uint64_t) 1 << (hash % word_bits)) | ((uint64_t) 1 << ((hash >> index->bloom_shift) % word_bits));
+
+            if((word & mask) != mask)
+            {
+                return -1;
+            }
+
+
+
+            for(uint64_t i = index->gnu_buckets[hash % index->num_gnu_buckets];
+                i >= index->symbol_offset && i < index->symbols.num_symbols; i++)
+            {
+                uint32_t chain_hash = index->gnu_chain[i - index->symbol_offset];
+
+                if((chain_hash | 1) == (hash | 1) && symbol_matches(index, i, name, length))
+                {
+                    return (int64_t) i;
+                }
+
+                if(chain_hash & 1)
+                {
+                    break;
+                }
+            }
+
+            return -1;
+        }
+
+        case LOOKUP_SYSV_HASH:
+        {
+            uint32_t hash = sysv_hash(name, length);
+            uint32_t i;
+
+            if(index->num_sysv_buckets == 0)
+            {
+                return -1;
+            }
+
+
+
+
+
+            i = index->sysv_buckets[hash % index->num_sysv_buckets];
+
+            for(uint64_t steps = 0; i != 0 && i < index->symbols.num_symbols && steps < index->symbols.num_symbols; steps++)
+            {
+                if(symbol_matches(index, i, name, length))
+                {
+                    return (int64_t) i;
+                }
+
+                i = index->sysv_chain[i];
+            }
+
+            return -1;
+        }
+
+        case LOOKUP_BUILT_HASH:
+        {
+            uint32_t hash = gnu_hash(name, length);
+
+            for(uint64_t slot = hash & index->slot_mask; index->slot_symbols[slot] != 0; slot = (slot + 1) & index->slot_mask)
+            {
+                if(index->slot_hashes[slot] == hash && symbol_matches(index, index->slot_symbols[slot] - 1, name, length))
+                {
+                    return (int64_t) index->slot_symbols[slot] - 1;
+                }
+            }
+
+            return -1;
+        }
+
+        default:
+            return -1;
+    }
+}
+
+
+
+
+void release_address_index(address_index_t *index)
+{
+    if(index == 
+# 1085 "src/lookup.c" 3 4
+               ((void *)0)
+# 1085 "src/lookup.c"
+                   )
+    {
+        return;
+    }
+
+    release_range_index(index->ranges);
+    free(index->names);
+    free(index);
+}
+# 1103 "src/lookup.c"
+static uint64_t find_section_name_slot(section_name_index_t *index, const char *name, size_t length, uint32_t hash)
+{
+    uint64_t slot;
+
+    for(slot = hash & index->slot_mask; index->slot_starts[slot] != 0; slot = (slot + 1) & index->slot_mask)
+    {
+        string_view_t *group_name = &index->section_names->names[index->sections[index->slot_starts[slot] - 1]];
+
+        if(index->slot_hashes[slot] == hash && group_name->length == length && memcmp(group_name->string, name, length) == 0)
+        {
+            break;
+        }
+    }
+
+    return slot;
+}
+# 1129 "src/lookup.c"
+section_name_index_t *build_section_name_index(section_name_table_t *section_names)
+{
+    section_name_index_t *index;
+    uint64_t num_slots = 16;
+    uint64_t *section_slots;
+    uint32_t *next_positions;
+    uint32_t num_placed = 0;
+
+
+    if((index = (section_name_index_t*) calloc(1, sizeof(section_name_index_t))) == 
+# 1138 "src/lookup.c" 3 4
+                                                                                   ((void *)0)
+# 1138 "src/lookup.c"
+                                                                                       )
+    {
+        return 
+# 1140 "src/lookup.c" 3 4
+              ((void *)0)
+# 1140 "src/lookup.c"
+                  ;
+    }
+
+    while(num_slots < 2 * (uint64_t) section_names->num_names)
+    {
+        num_slots *= 2;
+    }
+
+    index->section_names = section_names;
+    index->sections = (int*) malloc((section_names->num_names + 1) * sizeof(int));
+    index->slot_mask = num_slots - 1;
+    index->slot_starts = (uint32_t*) calloc(num_slots, sizeof(uint32_t));
+    index->slot_counts = (uint32_t*) calloc(num_slots, sizeof(uint32_t));
+    index->slot_hashes = (uint32_t*) malloc(num_slots * sizeof(uint32_t));
+
+    section_slots = (uint64_t*) malloc((section_names->num_names + 1) * sizeof(uint64_t));
+    next_positions = (uint32_t*) malloc(num_slots * sizeof(uint32_t));
+
+
+
+
+
+
+
+    for(int i = 0; i < section_names->num_names; i++)
+    {
+        string_view_t *name = &section_names->names[i];
+        uint32_t hash = gnu_hash(name->string, name->length);
+        uint64_t slot;
+
+        index->sections[i] = i;
+        slot = find_section_name_slot(index, name->string, name->length, hash);
+
+        if(index->slot_starts[slot] == 0)
+        {
+            index->slot_starts[slot] = i + 1;
+            index->slot_hashes[slot] = hash;
+        }
+
+        index->slot_counts[slot]++;
+        section_slots[i] = slot;
+    }
+
+
+
+    for(int i = 0; i < section_names->num_names; i++)
+    {
+        uint64_t slot = section_slots[i];
+
+        if(index->slot_starts[slot] == (uint32_t) i + 1)
+        {
+            next_positions[slot] = num_placed;
+            num_placed += index->slot_counts[slot];
+        }
+    }
+
+    for(uint64_t slot = 0; slot < num_slots; slot++)
+    {
+        if(index->slot_starts[slot] != 0)
+        {
+            index->slot_starts[slot] = next_positions[slot] + 1;
+        }
+    }
+
+    for(int i = 0; i < section_names->num_names; i++)
+    {
+        index->sections[next_positions[section_slots[i]]++] = i;
+    }
+
+
+    free(section_slots);
+    free(next_positions);
+
+    return index;
+}
+
+
+
+void release_section_name_index(section_name_index_t *index)
+{
+    if(index == 
+# 1220 "src/lookup.c" 3 4
+               ((void *)0)
+# 1220 "src/lookup.c"
+                   )
+    {
+        return;
+    }
+
+    free(index->sections);
+    free(index->slot_starts);
+    free(index->slot_counts);
+    free(index->slot_hashes);
+    free(index);
+}
+# 1239 "src/lookup.c"
+int find_sections(section_name_index_t *index, const char *name, size_t length, const int **sections)
+{
+    uint64_t slot = find_section_name_slot(index, name, length, gnu_hash(name, length));
+
+    if(index->slot_starts[slot] == 0)
+    {
+        return 0;
+    }
+
+    *sections = &index->sections[index->slot_starts[slot] - 1];
+    return (int) index->slot_counts[slot];
+}
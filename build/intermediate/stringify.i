@@ -0,0 +1,8237 @@
+# 0 "src/stringify.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/stringify.c"
+# 9 "src/stringify.c"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 39 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 909 "/usr/include/stdio.h" 3 4
+
+# 10 "src/stringify.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 11 "src/stringify.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 12 "src/stringify.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 59 "/usr/include/stdlib.h" 3 4
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+# 114 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 13 "src/stringify.c" 2
+
+
+# 1 "include/stringify.h" 1
+# 13 "include/stringify.h"
+# 1 "include/elf.h" 1
+# 16 "include/elf.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 17 "include/elf.h" 2
+
+
+
+
+# 20 "include/elf.h"
+typedef uint8_t BYTE;
+# 40 "include/elf.h"
+typedef uint32_t ELF32_Addr_t;
+
+
+
+typedef uint16_t ELF32_Half_t;
+
+
+
+typedef uint32_t ELF32_Off_t;
+
+
+typedef int32_t ELF32_Sword_t;
+
+typedef uint32_t ELF32_Word_t;
+
+
+
+
+
+
+
+typedef struct
+{
+
+
+
+
+
+    unsigned char e_ident[16];
+
+
+
+
+
+
+    ELF32_Half_t e_type;
+
+
+
+
+
+    ELF32_Half_t e_machine;
+
+
+
+
+
+    ELF32_Word_t e_version;
+# 96 "include/elf.h"
+    ELF32_Addr_t e_entry;
+
+
+
+
+
+
+
+    ELF32_Off_t e_phoff;
+
+
+
+
+
+
+
+    ELF32_Off_t e_shoff;
+
+
+
+
+
+    ELF32_Word_t e_flags;
+
+
+
+
+
+    ELF32_Half_t e_ehsize;
+
+
+
+
+
+
+
+    ELF32_Half_t e_phentsize;
+# 142 "include/elf.h"
+    ELF32_Half_t e_phnum;
+
+
+
+
+
+
+
+    ELF32_Half_t e_shentsize;
+# 160 "include/elf.h"
+    ELF32_Half_t e_shnum;
+
+
+
+
+
+
+
+    ELF32_Half_t e_shstrndx;
+
+
+
+} ELF32_Header_t;
+# 193 "include/elf.h"
+typedef uint64_t ELF64_Addr_t;
+
+
+
+typedef uint16_t ELF64_Half_t;
+
+
+
+typedef uint64_t ELF64_Off_t;
+
+
+typedef int32_t ELF64_Sword_t;
+
+typedef uint32_t ELF64_Word_t;
+
+
+
+typedef uint64_t ELF64_Xword_t;
+
+typedef int64_t ELF64_Sxword_t;
+
+
+
+
+
+
+typedef struct
+{
+
+
+
+
+
+    unsigned char e_ident[16];
+
+
+
+
+
+
+    ELF64_Half_t e_type;
+
+
+
+
+
+    ELF64_Half_t e_machine;
+
+
+
+
+
+    ELF64_Word_t e_version;
+# 254 "include/elf.h"
+    ELF64_Addr_t e_entry;
+
+
+
+
+
+
+
+    ELF64_Off_t e_phoff;
+
+
+
+
+
+
+
+    ELF64_Off_t e_shoff;
+
+
+
+
+
+    ELF64_Word_t e_flags;
+
+
+
+
+
+    ELF64_Half_t e_ehsize;
+
+
+
+
+
+
+
+    ELF64_Half_t e_phentsize;
+# 300 "include/elf.h"
+    ELF64_Half_t e_phnum;
+
+
+
+
+
+
+
+    ELF64_Half_t e_shentsize;
+# 318 "include/elf.h"
+    ELF64_Half_t e_shnum;
+
+
+
+
+
+
+
+    ELF64_Half_t e_shstrndx;
+
+
+
+} ELF64_Header_t;
+# 497 "include/elf.h"
+typedef struct
+{
+# 508 "include/elf.h"
+    ELF32_Word_t sh_name;
+
+
+
+
+
+
+    ELF32_Word_t sh_type;
+# 524 "include/elf.h"
+    ELF32_Word_t sh_flags;
+# 535 "include/elf.h"
+    ELF32_Addr_t sh_addr;
+# 546 "include/elf.h"
+    ELF32_Off_t sh_offset;
+# 556 "include/elf.h"
+    ELF32_Word_t sh_size;
+
+
+
+
+
+
+
+    ELF32_Word_t sh_link;
+
+
+
+
+
+
+    ELF32_Word_t sh_info;
+# 583 "include/elf.h"
+    ELF32_Word_t sh_addralign;
+# 593 "include/elf.h"
+    ELF32_Word_t sh_entsize;
+
+
+
+} ELF32_Section_Header_t;
+# 607 "include/elf.h"
+typedef struct
+{
+# 618 "include/elf.h"
+    ELF64_Word_t sh_name;
+
+
+
+
+
+
+    ELF64_Word_t sh_type;
+# 634 "include/elf.h"
+    ELF64_Xword_t sh_flags;
+# 645 "include/elf.h"
+    ELF64_Addr_t sh_addr;
+# 656 "include/elf.h"
+    ELF64_Off_t sh_offset;
+# 666 "include/elf.h"
+    ELF64_Xword_t sh_size;
+
+
+
+
+
+
+
+    ELF64_Word_t sh_link;
+
+
+
+
+
+
+    ELF64_Word_t sh_info;
+# 693 "include/elf.h"
+    ELF64_Xword_t sh_addralign;
+# 703 "include/elf.h"
+    ELF64_Xword_t sh_entsize;
+
+
+
+} ELF64_Section_Header_t;
+# 849 "include/elf.h"
+typedef struct
+{
+# 859 "include/elf.h"
+    ELF32_Word_t st_name;
+# 877 "include/elf.h"
+    ELF32_Addr_t st_value;
+
+
+
+
+
+
+
+    ELF32_Word_t st_size;
+# 894 "include/elf.h"
+    unsigned char st_info;
+
+
+
+
+
+
+    unsigned char st_other;
+# 911 "include/elf.h"
+    ELF32_Half_t st_shndx;
+
+
+} ELF32_Sym_t;
+
+
+
+typedef struct
+{
+# 934 "include/elf.h"
+    ELF64_Word_t st_name;
+# 943 "include/elf.h"
+    unsigned char st_info;
+
+
+
+
+
+
+    unsigned char st_other;
+# 960 "include/elf.h"
+    ELF64_Half_t st_shndx;
+# 978 "include/elf.h"
+    ELF64_Addr_t st_value;
+
+
+
+
+
+
+
+    ELF64_Xword_t st_size;
+
+
+} ELF64_Sym_t;
+# 1196 "include/elf.h"
+typedef struct
+{
+# 1208 "include/elf.h"
+    ELF32_Addr_t r_offset;
+# 1217 "include/elf.h"
+    ELF32_Word_t r_info;
+
+
+} ELF32_Rel_t;
+
+
+
+
+
+
+typedef struct
+{
+
+
+
+
+    ELF32_Addr_t r_offset;
+
+
+
+
+
+    ELF32_Word_t r_info;
+
+
+
+
+
+
+    ELF32_Sword_t r_addend;
+
+
+} ELF32_Rela_t;
+# 1276 "include/elf.h"
+typedef struct
+{
+# 1288 "include/elf.h"
+    ELF64_Addr_t r_offset;
+# 1297 "include/elf.h"
+    ELF64_Xword_t r_info;
+
+
+} ELF64_Rel_t;
+
+
+
+
+
+
+typedef struct
+{
+
+
+
+
+    ELF64_Addr_t r_offset;
+
+
+
+
+
+    ELF64_Xword_t r_info;
+
+
+
+
+
+
+    ELF64_Sxword_t r_addend;
+
+
+} ELF64_Rela_t;
+# 1363 "include/elf.h"
+typedef struct
+{
+
+
+
+
+
+
+    ELF32_Word_t p_type;
+
+
+
+
+
+
+    ELF32_Off_t p_offset;
+
+
+
+
+
+
+    ELF32_Addr_t p_vaddr;
+
+
+
+
+
+
+
+    ELF32_Addr_t p_paddr;
+
+
+
+
+
+
+    ELF32_Word_t p_filesz;
+
+
+
+
+
+
+
+    ELF32_Word_t p_memsz;
+
+
+
+
+
+    ELF32_Word_t p_flags;
+
+
+
+
+
+    ELF32_Word_t p_align;
+
+
+} ELF32_Program_Header_t;
+
+
+
+
+typedef struct
+{
+
+
+
+
+
+
+    ELF64_Word_t p_type;
+
+
+
+
+
+    ELF64_Word_t p_flags;
+
+
+
+
+
+
+    ELF64_Off_t p_offset;
+
+
+
+
+
+
+    ELF64_Addr_t p_vaddr;
+
+
+
+
+
+
+
+    ELF64_Addr_t p_paddr;
+
+
+
+
+
+
+    ELF64_Xword_t p_filesz;
+
+
+
+
+
+
+
+    ELF64_Xword_t p_memsz;
+
+
+
+
+
+    ELF64_Xword_t p_align;
+
+
+} ELF64_Program_Header_t;
+# 1568 "include/elf.h"
+typedef struct
+{
+
+    ELF32_Sword_t d_tag;
+
+
+
+
+
+    union
+    {
+        ELF32_Word_t d_val;
+        ELF32_Addr_t d_ptr;
+    } d_un;
+
+} ELF32_Dyn_t;
+
+
+
+typedef struct
+{
+
+    ELF64_Sxword_t d_tag;
+
+
+
+
+
+    union
+    {
+        ELF64_Xword_t d_val;
+        ELF64_Addr_t d_ptr;
+    } d_un;
+
+} ELF64_Dyn_t;
+# 14 "include/stringify.h" 2
+# 1 "include/readelf.h" 1
+# 12 "include/readelf.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 13 "include/readelf.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 14 "include/readelf.h" 2
+# 32 "include/readelf.h"
+typedef struct
+{
+
+    int file_descriptor;
+
+
+    size_t size;
+
+
+    unsigned char *data;
+
+} elf_image_t;
+# 53 "include/readelf.h"
+typedef struct
+{
+    char *string;
+    size_t length;
+
+} string_view_t;
+# 68 "include/readelf.h"
+typedef struct
+{
+
+    int num_names;
+
+
+    size_t max_length;
+
+
+    string_view_t *names;
+
+} section_name_table_t;
+# 94 "include/readelf.h"
+typedef struct
+{
+    int num_segments;
+    int *segment_start;
+    int *section_indices;
+
+} section_to_segment_mapping_t;
+# 111 "include/readelf.h"
+typedef struct
+{
+
+    void *symbols;
+    uint64_t num_symbols;
+
+    char *string_table;
+    uint64_t string_table_size;
+
+} symbol_table_t;
+# 129 "include/readelf.h"
+typedef struct
+{
+
+    void *entries;
+    uint64_t num_entries;
+
+
+    
+# 136 "include/readelf.h" 3 4
+   _Bool 
+# 136 "include/readelf.h"
+        has_addends;
+
+
+    
+# 139 "include/readelf.h" 3 4
+   _Bool 
+# 139 "include/readelf.h"
+        has_symbols;
+    symbol_table_t symbols;
+
+} relocation_table_t;
+
+
+
+int open_elf_image(elf_image_t *image, const char *filename);
+void close_elf_image(elf_image_t *image);
+void *get_image_range(elf_image_t *image, uint64_t offset, uint64_t size);
+void *get_aligned_image_range(elf_image_t *image, uint64_t offset, uint64_t size, uint64_t alignment);
+
+# 150 "include/readelf.h" 3 4
+_Bool 
+# 150 "include/readelf.h"
+    is_aligned(const void *pointer, uint64_t alignment);
+
+
+
+string_view_t get_string_table_entry(char *string_table, uint64_t string_table_size, uint64_t offset);
+void release_section_name_table(section_name_table_t *section_names);
+void release_section_to_segment_mapping(section_to_segment_mapping_t *mapping);
+
+
+
+int read_ELF_identification(elf_image_t *image, unsigned char *buffer);
+
+# 161 "include/readelf.h" 3 4
+_Bool 
+# 161 "include/readelf.h"
+    has_ELF_magic(elf_image_t *image);
+int get_file_class(elf_image_t *image);
+
+
+
+ELF32_Header_t *get_ELF32_header(elf_image_t *image);
+
+ELF32_Section_Header_t *get_ELF32_section_header(elf_image_t *image, int index);
+ELF32_Section_Header_t *get_ELF32_section_header_table(elf_image_t *image);
+int get_ELF32_num_sections(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+uint32_t get_ELF32_section_string_table_index(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+
+ELF32_Program_Header_t *get_ELF32_program_header(elf_image_t *image, int index);
+ELF32_Program_Header_t *get_ELF32_program_header_table(elf_image_t *image);
+
+section_name_table_t *get_ELF32_section_names(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+section_to_segment_mapping_t *get_ELF32_section_to_segment_mapping(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                                                                   ELF32_Program_Header_t *program_header_table);
+
+int get_ELF32_symbol_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                           int section_index, symbol_table_t *symbol_table);
+int get_ELF32_relocation_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                               int section_index, relocation_table_t *relocation_table);
+
+void *get_ELF32_address_range(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Program_Header_t *program_header_table,
+                              uint64_t address, uint64_t size);
+ELF32_Dyn_t *get_ELF32_dynamic_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Program_Header_t *program_header_table,
+                                     uint64_t *num_entries);
+
+# 189 "include/readelf.h" 3 4
+_Bool 
+# 189 "include/readelf.h"
+    *get_ELF32_relocated_sections(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+
+
+
+ELF64_Header_t *get_ELF64_header(elf_image_t *image);
+
+ELF64_Section_Header_t *get_ELF64_section_header(elf_image_t *image, int index);
+ELF64_Section_Header_t *get_ELF64_section_header_table(elf_image_t *image);
+int get_ELF64_num_sections(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+uint32_t get_ELF64_section_string_table_index(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+
+ELF64_Program_Header_t *get_ELF64_program_header(elf_image_t *image, int index);
+ELF64_Program_Header_t *get_ELF64_program_header_table(elf_image_t *image);
+
+section_name_table_t *get_ELF64_section_names(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+section_to_segment_mapping_t *get_ELF64_section_to_segment_mapping(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                                                                   ELF64_Program_Header_t *program_header_table);
+
+int get_ELF64_symbol_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                           int section_index, symbol_table_t *symbol_table);
+int get_ELF64_relocation_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                               int section_index, relocation_table_t *relocation_table);
+
+void *get_ELF64_address_range(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Program_Header_t *program_header_table,
+                              uint64_t address, uint64_t size);
+ELF64_Dyn_t *get_ELF64_dynamic_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Program_Header_t *program_header_table,
+                                     uint64_t *num_entries);
+
+# 216 "include/readelf.h" 3 4
+_Bool 
+# 216 "include/readelf.h"
+    *get_ELF64_relocated_sections(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+# 15 "include/stringify.h" 2
+# 1 "include/output.h" 1
+# 13 "include/output.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 14 "include/output.h" 2
+# 52 "include/output.h"
+typedef struct
+{
+
+    int file_descriptor;
+
+    char *buffer;
+
+
+    size_t capacity;
+
+
+    size_t size;
+
+
+    
+# 66 "include/output.h" 3 4
+   _Bool 
+# 66 "include/output.h"
+        error;
+
+} output_t;
+
+
+
+void init_output(output_t *output, int file_descriptor);
+void init_memory_output(output_t *output, size_t capacity);
+int flush_output(output_t *output);
+int release_output(output_t *output);
+
+
+void append_bytes(output_t *output, const char *bytes, size_t length);
+void append_string(output_t *output, const char *string);
+void append_char(output_t *output, char character);
+void append_padding(output_t *output, int num_spaces);
+void append_format(output_t *output, const char *format, ...);
+
+char *reserve_output(output_t *output, size_t length);
+
+void append_hex(output_t *output, uint64_t value, int min_width);
+void append_decimal(output_t *output, uint64_t value);
+void append_signed_decimal(output_t *output, int64_t value);
+# 16 "include/stringify.h" 2
+# 1 "include/lookup.h" 1
+# 12 "include/lookup.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 13 "include/lookup.h" 2
+
+
+
+
+
+# 1 "include/ranges.h" 1
+# 21 "include/ranges.h"
+typedef struct
+{
+    uint64_t start;
+    uint64_t end;
+    uint64_t payload;
+
+} range_t;
+# 39 "include/ranges.h"
+typedef enum
+{
+    RANGES_KEEP_FIRST,
+    RANGES_MERGE
+
+} range_overlap_t;
+# 55 "include/ranges.h"
+typedef struct
+{
+    uint64_t num_ranges;
+
+
+    uint64_t *starts;
+
+
+    uint64_t *ends;
+
+
+    uint64_t *payloads;
+
+} range_index_t;
+
+
+
+void sort_ranges(range_t *ranges, uint64_t num_ranges);
+range_index_t *build_range_index(const range_t *ranges, uint64_t num_ranges, range_overlap_t overlap);
+void release_range_index(range_index_t *index);
+int64_t find_range(range_index_t *index, uint64_t address);
+# 19 "include/lookup.h" 2
+
+
+
+
+
+
+typedef enum
+{
+
+    LOOKUP_GNU_HASH,
+
+
+    LOOKUP_SYSV_HASH,
+
+
+    LOOKUP_BUILT_HASH
+
+} lookup_method_t;
+# 49 "include/lookup.h"
+typedef struct
+{
+    lookup_method_t method;
+
+
+    int file_class;
+
+
+    symbol_table_t symbols;
+    string_view_t table_name;
+
+
+    uint16_t *versions;
+
+
+
+
+
+
+    uint32_t num_gnu_buckets;
+    uint32_t symbol_offset;
+    uint32_t bloom_size;
+    uint32_t bloom_shift;
+    void *bloom;
+    uint32_t *gnu_buckets;
+    uint32_t *gnu_chain;
+
+
+
+    uint32_t num_sysv_buckets;
+    uint32_t *sysv_buckets;
+    uint32_t *sysv_chain;
+# 89 "include/lookup.h"
+    uint32_t *slot_symbols;
+    uint32_t *slot_hashes;
+    uint64_t slot_mask;
+
+} symbol_index_t;
+# 103 "include/lookup.h"
+typedef struct
+{
+    range_index_t *ranges;
+
+
+    string_view_t *names;
+
+} address_index_t;
+# 122 "include/lookup.h"
+typedef struct
+{
+    section_name_table_t *section_names;
+
+
+    int *sections;
+
+
+
+
+
+
+    uint32_t *slot_starts;
+    uint32_t *slot_counts;
+    uint32_t *slot_hashes;
+    uint64_t slot_mask;
+
+} section_name_index_t;
+
+
+
+symbol_index_t *build_ELF32_symbol_index(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                                         ELF32_Program_Header_t *program_header_table, section_name_table_t *section_names);
+symbol_index_t *build_ELF64_symbol_index(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                                         ELF64_Program_Header_t *program_header_table, section_name_table_t *section_names);
+void release_symbol_index(symbol_index_t *index);
+
+address_index_t *build_ELF32_address_index(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+address_index_t *build_ELF64_address_index(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+void release_address_index(address_index_t *index);
+
+section_name_index_t *build_section_name_index(section_name_table_t *section_names);
+void release_section_name_index(section_name_index_t *index);
+
+
+int64_t find_symbol(symbol_index_t *index, const char *name, size_t length);
+int find_sections(section_name_index_t *index, const char *name, size_t length, const int **sections);
+# 17 "include/stringify.h" 2
+# 1 "include/debug.h" 1
+# 16 "include/debug.h"
+# 1 "/usr/include/pthread.h" 1 3 4
+# 22 "/usr/include/pthread.h" 3 4
+# 1 "/usr/include/sched.h" 1 3 4
+# 29 "/usr/include/sched.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/sched.h" 2 3 4
+# 43 "/usr/include/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/sched.h" 1 3 4
+# 80 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+struct sched_param
+{
+  int sched_priority;
+};
+# 81 "/usr/include/x86_64-linux-gnu/bits/sched.h" 2 3 4
+
+
+# 102 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+
+# 44 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+typedef unsigned long int __cpu_mask;
+
+
+
+
+
+
+typedef struct
+{
+  __cpu_mask __bits[1024 / (8 * sizeof (__cpu_mask))];
+} cpu_set_t;
+# 115 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+
+
+extern int __sched_cpucount (size_t __setsize, const cpu_set_t *__setp)
+     __attribute__ ((__nothrow__ , __leaf__));
+extern cpu_set_t *__sched_cpualloc (size_t __count) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern void __sched_cpufree (cpu_set_t *__set) __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 45 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+
+
+
+
+extern int sched_setparam (__pid_t __pid, const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getparam (__pid_t __pid, struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_setscheduler (__pid_t __pid, int __policy,
+          const struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getscheduler (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_max (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_min (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int sched_rr_get_interval (__pid_t __pid, struct timespec *__t) __attribute__ ((__nothrow__ , __leaf__));
+# 138 "/usr/include/sched.h" 3 4
+
+# 23 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/time.h" 1 3 4
+# 29 "/usr/include/time.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
+# 34 "/usr/include/time.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h" 1 3 4
+
+
+
+
+
+
+struct tm
+{
+  int tm_sec;
+  int tm_min;
+  int tm_hour;
+  int tm_mday;
+  int tm_mon;
+  int tm_year;
+  int tm_wday;
+  int tm_yday;
+  int tm_isdst;
+
+
+  long int tm_gmtoff;
+  const char *tm_zone;
+
+
+
+
+};
+# 40 "/usr/include/time.h" 2 3 4
+# 48 "/usr/include/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h" 1 3 4
+
+
+
+
+
+
+
+struct itimerspec
+  {
+    struct timespec it_interval;
+    struct timespec it_value;
+  };
+# 49 "/usr/include/time.h" 2 3 4
+struct sigevent;
+# 68 "/usr/include/time.h" 3 4
+
+
+
+
+extern clock_t clock (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern time_t time (time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double difftime (time_t __time1, time_t __time0)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern time_t mktime (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 100 "/usr/include/time.h" 3 4
+extern size_t strftime (char *__restrict __s, size_t __maxsize,
+   const char *__restrict __format,
+   const struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 116 "/usr/include/time.h" 3 4
+extern size_t strftime_l (char *__restrict __s, size_t __maxsize,
+     const char *__restrict __format,
+     const struct tm *__restrict __tp,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+# 132 "/usr/include/time.h" 3 4
+extern struct tm *gmtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 154 "/usr/include/time.h" 3 4
+extern struct tm *gmtime_r (const time_t *__restrict __timer,
+       struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime_r (const time_t *__restrict __timer,
+          struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 179 "/usr/include/time.h" 3 4
+extern char *asctime (const struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 197 "/usr/include/time.h" 3 4
+extern char *asctime_r (const struct tm *__restrict __tp,
+   char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime_r (const time_t *__restrict __timer,
+        char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+# 217 "/usr/include/time.h" 3 4
+extern char *__tzname[2];
+extern int __daylight;
+extern long int __timezone;
+
+
+
+
+extern char *tzname[2];
+
+
+
+extern void tzset (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int daylight;
+extern long int timezone;
+# 246 "/usr/include/time.h" 3 4
+extern time_t timegm (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 263 "/usr/include/time.h" 3 4
+extern time_t timelocal (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int dysize (int __year) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 281 "/usr/include/time.h" 3 4
+extern int nanosleep (const struct timespec *__requested_time,
+        struct timespec *__remaining);
+
+
+extern int clock_getres (clockid_t __clock_id, struct timespec *__res) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int clock_gettime (clockid_t __clock_id, struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int clock_settime (clockid_t __clock_id, const struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 323 "/usr/include/time.h" 3 4
+extern int clock_nanosleep (clockid_t __clock_id, int __flags,
+       const struct timespec *__req,
+       struct timespec *__rem);
+# 338 "/usr/include/time.h" 3 4
+extern int clock_getcpuclockid (pid_t __pid, clockid_t *__clock_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int timer_create (clockid_t __clock_id,
+    struct sigevent *__restrict __evp,
+    timer_t *__restrict __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_delete (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int timer_settime (timer_t __timerid, int __flags,
+     const struct itimerspec *__restrict __value,
+     struct itimerspec *__restrict __ovalue) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_gettime (timer_t __timerid, struct itimerspec *__value)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 376 "/usr/include/time.h" 3 4
+extern int timer_getoverrun (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int timespec_get (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 452 "/usr/include/time.h" 3 4
+
+# 24 "/usr/include/pthread.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 2 3 4
+
+
+
+
+typedef long int __jmp_buf[8];
+# 28 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 29 "/usr/include/pthread.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 3 4
+struct __jmp_buf_tag
+  {
+
+
+
+
+    __jmp_buf __jmpbuf;
+    int __mask_was_saved;
+    __sigset_t __saved_mask;
+  };
+# 32 "/usr/include/pthread.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 2 3 4
+# 34 "/usr/include/pthread.h" 2 3 4
+
+
+
+enum
+{
+  PTHREAD_CREATE_JOINABLE,
+
+  PTHREAD_CREATE_DETACHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_ADAPTIVE_NP
+
+  ,
+  PTHREAD_MUTEX_NORMAL = PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE = PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK = PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_DEFAULT = PTHREAD_MUTEX_NORMAL
+
+
+
+
+
+};
+
+
+
+
+enum
+{
+  PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_STALLED_NP = PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_ROBUST,
+  PTHREAD_MUTEX_ROBUST_NP = PTHREAD_MUTEX_ROBUST
+};
+
+
+
+
+
+enum
+{
+  PTHREAD_PRIO_NONE,
+  PTHREAD_PRIO_INHERIT,
+  PTHREAD_PRIO_PROTECT
+};
+# 104 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_RWLOCK_PREFER_READER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP,
+  PTHREAD_RWLOCK_DEFAULT_NP = PTHREAD_RWLOCK_PREFER_READER_NP
+};
+# 124 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_INHERIT_SCHED,
+
+  PTHREAD_EXPLICIT_SCHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_SCOPE_SYSTEM,
+
+  PTHREAD_SCOPE_PROCESS
+
+};
+
+
+
+enum
+{
+  PTHREAD_PROCESS_PRIVATE,
+
+  PTHREAD_PROCESS_SHARED
+
+};
+# 159 "/usr/include/pthread.h" 3 4
+struct _pthread_cleanup_buffer
+{
+  void (*__routine) (void *);
+  void *__arg;
+  int __canceltype;
+  struct _pthread_cleanup_buffer *__prev;
+};
+
+
+enum
+{
+  PTHREAD_CANCEL_ENABLE,
+
+  PTHREAD_CANCEL_DISABLE
+
+};
+enum
+{
+  PTHREAD_CANCEL_DEFERRED,
+
+  PTHREAD_CANCEL_ASYNCHRONOUS
+
+};
+# 197 "/usr/include/pthread.h" 3 4
+
+
+
+
+
+extern int pthread_create (pthread_t *__restrict __newthread,
+      const pthread_attr_t *__restrict __attr,
+      void *(*__start_routine) (void *),
+      void *__restrict __arg) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+
+extern void pthread_exit (void *__retval) __attribute__ ((__noreturn__));
+
+
+
+
+
+
+
+extern int pthread_join (pthread_t __th, void **__thread_return);
+# 269 "/usr/include/pthread.h" 3 4
+extern int pthread_detach (pthread_t __th) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern pthread_t pthread_self (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern int pthread_equal (pthread_t __thread1, pthread_t __thread2)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+
+
+extern int pthread_attr_init (pthread_attr_t *__attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_destroy (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getdetachstate (const pthread_attr_t *__attr,
+     int *__detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setdetachstate (pthread_attr_t *__attr,
+     int __detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getguardsize (const pthread_attr_t *__attr,
+          size_t *__guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setguardsize (pthread_attr_t *__attr,
+          size_t __guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getschedparam (const pthread_attr_t *__restrict __attr,
+           struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedparam (pthread_attr_t *__restrict __attr,
+           const struct sched_param *__restrict
+           __param) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_getschedpolicy (const pthread_attr_t *__restrict
+     __attr, int *__restrict __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedpolicy (pthread_attr_t *__attr, int __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getinheritsched (const pthread_attr_t *__restrict
+      __attr, int *__restrict __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setinheritsched (pthread_attr_t *__attr,
+      int __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getscope (const pthread_attr_t *__restrict __attr,
+      int *__restrict __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setscope (pthread_attr_t *__attr, int __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getstackaddr (const pthread_attr_t *__restrict
+          __attr, void **__restrict __stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__deprecated__));
+
+
+
+
+
+extern int pthread_attr_setstackaddr (pthread_attr_t *__attr,
+          void *__stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__));
+
+
+extern int pthread_attr_getstacksize (const pthread_attr_t *__restrict
+          __attr, size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_attr_setstacksize (pthread_attr_t *__attr,
+          size_t __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getstack (const pthread_attr_t *__restrict __attr,
+      void **__restrict __stackaddr,
+      size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+
+extern int pthread_attr_setstack (pthread_attr_t *__attr, void *__stackaddr,
+      size_t __stacksize) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 441 "/usr/include/pthread.h" 3 4
+extern int pthread_setschedparam (pthread_t __target_thread, int __policy,
+      const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getschedparam (pthread_t __target_thread,
+      int *__restrict __policy,
+      struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+extern int pthread_setschedprio (pthread_t __target_thread, int __prio)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 509 "/usr/include/pthread.h" 3 4
+extern int pthread_once (pthread_once_t *__once_control,
+    void (*__init_routine) (void)) __attribute__ ((__nonnull__ (1, 2)));
+# 521 "/usr/include/pthread.h" 3 4
+extern int pthread_setcancelstate (int __state, int *__oldstate);
+
+
+
+extern int pthread_setcanceltype (int __type, int *__oldtype);
+
+
+extern int pthread_cancel (pthread_t __th);
+
+
+
+
+extern void pthread_testcancel (void);
+
+
+
+
+struct __cancel_jmp_buf_tag
+{
+  __jmp_buf __cancel_jmp_buf;
+  int __mask_was_saved;
+};
+
+typedef struct
+{
+  struct __cancel_jmp_buf_tag __cancel_jmp_buf[1];
+  void *__pad[4];
+} __pthread_unwind_buf_t __attribute__ ((__aligned__));
+# 557 "/usr/include/pthread.h" 3 4
+struct __pthread_cleanup_frame
+{
+  void (*__cancel_routine) (void *);
+  void *__cancel_arg;
+  int __do_it;
+  int __cancel_type;
+};
+# 697 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel (__pthread_unwind_buf_t *__buf)
+     ;
+# 709 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel (__pthread_unwind_buf_t *__buf)
+  ;
+# 750 "/usr/include/pthread.h" 3 4
+extern void __pthread_unwind_next (__pthread_unwind_buf_t *__buf)
+     __attribute__ ((__noreturn__))
+
+     __attribute__ ((__weak__))
+
+     ;
+# 766 "/usr/include/pthread.h" 3 4
+extern int __sigsetjmp_cancel (struct __cancel_jmp_buf_tag __env[1], int __savemask) __asm__ ("" "__sigsetjmp") __attribute__ ((__nothrow__))
+
+
+                     __attribute__ ((__returns_twice__));
+# 781 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_init (pthread_mutex_t *__mutex,
+          const pthread_mutexattr_t *__mutexattr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_destroy (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_trylock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_lock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_mutex_timedlock (pthread_mutex_t *__restrict __mutex,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 835 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_unlock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutex_getprioceiling (const pthread_mutex_t *
+      __restrict __mutex,
+      int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutex_setprioceiling (pthread_mutex_t *__restrict __mutex,
+      int __prioceiling,
+      int *__restrict __old_ceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+extern int pthread_mutex_consistent (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 874 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_init (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_destroy (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getpshared (const pthread_mutexattr_t *
+      __restrict __attr,
+      int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setpshared (pthread_mutexattr_t *__attr,
+      int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_gettype (const pthread_mutexattr_t *__restrict
+          __attr, int *__restrict __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_mutexattr_settype (pthread_mutexattr_t *__attr, int __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getprotocol (const pthread_mutexattr_t *
+       __restrict __attr,
+       int *__restrict __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutexattr_setprotocol (pthread_mutexattr_t *__attr,
+       int __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getprioceiling (const pthread_mutexattr_t *
+          __restrict __attr,
+          int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setprioceiling (pthread_mutexattr_t *__attr,
+          int __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getrobust (const pthread_mutexattr_t *__attr,
+     int *__robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 946 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_setrobust (pthread_mutexattr_t *__attr,
+     int __robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 967 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_init (pthread_rwlock_t *__restrict __rwlock,
+    const pthread_rwlockattr_t *__restrict
+    __attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_destroy (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_rdlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_tryrdlock (pthread_rwlock_t *__rwlock)
+  __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedrdlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1023 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_wrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_trywrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedwrlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1071 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_unlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_rwlockattr_init (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_destroy (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getpshared (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setpshared (pthread_rwlockattr_t *__attr,
+       int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getkind_np (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pref)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setkind_np (pthread_rwlockattr_t *__attr,
+       int __pref) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int pthread_cond_init (pthread_cond_t *__restrict __cond,
+         const pthread_condattr_t *__restrict __cond_attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_destroy (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_signal (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_broadcast (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_cond_wait (pthread_cond_t *__restrict __cond,
+         pthread_mutex_t *__restrict __mutex)
+     __attribute__ ((__nonnull__ (1, 2)));
+# 1145 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_timedwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 3)));
+# 1194 "/usr/include/pthread.h" 3 4
+extern int pthread_condattr_init (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_destroy (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_getpshared (const pthread_condattr_t *
+     __restrict __attr,
+     int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setpshared (pthread_condattr_t *__attr,
+     int __pshared) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_condattr_getclock (const pthread_condattr_t *
+          __restrict __attr,
+          __clockid_t *__restrict __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setclock (pthread_condattr_t *__attr,
+          __clockid_t __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1230 "/usr/include/pthread.h" 3 4
+extern int pthread_spin_init (pthread_spinlock_t *__lock, int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_destroy (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_lock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_trylock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_unlock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_barrier_init (pthread_barrier_t *__restrict __barrier,
+     const pthread_barrierattr_t *__restrict
+     __attr, unsigned int __count)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_destroy (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_wait (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_barrierattr_init (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_destroy (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_getpshared (const pthread_barrierattr_t *
+        __restrict __attr,
+        int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_barrierattr_setpshared (pthread_barrierattr_t *__attr,
+        int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1297 "/usr/include/pthread.h" 3 4
+extern int pthread_key_create (pthread_key_t *__key,
+          void (*__destr_function) (void *))
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_key_delete (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void *pthread_getspecific (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setspecific (pthread_key_t __key,
+    const void *__pointer)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__access__ (__none__, 2)));
+
+
+
+
+extern int pthread_getcpuclockid (pthread_t __thread_id,
+      __clockid_t *__clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 1332 "/usr/include/pthread.h" 3 4
+extern int pthread_atfork (void (*__prepare) (void),
+      void (*__parent) (void),
+      void (*__child) (void)) __attribute__ ((__nothrow__ , __leaf__));
+# 1346 "/usr/include/pthread.h" 3 4
+
+# 17 "include/debug.h" 2
+
+
+# 1 "include/dwarf.h" 1
+# 20 "include/debug.h" 2
+# 29 "include/debug.h"
+
+# 29 "include/debug.h"
+typedef enum
+{
+    DBG_CMD_DUMP_ABBREV,
+    DBG_CMD_DUMP_ADDR,
+    DBG_CMD_DUMP_FRAMES,
+    DBG_CMD_DUMP_NAMES,
+    DBG_CMD_DUMP_INFO,
+    DBG_CMD_DUMP_ARANGES
+
+} debug_command_subtype;
+# 48 "include/debug.h"
+typedef struct
+{
+    uint32_t name;
+    uint32_t form;
+    int64_t implicit_const;
+
+} abbrev_attribute_t;
+
+
+
+
+
+
+
+typedef struct
+{
+    uint64_t code;
+    uint32_t tag;
+    
+# 66 "include/debug.h" 3 4
+   _Bool 
+# 66 "include/debug.h"
+        has_children;
+
+    uint32_t num_attributes;
+    abbrev_attribute_t *attributes;
+
+} abbrev_t;
+# 85 "include/debug.h"
+typedef struct
+{
+
+    uint64_t offset;
+    uint64_t end_offset;
+
+
+    uint64_t num_abbrevs;
+    abbrev_t *abbrevs;
+
+
+    abbrev_attribute_t *attributes;
+
+
+    uint64_t num_codes;
+    abbrev_t **by_code;
+
+
+    abbrev_t **slots;
+    uint64_t slot_mask;
+
+} abbrev_table_t;
+# 117 "include/debug.h"
+typedef struct
+{
+    pthread_mutex_t lock;
+
+
+    const unsigned char *section;
+    uint64_t section_size;
+
+
+    uint64_t num_tables;
+    abbrev_table_t **slots;
+    uint64_t slot_mask;
+
+} abbrev_cache_t;
+# 139 "include/debug.h"
+typedef struct
+{
+
+    uint64_t offset;
+    uint64_t die_offset;
+    uint64_t end_offset;
+
+    uint64_t length;
+    uint16_t version;
+    uint8_t unit_type;
+    uint8_t address_size;
+
+
+    uint8_t offset_size;
+
+    uint64_t abbrev_offset;
+
+
+    uint64_t type_signature;
+    uint64_t type_offset;
+    uint64_t dwo_id;
+
+} unit_header_t;
+# 184 "include/debug.h"
+typedef struct
+{
+    const unsigned char *section;
+    const unsigned char *position;
+    const unsigned char *end;
+
+    unit_header_t *unit;
+    abbrev_table_t *abbrevs;
+
+
+    int depth;
+
+
+    int8_t form_sizes[(0x2c + 1)];
+
+} die_reader_t;
+
+
+
+
+
+
+
+typedef struct
+{
+    uint64_t offset;
+    int depth;
+    abbrev_t *abbrev;
+
+} die_t;
+# 225 "include/debug.h"
+typedef struct
+{
+    uint32_t name;
+    uint32_t form;
+
+    uint64_t value;
+    const unsigned char *data;
+
+} attribute_value_t;
+# 245 "include/debug.h"
+typedef struct
+{
+    const unsigned char *str;
+    uint64_t str_size;
+
+    const unsigned char *line_str;
+    uint64_t line_str_size;
+
+    const unsigned char *str_offsets;
+    uint64_t str_offsets_size;
+
+    const unsigned char *addr;
+    uint64_t addr_size;
+
+
+    uint64_t str_offsets_base;
+    uint64_t addr_base;
+    uint8_t offset_size;
+    uint8_t address_size;
+
+} debug_strings_t;
+
+
+
+
+
+
+
+typedef struct
+{
+
+    uint64_t offset;
+    uint64_t ranges_offset;
+    uint64_t end_offset;
+
+    uint64_t length;
+    uint16_t version;
+    uint8_t offset_size;
+
+    uint64_t info_offset;
+    uint8_t address_size;
+    uint8_t segment_size;
+
+} aranges_header_t;
+
+
+
+typedef enum
+{
+    DIE_OK,
+    DIE_END_OF_UNIT,
+    DIE_CORRUPT
+
+} die_status_t;
+
+
+
+
+# 302 "include/debug.h" 3 4
+_Bool 
+# 302 "include/debug.h"
+    read_uleb128(const unsigned char **position, const unsigned char *end, uint64_t *value);
+
+# 303 "include/debug.h" 3 4
+_Bool 
+# 303 "include/debug.h"
+    read_sleb128(const unsigned char **position, const unsigned char *end, int64_t *value);
+
+# 304 "include/debug.h" 3 4
+_Bool 
+# 304 "include/debug.h"
+    read_unsigned(const unsigned char **position, const unsigned char *end, int size, uint64_t *value);
+
+abbrev_table_t *parse_abbrev_table(const unsigned char *section, uint64_t section_size, uint64_t offset);
+void release_abbrev_table(abbrev_table_t *table);
+abbrev_t *find_abbrev(abbrev_table_t *table, uint64_t code);
+
+abbrev_cache_t *create_abbrev_cache(const unsigned char *section, uint64_t section_size);
+void release_abbrev_cache(abbrev_cache_t *cache);
+abbrev_table_t *get_abbrev_table(abbrev_cache_t *cache, uint64_t offset);
+
+
+# 314 "include/debug.h" 3 4
+_Bool 
+# 314 "include/debug.h"
+    read_aranges_header(const unsigned char *section, uint64_t section_size, uint64_t offset, aranges_header_t *header);
+
+# 315 "include/debug.h" 3 4
+_Bool 
+# 315 "include/debug.h"
+    read_arange(const unsigned char **position, const unsigned char *end, aranges_header_t *header, uint64_t *address, uint64_t *length);
+range_index_t *build_unit_address_index(const unsigned char *section, uint64_t section_size);
+
+
+# 318 "include/debug.h" 3 4
+_Bool 
+# 318 "include/debug.h"
+    read_unit_header(const unsigned char *section, uint64_t section_size, uint64_t offset, unit_header_t *unit);
+uint64_t read_unit_headers(const unsigned char *section, uint64_t section_size, unit_header_t **units);
+void init_die_reader(die_reader_t *reader, const unsigned char *section, unit_header_t *unit, abbrev_table_t *abbrevs);
+die_status_t read_die(die_reader_t *reader, die_t *die);
+
+# 322 "include/debug.h" 3 4
+_Bool 
+# 322 "include/debug.h"
+    read_attribute(die_reader_t *reader, abbrev_attribute_t *attribute, attribute_value_t *value);
+
+# 323 "include/debug.h" 3 4
+_Bool 
+# 323 "include/debug.h"
+    skip_attributes(die_reader_t *reader, abbrev_attribute_t *attributes, uint32_t num_attributes);
+const char *get_attribute_string(attribute_value_t *value, debug_strings_t *strings, uint64_t *length);
+void read_unit_bases(const unsigned char *section, unit_header_t *unit, abbrev_table_t *abbrevs, debug_strings_t *strings);
+
+# 326 "include/debug.h" 3 4
+_Bool 
+# 326 "include/debug.h"
+    get_indexed_string_offset(debug_strings_t *strings, uint64_t index, uint64_t *offset);
+
+# 327 "include/debug.h" 3 4
+_Bool 
+# 327 "include/debug.h"
+    get_indexed_address(debug_strings_t *strings, uint64_t index, uint64_t *address);
+# 18 "include/stringify.h" 2
+# 1 "include/frame.h" 1
+# 29 "include/frame.h"
+typedef struct
+{
+    const unsigned char *data;
+    uint64_t size;
+    uint64_t address;
+
+    
+# 35 "include/frame.h" 3 4
+   _Bool 
+# 35 "include/frame.h"
+        is_eh_frame;
+
+
+    int address_size;
+
+} frame_section_t;
+# 49 "include/frame.h"
+typedef struct
+{
+    uint64_t offset;
+    uint64_t length;
+    uint64_t end_offset;
+
+
+    uint64_t id;
+
+    uint8_t version;
+    const char *augmentation;
+
+    uint64_t code_alignment;
+    int64_t data_alignment;
+    uint64_t return_address_register;
+
+
+    
+# 66 "include/frame.h" 3 4
+   _Bool 
+# 66 "include/frame.h"
+        has_augmentation_data;
+    const unsigned char *augmentation_data;
+    uint64_t augmentation_data_length;
+
+
+    uint8_t fde_encoding;
+    uint8_t lsda_encoding;
+    uint8_t personality_encoding;
+    uint64_t personality;
+    
+# 75 "include/frame.h" 3 4
+   _Bool 
+# 75 "include/frame.h"
+        is_signal_frame;
+
+
+    uint8_t address_size;
+    uint8_t segment_size;
+
+    const unsigned char *instructions;
+    uint64_t instructions_length;
+
+} cie_t;
+
+
+
+
+
+
+
+typedef struct
+{
+    uint64_t offset;
+    uint64_t length;
+    uint64_t end_offset;
+
+
+    uint64_t cie_pointer;
+    uint64_t cie_offset;
+
+    uint64_t pc_begin;
+    uint64_t pc_range;
+
+    const unsigned char *augmentation_data;
+    uint64_t augmentation_data_length;
+
+    const unsigned char *instructions;
+    uint64_t instructions_length;
+
+} fde_t;
+
+
+
+typedef enum
+{
+    FRAME_ENTRY_CIE,
+    FRAME_ENTRY_FDE,
+
+
+    FRAME_ENTRY_TERMINATOR,
+
+    FRAME_ENTRY_CORRUPT
+
+} frame_entry_type_t;
+# 135 "include/frame.h"
+typedef struct
+{
+
+    uint8_t opcode;
+
+    uint64_t register_number;
+    uint64_t second_register;
+    int64_t offset;
+    uint64_t address;
+
+    const unsigned char *expression;
+    uint64_t expression_length;
+
+} cfa_instruction_t;
+# 160 "include/frame.h"
+typedef struct
+{
+
+    frame_section_t section;
+
+    uint64_t eh_frame_address;
+
+    uint8_t table_encoding;
+    int field_size;
+
+    uint64_t num_entries;
+    const unsigned char *table;
+
+} eh_frame_hdr_t;
+
+
+
+
+# 177 "include/frame.h" 3 4
+_Bool 
+# 177 "include/frame.h"
+    read_encoded_pointer(frame_section_t *section, const unsigned char **position, const unsigned char *end,
+                          uint8_t encoding, uint64_t *value);
+
+frame_entry_type_t read_frame_entry_type(frame_section_t *section, uint64_t offset, uint64_t *end_offset);
+
+# 181 "include/frame.h" 3 4
+_Bool 
+# 181 "include/frame.h"
+    read_cie(frame_section_t *section, uint64_t offset, cie_t *cie);
+
+# 182 "include/frame.h" 3 4
+_Bool 
+# 182 "include/frame.h"
+    read_fde(frame_section_t *section, uint64_t offset, cie_t *cie, fde_t *fde);
+
+
+# 184 "include/frame.h" 3 4
+_Bool 
+# 184 "include/frame.h"
+    read_cfa_instruction(frame_section_t *section, cie_t *cie, const unsigned char **position, const unsigned char *end,
+                          uint64_t *location, cfa_instruction_t *instruction);
+
+range_index_t *build_fde_index(frame_section_t *section);
+
+
+# 189 "include/frame.h" 3 4
+_Bool 
+# 189 "include/frame.h"
+    read_eh_frame_hdr(frame_section_t *section, eh_frame_hdr_t *header);
+int64_t find_eh_frame_hdr_entry(eh_frame_hdr_t *header, uint64_t address, uint64_t *fde_address);
+# 19 "include/stringify.h" 2
+# 1 "include/names.h" 1
+# 13 "include/names.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 14 "include/names.h" 2
+# 28 "include/names.h"
+typedef struct
+{
+    uint64_t code;
+    uint32_t tag;
+
+    uint32_t num_attributes;
+    abbrev_attribute_t *attributes;
+
+} names_abbrev_t;
+# 49 "include/names.h"
+typedef struct
+{
+
+    uint64_t offset;
+    uint64_t end_offset;
+
+    uint64_t length;
+    uint16_t version;
+    uint8_t offset_size;
+
+    uint32_t comp_unit_count;
+    uint32_t local_type_unit_count;
+    uint32_t foreign_type_unit_count;
+    uint32_t bucket_count;
+    uint32_t name_count;
+    uint32_t abbrev_table_size;
+
+    const char *augmentation;
+    uint32_t augmentation_size;
+
+
+    const unsigned char *comp_units;
+    const unsigned char *local_type_units;
+    const unsigned char *foreign_type_units;
+
+
+    const unsigned char *buckets;
+    const unsigned char *hashes;
+    const unsigned char *string_offsets;
+    const unsigned char *entry_offsets;
+
+
+    const unsigned char *entry_pool;
+    const unsigned char *end;
+
+    uint64_t num_abbrevs;
+    names_abbrev_t *abbrevs;
+    abbrev_attribute_t *attributes;
+
+} names_table_t;
+
+
+
+
+
+
+
+typedef struct
+{
+    uint64_t num_tables;
+    names_table_t *tables;
+
+} names_index_t;
+# 110 "include/names.h"
+typedef struct
+{
+
+    uint64_t offset;
+
+    uint64_t code;
+    names_abbrev_t *abbrev;
+
+    
+# 118 "include/names.h" 3 4
+   _Bool 
+# 118 "include/names.h"
+        has_compile_unit;
+    
+# 119 "include/names.h" 3 4
+   _Bool 
+# 119 "include/names.h"
+        has_type_unit;
+    
+# 120 "include/names.h" 3 4
+   _Bool 
+# 120 "include/names.h"
+        has_die_offset;
+    
+# 121 "include/names.h" 3 4
+   _Bool 
+# 121 "include/names.h"
+        has_parent;
+
+    uint64_t compile_unit;
+    uint64_t type_unit;
+    uint64_t die_offset;
+
+
+    uint64_t parent;
+
+} names_entry_t;
+
+
+
+
+# 134 "include/names.h" 3 4
+_Bool 
+# 134 "include/names.h"
+    read_names_table(const unsigned char *section, uint64_t section_size, uint64_t offset, names_table_t *table);
+void release_names_table(names_table_t *table);
+
+names_index_t *build_names_index(const unsigned char *section, uint64_t section_size);
+void release_names_index(names_index_t *index);
+
+uint32_t hash_debug_name(const char *name, size_t length);
+uint64_t get_names_table_value(names_table_t *table, const unsigned char *array, uint64_t number, int size);
+int64_t find_debug_name(names_table_t *table, const unsigned char *str, uint64_t str_size, const char *name, size_t length);
+
+# 143 "include/names.h" 3 4
+_Bool 
+# 143 "include/names.h"
+    read_names_entry(names_table_t *table, const unsigned char **position, names_entry_t *entry);
+
+# 144 "include/names.h" 3 4
+_Bool 
+# 144 "include/names.h"
+    get_names_entry_die(names_table_t *table, names_entry_t *entry, uint64_t *die_offset);
+# 20 "include/stringify.h" 2
+
+
+
+
+int stringify_ELF32_header(output_t *output, ELF32_Header_t *elf_header, ELF32_Section_Header_t *section_header_table);
+int stringify_ELF32_section_header_table(output_t *output, ELF32_Section_Header_t *section_header_table, ELF32_Header_t *file_header, section_name_table_t *section_header_names);
+int stringify_ELF32_program_header_table(output_t *output, ELF32_Program_Header_t *program_header_table, ELF32_Header_t *file_header,
+                                         section_to_segment_mapping_t *section_to_segment_mapping, section_name_table_t *section_names);
+int stringify_ELF32_symbol_table(output_t *output, symbol_table_t *symbol_table, string_view_t section_name);
+void stringify_ELF32_symbol(output_t *output, symbol_table_t *symbol_table, uint64_t symbol_number);
+int stringify_ELF32_relocation_table(output_t *output, relocation_table_t *relocation_table, ELF32_Section_Header_t *section_header,
+                                      string_view_t section_name, int machine, section_name_table_t *section_names);
+
+
+
+int stringify_ELF64_header(output_t *output, ELF64_Header_t *elf_header, ELF64_Section_Header_t *section_header_table);
+int stringify_ELF64_section_header_table(output_t *output, ELF64_Section_Header_t *section_header_table, ELF64_Header_t *file_header, section_name_table_t *section_header_names);
+int stringify_ELF64_program_header_table(output_t *output, ELF64_Program_Header_t *program_header_table, ELF64_Header_t *file_header,
+                                         section_to_segment_mapping_t *section_to_segment_mapping, section_name_table_t *section_names);
+int stringify_ELF64_symbol_table(output_t *output, symbol_table_t *symbol_table, string_view_t section_name);
+void stringify_ELF64_symbol(output_t *output, symbol_table_t *symbol_table, uint64_t symbol_number);
+int stringify_ELF64_relocation_table(output_t *output, relocation_table_t *relocation_table, ELF64_Section_Header_t *section_header,
+                                      string_view_t section_name, int machine, section_name_table_t *section_names);
+
+
+
+void stringify_symbol_lookup_title(output_t *output, symbol_index_t *index);
+void stringify_missing_symbol(output_t *output, const char *name, size_t length);
+
+void stringify_debug_abbrev_table(output_t *output, abbrev_table_t *table);
+void stringify_debug_unit_header(output_t *output, unit_header_t *unit);
+void stringify_debug_die(output_t *output, die_t *die);
+void stringify_debug_attribute(output_t *output, uint64_t offset, attribute_value_t *value, debug_strings_t *strings);
+void stringify_debug_aranges_header(output_t *output, aranges_header_t *header);
+void stringify_debug_arange(output_t *output, uint64_t address, uint64_t length, int address_size);
+void stringify_debug_cie(output_t *output, cie_t *cie, int address_size);
+void stringify_debug_fde(output_t *output, fde_t *fde, int address_size);
+void stringify_debug_cfa_instruction(output_t *output, cfa_instruction_t *instruction, int address_size, int machine);
+void stringify_fde_index(output_t *output, range_index_t *index, const char *section_name, int address_size);
+void stringify_debug_names_header(output_t *output, names_table_t *table);
+void stringify_debug_names_buckets(output_t *output, names_table_t *table, uint64_t buckets_used, uint64_t longest_bucket);
+void stringify_debug_name(output_t *output, uint64_t number, uint32_t hash, 
+# 61 "include/stringify.h" 3 4
+                                                                           _Bool 
+# 61 "include/stringify.h"
+                                                                                has_hash, const char *name, uint64_t length);
+void stringify_debug_names_entry(output_t *output, names_entry_t *entry);
+void stringify_debug_name_match(output_t *output, const char *name, size_t length, uint64_t die_offset, uint32_t tag);
+# 16 "src/stringify.c" 2
+# 1 "include/format.h" 1
+# 12 "include/format.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 13 "include/format.h" 2
+# 25 "include/format.h"
+int format_hex(char *destination, uint64_t value, int min_width);
+int format_decimal(char *destination, uint64_t value);
+int format_signed_decimal(char *destination, int64_t value);
+void format_hex_bytes(char *destination, const unsigned char *bytes, size_t num_bytes);
+# 17 "src/stringify.c" 2
+# 39 "src/stringify.c"
+static string_view_t section_types[] = {
+    [0] = { "NULL", sizeof("NULL") - 1 },
+    [1] = { "PROGBITS", sizeof("PROGBITS") - 1 },
+    [2] = { "SYMTAB", sizeof("SYMTAB") - 1 },
+    [3] = { "STRTAB", sizeof("STRTAB") - 1 },
+    [4] = { "RELA", sizeof("RELA") - 1 },
+    [5] = { "HASH", sizeof("HASH") - 1 },
+    [6] = { "DYNAMIC", sizeof("DYNAMIC") - 1 },
+    [7] = { "NOTE", sizeof("NOTE") - 1 },
+    [8] = { "NOBITS", sizeof("NOBITS") - 1 },
+    [9] = { "REL", sizeof("REL") - 1 },
+    [10] = { "SHLIB", sizeof("SHLIB") - 1 },
+    [11] = { "DYNSYM", sizeof("DYNSYM") - 1 },
+    [11 + 1] = { "UNKNOWN", sizeof("UNKNOWN") - 1 }
+};
+
+
+
+
+
+
+static char *segment_types[] = {
+    [0] = "NULL",
+    [1] = "LOAD",
+    [2] = "DYNAMIC",
+    [3] = "INTERP",
+    [4] = "NOTE",
+    [5] = "SHLIB",
+    [6] = "PHDR"
+};
+
+
+
+
+
+
+static char *symbol_types[] = {
+    [0] = "NOTYPE",
+    [1] = "OBJECT",
+    [2] = "FUNC",
+    [3] = "SECTION",
+    [4] = "FILE",
+    [5] = "COMMON",
+    [6] = "TLS",
+    [10] = "IFUNC"
+};
+
+
+static char *symbol_bindings[] = {
+    [0] = "LOCAL",
+    [1] = "GLOBAL",
+    [2] = "WEAK",
+    [10] = "UNIQUE"
+};
+
+
+static char *symbol_visibilities[] = {
+    [0] = "DEFAULT",
+    [1] = "INTERNAL",
+    [2] = "HIDDEN",
+    [3] = "PROTECTED"
+};
+
+
+
+
+
+
+
+static char *x86_64_relocation_types[] = {
+    [0] = "R_X86_64_NONE",
+    [1] = "R_X86_64_64",
+    [2] = "R_X86_64_PC32",
+    [3] = "R_X86_64_GOT32",
+    [4] = "R_X86_64_PLT32",
+    [5] = "R_X86_64_COPY",
+    [6] = "R_X86_64_GLOB_DAT",
+    [7] = "R_X86_64_JUMP_SLOT",
+    [8] = "R_X86_64_RELATIVE",
+    [9] = "R_X86_64_GOTPCREL",
+    [10] = "R_X86_64_32",
+    [11] = "R_X86_64_32S",
+    [12] = "R_X86_64_16",
+    [13] = "R_X86_64_PC16",
+    [14] = "R_X86_64_8",
+    [15] = "R_X86_64_PC8",
+    [16] = "R_X86_64_DTPMOD64",
+    [17] = "R_X86_64_DTPOFF64",
+    [18] = "R_X86_64_TPOFF64",
+    [19] = "R_X86_64_TLSGD",
+    [20] = "R_X86_64_TLSLD",
+    [21] = "R_X86_64_DTPOFF32",
+    [22] = "R_X86_64_GOTTPOFF",
+    [23] = "R_X86_64_TPOFF32",
+    [24] = "R_X86_64_PC64",
+    [25] = "R_X86_64_GOTOFF64",
+    [26] = "R_X86_64_GOTPC32",
+    [27] = "R_X86_64_GOT64",
+    [28] = "R_X86_64_GOTPCREL64",
+    [29] = "R_X86_64_GOTPC64",
+    [30] = "R_X86_64_GOTPLT64",
+    [31] = "R_X86_64_PLTOFF64",
+    [32] = "R_X86_64_SIZE32",
+    [33] = "R_X86_64_SIZE64",
+    [34] = "R_X86_64_GOTPC32_TLSDESC",
+    [35] = "R_X86_64_TLSDESC_CALL",
+    [36] = "R_X86_64_TLSDESC",
+    [37] = "R_X86_64_IRELATIVE",
+    [38] = "R_X86_64_RELATIVE64",
+    [41] = "R_X86_64_GOTPCRELX",
+    [42] = "R_X86_64_REX_GOTPCRELX"
+};
+
+
+static char *i386_relocation_types[] = {
+    [0] = "R_386_NONE",
+    [1] = "R_386_32",
+    [2] = "R_386_PC32",
+    [3] = "R_386_GOT32",
+    [4] = "R_386_PLT32",
+    [5] = "R_386_COPY",
+    [6] = "R_386_GLOB_DAT",
+    [7] = "R_386_JUMP_SLOT",
+    [8] = "R_386_RELATIVE",
+    [9] = "R_386_GOTOFF",
+    [10] = "R_386_GOTPC",
+    [11] = "R_386_32PLT",
+    [14] = "R_386_TLS_TPOFF",
+    [15] = "R_386_TLS_IE",
+    [16] = "R_386_TLS_GOTIE",
+    [17] = "R_386_TLS_LE",
+    [18] = "R_386_TLS_GD",
+    [19] = "R_386_TLS_LDM",
+    [20] = "R_386_16",
+    [21] = "R_386_PC16",
+    [22] = "R_386_8",
+    [23] = "R_386_PC8",
+    [24] = "R_386_TLS_GD_32",
+    [25] = "R_386_TLS_GD_PUSH",
+    [26] = "R_386_TLS_GD_CALL",
+    [27] = "R_386_TLS_GD_POP",
+    [28] = "R_386_TLS_LDM_32",
+    [29] = "R_386_TLS_LDM_PUSH",
+    [30] = "R_386_TLS_LDM_CALL",
+    [31] = "R_386_TLS_LDM_POP",
+    [32] = "R_386_TLS_LDO_32",
+    [33] = "R_386_TLS_IE_32",
+    [34] = "R_386_TLS_LE_32",
+    [35] = "R_386_TLS_DTPMOD32",
+    [36] = "R_386_TLS_DTPOFF32",
+    [37] = "R_386_TLS_TPOFF32",
+    [38] = "R_386_SIZE32",
+    [39] = "R_386_TLS_GOTDESC",
+    [40] = "R_386_TLS_DESC_CALL",
+    [41] = "R_386_TLS_DESC",
+    [42] = "R_386_IRELATIVE",
+    [43] = "R_386_GOT32X"
+};
+# 205 "src/stringify.c"
+typedef struct
+{
+    uint32_t value;
+    char *name;
+
+} dwarf_name_t;
+
+
+static char *dwarf_unit_types[] = {
+    [0x01] = "DW_UT_compile",
+    [0x02] = "DW_UT_type",
+    [0x03] = "DW_UT_partial",
+    [0x04] = "DW_UT_skeleton",
+    [0x05] = "DW_UT_split_compile",
+    [0x06] = "DW_UT_split_type"
+};
+
+
+static char *dwarf_tags[] = {
+    [0x01] = "DW_TAG_array_type",
+    [0x02] = "DW_TAG_class_type",
+    [0x03] = "DW_TAG_entry_point",
+    [0x04] = "DW_TAG_enumeration_type",
+    [0x05] = "DW_TAG_formal_parameter",
+    [0x08] = "DW_TAG_imported_declaration",
+    [0x0a] = "DW_TAG_label",
+    [0x0b] = "DW_TAG_lexical_block",
+    [0x0d] = "DW_TAG_member",
+    [0x0f] = "DW_TAG_pointer_type",
+    [0x10] = "DW_TAG_reference_type",
+    [0x11] = "DW_TAG_compile_unit",
+    [0x12] = "DW_TAG_string_type",
+    [0x13] = "DW_TAG_structure_type",
+    [0x15] = "DW_TAG_subroutine_type",
+    [0x16] = "DW_TAG_typedef",
+    [0x17] = "DW_TAG_union_type",
+    [0x18] = "DW_TAG_unspecified_parameters",
+    [0x19] = "DW_TAG_variant",
+    [0x1a] = "DW_TAG_common_block",
+    [0x1b] = "DW_TAG_common_inclusion",
+    [0x1c] = "DW_TAG_inheritance",
+    [0x1d] = "DW_TAG_inlined_subroutine",
+    [0x1e] = "DW_TAG_module",
+    [0x1f] = "DW_TAG_ptr_to_member_type",
+    [0x20] = "DW_TAG_set_type",
+    [0x21] = "DW_TAG_subrange_type",
+    [0x22] = "DW_TAG_with_stmt",
+    [0x23] = "DW_TAG_access_declaration",
+    [0x24] = "DW_TAG_base_type",
+    [0x25] = "DW_TAG_catch_block",
+    [0x26] = "DW_TAG_const_type",
+    [0x27] = "DW_TAG_constant",
+    [0x28] = "DW_TAG_enumerator",
+    [0x29] = "DW_TAG_file_type",
+    [0x2a] = "DW_TAG_friend",
+    [0x2b] = "DW_TAG_namelist",
+    [0x2c] = "DW_TAG_namelist_item",
+    [0x2d] = "DW_TAG_packed_type",
+    [0x2e] = "DW_TAG_subprogram",
+    [0x2f] = "DW_TAG_template_type_param",
+    [0x30] = "DW_TAG_template_value_param",
+    [0x31] = "DW_TAG_thrown_type",
+    [0x32] = "DW_TAG_try_block",
+    [0x33] = "DW_TAG_variant_part",
+    [0x34] = "DW_TAG_variable",
+    [0x35] = "DW_TAG_volatile_type",
+    [0x36] = "DW_TAG_dwarf_procedure",
+    [0x37] = "DW_TAG_restrict_type",
+    [0x38] = "DW_TAG_interface_type",
+    [0x39] = "DW_TAG_namespace",
+    [0x3a] = "DW_TAG_imported_module",
+    [0x3b] = "DW_TAG_unspecified_type",
+    [0x3c] = "DW_TAG_partial_unit",
+    [0x3d] = "DW_TAG_imported_unit",
+    [0x3f] = "DW_TAG_condition",
+    [0x40] = "DW_TAG_shared_type",
+    [0x41] = "DW_TAG_type_unit",
+    [0x42] = "DW_TAG_rvalue_reference_type",
+    [0x43] = "DW_TAG_template_alias",
+    [0x44] = "DW_TAG_coarray_type",
+    [0x45] = "DW_TAG_generic_subrange",
+    [0x46] = "DW_TAG_dynamic_type",
+    [0x47] = "DW_TAG_atomic_type",
+    [0x48] = "DW_TAG_call_site",
+    [0x49] = "DW_TAG_call_site_parameter",
+    [0x4a] = "DW_TAG_skeleton_unit",
+    [0x4b] = "DW_TAG_immutable_type"
+};
+
+
+static dwarf_name_t vendor_dwarf_tags[] = {
+    {0x4101, "DW_TAG_format_label"},
+    {0x4102, "DW_TAG_function_template"},
+    {0x4103, "DW_TAG_class_template"},
+    {0x4104, "DW_TAG_GNU_BINCL"},
+    {0x4105, "DW_TAG_GNU_EINCL"},
+    {0x4106, "DW_TAG_GNU_template_template_param"},
+    {0x4107, "DW_TAG_GNU_template_parameter_pack"},
+    {0x4108, "DW_TAG_GNU_formal_parameter_pack"},
+    {0x4109, "DW_TAG_GNU_call_site"},
+    {0x410a, "DW_TAG_GNU_call_site_parameter"}
+};
+
+
+
+static char *dwarf_attributes[] = {
+    [0x01] = "DW_AT_sibling",
+    [0x02] = "DW_AT_location",
+    [0x03] = "DW_AT_name",
+    [0x09] = "DW_AT_ordering",
+    [0x0b] = "DW_AT_byte_size",
+    [0x0c] = "DW_AT_bit_offset",
+    [0x0d] = "DW_AT_bit_size",
+    [0x10] = "DW_AT_stmt_list",
+    [0x11] = "DW_AT_low_pc",
+    [0x12] = "DW_AT_high_pc",
+    [0x13] = "DW_AT_language",
+    [0x15] = "DW_AT_discr",
+    [0x16] = "DW_AT_discr_value",
+    [0x17] = "DW_AT_visibility",
+    [0x18] = "DW_AT_import",
+    [0x19] = "DW_AT_string_length",
+    [0x1a] = "DW_AT_common_reference",
+    [0x1b] = "DW_AT_comp_dir",
+    [0x1c] = "DW_AT_const_value",
+    [0x1d] = "DW_AT_containing_type",
+    [0x1e] = "DW_AT_default_value",
+    [0x20] = "DW_AT_inline",
+    [0x21] = "DW_AT_is_optional",
+    [0x22] = "DW_AT_lower_bound",
+    [0x25] = "DW_AT_producer",
+    [0x27] = "DW_AT_prototyped",
+    [0x2a] = "DW_AT_return_addr",
+    [0x2c] = "DW_AT_start_scope",
+    [0x2e] = "DW_AT_bit_stride",
+    [0x2f] = "DW_AT_upper_bound",
+    [0x31] = "DW_AT_abstract_origin",
+    [0x32] = "DW_AT_accessibility",
+    [0x33] = "DW_AT_address_class",
+    [0x34] = "DW_AT_artificial",
+    [0x35] = "DW_AT_base_types",
+    [0x36] = "DW_AT_calling_convention",
+    [0x37] = "DW_AT_count",
+    [0x38] = "DW_AT_data_member_location",
+    [0x39] = "DW_AT_decl_column",
+    [0x3a] = "DW_AT_decl_file",
+    [0x3b] = "DW_AT_decl_line",
+    [0x3c] = "DW_AT_declaration",
+    [0x3d] = "DW_AT_discr_list",
+    [0x3e] = "DW_AT_encoding",
+    [0x3f] = "DW_AT_external",
+    [0x40] = "DW_AT_frame_base",
+    [0x41] = "DW_AT_friend",
+    [0x42] = "DW_AT_identifier_case",
+    [0x43] = "DW_AT_macro_info",
+    [0x44] = "DW_AT_namelist_item",
+    [0x45] = "DW_AT_priority",
+    [0x46] = "DW_AT_segment",
+    [0x47] = "DW_AT_specification",
+    [0x48] = "DW_AT_static_link",
+    [0x49] = "DW_AT_type",
+    [0x4a] = "DW_AT_use_location",
+    [0x4b] = "DW_AT_variable_parameter",
+    [0x4c] = "DW_AT_virtuality",
+    [0x4d] = "DW_AT_vtable_elem_location",
+    [0x4e] = "DW_AT_allocated",
+    [0x4f] = "DW_AT_associated",
+    [0x50] = "DW_AT_data_location",
+    [0x51] = "DW_AT_byte_stride",
+    [0x52] = "DW_AT_entry_pc",
+    [0x53] = "DW_AT_use_UTF8",
+    [0x54] = "DW_AT_extension",
+    [0x55] = "DW_AT_ranges",
+    [0x56] = "DW_AT_trampoline",
+    [0x57] = "DW_AT_call_column",
+    [0x58] = "DW_AT_call_file",
+    [0x59] = "DW_AT_call_line",
+    [0x5a] = "DW_AT_description",
+    [0x5b] = "DW_AT_binary_scale",
+    [0x5c] = "DW_AT_decimal_scale",
+    [0x5d] = "DW_AT_small",
+    [0x5e] = "DW_AT_decimal_sign",
+    [0x5f] = "DW_AT_digit_count",
+    [0x60] = "DW_AT_picture_string",
+    [0x61] = "DW_AT_mutable",
+    [0x62] = "DW_AT_threads_scaled",
+    [0x63] = "DW_AT_explicit",
+    [0x64] = "DW_AT_object_pointer",
+    [0x65] = "DW_AT_endianity",
+    [0x66] = "DW_AT_elemental",
+    [0x67] = "DW_AT_pure",
+    [0x68] = "DW_AT_recursive",
+    [0x69] = "DW_AT_signature",
+    [0x6a] = "DW_AT_main_subprogram",
+    [0x6b] = "DW_AT_data_bit_offset",
+    [0x6c] = "DW_AT_const_expr",
+    [0x6d] = "DW_AT_enum_class",
+    [0x6e] = "DW_AT_linkage_name",
+    [0x6f] = "DW_AT_string_length_bit_size",
+    [0x70] = "DW_AT_string_length_byte_size",
+    [0x71] = "DW_AT_rank",
+    [0x72] = "DW_AT_str_offsets_base",
+    [0x73] = "DW_AT_addr_base",
+    [0x74] = "DW_AT_rnglists_base",
+    [0x76] = "DW_AT_dwo_name",
+    [0x77] = "DW_AT_reference",
+    [0x78] = "DW_AT_rvalue_reference",
+    [0x79] = "DW_AT_macros",
+    [0x7a] = "DW_AT_call_all_calls",
+    [0x7b] = "DW_AT_call_all_source_calls",
+    [0x7c] = "DW_AT_call_all_tail_calls",
+    [0x7d] = "DW_AT_call_return_pc",
+    [0x7e] = "DW_AT_call_value",
+    [0x7f] = "DW_AT_call_origin",
+    [0x80] = "DW_AT_call_parameter",
+    [0x81] = "DW_AT_call_pc",
+    [0x82] = "DW_AT_call_tail_call",
+    [0x83] = "DW_AT_call_target",
+    [0x84] = "DW_AT_call_target_clobbered",
+    [0x85] = "DW_AT_call_data_location",
+    [0x86] = "DW_AT_call_data_value",
+    [0x87] = "DW_AT_noreturn",
+    [0x88] = "DW_AT_alignment",
+    [0x89] = "DW_AT_export_symbols",
+    [0x8a] = "DW_AT_deleted",
+    [0x8b] = "DW_AT_defaulted",
+    [0x8c] = "DW_AT_loclists_base"
+};
+
+
+static dwarf_name_t vendor_dwarf_attributes[] = {
+    {0x2007, "DW_AT_MIPS_linkage_name"},
+    {0x2101, "DW_AT_sf_names"},
+    {0x2102, "DW_AT_src_info"},
+    {0x2103, "DW_AT_mac_info"},
+    {0x2104, "DW_AT_src_coords"},
+    {0x2105, "DW_AT_body_begin"},
+    {0x2106, "DW_AT_body_end"},
+    {0x2107, "DW_AT_GNU_vector"},
+    {0x2108, "DW_AT_GNU_guarded_by"},
+    {0x2109, "DW_AT_GNU_pt_guarded_by"},
+    {0x210a, "DW_AT_GNU_guarded"},
+    {0x210b, "DW_AT_GNU_pt_guarded"},
+    {0x210c, "DW_AT_GNU_locks_excluded"},
+    {0x210d, "DW_AT_GNU_exclusive_locks_required"},
+    {0x210e, "DW_AT_GNU_shared_locks_required"},
+    {0x210f, "DW_AT_GNU_odr_signature"},
+    {0x2110, "DW_AT_GNU_template_name"},
+    {0x2111, "DW_AT_GNU_call_site_value"},
+    {0x2112, "DW_AT_GNU_call_site_data_value"},
+    {0x2113, "DW_AT_GNU_call_site_target"},
+    {0x2114, "DW_AT_GNU_call_site_target_clobbered"},
+    {0x2115, "DW_AT_GNU_tail_call"},
+    {0x2116, "DW_AT_GNU_all_tail_call_sites"},
+    {0x2117, "DW_AT_GNU_all_call_sites"},
+    {0x2118, "DW_AT_GNU_all_source_call_sites"},
+    {0x2119, "DW_AT_GNU_macros"},
+    {0x211a, "DW_AT_GNU_deleted"},
+    {0x2130, "DW_AT_GNU_dwo_name"},
+    {0x2131, "DW_AT_GNU_dwo_id"},
+    {0x2132, "DW_AT_GNU_ranges_base"},
+    {0x2133, "DW_AT_GNU_addr_base"},
+    {0x2134, "DW_AT_GNU_pubnames"},
+    {0x2135, "DW_AT_GNU_pubtypes"},
+    {0x2136, "DW_AT_GNU_discriminator"},
+    {0x2137, "DW_AT_GNU_locviews"},
+    {0x2138, "DW_AT_GNU_entry_view"}
+};
+
+
+
+static char *dwarf_forms[] = {
+    [0x01] = "DW_FORM_addr",
+    [0x03] = "DW_FORM_block2",
+    [0x04] = "DW_FORM_block4",
+    [0x05] = "DW_FORM_data2",
+    [0x06] = "DW_FORM_data4",
+    [0x07] = "DW_FORM_data8",
+    [0x08] = "DW_FORM_string",
+    [0x09] = "DW_FORM_block",
+    [0x0a] = "DW_FORM_block1",
+    [0x0b] = "DW_FORM_data1",
+    [0x0c] = "DW_FORM_flag",
+    [0x0d] = "DW_FORM_sdata",
+    [0x0e] = "DW_FORM_strp",
+    [0x0f] = "DW_FORM_udata",
+    [0x10] = "DW_FORM_ref_addr",
+    [0x11] = "DW_FORM_ref1",
+    [0x12] = "DW_FORM_ref2",
+    [0x13] = "DW_FORM_ref4",
+    [0x14] = "DW_FORM_ref8",
+    [0x15] = "DW_FORM_ref_udata",
+    [0x16] = "DW_FORM_indirect",
+    [0x17] = "DW_FORM_sec_offset",
+    [0x18] = "DW_FORM_exprloc",
+    [0x19] = "DW_FORM_flag_present",
+    [0x1a] = "DW_FORM_strx",
+    [0x1b] = "DW_FORM_addrx",
+    [0x1c] = "DW_FORM_ref_sup4",
+    [0x1d] = "DW_FORM_strp_sup",
+    [0x1e] = "DW_FORM_data16",
+    [0x1f] = "DW_FORM_line_strp",
+    [0x20] = "DW_FORM_ref_sig8",
+    [0x21] = "DW_FORM_implicit_const",
+    [0x22] = "DW_FORM_loclistx",
+    [0x23] = "DW_FORM_rnglistx",
+    [0x24] = "DW_FORM_ref_sup8",
+    [0x25] = "DW_FORM_strx1",
+    [0x26] = "DW_FORM_strx2",
+    [0x27] = "DW_FORM_strx3",
+    [0x28] = "DW_FORM_strx4",
+    [0x29] = "DW_FORM_addrx1",
+    [0x2a] = "DW_FORM_addrx2",
+    [0x2b] = "DW_FORM_addrx3",
+    [0x2c] = "DW_FORM_addrx4"
+};
+
+
+static dwarf_name_t vendor_dwarf_forms[] = {
+    {0x1f01, "DW_FORM_GNU_addr_index"},
+    {0x1f02, "DW_FORM_GNU_str_index"},
+    {0x1f20, "DW_FORM_GNU_ref_alt"},
+    {0x1f21, "DW_FORM_GNU_strp_alt"}
+};
+
+
+static char *dwarf_name_index_attributes[] = {
+    [0x01] = "DW_IDX_compile_unit",
+    [0x02] = "DW_IDX_type_unit",
+    [0x03] = "DW_IDX_die_offset",
+    [0x04] = "DW_IDX_parent",
+    [0x05] = "DW_IDX_type_hash"
+};
+
+
+static dwarf_name_t vendor_dwarf_name_index_attributes[] = {
+    {0x2000, "DW_IDX_GNU_internal"},
+    {0x2001, "DW_IDX_GNU_external"}
+};
+
+
+static char *dwarf_cfa_instructions[] = {
+    [0x00] = "DW_CFA_nop",
+    [0x01] = "DW_CFA_set_loc",
+    [0x02] = "DW_CFA_advance_loc1",
+    [0x03] = "DW_CFA_advance_loc2",
+    [0x04] = "DW_CFA_advance_loc4",
+    [0x05] = "DW_CFA_offset_extended",
+    [0x06] = "DW_CFA_restore_extended",
+    [0x07] = "DW_CFA_undefined",
+    [0x08] = "DW_CFA_same_value",
+    [0x09] = "DW_CFA_register",
+    [0x0a] = "DW_CFA_remember_state",
+    [0x0b] = "DW_CFA_restore_state",
+    [0x0c] = "DW_CFA_def_cfa",
+    [0x0d] = "DW_CFA_def_cfa_register",
+    [0x0e] = "DW_CFA_def_cfa_offset",
+    [0x0f] = "DW_CFA_def_cfa_expression",
+    [0x10] = "DW_CFA_expression",
+    [0x11] = "DW_CFA_offset_extended_sf",
+    [0x12] = "DW_CFA_def_cfa_sf",
+    [0x13] = "DW_CFA_def_cfa_offset_sf",
+    [0x14] = "DW_CFA_val_offset",
+    [0x15] = "DW_CFA_val_offset_sf",
+    [0x16] = "DW_CFA_val_expression",
+    [0x40] = "DW_CFA_advance_loc",
+    [0x80] = "DW_CFA_offset",
+    [0xc0] = "DW_CFA_restore"
+};
+
+
+static dwarf_name_t vendor_dwarf_cfa_instructions[] = {
+    {0x2d, "DW_CFA_GNU_window_save"},
+    {0x2e, "DW_CFA_GNU_args_size"},
+    {0x2f, "DW_CFA_GNU_negative_offset_extended"}
+};
+
+
+
+
+
+
+static char *dwarf_operations[] = {
+    [0x03] = "DW_OP_addr",
+    [0x06] = "DW_OP_deref",
+    [0x08] = "DW_OP_const1u",
+    [0x09] = "DW_OP_const1s",
+    [0x0a] = "DW_OP_const2u",
+    [0x0b] = "DW_OP_const2s",
+    [0x0c] = "DW_OP_const4u",
+    [0x0d] = "DW_OP_const4s",
+    [0x0e] = "DW_OP_const8u",
+    [0x0f] = "DW_OP_const8s",
+    [0x10] = "DW_OP_constu",
+    [0x11] = "DW_OP_consts",
+    [0x12] = "DW_OP_dup",
+    [0x13] = "DW_OP_drop",
+    [0x14] = "DW_OP_over",
+    [0x15] = "DW_OP_pick",
+    [0x16] = "DW_OP_swap",
+    [0x17] = "DW_OP_rot",
+    [0x18] = "DW_OP_xderef",
+    [0x19] = "DW_OP_abs",
+    [0x1a] = "DW_OP_and",
+    [0x1b] = "DW_OP_div",
+    [0x1c] = "DW_OP_minus",
+    [0x1d] = "DW_OP_mod",
+    [0x1e] = "DW_OP_mul",
+    [0x1f] = "DW_OP_neg",
+    [0x20] = "DW_OP_not",
+    [0x21] = "DW_OP_or",
+    [0x22] = "DW_OP_plus",
+    [0x23] = "DW_OP_plus_uconst",
+    [0x24] = "DW_OP_shl",
+    [0x25] = "DW_OP_shr",
+    [0x26] = "DW_OP_shra",
+    [0x27] = "DW_OP_xor",
+    [0x28] = "DW_OP_bra",
+    [0x29] = "DW_OP_eq",
+    [0x2a] = "DW_OP_ge",
+    [0x2b] = "DW_OP_gt",
+    [0x2c] = "DW_OP_le",
+    [0x2d] = "DW_OP_lt",
+    [0x2e] = "DW_OP_ne",
+    [0x2f] = "DW_OP_skip",
+    [0x90] = "DW_OP_regx",
+    [0x91] = "DW_OP_fbreg",
+    [0x92] = "DW_OP_bregx",
+    [0x93] = "DW_OP_piece",
+    [0x94] = "DW_OP_deref_size",
+    [0x95] = "DW_OP_xderef_size",
+    [0x96] = "DW_OP_nop",
+    [0x97] = "DW_OP_push_object_address",
+    [0x98] = "DW_OP_call2",
+    [0x99] = "DW_OP_call4",
+    [0x9a] = "DW_OP_call_ref",
+    [0x9b] = "DW_OP_form_tls_address",
+    [0x9c] = "DW_OP_call_frame_cfa",
+    [0x9d] = "DW_OP_bit_piece",
+    [0x9e] = "DW_OP_implicit_value",
+    [0x9f] = "DW_OP_stack_value",
+    [0xa0] = "DW_OP_implicit_pointer",
+    [0xa1] = "DW_OP_addrx",
+    [0xa2] = "DW_OP_constx",
+    [0xa3] = "DW_OP_entry_value",
+    [0xa4] = "DW_OP_const_type",
+    [0xa5] = "DW_OP_regval_type",
+    [0xa6] = "DW_OP_deref_type",
+    [0xa7] = "DW_OP_xderef_type",
+    [0xa8] = "DW_OP_convert",
+    [0xa9] = "DW_OP_reinterpret"
+};
+
+
+static dwarf_name_t vendor_dwarf_operations[] = {
+    {0xe0, "DW_OP_GNU_push_tls_address"},
+    {0xf0, "DW_OP_GNU_uninit"}
+};
+
+
+
+
+
+
+
+static char *x86_64_registers[] = {
+    "rax", "rdx", "rcx", "rbx", "rsi", "rdi", "rbp", "rsp",
+    "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "rip",
+    "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7",
+    "xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13", "xmm14", "xmm15",
+    "st0", "st1", "st2", "st3", "st4", "st5", "st6", "st7",
+    "mm0", "mm1", "mm2", "mm3", "mm4", "mm5", "mm6", "mm7",
+    "rflags", "es", "cs", "ss", "ds", "fs", "gs", 
+# 677 "src/stringify.c" 3 4
+                                                 ((void *)0)
+# 677 "src/stringify.c"
+                                                     , 
+# 677 "src/stringify.c" 3 4
+                                                       ((void *)0)
+# 677 "src/stringify.c"
+                                                           ,
+    "fs.base", "gs.base", 
+# 678 "src/stringify.c" 3 4
+                         ((void *)0)
+# 678 "src/stringify.c"
+                             , 
+# 678 "src/stringify.c" 3 4
+                               ((void *)0)
+# 678 "src/stringify.c"
+                                   , "tr", "ldtr", "mxcsr", "fcw", "fsw"
+};
+
+
+static char *i386_registers[] = {
+    "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi", "eip", "eflags", 
+# 683 "src/stringify.c" 3 4
+                                                                            ((void *)0)
+# 683 "src/stringify.c"
+                                                                                ,
+    "st0", "st1", "st2", "st3", "st4", "st5", "st6", "st7", 
+# 684 "src/stringify.c" 3 4
+                                                           ((void *)0)
+# 684 "src/stringify.c"
+                                                               , 
+# 684 "src/stringify.c" 3 4
+                                                                 ((void *)0)
+# 684 "src/stringify.c"
+                                                                     ,
+    "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7",
+    "mm0", "mm1", "mm2", "mm3", "mm4", "mm5", "mm6", "mm7",
+    "fcw", "fsw", "mxcsr", "es", "cs", "ss", "ds", "fs", "gs", 
+# 687 "src/stringify.c" 3 4
+                                                              ((void *)0)
+# 687 "src/stringify.c"
+                                                                  , 
+# 687 "src/stringify.c" 3 4
+                                                                    ((void *)0)
+# 687 "src/stringify.c"
+                                                                        , "tr", "ldtr"
+};
+# 698 "src/stringify.c"
+static char *get_symbol_type_name(unsigned char info)
+{
+    unsigned char type = ((info)&0xf);
+
+    if(type <= 10 && symbol_types[type] != 
+# 702 "src/stringify.c" 3 4
+                                                     ((void *)0)
+# 702 "src/stringify.c"
+                                                         )
+        return symbol_types[type];
+
+    return "UNKNOWN";
+}
+
+
+static char *get_symbol_binding_name(unsigned char info)
+{
+    unsigned char binding = ((info)>>4);
+
+    if(binding <= 10 && symbol_bindings[binding] != 
+# 713 "src/stringify.c" 3 4
+                                                               ((void *)0)
+# 713 "src/stringify.c"
+                                                                   )
+        return symbol_bindings[binding];
+
+    return "UNKNOWN";
+}
+
+
+
+
+
+
+
+static char *get_relocation_type_name(int machine, uint32_t type)
+{
+    switch(machine)
+    {
+        case 62:
+            if(type < sizeof(x86_64_relocation_types)/sizeof(char*))
+                return x86_64_relocation_types[type];
+            return 
+# 732 "src/stringify.c" 3 4
+                  ((void *)0)
+# 732 "src/stringify.c"
+                      ;
+
+        case 3:
+            if(type < sizeof(i386_relocation_types)/sizeof(char*))
+                return i386_relocation_types[type];
+            return 
+# 737 "src/stringify.c" 3 4
+                  ((void *)0)
+# 737 "src/stringify.c"
+                      ;
+
+        default:
+            return 
+# 740 "src/stringify.c" 3 4
+                  ((void *)0)
+# 740 "src/stringify.c"
+                      ;
+    }
+}
+
+
+
+
+
+
+
+static char *get_register_name(int machine, uint64_t number)
+{
+    switch(machine)
+    {
+        case 62:
+            if(number < sizeof(x86_64_registers)/sizeof(char*))
+                return x86_64_registers[number];
+            return 
+# 757 "src/stringify.c" 3 4
+                  ((void *)0)
+# 757 "src/stringify.c"
+                      ;
+
+        case 3:
+            if(number < sizeof(i386_registers)/sizeof(char*))
+                return i386_registers[number];
+            return 
+# 762 "src/stringify.c" 3 4
+                  ((void *)0)
+# 762 "src/stringify.c"
+                      ;
+
+        default:
+            return 
+# 765 "src/stringify.c" 3 4
+                  ((void *)0)
+# 765 "src/stringify.c"
+                      ;
+    }
+}
+# 776 "src/stringify.c"
+static char *find_dwarf_name(char **names, size_t num_names, dwarf_name_t *vendor_names, size_t num_vendor_names, uint32_t value)
+{
+    if(value < num_names && names[value] != 
+# 778 "src/stringify.c" 3 4
+                                           ((void *)0)
+# 778 "src/stringify.c"
+                                               )
+        return names[value];
+
+    for(size_t i = 0; i < num_vendor_names; i++)
+    {
+        if(vendor_names[i].value == value)
+            return vendor_names[i].name;
+    }
+
+    return 
+# 787 "src/stringify.c" 3 4
+          ((void *)0)
+# 787 "src/stringify.c"
+              ;
+}
+# 800 "src/stringify.c"
+static void stringify_dwarf_tag(output_t *output, uint32_t tag)
+{
+    char *name = find_dwarf_name(dwarf_tags, sizeof(dwarf_tags)/sizeof(char*), vendor_dwarf_tags, sizeof(vendor_dwarf_tags)/sizeof(dwarf_name_t), tag);
+
+    if(name != 
+# 804 "src/stringify.c" 3 4
+              ((void *)0)
+# 804 "src/stringify.c"
+                  )
+        append_string(output, name);
+    else
+        append_format(output, "Unknown TAG value: %#x", tag);
+}
+
+
+static void stringify_dwarf_attribute(output_t *output, uint32_t attribute, int min_width)
+{
+    char *name = (attribute == 0) ? "DW_AT value: 0" : find_dwarf_name(dwarf_attributes, sizeof(dwarf_attributes)/sizeof(char*), vendor_dwarf_attributes, sizeof(vendor_dwarf_attributes)/sizeof(dwarf_name_t), attribute);
+
+
+    if(name == 
+# 816 "src/stringify.c" 3 4
+              ((void *)0)
+# 816 "src/stringify.c"
+                  )
+    {
+        append_format(output, "Unknown AT value: %x", attribute);
+        return;
+    }
+
+    append_string(output, name);
+    append_padding(output, min_width - (int) strlen(name));
+}
+
+
+static void stringify_dwarf_form(output_t *output, uint32_t form)
+{
+    char *name = (form == 0) ? "DW_FORM value: 0" : find_dwarf_name(dwarf_forms, sizeof(dwarf_forms)/sizeof(char*), vendor_dwarf_forms, sizeof(vendor_dwarf_forms)/sizeof(dwarf_name_t), form);
+
+    if(name != 
+# 831 "src/stringify.c" 3 4
+              ((void *)0)
+# 831 "src/stringify.c"
+                  )
+        append_string(output, name);
+    else
+        append_format(output, "Unknown FORM value: %x", form);
+}
+# 844 "src/stringify.c"
+static void stringify_relocation_type(output_t *output, int machine, uint32_t type)
+{
+    char *name = get_relocation_type_name(machine, type);
+    size_t length;
+
+    if(name == 
+# 849 "src/stringify.c" 3 4
+              ((void *)0)
+# 849 "src/stringify.c"
+                  )
+    {
+        append_string(output, "unknown (");
+        append_decimal(output, type);
+        append_char(output, ')');
+        append_padding(output, 24 - 10 - (type >= 10) - (type >= 100) - (type >= 1000));
+        return;
+    }
+
+    length = strlen(name);
+    append_string(output, name);
+    append_padding(output, 24 - (int) length);
+}
+
+
+
+
+
+
+static void stringify_relocation_table_title(output_t *output, string_view_t section_name, uint64_t offset, uint64_t num_entries, 
+# 868 "src/stringify.c" 3 4
+                                                                                                                                 _Bool 
+# 868 "src/stringify.c"
+                                                                                                                                      has_addends)
+{
+    append_string(output, "\nRelocation section '");
+    append_bytes(output, section_name.string, section_name.length);
+    append_string(output, "' at offset 0x");
+    append_hex(output, offset, 0);
+    append_string(output, " contains ");
+    append_decimal(output, num_entries);
+    append_string(output, " entries:\n");
+
+    append_string(output, has_addends ? "Offset\t\t\tInfo\t\t\tType\t\t\tSym. Value\t\tSym. Name + Addend\n"
+                                      : "Offset\t\t\tInfo\t\t\tType\t\t\tSym. Value\t\tSym. Name\n");
+    append_string(output, "----------------------------------------------------------------------------------------------------------\n");
+}
+
+
+
+
+
+
+
+static void stringify_addend(output_t *output, int64_t addend)
+{
+    if(addend < 0)
+    {
+        append_string(output, " - ");
+        append_hex(output, -(uint64_t) addend, 0);
+    }
+    else
+    {
+        append_string(output, " + ");
+        append_hex(output, addend, 0);
+    }
+}
+
+
+
+
+
+
+
+static void stringify_symbol_section_index(output_t *output, uint16_t section_index)
+{
+    switch(section_index)
+    {
+        case 0:
+            append_string(output, "UND");
+            break;
+
+        case 0xfff1:
+            append_string(output, "ABS");
+            break;
+
+        case 0xfff2:
+            append_string(output, "COM");
+            break;
+
+        default:
+            append_decimal(output, section_index);
+            break;
+    }
+}
+
+
+
+
+
+
+static void stringify_symbol_columns(output_t *output, int value_width)
+{
+    append_string(output, (value_width == 16) ? "Number\tValue\t\t\tSize\tType\tBind\tVis\t\tNdx\tName\n"
+                                              : "Number\tValue\t\tSize\tType\tBind\tVis\t\tNdx\tName\n");
+    append_string(output, "----------------------------------------------------------------------------------------------\n");
+}
+
+
+
+
+
+
+static void stringify_symbol_table_title(output_t *output, string_view_t section_name, uint64_t num_symbols, int value_width)
+{
+    append_string(output, "\nSymbol table '");
+    append_bytes(output, section_name.string, section_name.length);
+    append_string(output, "' contains ");
+    append_decimal(output, num_symbols);
+    append_string(output, " entries:\n");
+
+    stringify_symbol_columns(output, value_width);
+}
+# 966 "src/stringify.c"
+void stringify_symbol_lookup_title(output_t *output, symbol_index_t *index)
+{
+    static char *methods[] = {
+        [LOOKUP_GNU_HASH] = "the GNU hash table",
+        [LOOKUP_SYSV_HASH] = "the SysV hash table",
+        [LOOKUP_BUILT_HASH] = "a hash table built over it"
+    };
+
+    append_string(output, "\nSymbol lookup in '");
+    append_bytes(output, index->table_name.string, index->table_name.length);
+    append_string(output, "' using ");
+    append_string(output, methods[index->method]);
+    append_string(output, ":\n");
+
+    stringify_symbol_columns(output, (index->file_class == 2) ? 16 : 8);
+}
+
+
+
+
+
+
+void stringify_missing_symbol(output_t *output, const char *name, size_t length)
+{
+    append_string(output, "-\t\t\t\t\t\t\t\t");
+    append_bytes(output, name, length);
+    append_string(output, " (not found)\n");
+}
+# 1002 "src/stringify.c"
+void stringify_debug_abbrev_table(output_t *output, abbrev_table_t *table)
+{
+    if(table->num_abbrevs == 0)
+        return;
+
+    append_format(output, "  Number TAG (%#lx)\n", (unsigned long) table->offset);
+
+    for(uint64_t i = 0; i < table->num_abbrevs; i++)
+    {
+        abbrev_t *abbrev = &table->abbrevs[i];
+
+        append_string(output, "   ");
+        append_decimal(output, abbrev->code);
+        append_padding(output, 6);
+        stringify_dwarf_tag(output, abbrev->tag);
+        append_string(output, abbrev->has_children ? "    [has children]\n" : "    [no children]\n");
+
+        for(uint32_t j = 0; j < abbrev->num_attributes; j++)
+        {
+            abbrev_attribute_t *attribute = &abbrev->attributes[j];
+
+            append_padding(output, 4);
+            stringify_dwarf_attribute(output, attribute->name, 18);
+            append_char(output, ' ');
+            stringify_dwarf_form(output, attribute->form);
+
+            if(attribute->form == 0x21)
+            {
+                append_string(output, ": ");
+                append_signed_decimal(output, attribute->implicit_const);
+            }
+
+            append_char(output, '\n');
+        }
+
+        append_string(output, "    DW_AT value: 0     DW_FORM value: 0\n");
+    }
+}
+
+
+
+
+
+
+
+static void stringify_offset(output_t *output, uint64_t offset)
+{
+    if(offset != 0)
+        append_string(output, "0x");
+
+    append_hex(output, offset, 0);
+}
+
+
+
+
+
+
+
+void stringify_debug_unit_header(output_t *output, unit_header_t *unit)
+{
+    append_string(output, "  Compilation Unit @ offset ");
+    stringify_offset(output, unit->offset);
+    append_string(output, ":\n   Length:        0x");
+    append_hex(output, unit->length, 0);
+    append_string(output, (unit->offset_size == 8) ? " (64-bit)\n" : " (32-bit)\n");
+    append_string(output, "   Version:       ");
+    append_decimal(output, unit->version);
+    append_char(output, '\n');
+
+    if(unit->version >= 5)
+    {
+        char *name = (unit->unit_type <= 0x06) ? dwarf_unit_types[unit->unit_type] : 
+# 1074 "src/stringify.c" 3 4
+                                                                                                ((void *)0)
+# 1074 "src/stringify.c"
+                                                                                                    ;
+
+        append_string(output, "   Unit Type:     ");
+        append_string(output, (name != 
+# 1077 "src/stringify.c" 3 4
+                                      ((void *)0)
+# 1077 "src/stringify.c"
+                                          ) ? name : "???");
+        append_string(output, " (");
+        append_decimal(output, unit->unit_type);
+        append_string(output, ")\n");
+    }
+
+    append_string(output, "   Abbrev Offset: ");
+    stringify_offset(output, unit->abbrev_offset);
+    append_string(output, "\n   Pointer Size:  ");
+    append_decimal(output, unit->address_size);
+    append_char(output, '\n');
+
+    if(unit->unit_type == 0x02 || unit->unit_type == 0x06)
+    {
+        append_string(output, "   Signature:     0x");
+        append_hex(output, unit->type_signature, 0);
+        append_string(output, "\n   Type Offset:   0x");
+        append_hex(output, unit->type_offset, 0);
+        append_char(output, '\n');
+    }
+
+    if(unit->unit_type == 0x04 || unit->unit_type == 0x05)
+    {
+        append_string(output, "   DWO ID:        0x");
+        append_hex(output, unit->dwo_id, 0);
+        append_char(output, '\n');
+    }
+}
+
+
+
+
+
+
+void stringify_debug_die(output_t *output, die_t *die)
+{
+    append_string(output, " <");
+    append_decimal(output, die->depth);
+    append_string(output, "><");
+    append_hex(output, die->offset, 0);
+    append_string(output, ">: Abbrev Number: ");
+
+    if(die->abbrev == 
+# 1119 "src/stringify.c" 3 4
+                     ((void *)0)
+# 1119 "src/stringify.c"
+                         )
+    {
+        append_string(output, "0\n");
+        return;
+    }
+
+    append_decimal(output, die->abbrev->code);
+    append_string(output, " (");
+    stringify_dwarf_tag(output, die->abbrev->tag);
+    append_string(output, ")\n");
+}
+
+
+
+
+
+
+
+void stringify_debug_aranges_header(output_t *output, aranges_header_t *header)
+{
+    append_string(output, "  Length:                   ");
+    append_decimal(output, header->length);
+    append_string(output, "\n  Version:                  ");
+    append_decimal(output, header->version);
+    append_string(output, "\n  Offset into .debug_info:  ");
+    stringify_offset(output, header->info_offset);
+    append_string(output, "\n  Pointer Size:             ");
+    append_decimal(output, header->address_size);
+    append_string(output, "\n  Segment Size:             ");
+    append_decimal(output, header->segment_size);
+    append_string(output, (header->address_size == 4) ? "\n\n    Address    Length\n" : "\n\n    Address            Length\n");
+}
+
+
+
+
+
+
+void stringify_debug_arange(output_t *output, uint64_t address, uint64_t length, int address_size)
+{
+    append_padding(output, 4);
+    append_hex(output, address, 2*address_size);
+    append_char(output, ' ');
+    append_hex(output, length, 2*address_size);
+    append_char(output, '\n');
+}
+
+
+
+
+
+
+static void stringify_indirect_string(output_t *output, const unsigned char *section, uint64_t section_size,
+                                      char *section_name, uint64_t offset)
+{
+    if(section == 
+# 1174 "src/stringify.c" 3 4
+                 ((void *)0)
+# 1174 "src/stringify.c"
+                     )
+    {
+        append_string(output, "<no ");
+        append_string(output, section_name);
+        append_string(output, " section>");
+        return;
+    }
+
+    if(offset >= section_size)
+    {
+        append_string(output, "<offset is too big>");
+        return;
+    }
+
+    append_bytes(output, (const char*) section + offset, strnlen((const char*) section + offset, section_size - offset));
+}
+# 1201 "src/stringify.c"
+void stringify_debug_attribute(output_t *output, uint64_t offset, attribute_value_t *value, debug_strings_t *strings)
+{
+    append_string(output, "    <");
+    append_hex(output, offset, 0);
+    append_string(output, ">   ");
+    stringify_dwarf_attribute(output, value->name, 18);
+    append_string(output, ": ");
+
+    switch(value->form)
+    {
+        case 0x01:
+            append_string(output, "0x");
+            append_hex(output, value->value, 0);
+            break;
+
+        case 0x0b:
+        case 0x05:
+        case 0x06:
+        case 0x07:
+        case 0x0f:
+        case 0x0c:
+        case 0x19:
+            append_decimal(output, value->value);
+            break;
+
+        case 0x0d:
+        case 0x21:
+            append_signed_decimal(output, (int64_t) value->value);
+            break;
+
+        case 0x11:
+        case 0x12:
+        case 0x13:
+        case 0x14:
+        case 0x15:
+        case 0x10:
+            append_string(output, "<0x");
+            append_hex(output, value->value, 0);
+            append_char(output, '>');
+            break;
+
+        case 0x1c:
+        case 0x24:
+        case 0x1f20:
+            append_string(output, "<alt 0x");
+            append_hex(output, value->value, 0);
+            append_char(output, '>');
+            break;
+
+        case 0x20:
+            append_string(output, "signature: 0x");
+            append_hex(output, value->value, 0);
+            break;
+
+        case 0x17:
+            stringify_offset(output, value->value);
+            break;
+
+        case 0x08:
+            append_bytes(output, (const char*) value->data, value->value);
+            break;
+
+        case 0x0e:
+            append_string(output, "(indirect string, offset: ");
+            stringify_offset(output, value->value);
+            append_string(output, "): ");
+            stringify_indirect_string(output, strings->str, strings->str_size, ".debug_str", value->value);
+            break;
+
+        case 0x1f:
+            append_string(output, "(indirect line string, offset: ");
+            stringify_offset(output, value->value);
+            append_string(output, "): ");
+            stringify_indirect_string(output, strings->line_str, strings->line_str_size, ".debug_line_str", value->value);
+            break;
+
+        case 0x1d:
+        case 0x1f21:
+            append_string(output, "(alt indirect string, offset: ");
+            stringify_offset(output, value->value);
+            append_char(output, ')');
+            break;
+
+        case 0x1a:
+        case 0x25:
+        case 0x26:
+        case 0x27:
+        case 0x28:
+        case 0x1f02:
+        {
+            uint64_t string_offset;
+
+            append_string(output, "(indexed string: ");
+            stringify_offset(output, value->value);
+            append_char(output, ')');
+
+
+            if(get_indexed_string_offset(strings, value->value, &string_offset))
+            {
+                append_string(output, ": ");
+                stringify_indirect_string(output, strings->str, strings->str_size, ".debug_str", string_offset);
+            }
+
+            break;
+        }
+
+        case 0x1b:
+        case 0x29:
+        case 0x2a:
+        case 0x2b:
+        case 0x2c:
+        case 0x1f01:
+        {
+            uint64_t address;
+
+            append_string(output, "(index: ");
+            stringify_offset(output, value->value);
+            append_char(output, ')');
+
+
+            if(get_indexed_address(strings, value->value, &address))
+            {
+                append_string(output, ": 0x");
+                append_hex(output, address, 0);
+            }
+
+            break;
+        }
+
+        case 0x22:
+        case 0x23:
+            append_string(output, "(index: ");
+            stringify_offset(output, value->value);
+            append_char(output, ')');
+            break;
+
+        default:
+        {
+
+            char *bytes;
+            size_t length = 0;
+
+            append_decimal(output, value->value);
+            append_string(output, " byte block: ");
+
+            bytes = reserve_output(output, 3*value->value);
+
+            for(uint64_t i = 0; i < value->value; i++)
+            {
+                length += format_hex(bytes + length, value->data[i], 0);
+                bytes[length++] = ' ';
+            }
+
+            output->size += length;
+            break;
+        }
+    }
+
+    append_char(output, '\n');
+}
+
+
+
+
+
+
+static void stringify_byte_list(output_t *output, const unsigned char *bytes, uint64_t num_bytes)
+{
+    for(uint64_t i = 0; i < num_bytes; i++)
+    {
+        if(i > 0)
+            append_char(output, ' ');
+
+        append_hex(output, bytes[i], 2);
+    }
+}
+
+
+
+
+
+
+
+static void stringify_signed_offset(output_t *output, int64_t offset)
+{
+    append_char(output, (offset < 0) ? '-' : '+');
+    append_decimal(output, (offset < 0) ? -(uint64_t) offset : (uint64_t) offset);
+}
+
+
+
+
+
+
+
+static void stringify_register(output_t *output, int machine, uint64_t number)
+{
+    char *name = get_register_name(machine, number);
+
+    append_char(output, 'r');
+    append_decimal(output, number);
+
+    if(name != 
+# 1403 "src/stringify.c" 3 4
+              ((void *)0)
+# 1403 "src/stringify.c"
+                  )
+    {
+        append_string(output, " (");
+        append_string(output, name);
+        append_char(output, ')');
+    }
+}
+
+
+
+
+
+
+
+static void stringify_register_name(output_t *output, int machine, uint64_t number)
+{
+    char *name = get_register_name(machine, number);
+
+    if(name != 
+# 1421 "src/stringify.c" 3 4
+              ((void *)0)
+# 1421 "src/stringify.c"
+                  )
+    {
+        append_string(output, " (");
+        append_string(output, name);
+        append_char(output, ')');
+    }
+}
+# 1439 "src/stringify.c"
+static void stringify_dwarf_expression(output_t *output, const unsigned char *expression, uint64_t length,
+                                       int address_size, int machine)
+{
+    const unsigned char *position = expression;
+    const unsigned char *end = expression + length;
+
+
+    while(position < end)
+    {
+        uint8_t operation = *position++;
+        uint64_t value, number;
+        int64_t signed_value;
+        
+# 1451 "src/stringify.c" 3 4
+       _Bool 
+# 1451 "src/stringify.c"
+            valid = 
+# 1451 "src/stringify.c" 3 4
+                    1
+# 1451 "src/stringify.c"
+                        ;
+        char *name;
+
+        if(position - 1 > expression)
+            append_string(output, "; ");
+
+
+        if(operation >= 0x30 && operation <= 0x4f)
+        {
+            append_string(output, "DW_OP_lit");
+            append_decimal(output, operation - 0x30);
+            continue;
+        }
+
+        if(operation >= 0x50 && operation <= 0x6f)
+        {
+            append_string(output, "DW_OP_reg");
+            append_decimal(output, operation - 0x50);
+            stringify_register_name(output, machine, operation - 0x50);
+            continue;
+        }
+
+        if(operation >= 0x70 && operation <= 0x8f)
+        {
+            if(!read_sleb128(&position, end, &signed_value))
+                return;
+
+            append_string(output, "DW_OP_breg");
+            append_decimal(output, operation - 0x70);
+            stringify_register_name(output, machine, operation - 0x70);
+            append_string(output, ": ");
+            append_signed_decimal(output, signed_value);
+            continue;
+        }
+
+
+        if((name = find_dwarf_name(dwarf_operations, sizeof(dwarf_operations)/sizeof(char*), vendor_dwarf_operations, sizeof(vendor_dwarf_operations)/sizeof(dwarf_name_t), operation)) == 
+# 1487 "src/stringify.c" 3 4
+                                                             ((void *)0)
+# 1487 "src/stringify.c"
+                                                                 )
+        {
+            append_format(output, "(Unknown location op 0x%x)", operation);
+            return;
+        }
+
+        append_string(output, name);
+
+        switch(operation)
+        {
+            case 0x03:
+                if((valid = read_unsigned(&position, end, address_size, &value)))
+                {
+                    append_string(output, ": ");
+                    append_hex(output, value, 0);
+                }
+                break;
+
+            case 0x08:
+            case 0x0a:
+            case 0x0c:
+            case 0x0e:
+                if((valid = read_unsigned(&position, end, 1 << ((operation - 0x08) / 2), &value)))
+                {
+                    append_string(output, ": ");
+                    append_decimal(output, value);
+                }
+                break;
+
+            case 0x09:
+            case 0x0b:
+            case 0x0d:
+            case 0x0f:
+            {
+                int size = 1 << ((operation - 0x09) / 2);
+
+                if((valid = read_unsigned(&position, end, size, &value)))
+                {
+
+                    int shift = 64 - 8*size;
+
+                    append_string(output, ": ");
+                    append_signed_decimal(output, (int64_t) (value << shift) >> shift);
+                }
+                break;
+            }
+
+            case 0x10:
+            case 0x23:
+            case 0x93:
+                if((valid = read_uleb128(&position, end, &value)))
+                {
+                    append_string(output, ": ");
+                    append_decimal(output, value);
+                }
+                break;
+
+            case 0x11:
+            case 0x91:
+                if((valid = read_sleb128(&position, end, &signed_value)))
+                {
+                    append_string(output, ": ");
+                    append_signed_decimal(output, signed_value);
+                }
+                break;
+
+            case 0x15:
+            case 0x94:
+            case 0x95:
+                if((valid = read_unsigned(&position, end, 1, &value)))
+                {
+                    append_string(output, ": ");
+                    append_decimal(output, value);
+                }
+                break;
+
+            case 0x28:
+            case 0x2f:
+                if((valid = read_unsigned(&position, end, 2, &value)))
+                {
+                    append_string(output, ": ");
+                    append_signed_decimal(output, (int16_t) value);
+                }
+                break;
+
+            case 0x98:
+            case 0x99:
+                if((valid = read_unsigned(&position, end, (operation == 0x98) ? 2 : 4, &value)))
+                {
+                    append_string(output, ": <0x");
+                    append_hex(output, value, 0);
+                    append_char(output, '>');
+                }
+                break;
+
+            case 0x90:
+                if((valid = read_uleb128(&position, end, &number)))
+                {
+                    append_string(output, ": ");
+                    append_decimal(output, number);
+                    stringify_register_name(output, machine, number);
+                }
+                break;
+
+            case 0x92:
+                if((valid = read_uleb128(&position, end, &number) && read_sleb128(&position, end, &signed_value)))
+                {
+                    append_string(output, ": ");
+                    append_decimal(output, number);
+                    stringify_register_name(output, machine, number);
+                    append_char(output, ' ');
+                    append_signed_decimal(output, signed_value);
+                }
+                break;
+
+            case 0x06:
+            case 0x12:
+            case 0x13:
+            case 0x14:
+            case 0x16:
+            case 0x17:
+            case 0x18:
+            case 0x19:
+            case 0x1a:
+            case 0x1b:
+            case 0x1c:
+            case 0x1d:
+            case 0x1e:
+            case 0x1f:
+            case 0x20:
+            case 0x21:
+            case 0x22:
+            case 0x24:
+            case 0x25:
+            case 0x26:
+            case 0x27:
+            case 0x29:
+            case 0x2a:
+            case 0x2b:
+            case 0x2c:
+            case 0x2d:
+            case 0x2e:
+            case 0x96:
+            case 0x97:
+            case 0x9b:
+            case 0x9c:
+            case 0x9f:
+            case 0xe0:
+            case 0xf0:
+                break;
+
+            default:
+                return;
+        }
+
+        if(!valid)
+            return;
+    }
+}
+# 1654 "src/stringify.c"
+void stringify_debug_cie(output_t *output, cie_t *cie, int address_size)
+{
+    append_char(output, '\n');
+    append_hex(output, cie->offset, 8);
+    append_char(output, ' ');
+    append_hex(output, cie->length, 2*address_size);
+    append_char(output, ' ');
+    append_hex(output, cie->id, 8);
+    append_string(output, " CIE\n  Version:               ");
+    append_decimal(output, cie->version);
+    append_string(output, "\n  Augmentation:          \"");
+    append_string(output, cie->augmentation);
+    append_string(output, "\"\n");
+
+    if(cie->version == 4)
+    {
+        append_string(output, "  Pointer Size:          ");
+        append_decimal(output, cie->address_size);
+        append_string(output, "\n  Segment Size:          ");
+        append_decimal(output, cie->segment_size);
+        append_char(output, '\n');
+    }
+
+    append_string(output, "  Code alignment factor: ");
+    append_decimal(output, cie->code_alignment);
+    append_string(output, "\n  Data alignment factor: ");
+    append_signed_decimal(output, cie->data_alignment);
+    append_string(output, "\n  Return address column: ");
+    append_decimal(output, cie->return_address_register);
+    append_char(output, '\n');
+
+    if(cie->augmentation_data_length > 0)
+    {
+        append_string(output, "  Augmentation data:     ");
+        stringify_byte_list(output, cie->augmentation_data, cie->augmentation_data_length);
+    }
+
+    append_char(output, '\n');
+}
+
+
+
+
+
+
+void stringify_debug_fde(output_t *output, fde_t *fde, int address_size)
+{
+    append_char(output, '\n');
+    append_hex(output, fde->offset, 8);
+    append_char(output, ' ');
+    append_hex(output, fde->length, 2*address_size);
+    append_char(output, ' ');
+    append_hex(output, fde->cie_pointer, 8);
+    append_string(output, " FDE cie=");
+    append_hex(output, fde->cie_offset, 8);
+    append_string(output, " pc=");
+    append_hex(output, fde->pc_begin, 2*address_size);
+    append_string(output, "..");
+    append_hex(output, fde->pc_begin + fde->pc_range, 2*address_size);
+    append_char(output, '\n');
+
+    if(fde->augmentation_data_length > 0)
+    {
+        append_string(output, "  Augmentation data:     ");
+        stringify_byte_list(output, fde->augmentation_data, fde->augmentation_data_length);
+        append_char(output, '\n');
+    }
+}
+# 1730 "src/stringify.c"
+void stringify_debug_cfa_instruction(output_t *output, cfa_instruction_t *instruction, int address_size, int machine)
+{
+    append_string(output, "  ");
+    append_string(output, find_dwarf_name(dwarf_cfa_instructions, sizeof(dwarf_cfa_instructions)/sizeof(char*), vendor_dwarf_cfa_instructions, sizeof(vendor_dwarf_cfa_instructions)/sizeof(dwarf_name_t), instruction->opcode));
+
+    switch(instruction->opcode)
+    {
+        case 0x40:
+        case 0x02:
+        case 0x03:
+        case 0x04:
+            append_string(output, ": ");
+            append_signed_decimal(output, instruction->offset);
+            append_string(output, " to ");
+            append_hex(output, instruction->address, 2*address_size);
+            break;
+
+        case 0x01:
+            append_string(output, ": ");
+            append_hex(output, instruction->address, 2*address_size);
+            break;
+
+        case 0x80:
+        case 0x05:
+        case 0x11:
+        case 0x2f:
+            append_string(output, ": ");
+            stringify_register(output, machine, instruction->register_number);
+            append_string(output, " at cfa");
+            stringify_signed_offset(output, instruction->offset);
+            break;
+
+        case 0x14:
+        case 0x15:
+            append_string(output, ": ");
+            stringify_register(output, machine, instruction->register_number);
+            append_string(output, " is cfa");
+            stringify_signed_offset(output, instruction->offset);
+            break;
+
+        case 0xc0:
+        case 0x06:
+        case 0x07:
+        case 0x08:
+        case 0x0d:
+            append_string(output, ": ");
+            stringify_register(output, machine, instruction->register_number);
+            break;
+
+        case 0x09:
+            append_string(output, ": ");
+            stringify_register(output, machine, instruction->register_number);
+            append_string(output, " in ");
+            stringify_register(output, machine, instruction->second_register);
+            break;
+
+        case 0x0c:
+        case 0x12:
+            append_string(output, ": ");
+            stringify_register(output, machine, instruction->register_number);
+            append_string(output, " ofs ");
+            append_signed_decimal(output, instruction->offset);
+            break;
+
+        case 0x0e:
+        case 0x13:
+        case 0x2e:
+            append_string(output, ": ");
+            append_signed_decimal(output, instruction->offset);
+            break;
+
+        case 0x0f:
+            append_string(output, " (");
+            stringify_dwarf_expression(output, instruction->expression, instruction->expression_length, address_size, machine);
+            append_char(output, ')');
+            break;
+
+        case 0x10:
+        case 0x16:
+            append_string(output, ": ");
+            stringify_register(output, machine, instruction->register_number);
+            append_string(output, " (");
+            stringify_dwarf_expression(output, instruction->expression, instruction->expression_length, address_size, machine);
+            append_char(output, ')');
+            break;
+    }
+
+    append_char(output, '\n');
+}
+# 1828 "src/stringify.c"
+void stringify_fde_index(output_t *output, range_index_t *index, const char *section_name, int address_size)
+{
+    append_string(output, "Sorted FDE table of the ");
+    append_string(output, section_name);
+    append_string(output, " section (");
+    append_decimal(output, index->num_ranges);
+    append_string(output, (index->num_ranges == 1) ? " entry):\n" : " entries):\n");
+    append_string(output, (address_size == 4) ? "  Start    End      FDE\n" : "  Start            End              FDE\n");
+
+    for(uint64_t i = 0; i < index->num_ranges; i++)
+    {
+        append_padding(output, 2);
+        append_hex(output, index->starts[i], 2*address_size);
+        append_char(output, ' ');
+        append_hex(output, index->ends[i], 2*address_size);
+        append_char(output, ' ');
+        append_hex(output, index->payloads[i], 8);
+        append_char(output, '\n');
+    }
+
+    append_char(output, '\n');
+}
+# 1858 "src/stringify.c"
+void stringify_debug_names_header(output_t *output, names_table_t *table)
+{
+    const char *unit_lists[] = {"  CU table:\n", "  Local TU table:\n", "  Foreign TU table:\n"};
+    const unsigned char *unit_arrays[] = {table->comp_units, table->local_type_units, table->foreign_type_units};
+    uint32_t unit_counts[] = {table->comp_unit_count, table->local_type_unit_count, table->foreign_type_unit_count};
+
+
+    append_string(output, "  Name index @ offset ");
+    stringify_offset(output, table->offset);
+    append_string(output, ":\n   Length:                   0x");
+    append_hex(output, table->length, 0);
+    append_string(output, (table->offset_size == 8) ? " (64-bit)\n" : " (32-bit)\n");
+    append_string(output, "   Version:                  ");
+    append_decimal(output, table->version);
+    append_string(output, "\n   Augmentation:             \"");
+    append_bytes(output, table->augmentation, strnlen(table->augmentation, table->augmentation_size));
+    append_string(output, "\"\n   CU count:                 ");
+    append_decimal(output, table->comp_unit_count);
+    append_string(output, "\n   Local TU count:           ");
+    append_decimal(output, table->local_type_unit_count);
+    append_string(output, "\n   Foreign TU count:         ");
+    append_decimal(output, table->foreign_type_unit_count);
+    append_string(output, "\n   Bucket count:             ");
+    append_decimal(output, table->bucket_count);
+    append_string(output, "\n   Name count:               ");
+    append_decimal(output, table->name_count);
+    append_string(output, "\n   Abbreviation table size:  0x");
+    append_hex(output, table->abbrev_table_size, 0);
+    append_string(output, "\n\n");
+
+
+    for(int list = 0; list < 3; list++)
+    {
+        if(unit_counts[list] == 0)
+            continue;
+
+        append_string(output, unit_lists[list]);
+
+        for(uint32_t i = 0; i < unit_counts[list]; i++)
+        {
+            int size = (list == 2) ? 8 : table->offset_size;
+
+            append_format(output, "   [%3u] 0x", i);
+            append_hex(output, get_names_table_value(table, unit_arrays[list], i, size), 0);
+            append_char(output, '\n');
+        }
+
+        append_char(output, '\n');
+    }
+
+
+    append_string(output, "  Abbreviations:\n");
+
+    for(uint64_t i = 0; i < table->num_abbrevs; i++)
+    {
+        names_abbrev_t *abbrev = &table->abbrevs[i];
+
+        append_string(output, "   0x");
+        append_hex(output, abbrev->code, 0);
+        append_char(output, ' ');
+        stringify_dwarf_tag(output, abbrev->tag);
+
+        for(uint32_t j = 0; j < abbrev->num_attributes; j++)
+        {
+            char *name = find_dwarf_name(dwarf_name_index_attributes, sizeof(dwarf_name_index_attributes)/sizeof(char*), vendor_dwarf_name_index_attributes, sizeof(vendor_dwarf_name_index_attributes)/sizeof(dwarf_name_t), abbrev->attributes[j].name);
+
+            append_char(output, ' ');
+
+            if(name != 
+# 1926 "src/stringify.c" 3 4
+                      ((void *)0)
+# 1926 "src/stringify.c"
+                          )
+                append_string(output, name);
+            else
+                append_format(output, "DW_IDX_%#x", abbrev->attributes[j].name);
+
+            append_char(output, ' ');
+            stringify_dwarf_form(output, abbrev->attributes[j].form);
+        }
+
+        append_char(output, '\n');
+    }
+
+    append_char(output, '\n');
+}
+
+
+
+
+
+
+
+void stringify_debug_names_buckets(output_t *output, names_table_t *table, uint64_t buckets_used, uint64_t longest_bucket)
+{
+    append_string(output, "  Used ");
+    append_decimal(output, buckets_used);
+    append_string(output, " of ");
+    append_decimal(output, table->bucket_count);
+    append_string(output, (table->bucket_count == 1) ? " bucket.\n" : " buckets.\n");
+    append_string(output, "  Out of ");
+    append_decimal(output, table->name_count);
+    append_string(output, " items there are ");
+    append_decimal(output, table->name_count - buckets_used);
+    append_string(output, " bucket clashes (longest of ");
+    append_decimal(output, longest_bucket);
+    append_string(output, " entries).\n\n");
+}
+
+
+
+
+
+
+
+void stringify_debug_name(output_t *output, uint64_t number, uint32_t hash, 
+# 1969 "src/stringify.c" 3 4
+                                                                           _Bool 
+# 1969 "src/stringify.c"
+                                                                                has_hash, const char *name, uint64_t length)
+{
+    append_format(output, "   [%3lu] ", (unsigned long) number);
+
+    if(has_hash)
+    {
+        append_char(output, '#');
+        append_hex(output, hash, 8);
+        append_char(output, ' ');
+    }
+
+    append_bytes(output, name, length);
+    append_char(output, ':');
+}
+
+
+
+
+
+
+
+void stringify_debug_names_entry(output_t *output, names_entry_t *entry)
+{
+    append_string(output, " <0x");
+    append_hex(output, entry->offset, 0);
+    append_string(output, "> ");
+    stringify_dwarf_tag(output, entry->abbrev->tag);
+
+    if(entry->has_compile_unit)
+    {
+        append_string(output, " DW_IDX_compile_unit=");
+        append_decimal(output, entry->compile_unit);
+    }
+
+    if(entry->has_type_unit)
+    {
+        append_string(output, " DW_IDX_type_unit=");
+        append_decimal(output, entry->type_unit);
+    }
+
+    if(entry->has_die_offset)
+    {
+        append_string(output, " DW_IDX_die_offset=0x");
+        append_hex(output, entry->die_offset, 0);
+    }
+
+    if(entry->has_parent)
+    {
+        append_string(output, " DW_IDX_parent=<0x");
+        append_hex(output, entry->parent, 0);
+        append_char(output, '>');
+    }
+}
+
+
+
+
+
+
+
+void stringify_debug_name_match(output_t *output, const char *name, size_t length, uint64_t die_offset, uint32_t tag)
+{
+    append_bytes(output, name, length);
+    append_string(output, "\t0x");
+    append_hex(output, die_offset, 0);
+    append_char(output, '\t');
+    stringify_dwarf_tag(output, tag);
+    append_char(output, '\n');
+}
+# 2048 "src/stringify.c"
+int stringify_ELF32_header(output_t *output, ELF32_Header_t *elf_header, ELF32_Section_Header_t *section_header_table)
+{
+    char *header_string = "ELF header:\n";
+    char *ident = "  ELF Identification bits:\t";
+    char *class = "  Class:\t\t\t\t";
+    char *data = "  Data:\t\t\t\t\t";
+    char *version = "  Version:\t\t\t\t";
+    char *osabi = "  OS/ABI:\t\t\t\t";
+    char *type = "  Type:\t\t\t\t\t";
+    char *machine = "  Machine:\t\t\t\t";
+    char *entry = "  Entry point address:\t\t\t";
+    char *section_headers = "  Start of section headers:\t\t";
+    char *program_headers = "  Start of program headers:\t\t";
+    char *flags = "  Flags:\t\t\t\t";
+    char *header_size = "  Size of this header:\t\t\t";
+    char *program_header_size = "  Size of the program headers:\t\t";
+    char *num_program_headers = "  Number of program headers:\t\t";
+    char *section_header_size = "  Size of the section headers:\t\t";
+    char *num_section_headers = "  Number of section headers:\t\t";
+    char *string_table_index = "  Section header string table index:\t";
+
+
+    append_string(output, header_string);
+    append_string(output, ident);
+
+
+
+    for(int i = 0; i < 16; i++)
+    {
+        append_hex(output, elf_header->e_ident[i], 2);
+        append_char(output, (i < 16 - 1) ? ' ' : '\n');
+    }
+
+
+
+    append_string(output, class);
+
+    switch(elf_header->e_ident[4])
+    {
+        case 1:
+            append_string(output, "ELF32\n");
+            break;
+
+        case 2:
+            append_string(output, "ELF64\n");
+            break;
+
+        default:
+            append_string(output, "Unrecognized\n");
+    }
+
+
+
+
+
+    append_string(output, data);
+
+    switch (elf_header->e_ident[5])
+    {
+    case 1:
+        append_string(output, "2's complement, little-endian\n");
+        break;
+
+    case 2:
+        append_string(output, "2's complement, big-endian");
+        break;
+
+    default:
+        append_string(output, "Unrecognized format");
+        break;
+    }
+
+
+
+
+    append_string(output, version);
+
+    switch(elf_header->e_version)
+    {
+        case 1:
+            append_string(output, "Current\n");
+            break;
+
+        default:
+            append_string(output, "None\n");
+            break;
+    }
+
+
+
+
+
+    append_string(output, osabi);
+
+    switch(elf_header->e_ident[7])
+    {
+        case 0:
+            append_string(output, "Unix - System V\n");
+            break;
+
+        case 1:
+            append_string(output, "HP-UX\n");
+            break;
+
+        case 255:
+            append_string(output, "Standalone (embedded) application\n");
+            break;
+
+        default:
+            append_string(output, "Unrecognized\n");
+            break;
+    }
+
+
+
+
+
+    append_string(output, type);
+
+    switch(elf_header->e_type)
+    {
+        case 0:
+            append_string(output, "None\n");
+            break;
+
+        case 1:
+            append_string(output, "REL (Relocatable File)\n");
+            break;
+
+        case 2:
+            append_string(output, "EXEC (Executable file)\n");
+            break;
+
+        case 3:
+            append_string(output, "DYN (Dynamically-linker shared library)\n");
+            break;
+
+        case 4:
+            append_string(output, "CORE (Core dump file)\n");
+            break;
+
+        default:
+            append_string(output, "Unkown or processor-specific type\n");
+            break;
+    }
+
+
+
+
+
+    append_string(output, machine);
+
+    switch (elf_header->e_machine)
+    {
+    case 0:
+        append_string(output, "No machine type\n");
+        break;
+
+    case 1:
+        append_string(output, "AT&T WE 32100\n");
+        break;
+
+    case 2:
+        append_string(output, "SPARC\n");
+        break;
+
+    case 3:
+        append_string(output, "Intel Architecture\n");
+        break;
+
+    case 4:
+        append_string(output, "Motorola 68000\n");
+        break;
+
+    case 5:
+        append_string(output, "Motorola 88000\n");
+        break;
+
+    case 7:
+        append_string(output, "Intel 80860\n");
+        break;
+
+    case 8:
+        append_string(output, "MIPS RS3000 Big-Endian\n");
+        break;
+
+    case 10:
+        append_string(output, "MIPS RS4000 Big-Endian\n");
+        break;
+
+    case 62:
+        append_string(output, "Advanced Micro Devices X86-64\n");
+        break;
+
+    default:
+        append_decimal(output, elf_header->e_machine);
+        append_string(output, ": Unknown machine architecture\n");
+        break;
+    }
+
+
+
+
+
+    append_string(output, entry);
+    append_string(output, "0x");
+    append_hex(output, elf_header->e_entry, 0);
+    append_char(output, '\n');
+
+
+
+    append_string(output, section_headers);
+    append_decimal(output, elf_header->e_shoff);
+    append_string(output, " (bytes into the file)\n");
+
+
+
+    append_string(output, program_headers);
+    append_decimal(output, elf_header->e_phoff);
+    append_string(output, " (bytes into the file)\n");
+
+
+
+    append_string(output, flags);
+    append_string(output, "0x");
+    append_hex(output, elf_header->e_flags, 0);
+    append_char(output, '\n');
+
+
+
+    append_string(output, header_size);
+    append_decimal(output, elf_header->e_ehsize);
+    append_string(output, " (bytes)\n");
+
+
+
+    append_string(output, section_header_size);
+    append_decimal(output, elf_header->e_shentsize);
+    append_string(output, " (bytes)\n");
+
+
+
+    append_string(output, num_section_headers);
+    append_decimal(output, elf_header->e_shnum);
+
+    if(elf_header->e_shnum == 0 && get_ELF32_num_sections(elf_header, section_header_table) != 0)
+    {
+        append_string(output, " (");
+        append_decimal(output, get_ELF32_num_sections(elf_header, section_header_table));
+        append_char(output, ')');
+    }
+
+    append_char(output, '\n');
+
+
+
+    append_string(output, program_header_size);
+    append_decimal(output, elf_header->e_phentsize);
+    append_string(output, " (bytes)\n");
+
+
+
+    append_string(output, num_program_headers);
+    append_decimal(output, elf_header->e_phnum);
+    append_char(output, '\n');
+
+
+
+    append_string(output, string_table_index);
+    append_decimal(output, elf_header->e_shstrndx);
+
+    if(elf_header->e_shstrndx == 0xffff)
+    {
+        append_string(output, " (");
+        append_decimal(output, get_ELF32_section_string_table_index(elf_header, section_header_table));
+        append_char(output, ')');
+    }
+
+    append_char(output, '\n');
+
+
+    return 0;
+}
+
+
+int stringify_ELF32_section_header_table(output_t *output, ELF32_Section_Header_t *section_header_table, ELF32_Header_t *file_header, section_name_table_t *section_header_names)
+{
+    fprintf(
+# 2335 "src/stringify.c" 3 4
+           stderr
+# 2335 "src/stringify.c"
+                 , "TODO: Implement stringification of 32-bit ELF section header table.\n");
+    return -1;
+}
+
+
+
+
+
+
+
+static void stringify_program_header_preamble(output_t *output, uint16_t type, uint64_t entry, uint64_t num_program_headers,
+                                              uint64_t program_header_offset)
+{
+    static char *file_types[] = {
+        [0] = "NONE",
+        [1] = "REL (Relocatable File)",
+        [2] = "EXEC (Executable File)",
+        [3] = "DYN (Position Independent executable file)",
+        [4] = "CORE (Core Dump file)"
+    };
+
+
+    append_string(output, "\nELF file type is ");
+    append_string(output, (type <= 4) ? file_types[type] : "UNKNOWN");
+    append_char(output, '\n');
+
+
+    append_string(output, "Entry point is 0x");
+    append_hex(output, entry, 0);
+    append_char(output, '\n');
+
+    append_string(output, "There are ");
+    append_decimal(output, num_program_headers);
+    append_string(output, " section headers starting at offset ");
+    append_decimal(output, program_header_offset);
+    append_string(output, "\n\n");
+
+    append_string(output, "Program Headers:\n");
+}
+
+
+
+
+
+
+
+static void stringify_section_to_segment_mapping(output_t *output, int num_segments, section_to_segment_mapping_t *section_to_segment_mapping,
+                                                 section_name_table_t *section_names)
+{
+    append_string(output, "\n\nSection to Segment mapping:\n\n");
+
+    append_string(output, "Segment Number\tSection Name\n");
+
+
+    for(int i = 0; i < num_segments; i++)
+    {
+        append_decimal(output, i);
+        append_string(output, "\t\t");
+
+
+
+
+
+        for(int j = section_to_segment_mapping->segment_start[i]; j < section_to_segment_mapping->segment_start[i+1]; j++)
+        {
+            string_view_t section_name = section_names->names[section_to_segment_mapping->section_indices[j]];
+
+            append_bytes(output, section_name.string, section_name.length);
+            append_char(output, ' ');
+        }
+
+        append_string(output, "\n");
+    }
+}
+
+
+
+
+
+
+
+static void stringify_ELF32_program_header(output_t *output, ELF32_Program_Header_t *program_header_table, int index)
+{
+    ELF32_Program_Header_t *program_header = &program_header_table[index];
+
+
+    char *segment_type = (program_header->p_type <= 6) ? segment_types[program_header->p_type] : "UNKNOWN";
+
+
+    append_decimal(output, index);
+    append_char(output, '\t');
+    append_string(output, segment_type);
+    append_string(output, "\t\t");
+    append_hex(output, program_header->p_offset, 8);
+    append_char(output, '\t');
+    append_hex(output, program_header->p_vaddr, 8);
+    append_char(output, '\t');
+    append_hex(output, program_header->p_paddr, 8);
+    append_char(output, '\t');
+    append_hex(output, program_header->p_filesz, 8);
+    append_char(output, '\t');
+    append_hex(output, program_header->p_memsz, 8);
+    append_char(output, '\t');
+    append_decimal(output, program_header->p_flags);
+    append_char(output, '\t');
+    append_decimal(output, program_header->p_align);
+    append_char(output, '\n');
+}
+# 2451 "src/stringify.c"
+int stringify_ELF32_program_header_table(output_t *output, ELF32_Program_Header_t *program_header_table, ELF32_Header_t *file_header,
+                                         section_to_segment_mapping_t *section_to_segment_mapping, section_name_table_t *section_names)
+{
+
+
+
+
+    if(program_header_table == 
+# 2458 "src/stringify.c" 3 4
+                              ((void *)0) 
+# 2458 "src/stringify.c"
+                                   || file_header == 
+# 2458 "src/stringify.c" 3 4
+                                                     ((void *)0) 
+# 2458 "src/stringify.c"
+                                                          || section_to_segment_mapping == 
+# 2458 "src/stringify.c" 3 4
+                                                                                           ((void *)0) 
+# 2458 "src/stringify.c"
+                                                                                                || section_names == 
+# 2458 "src/stringify.c" 3 4
+                                                                                                                    ((void *)0)
+# 2458 "src/stringify.c"
+                                                                                                                        )
+    {
+        fprintf(
+# 2460 "src/stringify.c" 3 4
+               stderr
+# 2460 "src/stringify.c"
+                     , "NULL pointer passed to stringify_ELF32_program_header_table.\n");
+        return -1;
+    }
+
+
+    stringify_program_header_preamble(output, file_header->e_type, file_header->e_entry, file_header->e_phnum, file_header->e_phoff);
+
+    append_string(output, "Number\tType\t\tOffset\t\tVirtAddr\tPhysAddr\tFileSize\tMemSize\t\tFlags\tAlign\n");
+
+    append_string(output, "-----------------------------------------------------------------------------------------------------\n");
+
+
+    for(int i = 0; i < file_header->e_phnum; i++)
+    {
+        stringify_ELF32_program_header(output, program_header_table, i);
+    }
+
+
+    stringify_section_to_segment_mapping(output, file_header->e_phnum, section_to_segment_mapping, section_names);
+
+
+    return 0;
+}
+
+
+
+
+
+
+
+void stringify_ELF32_symbol(output_t *output, symbol_table_t *symbol_table, uint64_t symbol_number)
+{
+    ELF32_Sym_t *symbol = &((ELF32_Sym_t*) symbol_table->symbols)[symbol_number];
+    string_view_t name = get_string_table_entry(symbol_table->string_table, symbol_table->string_table_size, symbol->st_name);
+
+    append_decimal(output, symbol_number);
+    append_char(output, '\t');
+    append_hex(output, symbol->st_value, 8);
+    append_char(output, '\t');
+    append_decimal(output, symbol->st_size);
+    append_char(output, '\t');
+    append_string(output, get_symbol_type_name(symbol->st_info));
+    append_char(output, '\t');
+    append_string(output, get_symbol_binding_name(symbol->st_info));
+    append_char(output, '\t');
+    append_string(output, symbol_visibilities[((symbol->st_other)&0x3)]);
+    append_char(output, '\t');
+    stringify_symbol_section_index(output, symbol->st_shndx);
+    append_char(output, '\t');
+    append_bytes(output, name.string, name.length);
+    append_char(output, '\n');
+}
+# 2522 "src/stringify.c"
+int stringify_ELF32_symbol_table(output_t *output, symbol_table_t *symbol_table, string_view_t section_name)
+{
+
+
+
+
+    if(symbol_table == 
+# 2528 "src/stringify.c" 3 4
+                      ((void *)0) 
+# 2528 "src/stringify.c"
+                           || symbol_table->symbols == 
+# 2528 "src/stringify.c" 3 4
+                                                       ((void *)0)
+# 2528 "src/stringify.c"
+                                                           )
+    {
+        fprintf(
+# 2530 "src/stringify.c" 3 4
+               stderr
+# 2530 "src/stringify.c"
+                     , "NULL pointer passed to stringify_ELF32_symbol_table.\n");
+        return -1;
+    }
+
+    stringify_symbol_table_title(output, section_name, symbol_table->num_symbols, 8);
+
+
+    for(uint64_t i = 0; i < symbol_table->num_symbols; i++)
+    {
+        stringify_ELF32_symbol(output, symbol_table, i);
+    }
+
+
+    return 0;
+}
+# 2558 "src/stringify.c"
+int stringify_ELF32_relocation_table(output_t *output, relocation_table_t *relocation_table, ELF32_Section_Header_t *section_header,
+                                      string_view_t section_name, int machine, section_name_table_t *section_names)
+{
+    uint32_t symbol_indices[256];
+    uint32_t types[256];
+
+    ELF32_Rel_t *rel_entries;
+    ELF32_Rela_t *rela_entries;
+    ELF32_Sym_t *symbols;
+
+
+
+
+
+
+    if(relocation_table == 
+# 2573 "src/stringify.c" 3 4
+                          ((void *)0) 
+# 2573 "src/stringify.c"
+                               || relocation_table->entries == 
+# 2573 "src/stringify.c" 3 4
+                                                               ((void *)0) 
+# 2573 "src/stringify.c"
+                                                                    || section_header == 
+# 2573 "src/stringify.c" 3 4
+                                                                                         ((void *)0)
+# 2573 "src/stringify.c"
+                                                                                             )
+    {
+        fprintf(
+# 2575 "src/stringify.c" 3 4
+               stderr
+# 2575 "src/stringify.c"
+                     , "NULL pointer passed to stringify_ELF32_relocation_table.\n");
+        return -1;
+    }
+
+    rel_entries = (ELF32_Rel_t*) relocation_table->entries;
+    rela_entries = (ELF32_Rela_t*) relocation_table->entries;
+    symbols = (ELF32_Sym_t*) relocation_table->symbols.symbols;
+
+
+    stringify_relocation_table_title(output, section_name, section_header->sh_offset, relocation_table->num_entries, relocation_table->has_addends);
+
+
+    for(uint64_t start = 0; start < relocation_table->num_entries; start += 256)
+    {
+        uint64_t count = relocation_table->num_entries - start;
+
+        if(count > 256)
+            count = 256;
+
+
+
+        if(relocation_table->has_addends)
+        {
+            for(uint64_t i = 0; i < count; i++)
+            {
+                symbol_indices[i] = ((rela_entries[start + i].r_info)>>8);
+                types[i] = ((unsigned char)rela_entries[start + i].r_info);
+            }
+        }
+        else
+        {
+            for(uint64_t i = 0; i < count; i++)
+            {
+                symbol_indices[i] = ((rel_entries[start + i].r_info)>>8);
+                types[i] = ((unsigned char)rel_entries[start + i].r_info);
+            }
+        }
+
+
+        for(uint64_t i = 0; i < count; i++)
+        {
+            uint64_t offset = relocation_table->has_addends ? rela_entries[start + i].r_offset : rel_entries[start + i].r_offset;
+            uint64_t info = relocation_table->has_addends ? rela_entries[start + i].r_info : rel_entries[start + i].r_info;
+            
+# 2618 "src/stringify.c" 3 4
+           _Bool 
+# 2618 "src/stringify.c"
+                has_symbol = symbol_indices[i] != 0 && relocation_table->has_symbols &&
+                              symbol_indices[i] < relocation_table->symbols.num_symbols;
+
+            append_hex(output, offset, 8);
+            append_char(output, '\t');
+            append_hex(output, info, 8);
+            append_char(output, '\t');
+            stringify_relocation_type(output, machine, types[i]);
+            append_char(output, '\t');
+
+            if(has_symbol)
+            {
+                ELF32_Sym_t *symbol = &symbols[symbol_indices[i]];
+                string_view_t name = get_string_table_entry(relocation_table->symbols.string_table,
+                                                            relocation_table->symbols.string_table_size, symbol->st_name);
+
+
+                if(name.length == 0 && ((symbol->st_info)&0xf) == 3 &&
+                   section_names != 
+# 2636 "src/stringify.c" 3 4
+                                   ((void *)0) 
+# 2636 "src/stringify.c"
+                                        && symbol->st_shndx < section_names->num_names)
+                {
+                    name = section_names->names[symbol->st_shndx];
+                }
+
+                append_hex(output, symbol->st_value, 8);
+                append_char(output, '\t');
+                append_bytes(output, name.string, name.length);
+            }
+            else
+            {
+                append_padding(output, 8);
+                append_char(output, '\t');
+            }
+
+            if(relocation_table->has_addends)
+            {
+                if(has_symbol)
+                    stringify_addend(output, rela_entries[start + i].r_addend);
+                else
+                    append_hex(output, rela_entries[start + i].r_addend, 0);
+            }
+
+            append_char(output, '\n');
+        }
+    }
+
+
+    return 0;
+}
+# 2676 "src/stringify.c"
+int stringify_ELF64_header(output_t *output, ELF64_Header_t *elf_header, ELF64_Section_Header_t *section_header_table)
+{
+    char *header_string = "ELF header:\n";
+    char *ident = "  ELF Identification bits:\t";
+    char *class = "  Class:\t\t\t\t";
+    char *data = "  Data:\t\t\t\t\t";
+    char *version = "  Version:\t\t\t\t";
+    char *osabi = "  OS/ABI:\t\t\t\t";
+    char *type = "  Type:\t\t\t\t\t";
+    char *machine = "  Machine:\t\t\t\t";
+    char *entry = "  Entry point address:\t\t\t";
+    char *section_headers = "  Start of section headers:\t\t";
+    char *program_headers = "  Start of program headers:\t\t";
+    char *flags = "  Flags:\t\t\t\t";
+    char *header_size = "  Size of this header:\t\t\t";
+    char *program_header_size = "  Size of the program headers:\t\t";
+    char *num_program_headers = "  Number of program headers:\t\t";
+    char *section_header_size = "  Size of the section headers:\t\t";
+    char *num_section_headers = "  Number of section headers:\t\t";
+    char *string_table_index = "  Section header string table index:\t";
+
+
+    append_string(output, header_string);
+    append_string(output, ident);
+
+
+
+    for(int i = 0; i < 16; i++)
+    {
+        append_hex(output, elf_header->e_ident[i], 2);
+        append_char(output, (i < 16 - 1) ? ' ' : '\n');
+    }
+
+
+
+    append_string(output, class);
+
+    switch(elf_header->e_ident[4])
+    {
+        case 1:
+            append_string(output, "ELF32\n");
+            break;
+
+        case 2:
+            append_string(output, "ELF64\n");
+            break;
+
+        default:
+            append_string(output, "Unrecognized\n");
+    }
+
+
+
+
+
+    append_string(output, data);
+
+    switch (elf_header->e_ident[5])
+    {
+    case 1:
+        append_string(output, "2's complement, little-endian\n");
+        break;
+
+    case 2:
+        append_string(output, "2's complement, big-endian");
+        break;
+
+    default:
+        append_string(output, "Unrecognized format");
+        break;
+    }
+
+
+
+
+    append_string(output, version);
+
+    switch(elf_header->e_version)
+    {
+        case 1:
+            append_string(output, "Current\n");
+            break;
+
+        default:
+            append_string(output, "None\n");
+            break;
+    }
+
+
+
+
+
+    append_string(output, osabi);
+
+    switch(elf_header->e_ident[7])
+    {
+        case 0:
+            append_string(output, "Unix - System V\n");
+            break;
+
+        case 1:
+            append_string(output, "HP-UX\n");
+            break;
+
+        case 255:
+            append_string(output, "Standalone (embedded) application\n");
+            break;
+
+        default:
+            append_string(output, "Unrecognized\n");
+            break;
+    }
+
+
+
+
+
+    append_string(output, type);
+
+    switch(elf_header->e_type)
+    {
+        case 0:
+            append_string(output, "None\n");
+            break;
+
+        case 1:
+            append_string(output, "REL (Relocatable File)\n");
+            break;
+
+        case 2:
+            append_string(output, "EXEC (Executable file)\n");
+            break;
+
+        case 3:
+            append_string(output, "DYN (Dynamically-linker shared library)\n");
+            break;
+
+        case 4:
+            append_string(output, "CORE (Core dump file)\n");
+            break;
+
+        default:
+            append_string(output, "Unkown or processor-specific type\n");
+            break;
+    }
+
+
+
+
+
+    append_string(output, machine);
+
+    switch (elf_header->e_machine)
+    {
+    case 0:
+        append_string(output, "No machine type\n");
+        break;
+
+    case 1:
+        append_string(output, "AT&T WE 32100\n");
+        break;
+
+    case 2:
+        append_string(output, "SPARC\n");
+        break;
+
+    case 3:
+        append_string(output, "Intel Architecture\n");
+        break;
+
+    case 4:
+        append_string(output, "Motorola 68000\n");
+        break;
+
+    case 5:
+        append_string(output, "Motorola 88000\n");
+        break;
+
+    case 7:
+        append_string(output, "Intel 80860\n");
+        break;
+
+    case 8:
+        append_string(output, "MIPS RS3000 Big-Endian\n");
+        break;
+
+    case 10:
+        append_string(output, "MIPS RS4000 Big-Endian\n");
+        break;
+
+    case 62:
+        append_string(output, "Advanced Micro Devices X86-64\n");
+        break;
+
+    default:
+        append_decimal(output, elf_header->e_machine);
+        append_string(output, ": Unknown machine architecture\n");
+        break;
+    }
+
+
+
+
+
+    append_string(output, entry);
+    append_string(output, "0x");
+    append_hex(output, elf_header->e_entry, 0);
+    append_char(output, '\n');
+
+
+
+    append_string(output, section_headers);
+    append_decimal(output, elf_header->e_shoff);
+    append_string(output, " (bytes into the file)\n");
+
+
+
+    append_string(output, program_headers);
+    append_decimal(output, elf_header->e_phoff);
+    append_string(output, " (bytes into the file)\n");
+
+
+
+    append_string(output, flags);
+    append_string(output, "0x");
+    append_hex(output, elf_header->e_flags, 0);
+    append_char(output, '\n');
+
+
+
+    append_string(output, header_size);
+    append_decimal(output, elf_header->e_ehsize);
+    append_string(output, " (bytes)\n");
+
+
+
+    append_string(output, section_header_size);
+    append_decimal(output, elf_header->e_shentsize);
+    append_string(output, " (bytes)\n");
+
+
+
+    append_string(output, num_section_headers);
+    append_decimal(output, elf_header->e_shnum);
+
+    if(elf_header->e_shnum == 0 && get_ELF64_num_sections(elf_header, section_header_table) != 0)
+    {
+        append_string(output, " (");
+        append_decimal(output, get_ELF64_num_sections(elf_header, section_header_table));
+        append_char(output, ')');
+    }
+
+    append_char(output, '\n');
+
+
+
+    append_string(output, program_header_size);
+    append_decimal(output, elf_header->e_phentsize);
+    append_string(output, " (bytes)\n");
+
+
+
+    append_string(output, num_program_headers);
+    append_decimal(output, elf_header->e_phnum);
+    append_char(output, '\n');
+
+
+
+    append_string(output, string_table_index);
+    append_decimal(output, elf_header->e_shstrndx);
+
+    if(elf_header->e_shstrndx == 0xffff)
+    {
+        append_string(output, " (");
+        append_decimal(output, get_ELF64_section_string_table_index(elf_header, section_header_table));
+        append_char(output, ')');
+    }
+
+    append_char(output, '\n');
+
+
+    return 0;
+}
+
+
+
+
+
+
+
+int stringify_ELF64_flags(char *flag_buffer, ELF64_Xword_t flags)
+{
+    int current_index = 0;
+
+    flag_buffer[current_index] = 'W';
+    current_index += (flags & 0x1) != 0;
+
+    flag_buffer[current_index] = 'A';
+    current_index += (flags & 0x2) != 0;
+
+    flag_buffer[current_index] = 'X';
+    current_index += (flags & 0x4) != 0;
+
+    flag_buffer[current_index] = '\0';
+
+    return current_index;
+}
+# 3007 "src/stringify.c"
+static void stringify_ELF64_section_header(output_t *output, ELF64_Section_Header_t *section_header, int section_number, string_view_t section_name, int max_len)
+{
+    string_view_t *section_type = &section_types[(section_header->sh_type <= 11) ? section_header->sh_type : 11 + 1];
+    int padding = max_len - (int) section_name.length + 5;
+    char *destination;
+
+
+    destination = reserve_output(output, 3 + 21 + 3);
+
+    memcpy(destination, "[  ", 3);
+    destination += 3;
+    destination += format_decimal(destination, (uint64_t) section_number);
+    memcpy(destination, "]\t\t", 3);
+    destination += 3;
+
+    output->size = destination - output->buffer;
+
+
+
+
+
+
+    append_bytes(output, section_name.string, section_name.length);
+
+    if(padding > 256)
+    {
+        append_padding(output, padding);
+        padding = 0;
+    }
+
+    destination = reserve_output(output, ((padding > 0) ? padding : 0) + (3 + 21 + 3 + 8 + 2 + 4*(16 + 1) + 4 + 3*(21 + 1)));
+
+    if(padding > 0)
+    {
+        memset(destination, ' ', padding);
+        destination += padding;
+    }
+
+
+    memcpy(destination, section_type->string, section_type->length);
+    destination += section_type->length;
+    *destination++ = '\t';
+    *destination++ = '\t';
+    destination += format_hex(destination, section_header->sh_addr, 16);
+    *destination++ = '\t';
+    destination += format_hex(destination, section_header->sh_offset, 8);
+    *destination++ = '\t';
+    destination += format_hex(destination, section_header->sh_size, 16);
+    *destination++ = '\t';
+    destination += format_hex(destination, section_header->sh_entsize, 16);
+    *destination++ = '\t';
+    destination += stringify_ELF64_flags(destination, section_header->sh_flags);
+    *destination++ = '\t';
+    destination += format_decimal(destination, section_header->sh_link);
+    *destination++ = '\t';
+    destination += format_decimal(destination, section_header->sh_info);
+    *destination++ = '\t';
+    destination += format_decimal(destination, section_header->sh_addralign);
+    *destination++ = '\n';
+
+    output->size = destination - output->buffer;
+}
+# 3083 "src/stringify.c"
+int stringify_ELF64_section_header_table(output_t *output, ELF64_Section_Header_t *section_header_table, ELF64_Header_t *file_header, section_name_table_t *section_header_names)
+{
+
+
+
+
+
+    if(section_header_table == 
+# 3090 "src/stringify.c" 3 4
+                              ((void *)0) 
+# 3090 "src/stringify.c"
+                                   || file_header == 
+# 3090 "src/stringify.c" 3 4
+                                                     ((void *)0) 
+# 3090 "src/stringify.c"
+                                                          || section_header_names == 
+# 3090 "src/stringify.c" 3 4
+                                                                                     ((void *)0)
+# 3090 "src/stringify.c"
+                                                                                         )
+    {
+        fprintf(
+# 3092 "src/stringify.c" 3 4
+               stderr
+# 3092 "src/stringify.c"
+                     , "NULL pointer passed to stringify_ELF64_section_header_table.\n");
+        return -1;
+    }
+
+
+
+
+
+    append_string(output, "There are ");
+    append_decimal(output, get_ELF64_num_sections(file_header, section_header_table));
+    append_string(output, " section headers, starting at offset 0x");
+    append_hex(output, file_header->e_shoff, 0);
+    append_string(output, "\n\n");
+
+
+
+    append_string(output, "Section Headers:\n");
+
+
+
+    int max_len = section_header_names->max_length;
+
+
+
+    append_string(output, "[Number]\tName");
+    append_padding(output, max_len - strlen("Name") + 5);
+    append_string(output, "Type\t\tAddress\t\t\tOffset\t\tSize\t\t\tEntSize\t\t\tFlags\tLink\tInfo\tAlign\n");
+
+
+    append_string(output, "-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------\n");
+
+
+
+    for(int i = 0; i < section_header_names->num_names; i++)
+    {
+        stringify_ELF64_section_header(output, &section_header_table[i], i, section_header_names->names[i], max_len);
+    }
+
+
+    append_string(output, "\nKey to flags:  (W) Write, (A) alloc, (X) execute.\n");
+
+
+    return 0;
+}
+
+
+
+
+static void stringify_ELF64_program_header(output_t *output, ELF64_Program_Header_t *program_header_table, int index)
+{
+    ELF64_Program_Header_t program_header = program_header_table[index];
+# 3151 "src/stringify.c"
+    char *segment_type = (program_header.p_type <= 6) ? segment_types[program_header.p_type] : "UNKNOWN";
+
+
+    append_decimal(output, index);
+    append_char(output, '\t');
+    append_string(output, segment_type);
+    append_string(output, "\t\t");
+    append_hex(output, program_header.p_offset, 16);
+    append_char(output, '\t');
+    append_hex(output, program_header.p_vaddr, 16);
+    append_char(output, '\t');
+    append_hex(output, program_header.p_paddr, 16);
+    append_char(output, '\t');
+    append_hex(output, program_header.p_filesz, 16);
+    append_char(output, '\t');
+    append_hex(output, program_header.p_memsz, 16);
+    append_char(output, '\t');
+    append_decimal(output, program_header.p_flags);
+    append_char(output, '\t');
+    append_decimal(output, program_header.p_align);
+    append_char(output, '\n');
+}
+
+
+
+int stringify_ELF64_program_header_table(output_t *output, ELF64_Program_Header_t *program_header_table, ELF64_Header_t *file_header,
+                                         section_to_segment_mapping_t *section_to_segment_mapping, section_name_table_t *section_names)
+{
+
+
+
+
+
+
+    if(program_header_table == 
+# 3185 "src/stringify.c" 3 4
+                              ((void *)0) 
+# 3185 "src/stringify.c"
+                                   || file_header == 
+# 3185 "src/stringify.c" 3 4
+                                                     ((void *)0) 
+# 3185 "src/stringify.c"
+                                                          || section_to_segment_mapping == 
+# 3185 "src/stringify.c" 3 4
+                                                                                           ((void *)0) 
+# 3185 "src/stringify.c"
+                                                                                                || section_names == 
+# 3185 "src/stringify.c" 3 4
+                                                                                                                    ((void *)0)
+# 3185 "src/stringify.c"
+                                                                                                                        )
+    {
+        fprintf(
+# 3187 "src/stringify.c" 3 4
+               stderr
+# 3187 "src/stringify.c"
+                     , "NULL pointer passed to stringify_ELF64_program_header_table.\n");
+        return -1;
+    }
+
+
+
+
+    stringify_program_header_preamble(output, file_header->e_type, file_header->e_entry, file_header->e_phnum, file_header->e_phoff);
+
+
+    append_string(output, "Number\tType\t\tOffset\t\t\tVirtAddr\t\tPhysAddr\t\tFileSize\t\tMemSize\t\t\tFlags\tAlign\n");
+
+
+    append_string(output, "-------------------------------------------------------------------------------------------------------------------------------------------------------------\n");
+
+
+    for(int i = 0; i < file_header->e_phnum; i++)
+    {
+        stringify_ELF64_program_header(output, program_header_table, i);
+    }
+
+
+    stringify_section_to_segment_mapping(output, file_header->e_phnum, section_to_segment_mapping, section_names);
+
+
+    return 0;
+}
+
+
+
+
+
+
+
+void stringify_ELF64_symbol(output_t *output, symbol_table_t *symbol_table, uint64_t symbol_number)
+{
+    ELF64_Sym_t *symbol = &((ELF64_Sym_t*) symbol_table->symbols)[symbol_number];
+    string_view_t name = get_string_table_entry(symbol_table->string_table, symbol_table->string_table_size, symbol->st_name);
+
+    append_decimal(output, symbol_number);
+    append_char(output, '\t');
+    append_hex(output, symbol->st_value, 16);
+    append_char(output, '\t');
+    append_decimal(output, symbol->st_size);
+    append_char(output, '\t');
+    append_string(output, get_symbol_type_name(symbol->st_info));
+    append_char(output, '\t');
+    append_string(output, get_symbol_binding_name(symbol->st_info));
+    append_char(output, '\t');
+    append_string(output, symbol_visibilities[((symbol->st_other)&0x3)]);
+    append_char(output, '\t');
+    stringify_symbol_section_index(output, symbol->st_shndx);
+    append_char(output, '\t');
+    append_bytes(output, name.string, name.length);
+    append_char(output, '\n');
+}
+# 3253 "src/stringify.c"
+int stringify_ELF64_symbol_table(output_t *output, symbol_table_t *symbol_table, string_view_t section_name)
+{
+
+
+
+
+    if(symbol_table == 
+# 3259 "src/stringify.c" 3 4
+                      ((void *)0) 
+# 3259 "src/stringify.c"
+                           || symbol_table->symbols == 
+# 3259 "src/stringify.c" 3 4
+                                                       ((void *)0)
+# 3259 "src/stringify.c"
+                                                           )
+    {
+        fprintf(
+# 3261 "src/stringify.c" 3 4
+               stderr
+# 3261 "src/stringify.c"
+                     , "NULL pointer passed to stringify_ELF64_symbol_table.\n");
+        return -1;
+    }
+
+    stringify_symbol_table_title(output, section_name, symbol_table->num_symbols, 16);
+
+
+    for(uint64_t i = 0; i < symbol_table->num_symbols; i++)
+    {
+        stringify_ELF64_symbol(output, symbol_table, i);
+    }
+
+
+    return 0;
+}
+# 3289 "src/stringify.c"
+int stringify_ELF64_relocation_table(output_t *output, relocation_table_t *relocation_table, ELF64_Section_Header_t *section_header,
+                                      string_view_t section_name, int machine, section_name_table_t *section_names)
+{
+    uint32_t symbol_indices[256];
+    uint32_t types[256];
+
+    ELF64_Rel_t *rel_entries;
+    ELF64_Rela_t *rela_entries;
+    ELF64_Sym_t *symbols;
+
+
+
+
+
+
+    if(relocation_table == 
+# 3304 "src/stringify.c" 3 4
+                          ((void *)0) 
+# 3304 "src/stringify.c"
+                               || relocation_table->entries == 
+# 3304 "src/stringify.c" 3 4
+                                                               ((void *)0) 
+# 3304 "src/stringify.c"
+                                                                    || section_header == 
+# 3304 "src/stringify.c" 3 4
+                                                                                         ((void *)0)
+# 3304 "src/stringify.c"
+                                                                                             )
+    {
+        fprintf(
+# 3306 "src/stringify.c" 3 4
+               stderr
+# 3306 "src/stringify.c"
+                     , "NULL pointer passed to stringify_ELF64_relocation_table.\n");
+        return -1;
+    }
+
+    rel_entries = (ELF64_Rel_t*) relocation_table->entries;
+    rela_entries = (ELF64_Rela_t*) relocation_table->entries;
+    symbols = (ELF64_Sym_t*) relocation_table->symbols.symbols;
+
+
+    stringify_relocation_table_title(output, section_name, section_header->sh_offset, relocation_table->num_entries, relocation_table->has_addends);
+
+
+    for(uint64_t start = 0; start < relocation_table->num_entries; start += 256)
+    {
+        uint64_t count = relocation_table->num_entries - start;
+
+        if(count > 256)
+            count = 256;
+
+
+
+        if(relocation_table->has_addends)
+        {
+            for(uint64_t i = 0; i < count; i++)
+            {
+                symbol_indices[i] = ((rela_entries[start + i].r_info)>>32);
+                types[i] = ((rela_entries[start + i].r_info) & 0xffffffff);
+            }
+        }
+        else
+        {
+            for(uint64_t i = 0; i < count; i++)
+            {
+                symbol_indices[i] = ((rel_entries[start + i].r_info)>>32);
+                types[i] = ((rel_entries[start + i].r_info) & 0xffffffff);
+            }
+        }
+
+
+        for(uint64_t i = 0; i < count; i++)
+        {
+            uint64_t offset = relocation_table->has_addends ? rela_entries[start + i].r_offset : rel_entries[start + i].r_offset;
+            uint64_t info = relocation_table->has_addends ? rela_entries[start + i].r_info : rel_entries[start + i].r_info;
+            
+# 3349 "src/stringify.c" 3 4
+           _Bool 
+# 3349 "src/stringify.c"
+                has_symbol = symbol_indices[i] != 0 && relocation_table->has_symbols &&
+                              symbol_indices[i] < relocation_table->symbols.num_symbols;
+
+            append_hex(output, offset, 16);
+            append_char(output, '\t');
+            append_hex(output, info, 16);
+            append_char(output, '\t');
+            stringify_relocation_type(output, machine, types[i]);
+            append_char(output, '\t');
+
+            if(has_symbol)
+            {
+                ELF64_Sym_t *symbol = &symbols[symbol_indices[i]];
+                string_view_t name = get_string_table_entry(relocation_table->symbols.string_table,
+                                                            relocation_table->symbols.string_table_size, symbol->st_name);
+
+
+                if(name.length == 0 && ((symbol->st_info)&0xf) == 3 &&
+                   section_names != 
+# 3367 "src/stringify.c" 3 4
+                                   ((void *)0) 
+# 3367 "src/stringify.c"
+                                        && symbol->st_shndx < section_names->num_names)
+                {
+                    name = section_names->names[symbol->st_shndx];
+                }
+
+                append_hex(output, symbol->st_value, 16);
+                append_char(output, '\t');
+                append_bytes(output, name.string, name.length);
+            }
+            else
+            {
+                append_padding(output, 16);
+                append_char(output, '\t');
+            }
+
+            if(relocation_table->has_addends)
+            {
+                if(has_symbol)
+                    stringify_addend(output, rela_entries[start + i].r_addend);
+                else
+                    append_hex(output, rela_entries[start + i].r_addend, 0);
+            }
+
+            append_char(output, '\n');
+        }
+    }
+
+
+    return 0;
+}
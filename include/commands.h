@@ -8,6 +8,9 @@
 #define COMMANDS_H
 
 #include "debug.h"
+#include "session.h"
+#include "output.h"
+#include "pool.h"
 
 
 /*
@@ -28,7 +31,12 @@ typedef enum
     CMD_DUMP_RELOCATION_INFO,
     CMD_HEX_DUMP_SECTION,
     CMD_STRING_DUMP_SECTION,
-    CMD_DUMP_DEBUG_INFO
+    CMD_DUMP_DEBUG_INFO,
+    CMD_LOOKUP_SYMBOL,
+    CMD_ADDRESS_TO_SYMBOL,
+    CMD_ADDRESS_TO_UNIT,
+    CMD_FIND_FDE,
+    CMD_FIND_NAME
 
 } command_type;
 
@@ -56,6 +64,42 @@ typedef struct
     int section_number;
     char *section_name;
 
+    /*
+     * A section at least parallel_dump_threshold bytes
+     * long is dumped on the threads of the pool, if there
+     * is one.
+     */
+    thread_pool_t *pool;
+    uint64_t parallel_dump_threshold;
+
+
+    /*
+     * DIEs nested at least this deep are left out of a
+     * dump of .debug_info, unless it is -1.
+     */
+    int dwarf_depth;
+
+
+    /*
+     * Comma-separated names of the symbols to look up.
+     * Only used by the symbol lookup command.
+     */
+    char *symbol_names;
+
+
+    /*
+     * Comma-separated addresses to find the FDEs of.
+     * Only used by the FDE lookup command.
+     */
+    char *fde_addresses;
+
+
+    /*
+     * Comma-separated names to find the DIEs of in
+     * .debug_names. Only used by the name lookup command.
+     */
+    char *debug_names;
+
 
     /*
      * This is a string representation of the option
@@ -101,14 +145,22 @@ void release_command_list(command_list_t *list);
 /*
  * Functions for implementing the actual commands.
  */
-int dump_elf_header(FILE *input_file);
-int dump_section_headers(FILE *input_file);
-int dump_program_headers(FILE *input_file);
-int dump_symbol_table(FILE *input_file);
-int dump_relocation_info(FILE *input_file);
-int hex_dump_section(FILE *input_file, int section_number, char *section_name);
-int string_dump_section(FILE *input_file, int section_number, char *section_name);
-int dump_debug_info(FILE *input_file, debug_command_subtype subtype); 
+int dump_elf_header(elf_session_t *session, output_t *output);
+int dump_section_headers(elf_session_t *session, output_t *output);
+int dump_program_headers(elf_session_t *session, output_t *output);
+int dump_symbol_table(elf_session_t *session, output_t *output);
+int dump_relocation_info(elf_session_t *session, output_t *output);
+int hex_dump_section(elf_session_t *session, output_t *output, int section_number, char *section_name,
+                     thread_pool_t *pool, uint64_t parallel_dump_threshold);
+int string_dump_section(elf_session_t *session, output_t *output, int section_number, char *section_name,
+                        thread_pool_t *pool, uint64_t parallel_dump_threshold);
+int dump_debug_info(elf_session_t *session, output_t *output, debug_command_subtype subtype, int dwarf_depth,
+                    thread_pool_t *pool, uint64_t parallel_dump_threshold);
+int lookup_symbols(elf_session_t *session, output_t *output, char *symbol_names);
+int resolve_addresses(elf_session_t *session, output_t *output);
+int resolve_unit_addresses(elf_session_t *session, output_t *output);
+int find_fdes(elf_session_t *session, output_t *output, char *addresses);
+int find_debug_names(elf_session_t *session, output_t *output, char *names);
 
 
 
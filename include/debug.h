@@ -10,6 +10,16 @@
 #ifndef DEBUG_H
 #define DEBUG_H
 
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+
+
+#include "dwarf.h"
+#include "ranges.h"
+
+
 /*
  * Subtype of the command. This is used for
  * only commands that dump the debugging info.
@@ -29,4 +39,292 @@ typedef enum
 
 
 
-#endif
\ No newline at end of file
+/*
+ * One attribute specification of an abbreviation: the name
+ * of the attribute, its form, and for DW_FORM_implicit_const
+ * the value, which is kept in the abbreviation rather than
+ * in each DIE.
+ */
+typedef struct
+{
+    uint32_t name;
+    uint32_t form;
+    int64_t implicit_const;
+
+} abbrev_attribute_t;
+
+
+
+/*
+ * An abbreviation: the tag of the DIEs that use it, whether
+ * they have children, and the attributes they carry, in order.
+ */
+typedef struct
+{
+    uint64_t code;
+    uint32_t tag;
+    bool has_children;
+
+    uint32_t num_attributes;
+    abbrev_attribute_t *attributes;
+
+} abbrev_t;
+
+
+
+/*
+ * The set of abbreviations starting at some offset in
+ * .debug_abbrev, which one or more units refer to.
+ *
+ * Abbreviation codes are almost always numbered 1, 2, 3 ...
+ * so the abbreviations are found by code through a dense array
+ * indexed by the code itself. Only when the codes are too
+ * sparse for that (num_codes is then 0) is an open-addressing
+ * table used instead.
+ */
+typedef struct
+{
+    // offset of the set in .debug_abbrev, and of what follows it
+    uint64_t offset;
+    uint64_t end_offset;
+
+    // the abbreviations, in the order they appear
+    uint64_t num_abbrevs;
+    abbrev_t *abbrevs;
+
+    // every attribute specification of every abbreviation
+    abbrev_attribute_t *attributes;
+
+    // dense lookup: by_code[code] is the abbreviation, or NULL
+    uint64_t num_codes;
+    abbrev_t **by_code;
+
+    // sparse lookup; the number of slots is a power of 2
+    abbrev_t **slots;
+    uint64_t slot_mask;
+
+} abbrev_table_t;
+
+
+
+/*
+ * The abbreviation tables of a file, each parsed the first
+ * time a unit refers to it and kept by its offset, so that
+ * units sharing a table (as every unit of a linked program
+ * built from the same compiler run may) only decode it once.
+ * The cache may be used by several threads at once.
+ */
+typedef struct
+{
+    pthread_mutex_t lock;
+
+    // the .debug_abbrev section
+    const unsigned char *section;
+    uint64_t section_size;
+
+    // open-addressing table of the parsed tables by offset
+    uint64_t num_tables;
+    abbrev_table_t **slots;
+    uint64_t slot_mask;
+
+} abbrev_cache_t;
+
+
+
+/*
+ * The header of a unit of .debug_info: a compilation unit, or
+ * in DWARF 5 one of the other kinds given by unit_type. Only
+ * the fields of that kind of unit are filled in.
+ */
+typedef struct
+{
+    // offset of the header, of the first DIE, and past the unit
+    uint64_t offset;
+    uint64_t die_offset;
+    uint64_t end_offset;
+
+    uint64_t length;
+    uint16_t version;
+    uint8_t unit_type;
+    uint8_t address_size;
+
+    // 4 for the 32-bit DWARF format, 8 for the 64-bit one
+    uint8_t offset_size;
+
+    uint64_t abbrev_offset;
+
+    // of type units, and of skeleton and split units
+    uint64_t type_signature;
+    uint64_t type_offset;
+    uint64_t dwo_id;
+
+} unit_header_t;
+
+
+
+/*
+ * Number of forms whose encoded size depends at most on the
+ * unit they are in. Forms from DW_FORM_addr up to this are
+ * looked up in a die_reader_t's form_sizes; the rest are
+ * variable-length or vendor forms.
+ */
+#define NUM_DWARF_FORMS         (DW_FORM_addrx4 + 1)
+
+#define FORM_SIZE_VARIABLE      -1
+
+
+
+/*
+ * Reads the DIEs of one unit in order. A DIE is read with
+ * read_die and then each of its attributes, in the order of
+ * its abbreviation, with read_attribute; attributes that are
+ * not wanted are passed over with skip_attributes, which
+ * mostly just adds up sizes from form_sizes.
+ */
+typedef struct
+{
+    const unsigned char *section;
+    const unsigned char *position;
+    const unsigned char *end;
+
+    unit_header_t *unit;
+    abbrev_table_t *abbrevs;
+
+    // nesting depth of the next DIE, 0 for the unit DIE
+    int depth;
+
+    // size of each form in this unit, or FORM_SIZE_VARIABLE
+    int8_t form_sizes[NUM_DWARF_FORMS];
+
+} die_reader_t;
+
+
+
+/*
+ * One DIE, or for a null entry (which ends a list of siblings)
+ * a DIE without an abbreviation.
+ */
+typedef struct
+{
+    uint64_t offset;
+    int depth;
+    abbrev_t *abbrev;
+
+} die_t;
+
+
+
+/*
+ * The value of one attribute as it is encoded. DW_FORM_indirect
+ * is resolved into the form it names. Depending on the form,
+ * value is the constant, address, flag, index, or offset (of a
+ * reference, relative to .debug_info), and data points at an
+ * inline string or a block of value bytes. Constants of
+ * DW_FORM_data16 are left in data.
+ */
+typedef struct
+{
+    uint32_t name;
+    uint32_t form;
+
+    uint64_t value;
+    const unsigned char *data;
+
+} attribute_value_t;
+
+
+
+/*
+ * The sections that string attributes point into, any of which
+ * may be missing (NULL), along with .debug_addr, which indexed
+ * addresses are looked up in. The indexed forms also need to
+ * know where the current unit's entries start in
+ * .debug_str_offsets and .debug_addr and how big they are,
+ * which read_unit_bases fills in for each unit.
+ */
+typedef struct
+{
+    const unsigned char *str;
+    uint64_t str_size;
+
+    const unsigned char *line_str;
+    uint64_t line_str_size;
+
+    const unsigned char *str_offsets;
+    uint64_t str_offsets_size;
+
+    const unsigned char *addr;
+    uint64_t addr_size;
+
+    // of the unit being read
+    uint64_t str_offsets_base;
+    uint64_t addr_base;
+    uint8_t offset_size;
+    uint8_t address_size;
+
+} debug_strings_t;
+
+
+
+/*
+ * The header of one set of address ranges in .debug_aranges,
+ * all of which belong to the unit at info_offset in .debug_info.
+ */
+typedef struct
+{
+    // offset of the header, of the first range, and past the set
+    uint64_t offset;
+    uint64_t ranges_offset;
+    uint64_t end_offset;
+
+    uint64_t length;
+    uint16_t version;
+    uint8_t offset_size;
+
+    uint64_t info_offset;
+    uint8_t address_size;
+    uint8_t segment_size;
+
+} aranges_header_t;
+
+
+
+typedef enum
+{
+    DIE_OK,
+    DIE_END_OF_UNIT,
+    DIE_CORRUPT
+
+} die_status_t;
+
+
+
+bool read_uleb128(const unsigned char **position, const unsigned char *end, uint64_t *value);
+bool read_sleb128(const unsigned char **position, const unsigned char *end, int64_t *value);
+bool read_unsigned(const unsigned char **position, const unsigned char *end, int size, uint64_t *value);
+
+abbrev_table_t *parse_abbrev_table(const unsigned char *section, uint64_t section_size, uint64_t offset);
+void release_abbrev_table(abbrev_table_t *table);
+abbrev_t *find_abbrev(abbrev_table_t *table, uint64_t code);
+
+abbrev_cache_t *create_abbrev_cache(const unsigned char *section, uint64_t section_size);
+void release_abbrev_cache(abbrev_cache_t *cache);
+abbrev_table_t *get_abbrev_table(abbrev_cache_t *cache, uint64_t offset);
+
+bool read_aranges_header(const unsigned char *section, uint64_t section_size, uint64_t offset, aranges_header_t *header);
+bool read_arange(const unsigned char **position, const unsigned char *end, aranges_header_t *header, uint64_t *address, uint64_t *length);
+range_index_t *build_unit_address_index(const unsigned char *section, uint64_t section_size);
+
+bool read_unit_header(const unsigned char *section, uint64_t section_size, uint64_t offset, unit_header_t *unit);
+uint64_t read_unit_headers(const unsigned char *section, uint64_t section_size, unit_header_t **units);
+void init_die_reader(die_reader_t *reader, const unsigned char *section, unit_header_t *unit, abbrev_table_t *abbrevs);
+die_status_t read_die(die_reader_t *reader, die_t *die);
+bool read_attribute(die_reader_t *reader, abbrev_attribute_t *attribute, attribute_value_t *value);
+bool skip_attributes(die_reader_t *reader, abbrev_attribute_t *attributes, uint32_t num_attributes);
+const char *get_attribute_string(attribute_value_t *value, debug_strings_t *strings, uint64_t *length);
+void read_unit_bases(const unsigned char *section, unit_header_t *unit, abbrev_table_t *abbrevs, debug_strings_t *strings);
+bool get_indexed_string_offset(debug_strings_t *strings, uint64_t index, uint64_t *offset);
+bool get_indexed_address(debug_strings_t *strings, uint64_t index, uint64_t *address);
+
+
+#endif
@@ -0,0 +1,44 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Declarations for dumping the raw contents of a section.
+ */
+#ifndef DUMP_H
+#define DUMP_H
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+#include "output.h"
+#include "pool.h"
+
+
+
+/*
+ * Number of bytes shown on each row of a hex dump.
+ */
+#define HEX_DUMP_ROW_SIZE       16
+
+
+/*
+ * Sections at least this large are dumped on several threads
+ * (when there are several), unless another threshold is given
+ * on the command line. The work is split into chunks of
+ * DUMP_CHUNK_SIZE bytes, which must be a whole number of rows.
+ */
+#define DEFAULT_PARALLEL_DUMP_THRESHOLD     (8 * 1024 * 1024)
+#define DUMP_CHUNK_SIZE                     (32 * 1024)
+
+
+
+void hex_dump(output_t *output, const unsigned char *data, uint64_t size, uint64_t address);
+uint64_t string_dump(output_t *output, const unsigned char *data, uint64_t size);
+
+void hex_dump_in_parallel(output_t *output, const unsigned char *data, uint64_t size, uint64_t address, thread_pool_t *pool);
+uint64_t string_dump_in_parallel(output_t *output, const unsigned char *data, uint64_t size, thread_pool_t *pool);
+
+
+#endif
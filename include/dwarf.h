@@ -0,0 +1,532 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Definitions of the constants used in DWARF debugging
+ * information (versions 2 to 5), along with those used in
+ * the .eh_frame and .eh_frame_hdr sections, which share the
+ * call frame information format of .debug_frame.
+ */
+
+
+#ifndef DWARF_H
+#define DWARF_H
+
+
+
+/**************************************
+ * Unit types (DWARF 5 unit headers). *
+ *************************************/
+
+#define DW_UT_compile                            0x01
+#define DW_UT_type                               0x02
+#define DW_UT_partial                            0x03
+#define DW_UT_skeleton                           0x04
+#define DW_UT_split_compile                      0x05
+#define DW_UT_split_type                         0x06
+
+
+
+/*******************************
+ * Whether a DIE has children. *
+ ******************************/
+
+#define DW_CHILDREN_no                           0x00
+#define DW_CHILDREN_yes                          0x01
+
+
+
+/*********
+ * Tags. *
+ ********/
+
+#define DW_TAG_array_type                        0x01
+#define DW_TAG_class_type                        0x02
+#define DW_TAG_entry_point                       0x03
+#define DW_TAG_enumeration_type                  0x04
+#define DW_TAG_formal_parameter                  0x05
+#define DW_TAG_imported_declaration              0x08
+#define DW_TAG_label                             0x0a
+#define DW_TAG_lexical_block                     0x0b
+#define DW_TAG_member                            0x0d
+#define DW_TAG_pointer_type                      0x0f
+#define DW_TAG_reference_type                    0x10
+#define DW_TAG_compile_unit                      0x11
+#define DW_TAG_string_type                       0x12
+#define DW_TAG_structure_type                    0x13
+#define DW_TAG_subroutine_type                   0x15
+#define DW_TAG_typedef                           0x16
+#define DW_TAG_union_type                        0x17
+#define DW_TAG_unspecified_parameters            0x18
+#define DW_TAG_variant                           0x19
+#define DW_TAG_common_block                      0x1a
+#define DW_TAG_common_inclusion                  0x1b
+#define DW_TAG_inheritance                       0x1c
+#define DW_TAG_inlined_subroutine                0x1d
+#define DW_TAG_module                            0x1e
+#define DW_TAG_ptr_to_member_type                0x1f
+#define DW_TAG_set_type                          0x20
+#define DW_TAG_subrange_type                     0x21
+#define DW_TAG_with_stmt                         0x22
+#define DW_TAG_access_declaration                0x23
+#define DW_TAG_base_type                         0x24
+#define DW_TAG_catch_block                       0x25
+#define DW_TAG_const_type                        0x26
+#define DW_TAG_constant                          0x27
+#define DW_TAG_enumerator                        0x28
+#define DW_TAG_file_type                         0x29
+#define DW_TAG_friend                            0x2a
+#define DW_TAG_namelist                          0x2b
+#define DW_TAG_namelist_item                     0x2c
+#define DW_TAG_packed_type                       0x2d
+#define DW_TAG_subprogram                        0x2e
+#define DW_TAG_template_type_param               0x2f
+#define DW_TAG_template_value_param              0x30
+#define DW_TAG_thrown_type                       0x31
+#define DW_TAG_try_block                         0x32
+#define DW_TAG_variant_part                      0x33
+#define DW_TAG_variable                          0x34
+#define DW_TAG_volatile_type                     0x35
+#define DW_TAG_dwarf_procedure                   0x36
+#define DW_TAG_restrict_type                     0x37
+#define DW_TAG_interface_type                    0x38
+#define DW_TAG_namespace                         0x39
+#define DW_TAG_imported_module                   0x3a
+#define DW_TAG_unspecified_type                  0x3b
+#define DW_TAG_partial_unit                      0x3c
+#define DW_TAG_imported_unit                     0x3d
+#define DW_TAG_condition                         0x3f
+#define DW_TAG_shared_type                       0x40
+#define DW_TAG_type_unit                         0x41
+#define DW_TAG_rvalue_reference_type             0x42
+#define DW_TAG_template_alias                    0x43
+#define DW_TAG_coarray_type                      0x44
+#define DW_TAG_generic_subrange                  0x45
+#define DW_TAG_dynamic_type                      0x46
+#define DW_TAG_atomic_type                       0x47
+#define DW_TAG_call_site                         0x48
+#define DW_TAG_call_site_parameter               0x49
+#define DW_TAG_skeleton_unit                     0x4a
+#define DW_TAG_immutable_type                    0x4b
+#define DW_TAG_format_label                      0x4101
+#define DW_TAG_function_template                 0x4102
+#define DW_TAG_class_template                    0x4103
+#define DW_TAG_GNU_BINCL                         0x4104
+#define DW_TAG_GNU_EINCL                         0x4105
+#define DW_TAG_GNU_template_template_param       0x4106
+#define DW_TAG_GNU_template_parameter_pack       0x4107
+#define DW_TAG_GNU_formal_parameter_pack         0x4108
+#define DW_TAG_GNU_call_site                     0x4109
+#define DW_TAG_GNU_call_site_parameter           0x410a
+
+
+
+#define DW_TAG_lo_user                           0x4080
+#define DW_TAG_hi_user                           0xffff
+
+
+
+/********************
+ * Attribute names. *
+ *******************/
+
+#define DW_AT_sibling                            0x01
+#define DW_AT_location                           0x02
+#define DW_AT_name                               0x03
+#define DW_AT_ordering                           0x09
+#define DW_AT_byte_size                          0x0b
+#define DW_AT_bit_offset                         0x0c
+#define DW_AT_bit_size                           0x0d
+#define DW_AT_stmt_list                          0x10
+#define DW_AT_low_pc                             0x11
+#define DW_AT_high_pc                            0x12
+#define DW_AT_language                           0x13
+#define DW_AT_discr                              0x15
+#define DW_AT_discr_value                        0x16
+#define DW_AT_visibility                         0x17
+#define DW_AT_import                             0x18
+#define DW_AT_string_length                      0x19
+#define DW_AT_common_reference                   0x1a
+#define DW_AT_comp_dir                           0x1b
+#define DW_AT_const_value                        0x1c
+#define DW_AT_containing_type                    0x1d
+#define DW_AT_default_value                      0x1e
+#define DW_AT_inline                             0x20
+#define DW_AT_is_optional                        0x21
+#define DW_AT_lower_bound                        0x22
+#define DW_AT_producer                           0x25
+#define DW_AT_prototyped                         0x27
+#define DW_AT_return_addr                        0x2a
+#define DW_AT_start_scope                        0x2c
+#define DW_AT_bit_stride                         0x2e
+#define DW_AT_upper_bound                        0x2f
+#define DW_AT_abstract_origin                    0x31
+#define DW_AT_accessibility                      0x32
+#define DW_AT_address_class                      0x33
+#define DW_AT_artificial                         0x34
+#define DW_AT_base_types                         0x35
+#define DW_AT_calling_convention                 0x36
+#define DW_AT_count                              0x37
+#define DW_AT_data_member_location               0x38
+#define DW_AT_decl_column                        0x39
+#define DW_AT_decl_file                          0x3a
+#define DW_AT_decl_line                          0x3b
+#define DW_AT_declaration                        0x3c
+#define DW_AT_discr_list                         0x3d
+#define DW_AT_encoding                           0x3e
+#define DW_AT_external                           0x3f
+#define DW_AT_frame_base                         0x40
+#define DW_AT_friend                             0x41
+#define DW_AT_identifier_case                    0x42
+#define DW_AT_macro_info                         0x43
+#define DW_AT_namelist_item                      0x44
+#define DW_AT_priority                           0x45
+#define DW_AT_segment                            0x46
+#define DW_AT_specification                      0x47
+#define DW_AT_static_link                        0x48
+#define DW_AT_type                               0x49
+#define DW_AT_use_location                       0x4a
+#define DW_AT_variable_parameter                 0x4b
+#define DW_AT_virtuality                         0x4c
+#define DW_AT_vtable_elem_location               0x4d
+#define DW_AT_allocated                          0x4e
+#define DW_AT_associated                         0x4f
+#define DW_AT_data_location                      0x50
+#define DW_AT_byte_stride                        0x51
+#define DW_AT_entry_pc                           0x52
+#define DW_AT_use_UTF8                           0x53
+#define DW_AT_extension                          0x54
+#define DW_AT_ranges                             0x55
+#define DW_AT_trampoline                         0x56
+#define DW_AT_call_column                        0x57
+#define DW_AT_call_file                          0x58
+#define DW_AT_call_line                          0x59
+#define DW_AT_description                        0x5a
+#define DW_AT_binary_scale                       0x5b
+#define DW_AT_decimal_scale                      0x5c
+#define DW_AT_small                              0x5d
+#define DW_AT_decimal_sign                       0x5e
+#define DW_AT_digit_count                        0x5f
+#define DW_AT_picture_string                     0x60
+#define DW_AT_mutable                            0x61
+#define DW_AT_threads_scaled                     0x62
+#define DW_AT_explicit                           0x63
+#define DW_AT_object_pointer                     0x64
+#define DW_AT_endianity                          0x65
+#define DW_AT_elemental                          0x66
+#define DW_AT_pure                               0x67
+#define DW_AT_recursive                          0x68
+#define DW_AT_signature                          0x69
+#define DW_AT_main_subprogram                    0x6a
+#define DW_AT_data_bit_offset                    0x6b
+#define DW_AT_const_expr                         0x6c
+#define DW_AT_enum_class                         0x6d
+#define DW_AT_linkage_name                       0x6e
+#define DW_AT_string_length_bit_size             0x6f
+#define DW_AT_string_length_byte_size            0x70
+#define DW_AT_rank                               0x71
+#define DW_AT_str_offsets_base                   0x72
+#define DW_AT_addr_base                          0x73
+#define DW_AT_rnglists_base                      0x74
+#define DW_AT_dwo_name                           0x76
+#define DW_AT_reference                          0x77
+#define DW_AT_rvalue_reference                   0x78
+#define DW_AT_macros                             0x79
+#define DW_AT_call_all_calls                     0x7a
+#define DW_AT_call_all_source_calls              0x7b
+#define DW_AT_call_all_tail_calls                0x7c
+#define DW_AT_call_return_pc                     0x7d
+#define DW_AT_call_value                         0x7e
+#define DW_AT_call_origin                        0x7f
+#define DW_AT_call_parameter                     0x80
+#define DW_AT_call_pc                            0x81
+#define DW_AT_call_tail_call                     0x82
+#define DW_AT_call_target                        0x83
+#define DW_AT_call_target_clobbered              0x84
+#define DW_AT_call_data_location                 0x85
+#define DW_AT_call_data_value                    0x86
+#define DW_AT_noreturn                           0x87
+#define DW_AT_alignment                          0x88
+#define DW_AT_export_symbols                     0x89
+#define DW_AT_deleted                            0x8a
+#define DW_AT_defaulted                          0x8b
+#define DW_AT_loclists_base                      0x8c
+#define DW_AT_MIPS_linkage_name                  0x2007
+#define DW_AT_sf_names                           0x2101
+#define DW_AT_src_info                           0x2102
+#define DW_AT_mac_info                           0x2103
+#define DW_AT_src_coords                         0x2104
+#define DW_AT_body_begin                         0x2105
+#define DW_AT_body_end                           0x2106
+#define DW_AT_GNU_vector                         0x2107
+#define DW_AT_GNU_guarded_by                     0x2108
+#define DW_AT_GNU_pt_guarded_by                  0x2109
+#define DW_AT_GNU_guarded                        0x210a
+#define DW_AT_GNU_pt_guarded                     0x210b
+#define DW_AT_GNU_locks_excluded                 0x210c
+#define DW_AT_GNU_exclusive_locks_required       0x210d
+#define DW_AT_GNU_shared_locks_required          0x210e
+#define DW_AT_GNU_odr_signature                  0x210f
+#define DW_AT_GNU_template_name                  0x2110
+#define DW_AT_GNU_call_site_value                0x2111
+#define DW_AT_GNU_call_site_data_value           0x2112
+#define DW_AT_GNU_call_site_target               0x2113
+#define DW_AT_GNU_call_site_target_clobbered     0x2114
+#define DW_AT_GNU_tail_call                      0x2115
+#define DW_AT_GNU_all_tail_call_sites            0x2116
+#define DW_AT_GNU_all_call_sites                 0x2117
+#define DW_AT_GNU_all_source_call_sites          0x2118
+#define DW_AT_GNU_macros                         0x2119
+#define DW_AT_GNU_deleted                        0x211a
+#define DW_AT_GNU_dwo_name                       0x2130
+#define DW_AT_GNU_dwo_id                         0x2131
+#define DW_AT_GNU_ranges_base                    0x2132
+#define DW_AT_GNU_addr_base                      0x2133
+#define DW_AT_GNU_pubnames                       0x2134
+#define DW_AT_GNU_pubtypes                       0x2135
+#define DW_AT_GNU_discriminator                  0x2136
+#define DW_AT_GNU_locviews                       0x2137
+#define DW_AT_GNU_entry_view                     0x2138
+
+
+
+#define DW_AT_lo_user                            0x2000
+#define DW_AT_hi_user                            0x3fff
+
+
+
+/********************
+ * Attribute forms. *
+ *******************/
+
+#define DW_FORM_addr                             0x01
+#define DW_FORM_block2                           0x03
+#define DW_FORM_block4                           0x04
+#define DW_FORM_data2                            0x05
+#define DW_FORM_data4                            0x06
+#define DW_FORM_data8                            0x07
+#define DW_FORM_string                           0x08
+#define DW_FORM_block                            0x09
+#define DW_FORM_block1                           0x0a
+#define DW_FORM_data1                            0x0b
+#define DW_FORM_flag                             0x0c
+#define DW_FORM_sdata                            0x0d
+#define DW_FORM_strp                             0x0e
+#define DW_FORM_udata                            0x0f
+#define DW_FORM_ref_addr                         0x10
+#define DW_FORM_ref1                             0x11
+#define DW_FORM_ref2                             0x12
+#define DW_FORM_ref4                             0x13
+#define DW_FORM_ref8                             0x14
+#define DW_FORM_ref_udata                        0x15
+#define DW_FORM_indirect                         0x16
+#define DW_FORM_sec_offset                       0x17
+#define DW_FORM_exprloc                          0x18
+#define DW_FORM_flag_present                     0x19
+#define DW_FORM_strx                             0x1a
+#define DW_FORM_addrx                            0x1b
+#define DW_FORM_ref_sup4                         0x1c
+#define DW_FORM_strp_sup                         0x1d
+#define DW_FORM_data16                           0x1e
+#define DW_FORM_line_strp                        0x1f
+#define DW_FORM_ref_sig8                         0x20
+#define DW_FORM_implicit_const                   0x21
+#define DW_FORM_loclistx                         0x22
+#define DW_FORM_rnglistx                         0x23
+#define DW_FORM_ref_sup8                         0x24
+#define DW_FORM_strx1                            0x25
+#define DW_FORM_strx2                            0x26
+#define DW_FORM_strx3                            0x27
+#define DW_FORM_strx4                            0x28
+#define DW_FORM_addrx1                           0x29
+#define DW_FORM_addrx2                           0x2a
+#define DW_FORM_addrx3                           0x2b
+#define DW_FORM_addrx4                           0x2c
+#define DW_FORM_GNU_addr_index                   0x1f01
+#define DW_FORM_GNU_str_index                    0x1f02
+#define DW_FORM_GNU_ref_alt                      0x1f20
+#define DW_FORM_GNU_strp_alt                     0x1f21
+
+
+
+/*********************************************
+ * Call frame instructions. The first three  *
+ * keep their operand in the low six bits of *
+ * the opcode.                               *
+ *********************************************/
+
+#define DW_CFA_advance_loc                       0x40
+#define DW_CFA_offset                            0x80
+#define DW_CFA_restore                           0xc0
+#define DW_CFA_nop                               0x00
+#define DW_CFA_set_loc                           0x01
+#define DW_CFA_advance_loc1                      0x02
+#define DW_CFA_advance_loc2                      0x03
+#define DW_CFA_advance_loc4                      0x04
+#define DW_CFA_offset_extended                   0x05
+#define DW_CFA_restore_extended                  0x06
+#define DW_CFA_undefined                         0x07
+#define DW_CFA_same_value                        0x08
+#define DW_CFA_register                          0x09
+#define DW_CFA_remember_state                    0x0a
+#define DW_CFA_restore_state                     0x0b
+#define DW_CFA_def_cfa                           0x0c
+#define DW_CFA_def_cfa_register                  0x0d
+#define DW_CFA_def_cfa_offset                    0x0e
+#define DW_CFA_def_cfa_expression                0x0f
+#define DW_CFA_expression                        0x10
+#define DW_CFA_offset_extended_sf                0x11
+#define DW_CFA_def_cfa_sf                        0x12
+#define DW_CFA_def_cfa_offset_sf                 0x13
+#define DW_CFA_val_offset                        0x14
+#define DW_CFA_val_offset_sf                     0x15
+#define DW_CFA_val_expression                    0x16
+#define DW_CFA_GNU_window_save                   0x2d
+#define DW_CFA_GNU_args_size                     0x2e
+#define DW_CFA_GNU_negative_offset_extended      0x2f
+
+
+
+/**********************************************
+ * Operations of DWARF expressions, as found  *
+ * in location descriptions and call frame    *
+ * instructions. The literals, registers and  *
+ * base registers run in blocks of 32 between *
+ * the first and last one given.              *
+ **********************************************/
+
+#define DW_OP_addr                               0x03
+#define DW_OP_deref                              0x06
+#define DW_OP_const1u                            0x08
+#define DW_OP_const1s                            0x09
+#define DW_OP_const2u                            0x0a
+#define DW_OP_const2s                            0x0b
+#define DW_OP_const4u                            0x0c
+#define DW_OP_const4s                            0x0d
+#define DW_OP_const8u                            0x0e
+#define DW_OP_const8s                            0x0f
+#define DW_OP_constu                             0x10
+#define DW_OP_consts                             0x11
+#define DW_OP_dup                                0x12
+#define DW_OP_drop                               0x13
+#define DW_OP_over                               0x14
+#define DW_OP_pick                               0x15
+#define DW_OP_swap                               0x16
+#define DW_OP_rot                                0x17
+#define DW_OP_xderef                             0x18
+#define DW_OP_abs                                0x19
+#define DW_OP_and                                0x1a
+#define DW_OP_div                                0x1b
+#define DW_OP_minus                              0x1c
+#define DW_OP_mod                                0x1d
+#define DW_OP_mul                                0x1e
+#define DW_OP_neg                                0x1f
+#define DW_OP_not                                0x20
+#define DW_OP_or                                 0x21
+#define DW_OP_plus                               0x22
+#define DW_OP_plus_uconst                        0x23
+#define DW_OP_shl                                0x24
+#define DW_OP_shr                                0x25
+#define DW_OP_shra                               0x26
+#define DW_OP_xor                                0x27
+#define DW_OP_bra                                0x28
+#define DW_OP_eq                                 0x29
+#define DW_OP_ge                                 0x2a
+#define DW_OP_gt                                 0x2b
+#define DW_OP_le                                 0x2c
+#define DW_OP_lt                                 0x2d
+#define DW_OP_ne                                 0x2e
+#define DW_OP_skip                               0x2f
+#define DW_OP_lit0                               0x30
+#define DW_OP_lit31                              0x4f
+#define DW_OP_reg0                               0x50
+#define DW_OP_reg31                              0x6f
+#define DW_OP_breg0                              0x70
+#define DW_OP_breg31                             0x8f
+#define DW_OP_regx                               0x90
+#define DW_OP_fbreg                              0x91
+#define DW_OP_bregx                              0x92
+#define DW_OP_piece                              0x93
+#define DW_OP_deref_size                         0x94
+#define DW_OP_xderef_size                        0x95
+#define DW_OP_nop                                0x96
+#define DW_OP_push_object_address                0x97
+#define DW_OP_call2                              0x98
+#define DW_OP_call4                              0x99
+#define DW_OP_call_ref                           0x9a
+#define DW_OP_form_tls_address                   0x9b
+#define DW_OP_call_frame_cfa                     0x9c
+#define DW_OP_bit_piece                          0x9d
+#define DW_OP_implicit_value                     0x9e
+#define DW_OP_stack_value                        0x9f
+#define DW_OP_implicit_pointer                   0xa0
+#define DW_OP_addrx                              0xa1
+#define DW_OP_constx                             0xa2
+#define DW_OP_entry_value                        0xa3
+#define DW_OP_const_type                         0xa4
+#define DW_OP_regval_type                        0xa5
+#define DW_OP_deref_type                         0xa6
+#define DW_OP_xderef_type                        0xa7
+#define DW_OP_convert                            0xa8
+#define DW_OP_reinterpret                        0xa9
+#define DW_OP_GNU_push_tls_address               0xe0
+#define DW_OP_GNU_uninit                         0xf0
+#define DW_OP_GNU_encoded_addr                   0xf1
+#define DW_OP_GNU_implicit_pointer               0xf2
+#define DW_OP_GNU_entry_value                    0xf3
+#define DW_OP_GNU_const_type                     0xf4
+#define DW_OP_GNU_regval_type                    0xf5
+#define DW_OP_GNU_deref_type                     0xf6
+#define DW_OP_GNU_convert                        0xf7
+#define DW_OP_GNU_reinterpret                    0xf9
+#define DW_OP_GNU_parameter_ref                  0xfa
+#define DW_OP_GNU_addr_index                     0xfb
+#define DW_OP_GNU_const_index                    0xfc
+#define DW_OP_GNU_variable_value                 0xfd
+
+
+
+/**********************************************
+ * Pointer encodings used in .eh_frame and    *
+ * .eh_frame_hdr. The low four bits give the  *
+ * format of the value, and the next three    *
+ * what it is relative to.                    *
+ **********************************************/
+
+#define DW_EH_PE_absptr                          0x00
+#define DW_EH_PE_uleb128                         0x01
+#define DW_EH_PE_udata2                          0x02
+#define DW_EH_PE_udata4                          0x03
+#define DW_EH_PE_udata8                          0x04
+#define DW_EH_PE_sleb128                         0x09
+#define DW_EH_PE_sdata2                          0x0a
+#define DW_EH_PE_sdata4                          0x0b
+#define DW_EH_PE_sdata8                          0x0c
+#define DW_EH_PE_pcrel                           0x10
+#define DW_EH_PE_textrel                         0x20
+#define DW_EH_PE_datarel                         0x30
+#define DW_EH_PE_funcrel                         0x40
+#define DW_EH_PE_aligned                         0x50
+#define DW_EH_PE_indirect                        0x80
+#define DW_EH_PE_omit                            0xff
+
+#define DW_EH_PE_FORMAT_MASK                     0x0f
+#define DW_EH_PE_APPLICATION_MASK                0x70
+
+
+
+/*************************************
+ * Index attributes of .debug_names. *
+ ************************************/
+
+#define DW_IDX_compile_unit                      0x01
+#define DW_IDX_type_unit                         0x02
+#define DW_IDX_die_offset                        0x03
+#define DW_IDX_parent                            0x04
+#define DW_IDX_type_hash                         0x05
+#define DW_IDX_GNU_internal                      0x2000
+#define DW_IDX_GNU_external                      0x2001
+
+
+
+#endif
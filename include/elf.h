@@ -484,6 +484,7 @@ typedef struct
 #define SHN_ABS         0xfff1      // Defines absolute values for the corresponding reference.
 #define SHN_COMMON      0xfff2      // Common symbols
 #define SHN_HIRESERVE   0xffff      // Upper bound on the range of reserved indices
+#define SHN_XINDEX      0xffff      // The real index is too large and is kept elsewhere
 
 
 
@@ -806,6 +807,13 @@ typedef struct
 #define SHT_DYNSYM      11
 
 
+/*
+ * GNU extension: the section holds a GNU-style symbol hash
+ * table, the same table that DT_GNU_HASH points to.
+ */
+#define SHT_GNU_HASH    0x6ffffff6
+
+
 /*
  * Values in this range are reserved for
  * processor-specific semantics.
@@ -831,6 +839,7 @@ typedef struct
 #define SHF_WRITE       0x1         // Flag marks section as writable during process execution
 #define SHF_ALLOC       0x2         // Flag marks section as occupying memory in process image
 #define SHF_EXECINSTR   0x4         // Flag marks section as containing executable machine instructions
+#define SHF_COMPRESSED  0x800       // Section data is compressed, behind a compression header
 #define SHF_MASKPROC    0xf0000000  // Processor-specific semantics
 
 
@@ -886,7 +895,8 @@ typedef struct
 
 
     /*
-     * Currently defined to be 0 and given no meaning.
+     * The lower 2 bits give the symbol's visibility. The
+     * rest are 0 and given no meaning.
      */
     unsigned char st_other;
 
@@ -908,6 +918,12 @@ typedef struct
 typedef struct
 {
 
+    /*
+     * Unlike the 32-bit symbol, the members are ordered so
+     * that the two 8-byte members come last and are aligned
+     * without padding.
+     */
+
     /*
      * Gives an index into one of the object file's
      * string tables. This index gives the name of
@@ -918,6 +934,32 @@ typedef struct
     ELF64_Word_t st_name;
 
 
+    /*
+     * The upper 4 bits of this member contain the symbol's
+     * binding characteristics, and the lower 4 bits contain
+     * the symbol's type. Macros to manipulate this member
+     * are given elsewhere.
+     */
+    unsigned char st_info;
+
+
+    /*
+     * The lower 2 bits give the symbol's visibility. The
+     * rest are 0 and given no meaning.
+     */
+    unsigned char st_other;
+
+
+    /*
+     * Since every symbol is defined relative to some section
+     * of the object file, this member gives the index into the
+     * section header table of the relevant section. Some section
+     * indexes have special meanings. See section index definitions
+     * for details.
+     */
+    ELF64_Half_t st_shndx;
+
+
     /*
      * Gives the value of the associated symbol. Depending
      * on the type of the object file and the type of the
@@ -941,32 +983,7 @@ typedef struct
      * symbol. Size is 0 if object takes up no space or the
      * size is unknown.
      */
-    ELF64_Word_t st_size;
-
-
-    /*
-     * The upper 4 bits of this member contain the symbol's
-     * binding characteristics, and the lower 4 bits contain
-     * the symbol's type. Macros to manipulate this member
-     * are given elsewhere.
-     */
-    unsigned char st_info;
-
-
-    /*
-     * Currently defined to be 0 and given no meaning.
-     */
-    unsigned char st_other;
-
-
-    /*
-     * Since every symbol is defined relative to some section
-     * of the object file, this member gives the index into the
-     * section header table of the relevant section. Some section
-     * indexes have special meanings. See section index definitions
-     * for details.
-     */
-    ELF64_Half_t st_shndx;
+    ELF64_Xword_t st_size;
 
     
 } ELF64_Sym_t;
@@ -999,6 +1016,14 @@ typedef struct
 #define ELF_ST_INFO(b,t)( ((b)<<4) | ((t)&0xf) )
 
 
+/*
+ * Extracts the visibility from the st_other member
+ * of the symbol table entry. Visibility is the lower
+ * 2 bits of the member.
+ */
+#define ELF_ST_VISIBILITY(o) ((o)&0x3)
+
+
 
 
 /*******************************
@@ -1031,6 +1056,14 @@ typedef struct
 #define STB_WEAK 2
 
 
+/*
+ * GNU extension: a global symbol that the dynamic linker
+ * makes sure only one definition of is used in the whole
+ * process, even across libraries loaded with RTLD_LOCAL.
+ */
+#define STB_GNU_UNIQUE 10
+
+
 // Processor-specific semantics
 #define STB_LOPROC 13
 #define STB_HIPROC 15
@@ -1077,8 +1110,63 @@ typedef struct
 #define STT_FILE 4
 
 
+/*
+ * The symbol labels an uninitialized common block.
+ */
+#define STT_COMMON 5
+
+
+/*
+ * The symbol is a thread-local storage entity, and its
+ * value is an offset into the thread-local storage block
+ * rather than an address.
+ */
+#define STT_TLS 6
+
+
+/*
+ * GNU extension: the symbol is an indirect function, whose
+ * value is the address of a resolver that returns the
+ * address of the implementation to use.
+ */
+#define STT_GNU_IFUNC 10
+
+
 // Processor-specific semantics
 #define STT_LOPROC 13
+
+
+
+
+/*********************************
+ * Symbol visibility definitions *
+ *********************************/
+
+
+/*
+ * The visibility is given by the binding of the symbol.
+ */
+#define STV_DEFAULT 0
+
+
+/*
+ * Processor-specific meaning; treated as hidden.
+ */
+#define STV_INTERNAL 1
+
+
+/*
+ * The symbol is not visible to other components, even
+ * if it has global binding.
+ */
+#define STV_HIDDEN 2
+
+
+/*
+ * The symbol is visible to other components, but references
+ * to it from within its own component cannot be preempted.
+ */
+#define STV_PROTECTED 3
 #define STT_HIPROC 15
 
 
@@ -1465,5 +1553,100 @@ typedef struct
 
 
 
+/*******************************************************
+ * This section defines the dynamic section, which the
+ * PT_DYNAMIC segment points to. It is an array of tagged
+ * entries, ended by an entry with tag DT_NULL, that tell
+ * the dynamic linker where to find the tables it needs
+ * (symbols, strings, hash tables, relocations) and which
+ * libraries to load. Addresses in it are virtual addresses,
+ * which have to be translated through the PT_LOAD segments
+ * to find the data in the file.
+ *******************************************************/
+
+
+typedef struct
+{
+    // what kind of entry this is (one of the DT_ values)
+    ELF32_Sword_t d_tag;
+
+    /*
+     * Depending on the tag, either an integer value
+     * or a virtual address.
+     */
+    union
+    {
+        ELF32_Word_t d_val;
+        ELF32_Addr_t d_ptr;
+    } d_un;
+
+} ELF32_Dyn_t;
+
+
+
+typedef struct
+{
+    // what kind of entry this is (one of the DT_ values)
+    ELF64_Sxword_t d_tag;
+
+    /*
+     * Depending on the tag, either an integer value
+     * or a virtual address.
+     */
+    union
+    {
+        ELF64_Xword_t d_val;
+        ELF64_Addr_t d_ptr;
+    } d_un;
+
+} ELF64_Dyn_t;
+
+
+
+/*****************************
+ * Dynamic entry tags.       *
+ *****************************/
+
+#define DT_NULL         0           // Marks the end of the dynamic section
+#define DT_NEEDED       1           // String table offset of the name of a needed library
+#define DT_PLTRELSZ     2           // Size in bytes of the PLT relocations
+#define DT_PLTGOT       3           // Address of the PLT and/or GOT
+#define DT_HASH         4           // Address of the SysV symbol hash table
+#define DT_STRTAB       5           // Address of the dynamic string table
+#define DT_SYMTAB       6           // Address of the dynamic symbol table
+#define DT_RELA         7           // Address of the RELA relocations
+#define DT_RELASZ       8           // Size in bytes of the RELA relocations
+#define DT_RELAENT      9           // Size in bytes of a RELA relocation
+#define DT_STRSZ        10          // Size in bytes of the dynamic string table
+#define DT_SYMENT       11          // Size in bytes of a symbol table entry
+#define DT_INIT         12          // Address of the initialization function
+#define DT_FINI         13          // Address of the termination function
+#define DT_SONAME       14          // String table offset of the name of this library
+#define DT_RPATH        15          // String table offset of the library search path
+#define DT_SYMBOLIC     16          // Symbol resolution starts with this object
+#define DT_REL          17          // Address of the REL relocations
+#define DT_RELSZ        18          // Size in bytes of the REL relocations
+#define DT_RELENT       19          // Size in bytes of a REL relocation
+#define DT_PLTREL       20          // Type of the PLT relocations (DT_REL or DT_RELA)
+#define DT_DEBUG        21          // Used for debugging
+#define DT_TEXTREL      22          // Relocations may modify a read-only segment
+#define DT_JMPREL       23          // Address of the PLT relocations
+#define DT_GNU_HASH     0x6ffffef5  // Address of the GNU symbol hash table
+#define DT_VERSYM       0x6ffffff0  // Address of the symbol version table (.gnu.version)
+
+
+
+/*
+ * Each entry of the symbol version table is the index of the
+ * version of the dynamic symbol with the same index. A hidden
+ * version is an old one, kept for the binaries linked against
+ * it; a name without a version never refers to it.
+ */
+#define VERSYM_HIDDEN   0x8000
+
+
+
+
+
 
 #endif
\ No newline at end of file
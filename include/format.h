@@ -0,0 +1,31 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Declarations for the number formatting routines used in
+ * place of sprintf when printing large tables.
+ */
+#ifndef FORMAT_H
+#define FORMAT_H
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+/*
+ * The most characters any of the routines below can write
+ * for a single number: 20 decimal digits plus a sign.
+ */
+#define FORMAT_MAX_DIGITS       21
+
+
+
+int format_hex(char *destination, uint64_t value, int min_width);
+int format_decimal(char *destination, uint64_t value);
+int format_signed_decimal(char *destination, int64_t value);
+void format_hex_bytes(char *destination, const unsigned char *bytes, size_t num_bytes);
+
+
+#endif
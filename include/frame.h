@@ -0,0 +1,193 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Declarations for reading call frame information, the CIEs
+ * and FDEs of .debug_frame and .eh_frame, and for finding the
+ * FDE that covers an address.
+ */
+#ifndef FRAME_H
+#define FRAME_H
+
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+#include "dwarf.h"
+#include "ranges.h"
+
+
+
+/*
+ * A section of call frame information. .eh_frame differs from
+ * .debug_frame in how a CIE is told apart from an FDE and how
+ * an FDE points at its CIE, and in having pointer encodings
+ * and augmentations; relative pointers are worked out from the
+ * address of the section.
+ */
+typedef struct
+{
+    const unsigned char *data;
+    uint64_t size;
+    uint64_t address;
+
+    bool is_eh_frame;
+
+    // size of an address in the file, 4 or 8
+    int address_size;
+
+} frame_section_t;
+
+
+
+/*
+ * A Common Information Entry: what the FDEs that point at it
+ * share, including the instructions that set up the initial
+ * rules before the FDE's own instructions run.
+ */
+typedef struct
+{
+    uint64_t offset;
+    uint64_t length;
+    uint64_t end_offset;
+
+    // the CIE id as it appears in the entry
+    uint64_t id;
+
+    uint8_t version;
+    const char *augmentation;
+
+    uint64_t code_alignment;
+    int64_t data_alignment;
+    uint64_t return_address_register;
+
+    // the augmentation data, given only with a 'z' augmentation
+    bool has_augmentation_data;
+    const unsigned char *augmentation_data;
+    uint64_t augmentation_data_length;
+
+    // what the augmentation data says
+    uint8_t fde_encoding;
+    uint8_t lsda_encoding;
+    uint8_t personality_encoding;
+    uint64_t personality;
+    bool is_signal_frame;
+
+    // of DWARF 4 .debug_frame, which gives them in the CIE
+    uint8_t address_size;
+    uint8_t segment_size;
+
+    const unsigned char *instructions;
+    uint64_t instructions_length;
+
+} cie_t;
+
+
+
+/*
+ * A Frame Description Entry, giving the rules for the range
+ * of addresses [pc_begin, pc_begin + pc_range).
+ */
+typedef struct
+{
+    uint64_t offset;
+    uint64_t length;
+    uint64_t end_offset;
+
+    // the CIE pointer as it appears in the entry, and the offset of the CIE it leads to
+    uint64_t cie_pointer;
+    uint64_t cie_offset;
+
+    uint64_t pc_begin;
+    uint64_t pc_range;
+
+    const unsigned char *augmentation_data;
+    uint64_t augmentation_data_length;
+
+    const unsigned char *instructions;
+    uint64_t instructions_length;
+
+} fde_t;
+
+
+
+typedef enum
+{
+    FRAME_ENTRY_CIE,
+    FRAME_ENTRY_FDE,
+
+    // a zero length, which ends .eh_frame
+    FRAME_ENTRY_TERMINATOR,
+
+    FRAME_ENTRY_CORRUPT
+
+} frame_entry_type_t;
+
+
+
+/*
+ * One call frame instruction with its operands decoded. Offsets
+ * are already multiplied by the data alignment factor where the
+ * instruction calls for it, and advances by the code alignment
+ * factor, with address set to the location advanced to.
+ */
+typedef struct
+{
+    // for the three instructions with an operand in the opcode, the opcode without it
+    uint8_t opcode;
+
+    uint64_t register_number;
+    uint64_t second_register;
+    int64_t offset;
+    uint64_t address;
+
+    const unsigned char *expression;
+    uint64_t expression_length;
+
+} cfa_instruction_t;
+
+
+
+/*
+ * The search table of .eh_frame_hdr, which the linker sorts by
+ * start address so that an unwinder can binary-search it without
+ * reading .eh_frame. Each entry is a pair of fixed-size fields,
+ * the start of an FDE's range and the address of the FDE. The
+ * entries are decoded as they are searched, straight out of the
+ * mapped section.
+ */
+typedef struct
+{
+    // .eh_frame_hdr itself, which datarel fields are relative to
+    frame_section_t section;
+
+    uint64_t eh_frame_address;
+
+    uint8_t table_encoding;
+    int field_size;
+
+    uint64_t num_entries;
+    const unsigned char *table;
+
+} eh_frame_hdr_t;
+
+
+
+bool read_encoded_pointer(frame_section_t *section, const unsigned char **position, const unsigned char *end,
+                          uint8_t encoding, uint64_t *value);
+
+frame_entry_type_t read_frame_entry_type(frame_section_t *section, uint64_t offset, uint64_t *end_offset);
+bool read_cie(frame_section_t *section, uint64_t offset, cie_t *cie);
+bool read_fde(frame_section_t *section, uint64_t offset, cie_t *cie, fde_t *fde);
+
+bool read_cfa_instruction(frame_section_t *section, cie_t *cie, const unsigned char **position, const unsigned char *end,
+                          uint64_t *location, cfa_instruction_t *instruction);
+
+range_index_t *build_fde_index(frame_section_t *section);
+
+bool read_eh_frame_hdr(frame_section_t *section, eh_frame_hdr_t *header);
+int64_t find_eh_frame_hdr_entry(eh_frame_hdr_t *header, uint64_t address, uint64_t *fde_address);
+
+
+#endif
@@ -0,0 +1,55 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Declarations for reading queries (such as addresses to look
+ * up) from a file descriptor, usually standard input.
+ */
+#ifndef INPUT_H
+#define INPUT_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+#include "readelf.h"
+
+
+
+/*
+ * Size of the buffer input is read into. Queries arrive by
+ * the million, so they are read a buffer at a time and split
+ * into tokens in place rather than a line at a time.
+ */
+#define INPUT_BUFFER_SIZE       (64*1024)
+
+
+
+typedef struct
+{
+    int file_descriptor;
+
+    char *buffer;
+
+    // bytes of the buffer holding input
+    size_t size;
+
+    // where the next token is searched for from
+    size_t position;
+
+    bool end_of_input;
+
+} input_t;
+
+
+
+void init_input(input_t *input, int file_descriptor);
+void release_input(input_t *input);
+
+bool read_token(input_t *input, string_view_t *token);
+bool parse_address(string_view_t token, uint64_t *address);
+
+
+#endif
@@ -0,0 +1,161 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Declarations for looking symbols and sections up by name.
+ */
+#ifndef LOOKUP_H
+#define LOOKUP_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+#include "elf.h"
+#include "readelf.h"
+#include "ranges.h"
+
+
+
+/*
+ * How a symbol index finds names.
+ */
+typedef enum
+{
+    // the file's own DT_GNU_HASH table over the dynamic symbols
+    LOOKUP_GNU_HASH,
+
+    // the file's own DT_HASH table over the dynamic symbols
+    LOOKUP_SYSV_HASH,
+
+    // a hash table built in memory over a symbol table section
+    LOOKUP_BUILT_HASH
+
+} lookup_method_t;
+
+
+
+/*
+ * An index for finding a symbol by name in constant time.
+ *
+ * If the file has a dynamic section with a GNU or SysV hash table,
+ * the index uses that table in place, and answers questions about
+ * the symbols the file exports. Otherwise (relocatable objects,
+ * static executables) an open-addressing table is built over the
+ * symbol indices of .symtab (or .dynsym, if there is no .symtab).
+ */
+typedef struct
+{
+    lookup_method_t method;
+
+    // ELFCLASS32 or ELFCLASS64
+    int file_class;
+
+    // the symbols searched, and the names of the section they came from
+    symbol_table_t symbols;
+    string_view_t table_name;
+
+    // version of each symbol, when the hash table's symbols are versioned, or NULL
+    uint16_t *versions;
+
+
+    /*
+     * GNU hash table. The Bloom filter words are 32 or 64 bits
+     * wide depending on the class of the file.
+     */
+    uint32_t num_gnu_buckets;
+    uint32_t symbol_offset;
+    uint32_t bloom_size;
+    uint32_t bloom_shift;
+    void *bloom;
+    uint32_t *gnu_buckets;
+    uint32_t *gnu_chain;
+
+
+    // SysV hash table
+    uint32_t num_sysv_buckets;
+    uint32_t *sysv_buckets;
+    uint32_t *sysv_chain;
+
+
+    /*
+     * Built table. Each slot holds a symbol index plus one
+     * (0 marks an empty slot) and the hash of its name, so
+     * that most mismatches are rejected without looking at
+     * the string table. The number of slots is a power of 2.
+     */
+    uint32_t *slot_symbols;
+    uint32_t *slot_hashes;
+    uint64_t slot_mask;
+
+} symbol_index_t;
+
+
+
+/*
+ * An index for finding the symbol that contains an address.
+ * Every defined function and object symbol with a size gives
+ * a range of addresses, whose payload is the number of the
+ * symbol's name in names.
+ */
+typedef struct
+{
+    range_index_t *ranges;
+
+    // the names of the symbols, views into their string tables
+    string_view_t *names;
+
+} address_index_t;
+
+
+
+/*
+ * An index for finding sections by name. Names need not be
+ * unique (an object file can have several .text or .group
+ * sections, for example), so the sections are grouped by name
+ * in one array, each group in section header table order, and
+ * a slot of the open-addressing table gives where a name's
+ * group starts in that array and how many sections it has.
+ */
+typedef struct
+{
+    section_name_table_t *section_names;
+
+    // section indices, grouped by name
+    int *sections;
+
+    /*
+     * Each slot holds the start of a group plus one (0 marks
+     * an empty slot), the size of the group and the hash of
+     * its name. The number of slots is a power of 2.
+     */
+    uint32_t *slot_starts;
+    uint32_t *slot_counts;
+    uint32_t *slot_hashes;
+    uint64_t slot_mask;
+
+} section_name_index_t;
+
+
+
+symbol_index_t *build_ELF32_symbol_index(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                                         ELF32_Program_Header_t *program_header_table, section_name_table_t *section_names);
+symbol_index_t *build_ELF64_symbol_index(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                                         ELF64_Program_Header_t *program_header_table, section_name_table_t *section_names);
+void release_symbol_index(symbol_index_t *index);
+
+address_index_t *build_ELF32_address_index(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+address_index_t *build_ELF64_address_index(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+void release_address_index(address_index_t *index);
+
+section_name_index_t *build_section_name_index(section_name_table_t *section_names);
+void release_section_name_index(section_name_index_t *index);
+
+
+int64_t find_symbol(symbol_index_t *index, const char *name, size_t length);
+int find_sections(section_name_index_t *index, const char *name, size_t length, const int **sections);
+
+
+#endif
@@ -0,0 +1,147 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Declarations for reading the name indexes of .debug_names
+ * and for looking up DIEs by name through their hash tables.
+ */
+#ifndef NAMES_H
+#define NAMES_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+#include "dwarf.h"
+#include "debug.h"
+
+
+
+/*
+ * An abbreviation of a name index: the tag of the DIEs whose
+ * entries use it and the DW_IDX_* attributes the entries carry.
+ * The attributes are kept as abbreviation attribute specifications,
+ * with the DW_IDX_* code as the name.
+ */
+typedef struct
+{
+    uint64_t code;
+    uint32_t tag;
+
+    uint32_t num_attributes;
+    abbrev_attribute_t *attributes;
+
+} names_abbrev_t;
+
+
+
+/*
+ * One name index of .debug_names. A linker that does not merge
+ * the indexes leaves one per object file one after the other.
+ *
+ * The lists of units and the arrays of the hash table are used
+ * where they are in the mapped section; only the abbreviations
+ * are decoded, since the entries cannot be read without them.
+ * Names are numbered from 1, as the buckets number them.
+ */
+typedef struct
+{
+    // offset of the index and of what follows it
+    uint64_t offset;
+    uint64_t end_offset;
+
+    uint64_t length;
+    uint16_t version;
+    uint8_t offset_size;
+
+    uint32_t comp_unit_count;
+    uint32_t local_type_unit_count;
+    uint32_t foreign_type_unit_count;
+    uint32_t bucket_count;
+    uint32_t name_count;
+    uint32_t abbrev_table_size;
+
+    const char *augmentation;
+    uint32_t augmentation_size;
+
+    // offsets of units in .debug_info, and signatures of type units elsewhere
+    const unsigned char *comp_units;
+    const unsigned char *local_type_units;
+    const unsigned char *foreign_type_units;
+
+    // the hash table, of which buckets and hashes are missing with no buckets
+    const unsigned char *buckets;
+    const unsigned char *hashes;
+    const unsigned char *string_offsets;
+    const unsigned char *entry_offsets;
+
+    // the entries, which entry_offsets are relative to
+    const unsigned char *entry_pool;
+    const unsigned char *end;
+
+    uint64_t num_abbrevs;
+    names_abbrev_t *abbrevs;
+    abbrev_attribute_t *attributes;
+
+} names_table_t;
+
+
+
+/*
+ * Every name index of .debug_names, read once and kept for
+ * looking names up.
+ */
+typedef struct
+{
+    uint64_t num_tables;
+    names_table_t *tables;
+
+} names_index_t;
+
+
+
+/*
+ * One entry of a name index: a DIE with the name. Only the
+ * attributes the abbreviation has are set. An entry with a code
+ * of 0 (and no abbreviation) ends the list of entries of a name.
+ */
+typedef struct
+{
+    // offset of the entry in the entry pool
+    uint64_t offset;
+
+    uint64_t code;
+    names_abbrev_t *abbrev;
+
+    bool has_compile_unit;
+    bool has_type_unit;
+    bool has_die_offset;
+    bool has_parent;
+
+    uint64_t compile_unit;
+    uint64_t type_unit;
+    uint64_t die_offset;
+
+    // offset in the entry pool of the entry of the parent DIE
+    uint64_t parent;
+
+} names_entry_t;
+
+
+
+bool read_names_table(const unsigned char *section, uint64_t section_size, uint64_t offset, names_table_t *table);
+void release_names_table(names_table_t *table);
+
+names_index_t *build_names_index(const unsigned char *section, uint64_t section_size);
+void release_names_index(names_index_t *index);
+
+uint32_t hash_debug_name(const char *name, size_t length);
+uint64_t get_names_table_value(names_table_t *table, const unsigned char *array, uint64_t number, int size);
+int64_t find_debug_name(names_table_t *table, const unsigned char *str, uint64_t str_size, const char *name, size_t length);
+bool read_names_entry(names_table_t *table, const unsigned char **position, names_entry_t *entry);
+bool get_names_entry_die(names_table_t *table, names_entry_t *entry, uint64_t *die_offset);
+
+
+#endif
@@ -0,0 +1,91 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Declarations for the output sink that the stringify functions
+ * write their text into.
+ */
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+/*
+ * Size of the buffer used by an output that writes to a file
+ * descriptor. Text accumulates in the buffer and is written
+ * out each time the buffer fills, so memory use does not depend
+ * on the size of the report and output starts appearing as soon
+ * as the first buffer's worth is ready.
+ */
+#define OUTPUT_BUFFER_SIZE      (256*1024)
+
+
+
+/*
+ * File descriptor of an output that is kept in memory rather
+ * than written anywhere. Used to render the report of one file
+ * while another is still being written out.
+ */
+#define OUTPUT_IN_MEMORY        -1
+
+
+/*
+ * What a memory output starts out with when there is nothing
+ * better to go on. Most jobs write a few lines; the ones that
+ * write more grow it, or know what they need up front.
+ */
+#define MEMORY_OUTPUT_SIZE      (4*1024)
+
+
+
+/*
+ * An output sink. Text is appended to the buffer, which is
+ * written to the file descriptor whenever it runs out of space
+ * (or, for a memory output, grown). Once a write fails, the
+ * error flag is set and everything after that is discarded.
+ */
+typedef struct
+{
+    // where the buffer is flushed to, or OUTPUT_IN_MEMORY
+    int file_descriptor;
+
+    char *buffer;
+
+    // bytes allocated for the buffer
+    size_t capacity;
+
+    // bytes of the buffer currently in use
+    size_t size;
+
+    // set once a write to the file descriptor fails
+    bool error;
+
+} output_t;
+
+
+
+void init_output(output_t *output, int file_descriptor);
+void init_memory_output(output_t *output, size_t capacity);
+int flush_output(output_t *output);
+int release_output(output_t *output);
+
+
+void append_bytes(output_t *output, const char *bytes, size_t length);
+void append_string(output_t *output, const char *string);
+void append_char(output_t *output, char character);
+void append_padding(output_t *output, int num_spaces);
+void append_format(output_t *output, const char *format, ...);
+
+char *reserve_output(output_t *output, size_t length);
+
+void append_hex(output_t *output, uint64_t value, int min_width);
+void append_decimal(output_t *output, uint64_t value);
+void append_signed_decimal(output_t *output, int64_t value);
+
+
+#endif
@@ -0,0 +1,169 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Declarations for the thread pool that runs numbered lists of
+ * jobs (for example, one job per file given on the command line)
+ * while the caller writes out their results in job order.
+ */
+#ifndef POOL_H
+#define POOL_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
+
+
+#include "output.h"
+
+
+
+/*
+ * The function run for each job. It is passed the context given
+ * with the jobs, the number of the job, from 0 to num_jobs - 1,
+ * and the output to write the job's part of the report to.
+ */
+typedef void (*job_function_t)(void *context, int job_number, output_t *output);
+
+
+
+/*
+ * Called in job order, once a job's output has been written, to
+ * deal with anything else it left behind (such as an error to
+ * report). Returns RET_OK to carry on with the next job, or
+ * RET_NOT_OK to stop there.
+ */
+typedef int (*job_finish_function_t)(void *context, int job_number);
+
+
+
+/*
+ * A numbered list of jobs whose outputs are written out in job
+ * order. Each job that runs on a worker is written into a memory
+ * output of its own, which starts out output_size bytes long, so
+ * that should be about what one job writes.
+ *
+ * A job flagged in run_by_caller is never run ahead on a worker,
+ * only by the caller once it reaches the job. That is for jobs
+ * that hand work of their own to the pool (whose output would
+ * otherwise be held in memory as a whole) and for jobs that read
+ * standard input.
+ */
+typedef struct
+{
+    job_function_t function;
+
+    // may be NULL
+    job_finish_function_t finish;
+
+    void *context;
+    int num_jobs;
+
+    size_t output_size;
+
+    // one flag per job, or NULL if any job may be run ahead
+    const bool *run_by_caller;
+
+} ordered_jobs_t;
+
+
+
+/*
+ * Where each job has got to. A job is run by whichever thread
+ * claims it first: a worker, which writes it into the job's
+ * memory output, or the caller once it reaches the job, which
+ * writes it straight to the real output.
+ */
+typedef enum
+{
+    JOB_WAITING,
+    JOB_RUNNING,
+    JOB_FINISHED
+
+} job_state_t;
+
+
+
+/*
+ * A list of jobs being run on the pool. The workers claim jobs
+ * from a shared position that only moves forwards, and may finish
+ * them in any order, while the caller writes out their outputs in
+ * order.
+ *
+ * The caller never waits for a job nobody has claimed: it runs
+ * it itself, straight into the real output. It only waits for
+ * the job it is up to when a worker is already running that job.
+ * So that the outputs of finished jobs do not pile up in memory
+ * meanwhile, a worker only starts a job fewer than max_ahead
+ * jobs past the one the caller is up to.
+ */
+typedef struct job_batch
+{
+    ordered_jobs_t *jobs;
+
+    // one memory output and state per job
+    output_t *outputs;
+    job_state_t *states;
+
+    // no job before this one is waiting to be claimed
+    int next_job;
+
+    // the job the caller is up to
+    int oldest_job;
+
+    // how far past oldest_job a worker may start a job
+    int max_ahead;
+
+    // jobs of the batch being run by workers
+    int num_running;
+
+    // set once the caller wants no more jobs started
+    bool stopping;
+
+    // the batch started before this one
+    struct job_batch *next;
+
+} job_batch_t;
+
+
+
+/*
+ * A fixed set of worker threads shared by every list of jobs run
+ * while it is up. A job may run a list of its own (a command that
+ * splits a large section into chunks, say) on the same pool. The
+ * workers take jobs from the newest list first, so the chunks of
+ * a section being written out are finished before anything else
+ * is started, and there are never more threads than the pool was
+ * started with.
+ */
+typedef struct
+{
+    pthread_t *threads;
+    int num_threads;
+
+    // the lists of jobs being run, newest first
+    job_batch_t *batches;
+
+    // set when the workers are to exit
+    bool stopping;
+
+    pthread_mutex_t lock;
+
+    // signalled when a job finishes
+    pthread_cond_t job_finished;
+
+    // signalled when there may be new jobs a worker can start
+    pthread_cond_t work_available;
+
+} thread_pool_t;
+
+
+
+int start_thread_pool(thread_pool_t *pool, int num_threads);
+void join_thread_pool(thread_pool_t *pool);
+
+int run_ordered_jobs(thread_pool_t *pool, output_t *output, ordered_jobs_t *jobs);
+
+
+#endif
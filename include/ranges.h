@@ -0,0 +1,78 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Declarations for the sorted index of address ranges that the
+ * symbol, unit and FDE lookups all search.
+ */
+#ifndef RANGES_H
+#define RANGES_H
+
+
+#include <stdint.h>
+
+
+
+/*
+ * A range [start, end) of addresses while an index is being
+ * built, with the value the index gives back for it (a unit
+ * offset, an FDE offset, the number of a symbol name and so on).
+ */
+typedef struct
+{
+    uint64_t start;
+    uint64_t end;
+    uint64_t payload;
+
+} range_t;
+
+
+
+/*
+ * What to do with a range that starts at or before the end of
+ * the one kept before it. RANGES_KEEP_FIRST drops a range with
+ * the same start as the one before it, and keeps any other as
+ * it is. RANGES_MERGE joins it onto the range before it if they
+ * have the same payload, and otherwise keeps only the part of
+ * it past the end of the range before it.
+ */
+typedef enum
+{
+    RANGES_KEEP_FIRST,
+    RANGES_MERGE
+
+} range_overlap_t;
+
+
+
+/*
+ * An index for finding the range that contains an address. The
+ * ranges are sorted by start address, and the start addresses
+ * are kept in an array of their own, so that the binary search
+ * for an address only touches that array and reads the end and
+ * payload of just the one range it lands on.
+ */
+typedef struct
+{
+    uint64_t num_ranges;
+
+    // start address of each range, in increasing order
+    uint64_t *starts;
+
+    // end address (one past the last byte) of each range
+    uint64_t *ends;
+
+    // the payload of each range
+    uint64_t *payloads;
+
+} range_index_t;
+
+
+
+void sort_ranges(range_t *ranges, uint64_t num_ranges);
+range_index_t *build_range_index(const range_t *ranges, uint64_t num_ranges, range_overlap_t overlap);
+void release_range_index(range_index_t *index);
+int64_t find_range(range_index_t *index, uint64_t address);
+
+
+#endif
@@ -1,7 +1,7 @@
 /* Author: Joshua Jacobs-Rebhun
  * Date: December 5, 2023
  *
- * 
+ *
  * This file declares a number of functions for reading particular
  * data structures out of an ELF file.
  */
@@ -10,6 +10,7 @@
 
 
 #include <stdbool.h>
+#include <stddef.h>
 
 
 #include "elf.h"
@@ -19,33 +20,200 @@
 #define RET_NOT_OK      -1
 
 
-int read_ELF_identification(FILE *input_file, unsigned char *buffer);
-int get_file_class(FILE *input_file);
-char **get_section_names(FILE *input_file);
 
+/*
+ * An ELF file that has been mapped into memory. The file
+ * is mapped once when it is opened, and every data structure
+ * in it (headers, tables, string tables) is accessed through
+ * pointers into the mapping rather than being read into
+ * separately allocated buffers. The mapping is read-only,
+ * so none of the pointers handed out may be written through.
+ */
+typedef struct
+{
+    // descriptor of the underlying file
+    int file_descriptor;
+
+    // size of the file (and mapping) in bytes
+    size_t size;
+
+    // start of the mapping
+    unsigned char *data;
+
+} elf_image_t;
+
+
+
+/*
+ * A string inside one of the string tables of the mapped file.
+ * The string is not copied out of the file, and since nothing
+ * guarantees that a corrupt string table is NULL-terminated,
+ * the length must be used instead of searching for the NULL.
+ */
+typedef struct
+{
+    char *string;
+    size_t length;
+
+} string_view_t;
+
+
+
+/*
+ * The names of every section in the file. Each name is a view
+ * into the section header string table, which is used in place
+ * in the mapping, so building the table costs one allocation
+ * no matter how many sections the file has.
+ */
+typedef struct
+{
+    // number of names (the number of section headers)
+    int num_names;
+
+    // length of the longest name, for lining up columns
+    size_t max_length;
+
+    // one view per section, in section header table order
+    string_view_t *names;
+
+} section_name_table_t;
+
+
+
+/*
+ * The mapping from segments to the sections they contain, kept
+ * in compressed sparse row form. The sections in segment i are
+ * the section header table indices
+ *
+ *     section_indices[segment_start[i]] ... section_indices[segment_start[i+1] - 1]
+ *
+ * in increasing order, so segment_start has num_segments + 1
+ * entries and section_indices has one entry per (section, segment)
+ * pair.
+ */
+typedef struct
+{
+    int num_segments;
+    int *segment_start;
+    int *section_indices;
+
+} section_to_segment_mapping_t;
+
+
+
+/*
+ * A symbol table section together with the string table its
+ * names are in (the section its sh_link member gives). Both
+ * are used in place in the mapping, so there is nothing to
+ * free, and a symbol's name is looked up only when it is
+ * needed, as a view into the string table.
+ */
+typedef struct
+{
+    // ELF32_Sym_t or ELF64_Sym_t, depending on the file class
+    void *symbols;
+    uint64_t num_symbols;
+
+    char *string_table;
+    uint64_t string_table_size;
+
+} symbol_table_t;
+
+
+
+/*
+ * A relocation section (SHT_REL or SHT_RELA), used in place in
+ * the mapping, together with the symbol table its entries refer
+ * to by index (the section its sh_link member gives).
+ */
+typedef struct
+{
+    // ELF32_Rel_t, ELF32_Rela_t, ELF64_Rel_t or ELF64_Rela_t
+    void *entries;
+    uint64_t num_entries;
+
+    // true for SHT_RELA, whose entries carry an addend
+    bool has_addends;
+
+    // the linked symbol table, if there is one
+    bool has_symbols;
+    symbol_table_t symbols;
+
+} relocation_table_t;
+
+
+
+int open_elf_image(elf_image_t *image, const char *filename);
+void close_elf_image(elf_image_t *image);
+void *get_image_range(elf_image_t *image, uint64_t offset, uint64_t size);
+void *get_aligned_image_range(elf_image_t *image, uint64_t offset, uint64_t size, uint64_t alignment);
+bool is_aligned(const void *pointer, uint64_t alignment);
+
+
+
+string_view_t get_string_table_entry(char *string_table, uint64_t string_table_size, uint64_t offset);
+void release_section_name_table(section_name_table_t *section_names);
+void release_section_to_segment_mapping(section_to_segment_mapping_t *mapping);
+
+
+
+int read_ELF_identification(elf_image_t *image, unsigned char *buffer);
+bool has_ELF_magic(elf_image_t *image);
+int get_file_class(elf_image_t *image);
+
+
+
+ELF32_Header_t *get_ELF32_header(elf_image_t *image);
+
+ELF32_Section_Header_t *get_ELF32_section_header(elf_image_t *image, int index);
+ELF32_Section_Header_t *get_ELF32_section_header_table(elf_image_t *image);
+int get_ELF32_num_sections(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+uint32_t get_ELF32_section_string_table_index(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
 
+ELF32_Program_Header_t *get_ELF32_program_header(elf_image_t *image, int index);
+ELF32_Program_Header_t *get_ELF32_program_header_table(elf_image_t *image);
 
-int read_ELF32_header(FILE *input_file, ELF32_Header_t *header);
+section_name_table_t *get_ELF32_section_names(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
+section_to_segment_mapping_t *get_ELF32_section_to_segment_mapping(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                                                                   ELF32_Program_Header_t *program_header_table);
 
-ELF32_Section_Header_t *read_ELF32_section_header(FILE *input_file, int index);
-ELF32_Section_Header_t *read_ELF32_section_header_table(FILE *input_file);
+int get_ELF32_symbol_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                           int section_index, symbol_table_t *symbol_table);
+int get_ELF32_relocation_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                               int section_index, relocation_table_t *relocation_table);
 
-ELF32_Program_Header_t *read_ELF32_program_header(FILE *input_file, int index);
-ELF32_Program_Header_t *read_ELF32_program_header_table(FILE *input_file);
+void *get_ELF32_address_range(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Program_Header_t *program_header_table,
+                              uint64_t address, uint64_t size);
+ELF32_Dyn_t *get_ELF32_dynamic_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Program_Header_t *program_header_table,
+                                     uint64_t *num_entries);
+bool *get_ELF32_relocated_sections(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table);
 
 
 
-int read_ELF64_header(FILE *input_file, ELF64_Header_t *header);
+ELF64_Header_t *get_ELF64_header(elf_image_t *image);
 
-ELF64_Section_Header_t *read_ELF64_section_header(FILE *input_file, int index);
-ELF64_Section_Header_t *read_ELF64_section_header_table(FILE *input_file);
+ELF64_Section_Header_t *get_ELF64_section_header(elf_image_t *image, int index);
+ELF64_Section_Header_t *get_ELF64_section_header_table(elf_image_t *image);
+int get_ELF64_num_sections(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+uint32_t get_ELF64_section_string_table_index(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
 
-ELF64_Program_Header_t *read_ELF64_program_header(FILE *input_file, int index);
-ELF64_Program_Header_t *read_ELF64_program_header_table(FILE *input_file);
+ELF64_Program_Header_t *get_ELF64_program_header(elf_image_t *image, int index);
+ELF64_Program_Header_t *get_ELF64_program_header_table(elf_image_t *image);
 
+section_name_table_t *get_ELF64_section_names(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
+section_to_segment_mapping_t *get_ELF64_section_to_segment_mapping(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                                                                   ELF64_Program_Header_t *program_header_table);
 
+int get_ELF64_symbol_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                           int section_index, symbol_table_t *symbol_table);
+int get_ELF64_relocation_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                               int section_index, relocation_table_t *relocation_table);
 
-char ***get_section_to_segment_mapping(FILE *input_file);
+void *get_ELF64_address_range(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Program_Header_t *program_header_table,
+                              uint64_t address, uint64_t size);
+ELF64_Dyn_t *get_ELF64_dynamic_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Program_Header_t *program_header_table,
+                                     uint64_t *num_entries);
+bool *get_ELF64_relocated_sections(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table);
 
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,55 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Declarations for the list of files to dump, and for filling
+ * it from a directory tree.
+ */
+#ifndef SCAN_H
+#define SCAN_H
+
+
+#include <stdbool.h>
+
+
+
+/*
+ * One file to run the commands over.
+ */
+typedef struct
+{
+    char *name;
+
+    /*
+     * Set for files found by walking a directory. Those are
+     * only dumped if they turn out to be ELF files, and their
+     * names were allocated by the walk, so they are freed
+     * with the list. Names given on the command line point
+     * into argv.
+     */
+    bool found_in_directory;
+
+} file_entry_t;
+
+
+
+/*
+ * The files to dump, in the order their reports are printed.
+ */
+typedef struct
+{
+    int num_files;
+    int capacity;
+    file_entry_t *files;
+
+} file_list_t;
+
+
+
+void init_file_list(file_list_t *list);
+void release_file_list(file_list_t *list);
+void add_file(file_list_t *list, char *name, bool found_in_directory);
+int add_directory(file_list_t *list, const char *directory);
+
+
+#endif
@@ -0,0 +1,136 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Declarations for the session, which holds everything parsed
+ * out of a single ELF file for the duration of one invocation.
+ */
+#ifndef SESSION_H
+#define SESSION_H
+
+
+#include <stdbool.h>
+#include <pthread.h>
+
+
+#include "elf.h"
+#include "readelf.h"
+#include "lookup.h"
+#include "debug.h"
+#include "frame.h"
+#include "names.h"
+
+
+
+/*
+ * A session wraps the mapped image of one ELF file together
+ * with every structure that has been parsed out of it so far.
+ * Nothing is parsed when the session is opened. Each structure
+ * is parsed the first time a command asks for it and is then
+ * cached, so running several commands over the same file
+ * (for example dumpelf -h -S -l) parses each structure once.
+ *
+ * The tables are stored as void pointers since their type
+ * depends on the class of the file. They should only be
+ * accessed through the class-specific getters below, which
+ * return NULL when asked for the wrong class.
+ *
+ * Several commands may run over one session at the same time,
+ * so the getters hold the session's lock while they check and
+ * fill the cache. The lock is recursive since the getters for
+ * the derived structures call the others. Everything a getter
+ * returns is never modified afterwards, so it can be read
+ * without the lock.
+ */
+typedef struct
+{
+    // the memory-mapped file
+    elf_image_t image;
+
+    // ELFCLASS32 or ELFCLASS64 (or ELFCLASSNONE if neither)
+    int file_class;
+
+
+    /*
+     * Cached structures. These are NULL until first
+     * requested (or if they could not be parsed).
+     */
+    void *file_header;
+    void *section_header_table;
+    void *program_header_table;
+    section_name_table_t *section_names;
+    section_to_segment_mapping_t *section_to_segment_mapping;
+    symbol_index_t *symbol_index;
+    address_index_t *address_index;
+    section_name_index_t *section_name_index;
+    bool *relocated_sections;
+    abbrev_cache_t *abbrev_cache;
+    range_index_t *unit_address_index;
+    range_index_t *eh_frame_index;
+    range_index_t *debug_frame_index;
+    names_index_t *names_index;
+
+
+    /*
+     * Whether parsing of the corresponding structure has
+     * already been attempted. This keeps a structure that
+     * failed to parse from being retried (and its error
+     * message printed) by every command that asks for it.
+     */
+    bool file_header_parsed;
+    bool section_header_table_parsed;
+    bool program_header_table_parsed;
+    bool section_names_parsed;
+    bool section_to_segment_mapping_parsed;
+    bool symbol_index_parsed;
+    bool address_index_parsed;
+    bool section_name_index_parsed;
+    bool relocated_sections_parsed;
+    bool abbrev_cache_parsed;
+    bool unit_address_index_parsed;
+    bool eh_frame_index_parsed;
+    bool debug_frame_index_parsed;
+    bool names_index_parsed;
+
+
+    // guards the cached structures and flags above
+    pthread_mutex_t lock;
+
+} elf_session_t;
+
+
+
+int open_session(elf_session_t *session, const char *filename);
+void close_session(elf_session_t *session);
+
+
+
+ELF32_Header_t *get_session_ELF32_header(elf_session_t *session);
+ELF32_Section_Header_t *get_session_ELF32_section_header_table(elf_session_t *session);
+ELF32_Program_Header_t *get_session_ELF32_program_header_table(elf_session_t *session);
+
+
+ELF64_Header_t *get_session_ELF64_header(elf_session_t *session);
+ELF64_Section_Header_t *get_session_ELF64_section_header_table(elf_session_t *session);
+ELF64_Program_Header_t *get_session_ELF64_program_header_table(elf_session_t *session);
+
+int get_session_num_sections(elf_session_t *session);
+uint32_t get_session_section_string_table_index(elf_session_t *session);
+
+
+section_name_table_t *get_session_section_names(elf_session_t *session);
+section_to_segment_mapping_t *get_session_section_to_segment_mapping(elf_session_t *session);
+symbol_index_t *get_session_symbol_index(elf_session_t *session);
+address_index_t *get_session_address_index(elf_session_t *session);
+section_name_index_t *get_session_section_name_index(elf_session_t *session);
+bool *get_session_relocated_sections(elf_session_t *session);
+
+unsigned char *get_session_named_section(elf_session_t *session, const char *name, uint64_t *size, uint64_t *address);
+abbrev_cache_t *get_session_abbrev_cache(elf_session_t *session);
+range_index_t *get_session_unit_address_index(elf_session_t *session);
+bool get_session_frame_section(elf_session_t *session, bool is_eh_frame, frame_section_t *section);
+range_index_t *get_session_fde_index(elf_session_t *session, bool is_eh_frame);
+names_index_t *get_session_names_index(elf_session_t *session);
+
+
+#endif
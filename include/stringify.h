@@ -3,7 +3,7 @@
  *
  * 
  * Declarations for functions that convert information
- * read from ELF file into string to be printed to screen.
+ * read from ELF file into text written to an output.
  */
 
 #ifndef STRINGIFY_H
@@ -11,38 +11,55 @@
 
 
 #include "elf.h"
-
-
-
-
-/*
- * Concatenates a new NULL-terminated string onto an existing dynamically-allocated string.
- * The _output_string argument must be a heap-allocated string (i.e. with malloc) or else
- * the program will crash, and _new_string must be NULL-terminated or this will not work.
- * The _max_size and _current_size variables keep track of how much memory is allocated
- * and how much of the allocated memory is being used, respectively.
- */
-#define CONCATENATE_DYNAMIC_STRING(_output_string, _new_string, _max_size, _current_size)       \
-    while(strlen(_new_string) > _max_size - _current_size)                                      \
-    {                                                                                           \
-        _max_size = _max_size*2;                                                                \
-        _output_string = (char*) realloc(_output_string, _max_size);                            \
-    }                                                                                           \
-    memcpy(_output_string + _current_size, _new_string, strlen(_new_string)*sizeof(char));      \
-    _current_size += strlen(_new_string);
-
-
-
-
-
-char *stringify_ELF32_header(ELF32_Header_t *elf_header);
-char *stringify_ELF32_section_header_table(ELF32_Section_Header_t *section_header_table, ELF32_Header_t *file_header, char **section_header_names);
-char *stringify_ELF32_program_header_table(ELF32_Program_Header_t *program_header_table, ELF32_Header_t *file_header, char ***section_to_segment_mapping);
-
-
-
-char *stringify_ELF64_header(ELF64_Header_t *elf_header);
-char *stringify_ELF64_section_header_table(ELF64_Section_Header_t *section_header_table, ELF64_Header_t *file_header, char **section_header_names);
-char *stringify_ELF64_program_header_table(ELF64_Program_Header_t *program_header_table, ELF64_Header_t *file_header, char ***section_to_segment_mapping);
+#include "readelf.h"
+#include "output.h"
+#include "lookup.h"
+#include "debug.h"
+#include "frame.h"
+#include "names.h"
+
+
+
+
+int stringify_ELF32_header(output_t *output, ELF32_Header_t *elf_header, ELF32_Section_Header_t *section_header_table);
+int stringify_ELF32_section_header_table(output_t *output, ELF32_Section_Header_t *section_header_table, ELF32_Header_t *file_header, section_name_table_t *section_header_names);
+int stringify_ELF32_program_header_table(output_t *output, ELF32_Program_Header_t *program_header_table, ELF32_Header_t *file_header,
+                                         section_to_segment_mapping_t *section_to_segment_mapping, section_name_table_t *section_names);
+int stringify_ELF32_symbol_table(output_t *output, symbol_table_t *symbol_table, string_view_t section_name);
+void stringify_ELF32_symbol(output_t *output, symbol_table_t *symbol_table, uint64_t symbol_number);
+int stringify_ELF32_relocation_table(output_t *output, relocation_table_t *relocation_table, ELF32_Section_Header_t *section_header,
+                                      string_view_t section_name, int machine, section_name_table_t *section_names);
+
+
+
+int stringify_ELF64_header(output_t *output, ELF64_Header_t *elf_header, ELF64_Section_Header_t *section_header_table);
+int stringify_ELF64_section_header_table(output_t *output, ELF64_Section_Header_t *section_header_table, ELF64_Header_t *file_header, section_name_table_t *section_header_names);
+int stringify_ELF64_program_header_table(output_t *output, ELF64_Program_Header_t *program_header_table, ELF64_Header_t *file_header,
+                                         section_to_segment_mapping_t *section_to_segment_mapping, section_name_table_t *section_names);
+int stringify_ELF64_symbol_table(output_t *output, symbol_table_t *symbol_table, string_view_t section_name);
+void stringify_ELF64_symbol(output_t *output, symbol_table_t *symbol_table, uint64_t symbol_number);
+int stringify_ELF64_relocation_table(output_t *output, relocation_table_t *relocation_table, ELF64_Section_Header_t *section_header,
+                                      string_view_t section_name, int machine, section_name_table_t *section_names);
+
+
+
+void stringify_symbol_lookup_title(output_t *output, symbol_index_t *index);
+void stringify_missing_symbol(output_t *output, const char *name, size_t length);
+
+void stringify_debug_abbrev_table(output_t *output, abbrev_table_t *table);
+void stringify_debug_unit_header(output_t *output, unit_header_t *unit);
+void stringify_debug_die(output_t *output, die_t *die);
+void stringify_debug_attribute(output_t *output, uint64_t offset, attribute_value_t *value, debug_strings_t *strings);
+void stringify_debug_aranges_header(output_t *output, aranges_header_t *header);
+void stringify_debug_arange(output_t *output, uint64_t address, uint64_t length, int address_size);
+void stringify_debug_cie(output_t *output, cie_t *cie, int address_size);
+void stringify_debug_fde(output_t *output, fde_t *fde, int address_size);
+void stringify_debug_cfa_instruction(output_t *output, cfa_instruction_t *instruction, int address_size, int machine);
+void stringify_fde_index(output_t *output, range_index_t *index, const char *section_name, int address_size);
+void stringify_debug_names_header(output_t *output, names_table_t *table);
+void stringify_debug_names_buckets(output_t *output, names_table_t *table, uint64_t buckets_used, uint64_t longest_bucket);
+void stringify_debug_name(output_t *output, uint64_t number, uint32_t hash, bool has_hash, const char *name, uint64_t length);
+void stringify_debug_names_entry(output_t *output, names_entry_t *entry);
+void stringify_debug_name_match(output_t *output, const char *name, size_t length, uint64_t die_offset, uint32_t tag);
 
 #endif
\ No newline at end of file
@@ -8,12 +8,18 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <limits.h>
 #include <string.h>
+#include <unistd.h>
 
 
 #include "commands.h"
 #include "readelf.h"
+#include "session.h"
 #include "stringify.h"
+#include "input.h"
+#include "dump.h"
+#include "pool.h"
 
 
 
@@ -111,208 +117,175 @@ void release_command_list(command_list_t *list)
 
 
 
-static char *dump_ELF32_header(FILE *input_file)
+
+
+
+static int dump_ELF32_header(elf_session_t *session, output_t *output)
 {
-    ELF32_Header_t file_header;
+    ELF32_Header_t *file_header;
 
-    if(read_ELF32_header(input_file, &file_header) != RET_OK)
+    if((file_header = get_session_ELF32_header(session)) == NULL)
     {
         fprintf(stderr, "Unable to read ELF32 file header.\n");
-        return NULL;
+        return RET_NOT_OK;
     }
 
-    return stringify_ELF32_header(&file_header);
+    /*
+     * The section header table is only needed for the real
+     * section count and string table index when they do not
+     * fit in the header, so the header is still dumped if
+     * the table cannot be read.
+     */
+    return stringify_ELF32_header(output, file_header, get_session_ELF32_section_header_table(session));
 }
 
 
 
-static char *dump_ELF64_header(FILE *input_file)
+static int dump_ELF64_header(elf_session_t *session, output_t *output)
 {
-    ELF64_Header_t file_header;
+    ELF64_Header_t *file_header;
 
-    if(read_ELF64_header(input_file, &file_header) != RET_OK)
+    if((file_header = get_session_ELF64_header(session)) == NULL)
     {
         fprintf(stderr, "Unable to read ELF64 file header.\n");
-        return NULL;
+        return RET_NOT_OK;
     }
 
-    return stringify_ELF64_header(&file_header);
+    /*
+     * The section header table is only needed for the real
+     * section count and string table index when they do not
+     * fit in the header, so the header is still dumped if
+     * the table cannot be read.
+     */
+    return stringify_ELF64_header(output, file_header, get_session_ELF64_section_header_table(session));
 }
 
 
-int dump_elf_header(FILE *input_file)
+int dump_elf_header(elf_session_t *session, output_t *output)
 {
-    char *output_string;
-    int file_class = get_file_class(input_file);
-
-
-    switch (file_class)
+    switch (session->file_class)
     {
     case ELFCLASS32:
-        output_string = dump_ELF32_header(input_file);
-        break;
+        return dump_ELF32_header(session, output);
     
     case ELFCLASS64:
-        output_string = dump_ELF64_header(input_file);
-        break;
+        return dump_ELF64_header(session, output);
 
     default:
-        printf("ELF file has no class.\n");
-        return RET_NOT_OK;
-        break;
-    }
-
-    if(output_string == NULL)
-    {
+        append_string(output, "ELF file has no class.\n");
         return RET_NOT_OK;
     }
-
-
-    fputs(output_string, stdout);
-    free(output_string);
-
-    return RET_OK;
 }
 
 
 
 
 
-static char *dump_ELF32_section_headers(FILE *input_file)
+static int dump_ELF32_section_headers(elf_session_t *session, output_t *output)
 {
-    ELF32_Header_t file_header;
+    ELF32_Header_t *file_header;
     ELF32_Section_Header_t *section_header_table;
-    char **section_names;
-    char *output_string;
+    section_name_table_t *section_names;
 
 
     /*
      * Get the ELF file header which is needed by
      * the stringify function.
      */
-    if(read_ELF32_header(input_file, &file_header) != RET_OK)
+    if((file_header = get_session_ELF32_header(session)) == NULL)
     {
         fprintf(stderr, "Unable to read ELF32 section headers.\n");
-        return NULL;
+        return RET_NOT_OK;
     }
 
 
     /*
-     * Read the section header table from the ELF
-     * file and return pointer to heap-allocated
-     * memory containing the section header table.
+     * Get the section header table. This points
+     * straight into the mapped file, so there is
+     * nothing to free afterwards.
      */
-    if((section_header_table = read_ELF32_section_header_table(input_file)) == NULL)
+    if((section_header_table = get_session_ELF32_section_header_table(session)) == NULL)
     {
         fprintf(stderr, "Unable to read ELF32 section headers.\n");
-        return NULL;
+        return RET_NOT_OK;
     }
 
 
     /*
      * Get the section names from the section header
      * string table, since they are not stored in
-     * the section header table themselves.
+     * the section header table themselves. The
+     * session owns the names.
      */
-    if((section_names = get_section_names(input_file)) == NULL)
+    if((section_names = get_session_section_names(session)) == NULL)
     {
         fprintf(stderr, "Unable to find section names.\n");
-        free(section_header_table);
-        return NULL;
+        return RET_NOT_OK;
     }
 
 
     /*
-     * Stringify the section headers. Output string
-     * will be printed to user.
+     * Stringify the section headers straight
+     * into the output.
      */
-    output_string = stringify_ELF32_section_header_table(section_header_table, &file_header, section_names);
-    
-
-    // free dynamically-allocated memory
-    free(section_header_table);
-    for(int i = 0; section_names[i] != NULL; i++)
-    {
-        free(section_names[i]);
-    }
-    free(section_names);
-
-
-    return output_string;
+    return stringify_ELF32_section_header_table(output, section_header_table, file_header, section_names);
 }
 
 
-static char *dump_ELF64_section_headers(FILE *input_file)
+static int dump_ELF64_section_headers(elf_session_t *session, output_t *output)
 {
-    ELF64_Header_t file_header;
+    ELF64_Header_t *file_header;
     ELF64_Section_Header_t *section_header_table;
-    char *output_string;
-    char **section_names;
+    section_name_table_t *section_names;
 
 
     /*
      * Get the ELF file header which is needed by
      * the stringify function.
      */
-    if(read_ELF64_header(input_file, &file_header) != RET_OK)
+    if((file_header = get_session_ELF64_header(session)) == NULL)
     {
         fprintf(stderr, "Unable to read ELF64 section header table.\n");
-        return NULL;
+        return RET_NOT_OK;
     }
 
 
     /*
-     * Read the section header table from the ELF
-     * file and return pointer to heap-allocated
-     * memory containing the section header table.
+     * Get the section header table. This points
+     * straight into the mapped file, so there is
+     * nothing to free afterwards.
      */
-    if((section_header_table = read_ELF64_section_header_table(input_file)) == NULL)
+    if((section_header_table = get_session_ELF64_section_header_table(session)) == NULL)
     {
         fprintf(stderr, "Unable to read ELF64 section header table.\n");
-        return NULL;
+        return RET_NOT_OK;
     }
 
 
     /*
      * Get the section names from the section header
      * string table, since they are not stored in
-     * the section header table themselves.
+     * the section header table themselves. The
+     * session owns the names.
      */
-    if((section_names = get_section_names(input_file)) == NULL)
+    if((section_names = get_session_section_names(session)) == NULL)
     {
         fprintf(stderr, "Unable to get section names.\n");
-        free(section_header_table);
-        return NULL;
+        return RET_NOT_OK;
     }
 
 
     /*
-     * Stringify the section headers. Output string
-     * will be printed to user.
+     * Stringify the section headers straight
+     * into the output.
      */
-    output_string = stringify_ELF64_section_header_table(section_header_table, &file_header, section_names);
-
-
-    // free dynamically allocated memory
-    free(section_header_table);
-    for(int i = 0; section_names[i] != NULL; i++)
-    {
-        free(section_names[i]);
-    }
-    free(section_names);
-
-
-    return output_string;
+    return stringify_ELF64_section_header_table(output, section_header_table, file_header, section_names);
 }
 
 
 
-int dump_section_headers(FILE *input_file)
+int dump_section_headers(elf_session_t *session, output_t *output)
 {
-    char *output_string;
-    int file_class = get_file_class(input_file);
-
-
     /*
      * Since the data structures for 32-bit
      * and 64-bit ELF files differ slightly
@@ -321,246 +294,1985 @@ int dump_section_headers(FILE *input_file)
      * file. The handler functions are almost
      * identical except for 32-bit vs. 64-bit.
      */
-    switch (file_class)
+    switch (session->file_class)
     {
     case ELFCLASS32:
-        output_string = dump_ELF32_section_headers(input_file);
-        break;
+        return dump_ELF32_section_headers(session, output);
     
     case ELFCLASS64:
-        output_string = dump_ELF64_section_headers(input_file);
-        break;
+        return dump_ELF64_section_headers(session, output);
     
     default:
-        printf("ELF file has no class.\n");
+        append_string(output, "ELF file has no class.\n");
         return RET_NOT_OK;
-        break;
     }
+}
+
+
+
+static int dump_ELF32_program_headers(elf_session_t *session, output_t *output)
+{
+    ELF32_Header_t *file_header;
+    ELF32_Program_Header_t *program_header_table;
+    section_to_segment_mapping_t *section_to_segment_mapping;
 
 
     /*
-     * The handler functions will return
-     * a NULL pointer on failure.
+     * Get the ELF file header which is needed by
+     * the stringify function.
      */
-    if(output_string == NULL)
+    if((file_header = get_session_ELF32_header(session)) == NULL)
     {
+        fprintf(stderr, "Unable to read ELF32 program header table.\n");
         return RET_NOT_OK;
     }
 
-
+    
     /*
-     * Print to screen and free the
-     * output string.
+     * Get the program header table out of the
+     * mapped file.
      */
-    fputs(output_string, stdout);
-    free(output_string);
+    if((program_header_table = get_session_ELF32_program_header_table(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to read ELF32 program header table.\n");
+        return RET_NOT_OK;
+    }
 
-    return RET_OK;
-}
 
+    section_to_segment_mapping = get_session_section_to_segment_mapping(session);
 
 
-static char *dump_ELF32_program_headers(FILE *input_file)
-{
-    ELF32_Header_t file_header;
-    ELF32_Program_Header_t *program_header_table;
-    char *output_string;
+    /*
+     * Stringify the program headers. The mapping
+     * belongs to the session and is freed with it.
+     */
+    return stringify_ELF32_program_header_table(output, program_header_table, file_header, section_to_segment_mapping,
+                                                get_session_section_names(session));
+}
+
 
 
-    char ***section_to_segment_mapping;
+static int dump_ELF64_program_headers(elf_session_t *session, output_t *output)
+{
+    ELF64_Header_t *file_header;
+    ELF64_Program_Header_t *program_header_table;
+    section_to_segment_mapping_t *section_to_segment_mapping;
 
 
     /*
      * Get the ELF file header which is needed by
      * the stringify function.
      */
-    if(read_ELF32_header(input_file, &file_header) != RET_OK)
+    if((file_header = get_session_ELF64_header(session)) == NULL)
     {
-        fprintf(stderr, "Unable to read ELF32 program header table.\n");
-        return NULL;
+        fprintf(stderr, "Unable to read ELF64 program header table.\n");
+        return RET_NOT_OK;
     }
 
-    
+
+    if((program_header_table = get_session_ELF64_program_header_table(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to read ELF64 program header table.\n");
+        return RET_NOT_OK;
+    }
+
+
     /*
-     * Read the program header table into a dynamically
-     * allocated array of program headers. 
+     * Get the section to segment mapping. It refers
+     * to sections by index, so the stringify function
+     * also needs the section names.
      */
-    if((program_header_table = read_ELF32_program_header_table(input_file)) == NULL)
+    section_to_segment_mapping = get_session_section_to_segment_mapping(session);
+
+
+    return stringify_ELF64_program_header_table(output, program_header_table, file_header, section_to_segment_mapping,
+                                                get_session_section_names(session));
+}
+
+
+
+int dump_program_headers(elf_session_t *session, output_t *output)
+{
+    switch(session->file_class)
     {
-        fprintf(stderr, "Unable to read ELF32 program header table.\n");
-        return NULL;
+        case ELFCLASS32:
+            return dump_ELF32_program_headers(session, output);
+        
+        case ELFCLASS64:
+            return dump_ELF64_program_headers(session, output);
+        
+        default:
+            append_string(output, "ELF file has no class.\n");
+            return RET_NOT_OK;
     }
+}
 
 
-    section_to_segment_mapping = get_section_to_segment_mapping(input_file);
 
+static int dump_ELF32_symbol_tables(elf_session_t *session, output_t *output)
+{
+    ELF32_Header_t *file_header;
+    ELF32_Section_Header_t *section_header_table;
+    section_name_table_t *section_names;
+    int num_sections;
+    int num_symbol_tables = 0;
+
+
+    if((file_header = get_session_ELF32_header(session)) == NULL ||
+       (section_header_table = get_session_ELF32_section_header_table(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to read ELF32 section header table.\n");
+        return RET_NOT_OK;
+    }
+
+    if((section_names = get_session_section_names(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to get section names.\n");
+        return RET_NOT_OK;
+    }
+
+    num_sections = get_session_num_sections(session);
 
-    /*
-     * Stringify the program headers and free
-     * the dynamically-allocated memory.
-     */
-    output_string = stringify_ELF32_program_header_table(program_header_table, &file_header, section_to_segment_mapping);
-    
-    
 
     /*
-     * Free all dynamically-allocated memory
-     * that is no longer needed.
+     * Dump every symbol table in the file, which
+     * is usually .dynsym and/or .symtab.
      */
-    free(program_header_table);
-
-    for(int i = 0; i < file_header.e_phnum; i++)
+    for(int i = 0; i < num_sections; i++)
     {
-        for(int j = 0; section_to_segment_mapping[i][j] != NULL; j++)
+        symbol_table_t symbol_table;
+
+        if(section_header_table[i].sh_type != SHT_SYMTAB && section_header_table[i].sh_type != SHT_DYNSYM)
         {
-            free(section_to_segment_mapping[i][j]);
+            continue;
         }
 
-        free(section_to_segment_mapping[i]);
-    }
+        num_symbol_tables++;
+
+        if(get_ELF32_symbol_table(&session->image, file_header, section_header_table, i, &symbol_table) != RET_OK)
+        {
+            continue;
+        }
 
-    free(section_to_segment_mapping);
+        stringify_ELF32_symbol_table(output, &symbol_table, section_names->names[i]);
+    }
 
 
+    if(num_symbol_tables == 0)
+    {
+        append_string(output, "\nThere are no symbol tables in this file.\n");
+    }
 
-    return output_string;
+    return RET_OK;
 }
 
 
 
-static char *dump_ELF64_program_headers(FILE *input_file)
+static int dump_ELF64_symbol_tables(elf_session_t *session, output_t *output)
 {
-    ELF64_Header_t file_header;
-    ELF64_Program_Header_t *program_header_table;
-    char *output_string;
-    
-    
-    char ***section_to_segment_mapping;
+    ELF64_Header_t *file_header;
+    ELF64_Section_Header_t *section_header_table;
+    section_name_table_t *section_names;
+    int num_sections;
+    int num_symbol_tables = 0;
 
 
-    /*
-     * Get the ELF file header which is needed by
-     * the stringify function.
-     */
-    if(read_ELF64_header(input_file, &file_header) != RET_OK)
+    if((file_header = get_session_ELF64_header(session)) == NULL ||
+       (section_header_table = get_session_ELF64_section_header_table(session)) == NULL)
     {
-        fprintf(stderr, "Unable to read ELF64 program header table.\n");
-        return NULL;
+        fprintf(stderr, "Unable to read ELF64 section header table.\n");
+        return RET_NOT_OK;
     }
 
-
-    if((program_header_table = read_ELF64_program_header_table(input_file)) == NULL)
+    if((section_names = get_session_section_names(session)) == NULL)
     {
-        fprintf(stderr, "Unable to read ELF64 program header table.\n");
-        return NULL;
+        fprintf(stderr, "Unable to get section names.\n");
+        return RET_NOT_OK;
     }
 
+    num_sections = get_session_num_sections(session);
+
 
     /*
-     * Get the section to segment mapping 
+     * Dump every symbol table in the file, which
+     * is usually .dynsym and/or .symtab.
      */
-    section_to_segment_mapping = get_section_to_segment_mapping(input_file);
+    for(int i = 0; i < num_sections; i++)
+    {
+        symbol_table_t symbol_table;
 
+        if(section_header_table[i].sh_type != SHT_SYMTAB && section_header_table[i].sh_type != SHT_DYNSYM)
+        {
+            continue;
+        }
 
-    output_string = stringify_ELF64_program_header_table(program_header_table, &file_header, section_to_segment_mapping);
+        num_symbol_tables++;
 
+        if(get_ELF64_symbol_table(&session->image, file_header, section_header_table, i, &symbol_table) != RET_OK)
+        {
+            continue;
+        }
 
+        stringify_ELF64_symbol_table(output, &symbol_table, section_names->names[i]);
+    }
 
-    /*
-     * Free all dynamically-allocated memory
-     * that is no longer needed.
-     */
-    free(program_header_table);
 
-    for(int i = 0; i < file_header.e_phnum; i++)
+    if(num_symbol_tables == 0)
     {
-        for(int j = 0; section_to_segment_mapping[i][j] != NULL; j++)
-        {
-            free(section_to_segment_mapping[i][j]);
-        }
-
-        free(section_to_segment_mapping[i]);
+        append_string(output, "\nThere are no symbol tables in this file.\n");
     }
 
-    free(section_to_segment_mapping);
+    return RET_OK;
+}
 
 
 
-    return output_string;
+int dump_symbol_table(elf_session_t *session, output_t *output)
+{
+    switch (session->file_class)
+    {
+    case ELFCLASS32:
+        return dump_ELF32_symbol_tables(session, output);
+    
+    case ELFCLASS64:
+        return dump_ELF64_symbol_tables(session, output);
+    
+    default:
+        append_string(output, "ELF file has no class.\n");
+        return RET_NOT_OK;
+    }
 }
 
 
 
-int dump_program_headers(FILE *input_file)
+static int dump_ELF32_relocations(elf_session_t *session, output_t *output)
 {
-    char *output_string;
-    int file_class = get_file_class(input_file);
+    ELF32_Header_t *file_header;
+    ELF32_Section_Header_t *section_header_table;
+    section_name_table_t *section_names;
+    int num_sections;
+    int num_relocation_sections = 0;
 
 
-    switch(file_class)
+    if((file_header = get_session_ELF32_header(session)) == NULL ||
+       (section_header_table = get_session_ELF32_section_header_table(session)) == NULL)
     {
-        case ELFCLASS32:
-            output_string = dump_ELF32_program_headers(input_file);
-            break;
-        
-        case ELFCLASS64:
-            output_string = dump_ELF64_program_headers(input_file);
-            break;
-        
-        default:
-            printf("ELF file has no class.\n");
-            return RET_NOT_OK;
-            break;
+        fprintf(stderr, "Unable to read ELF32 section header table.\n");
+        return RET_NOT_OK;
     }
 
-    if(output_string == NULL)
+    if((section_names = get_session_section_names(session)) == NULL)
     {
+        fprintf(stderr, "Unable to get section names.\n");
         return RET_NOT_OK;
     }
 
-    fputs(output_string, stdout);
-    free(output_string);
+    num_sections = get_session_num_sections(session);
+
+
+    for(int i = 0; i < num_sections; i++)
+    {
+        relocation_table_t relocation_table;
+
+        if(section_header_table[i].sh_type != SHT_REL && section_header_table[i].sh_type != SHT_RELA)
+        {
+            continue;
+        }
+
+        num_relocation_sections++;
+
+        if(get_ELF32_relocation_table(&session->image, file_header, section_header_table, i, &relocation_table) != RET_OK)
+        {
+            continue;
+        }
+
+        stringify_ELF32_relocation_table(output, &relocation_table, &section_header_table[i], section_names->names[i],
+                                          file_header->e_machine, section_names);
+    }
+
+
+    if(num_relocation_sections == 0)
+    {
+        append_string(output, "\nThere are no relocations in this file.\n");
+    }
 
     return RET_OK;
 }
 
 
 
-int dump_symbol_table(FILE *input_file)
+static int dump_ELF64_relocations(elf_session_t *session, output_t *output)
 {
-    fprintf(stderr, "TODO: Dump the symbol table.\n");
-    return RET_NOT_OK;
-}
+    ELF64_Header_t *file_header;
+    ELF64_Section_Header_t *section_header_table;
+    section_name_table_t *section_names;
+    int num_sections;
+    int num_relocation_sections = 0;
 
 
+    if((file_header = get_session_ELF64_header(session)) == NULL ||
+       (section_header_table = get_session_ELF64_section_header_table(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to read ELF64 section header table.\n");
+        return RET_NOT_OK;
+    }
 
-int dump_relocation_info(FILE *input_file)
-{
-    fprintf(stderr, "TODO: Dump the relocation info.\n");
-    return RET_NOT_OK;
+    if((section_names = get_session_section_names(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to get section names.\n");
+        return RET_NOT_OK;
+    }
+
+    num_sections = get_session_num_sections(session);
+
+
+    for(int i = 0; i < num_sections; i++)
+    {
+        relocation_table_t relocation_table;
+
+        if(section_header_table[i].sh_type != SHT_REL && section_header_table[i].sh_type != SHT_RELA)
+        {
+            continue;
+        }
+
+        num_relocation_sections++;
+
+        if(get_ELF64_relocation_table(&session->image, file_header, section_header_table, i, &relocation_table) != RET_OK)
+        {
+            continue;
+        }
+
+        stringify_ELF64_relocation_table(output, &relocation_table, &section_header_table[i], section_names->names[i],
+                                          file_header->e_machine, section_names);
+    }
+
+
+    if(num_relocation_sections == 0)
+    {
+        append_string(output, "\nThere are no relocations in this file.\n");
+    }
+
+    return RET_OK;
 }
 
 
 
-int hex_dump_section(FILE *input_file, int section_number, char *section_name)
+int dump_relocation_info(elf_session_t *session, output_t *output)
 {
-    fprintf(stderr, "TODO: Hex dump a particular section.\n");
-    return RET_NOT_OK;
+    switch (session->file_class)
+    {
+    case ELFCLASS32:
+        return dump_ELF32_relocations(session, output);
+    
+    case ELFCLASS64:
+        return dump_ELF64_relocations(session, output);
+    
+    default:
+        append_string(output, "ELF file has no class.\n");
+        return RET_NOT_OK;
+    }
 }
 
 
 
-int string_dump_section(FILE *input_file, int section_number, char *section_name)
+/*
+ * The part of the file that holds a section being dumped.
+ */
+typedef struct
 {
-    fprintf(stderr, "TODO: String dump a particular section.\n");
-    return RET_NOT_OK;
-}
+    string_view_t name;
+    unsigned char *data;
+    uint64_t size;
+    uint64_t address;
+    bool has_relocations;
 
+} section_contents_t;
 
 
-int dump_debug_info(FILE *input_file, debug_command_subtype subtype)
+
+/*
+ * Finds the sections a dump command refers to: every section
+ * with the given name, as readelf does, or the section with the
+ * given number if there is no name. Returns how many there are,
+ * pointing sections at their indices, or 0 after printing a
+ * warning if there are none.
+ */
+static int find_dump_sections(elf_session_t *session, int *section_number, char *section_name, const int **sections)
 {
-    fprintf(stderr, "TODO: Dump a section of debugging symbols.\n");
-    return RET_NOT_OK;
-}
+    section_name_table_t *section_names;
+    section_name_index_t *index;
+    int num_sections;
+
+
+    if((section_names = get_session_section_names(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to get section names.\n");
+        return 0;
+    }
+
+    if(section_name == NULL)
+    {
+        if(*section_number >= 0 && *section_number < section_names->num_names)
+        {
+            *sections = section_number;
+            return 1;
+        }
 
+        fprintf(stderr, "Section %d was not dumped because it does not exist.\n", *section_number);
+        return 0;
+    }
+
+
+    if((index = get_session_section_name_index(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to build section name index.\n");
+        return 0;
+    }
+
+    if((num_sections = find_sections(index, section_name, strlen(section_name), sections)) == 0)
+    {
+        fprintf(stderr, "Section '%s' was not dumped because it does not exist.\n", section_name);
+    }
+
+    return num_sections;
+}
+
+
+
+/*
+ * Finds where the contents of a section are in the mapping.
+ * When there are relocation sections that apply to it,
+ * has_relocations is set, since the contents are dumped as
+ * they are in the file.
+ */
+static int get_ELF32_section_contents(elf_session_t *session, int index, section_contents_t *contents)
+{
+    ELF32_Header_t *file_header;
+    ELF32_Section_Header_t *section_header_table;
+    ELF32_Section_Header_t *section_header;
+    section_name_table_t *section_names;
+    bool *relocated_sections = get_session_relocated_sections(session);
+
+
+    if((file_header = get_session_ELF32_header(session)) == NULL ||
+       (section_header_table = get_session_ELF32_section_header_table(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to read ELF32 section header table.\n");
+        return RET_NOT_OK;
+    }
+
+    if((section_names = get_session_section_names(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to get section names.\n");
+        return RET_NOT_OK;
+    }
+
+
+    section_header = &section_header_table[index];
+
+    contents->name = section_names->names[index];
+    contents->address = section_header->sh_addr;
+    contents->size = (section_header->sh_type == SHT_NOBITS) ? 0 : section_header->sh_size;
+    contents->has_relocations = (relocated_sections != NULL && relocated_sections[index]);
+
+    if((contents->data = get_image_range(&session->image, section_header->sh_offset, contents->size)) == NULL)
+    {
+        fprintf(stderr, "Section %d extends past the end of the file.\n", index);
+        return RET_NOT_OK;
+    }
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Finds where the contents of a section are in the mapping.
+ * When there are relocation sections that apply to it,
+ * has_relocations is set, since the contents are dumped as
+ * they are in the file.
+ */
+static int get_ELF64_section_contents(elf_session_t *session, int index, section_contents_t *contents)
+{
+    ELF64_Header_t *file_header;
+    ELF64_Section_Header_t *section_header_table;
+    ELF64_Section_Header_t *section_header;
+    section_name_table_t *section_names;
+    bool *relocated_sections = get_session_relocated_sections(session);
+
+
+    if((file_header = get_session_ELF64_header(session)) == NULL ||
+       (section_header_table = get_session_ELF64_section_header_table(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to read ELF64 section header table.\n");
+        return RET_NOT_OK;
+    }
+
+    if((section_names = get_session_section_names(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to get section names.\n");
+        return RET_NOT_OK;
+    }
+
+
+    section_header = &section_header_table[index];
+
+    contents->name = section_names->names[index];
+    contents->address = section_header->sh_addr;
+    contents->size = (section_header->sh_type == SHT_NOBITS) ? 0 : section_header->sh_size;
+    contents->has_relocations = (relocated_sections != NULL && relocated_sections[index]);
+
+    if((contents->data = get_image_range(&session->image, section_header->sh_offset, contents->size)) == NULL)
+    {
+        fprintf(stderr, "Section %d extends past the end of the file.\n", index);
+        return RET_NOT_OK;
+    }
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Finds the contents of a section, printing the message
+ * readelf does when there are none.
+ */
+static int get_section_contents(elf_session_t *session, output_t *output, int index, section_contents_t *contents)
+{
+    int result;
+
+
+    switch (session->file_class)
+    {
+    case ELFCLASS32:
+        result = get_ELF32_section_contents(session, index, contents);
+        break;
+
+    case ELFCLASS64:
+        result = get_ELF64_section_contents(session, index, contents);
+        break;
+
+    default:
+        append_string(output, "ELF file has no class.\n");
+        return RET_NOT_OK;
+    }
+
+    if(result == RET_OK && contents->size == 0)
+    {
+        append_string(output, "Section '");
+        append_bytes(output, contents->name.string, contents->name.length);
+        append_string(output, "' has no data to dump.\n");
+    }
+
+    return result;
+}
+
+
+
+/*
+ * Dumps the contents of one section in hex, sixteen bytes to a
+ * row, with the printable ones shown alongside. A section of at
+ * least parallel_dump_threshold bytes is split between threads.
+ */
+static int hex_dump_one_section(elf_session_t *session, output_t *output, int index,
+                                thread_pool_t *pool, uint64_t parallel_dump_threshold)
+{
+    section_contents_t contents;
+
+
+    if(get_section_contents(session, output, index, &contents) != RET_OK)
+    {
+        return RET_NOT_OK;
+    }
+
+    if(contents.size == 0)
+    {
+        return RET_OK;
+    }
+
+
+    append_string(output, "\nHex dump of section '");
+    append_bytes(output, contents.name.string, contents.name.length);
+    append_string(output, "':\n");
+
+    if(contents.has_relocations)
+    {
+        append_string(output, " NOTE: This section has relocations against it, but these have NOT been applied to this dump.\n");
+    }
+
+    if(pool != NULL && contents.size >= parallel_dump_threshold)
+    {
+        hex_dump_in_parallel(output, contents.data, contents.size, contents.address, pool);
+    }
+    else
+    {
+        hex_dump(output, contents.data, contents.size, contents.address);
+    }
+
+    append_char(output, '\n');
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Dumps the strings in one section, each with its offset, on
+ * several threads when the section is large enough.
+ */
+static int string_dump_one_section(elf_session_t *session, output_t *output, int index,
+                                   thread_pool_t *pool, uint64_t parallel_dump_threshold)
+{
+    section_contents_t contents;
+    uint64_t num_lines;
+
+
+    if(get_section_contents(session, output, index, &contents) != RET_OK)
+    {
+        return RET_NOT_OK;
+    }
+
+    if(contents.size == 0)
+    {
+        return RET_OK;
+    }
+
+
+    append_string(output, "\nString dump of section '");
+    append_bytes(output, contents.name.string, contents.name.length);
+    append_string(output, "':\n");
+
+    if(contents.has_relocations)
+    {
+        append_string(output, "  Note: This section has relocations against it, but these have NOT been applied to this dump.\n");
+    }
+
+    if(pool != NULL && contents.size >= parallel_dump_threshold)
+    {
+        num_lines = string_dump_in_parallel(output, contents.data, contents.size, pool);
+    }
+    else
+    {
+        num_lines = string_dump(output, contents.data, contents.size);
+    }
+
+    if(num_lines == 0)
+    {
+        append_string(output, "  No strings found in this section.");
+    }
+
+    append_char(output, '\n');
+
+    return RET_OK;
+}
+
+
+
+int hex_dump_section(elf_session_t *session, output_t *output, int section_number, char *section_name,
+                     thread_pool_t *pool, uint64_t parallel_dump_threshold)
+{
+    const int *sections;
+    int num_sections = find_dump_sections(session, &section_number, section_name, &sections);
+    int result = (num_sections > 0) ? RET_OK : RET_NOT_OK;
+
+
+    for(int i = 0; i < num_sections; i++)
+    {
+        if(hex_dump_one_section(session, output, sections[i], pool, parallel_dump_threshold) != RET_OK)
+        {
+            result = RET_NOT_OK;
+        }
+    }
+
+    return result;
+}
+
+
+
+int string_dump_section(elf_session_t *session, output_t *output, int section_number, char *section_name,
+                        thread_pool_t *pool, uint64_t parallel_dump_threshold)
+{
+    const int *sections;
+    int num_sections = find_dump_sections(session, &section_number, section_name, &sections);
+    int result = (num_sections > 0) ? RET_OK : RET_NOT_OK;
+
+
+    for(int i = 0; i < num_sections; i++)
+    {
+        if(string_dump_one_section(session, output, sections[i], pool, parallel_dump_threshold) != RET_OK)
+        {
+            result = RET_NOT_OK;
+        }
+    }
+
+    return result;
+}
+
+
+
+/*
+ * Checks whether the first section with the given name has
+ * relocations against it.
+ */
+static bool has_relocations(elf_session_t *session, const char *name)
+{
+    section_name_index_t *index = get_session_section_name_index(session);
+    bool *relocated_sections = get_session_relocated_sections(session);
+    const int *sections;
+
+
+    if(index == NULL || relocated_sections == NULL || find_sections(index, name, strlen(name), &sections) == 0)
+    {
+        return false;
+    }
+
+    return relocated_sections[sections[0]];
+}
+
+
+
+/*
+ * Finds the sections that the string and indexed attributes
+ * of DIEs point into. Indexed strings and addresses are left
+ * unresolved (shown as their index) when .debug_info,
+ * .debug_str_offsets or .debug_addr have relocations against
+ * them, since in an object file the bases and entries are
+ * not filled in until it is linked.
+ */
+static void get_debug_strings(elf_session_t *session, debug_strings_t *strings)
+{
+    strings->str = get_session_named_section(session, ".debug_str", &strings->str_size, NULL);
+    strings->line_str = get_session_named_section(session, ".debug_line_str", &strings->line_str_size, NULL);
+    strings->str_offsets = NULL;
+    strings->str_offsets_size = 0;
+    strings->addr = NULL;
+    strings->addr_size = 0;
+
+    if(has_relocations(session, ".debug_info") || has_relocations(session, ".debug_str_offsets") ||
+       has_relocations(session, ".debug_addr"))
+    {
+        return;
+    }
+
+    strings->str_offsets = get_session_named_section(session, ".debug_str_offsets", &strings->str_offsets_size, NULL);
+    strings->addr = get_session_named_section(session, ".debug_addr", &strings->addr_size, NULL);
+}
+
+
+
+/*
+ * Dumps every set of abbreviations in .debug_abbrev, in the
+ * order they appear. The sets go through the session's cache
+ * of abbreviation tables, so a later dump of the units that
+ * use them does not parse them again.
+ */
+static int dump_debug_abbrev(elf_session_t *session, output_t *output)
+{
+    abbrev_cache_t *cache = get_session_abbrev_cache(session);
+    uint64_t offset = 0;
+
+
+    if(cache == NULL)
+    {
+        return RET_OK;
+    }
+
+    append_string(output, "Contents of the .debug_abbrev section:\n\n");
+
+    while(offset < cache->section_size)
+    {
+        abbrev_table_t *table = get_abbrev_table(cache, offset);
+
+        if(table == NULL)
+        {
+            fprintf(stderr, "Error: corrupt abbreviations at offset 0x%lx of .debug_abbrev.\n", (unsigned long) offset);
+            return RET_NOT_OK;
+        }
+
+        stringify_debug_abbrev_table(output, table);
+        offset = table->end_offset;
+    }
+
+    append_char(output, '\n');
+
+    return RET_OK;
+}
+
+
+
+/*
+ * What went wrong in a unit of .debug_info, if anything, and
+ * the offset it went wrong at.
+ */
+typedef enum
+{
+    UNIT_OK,
+    UNIT_CORRUPT_ABBREVS,
+    UNIT_CORRUPT_DIE
+
+} unit_status_t;
+
+
+typedef struct
+{
+    unit_status_t status;
+    uint64_t offset;
+
+} unit_result_t;
+
+
+
+/*
+ * Prints the error a unit ran into, and returns RET_NOT_OK if
+ * there was one.
+ */
+static int report_debug_unit_error(unit_result_t *result)
+{
+    switch(result->status)
+    {
+        case UNIT_CORRUPT_ABBREVS:
+            fprintf(stderr, "Error: corrupt abbreviations at offset 0x%lx of .debug_abbrev.\n", (unsigned long) result->offset);
+            return RET_NOT_OK;
+
+        case UNIT_CORRUPT_DIE:
+            fprintf(stderr, "Error: corrupt DIE at offset 0x%lx of .debug_info.\n", (unsigned long) result->offset);
+            return RET_NOT_OK;
+
+        default:
+            return RET_OK;
+    }
+}
+
+
+
+/*
+ * Dumps the DIEs of one unit, reading them in a single pass.
+ * DIEs nested dwarf_depth or more deep (if dwarf_depth is not
+ * negative) are not shown, and their attributes are skipped
+ * over rather than decoded; where such a run of DIEs starts,
+ * a line with "..." stands in for it, as in readelf.
+ *
+ * An error is not printed but left in result, since a unit may
+ * be dumped on another thread ahead of units before it that
+ * fail, in which case it should not be reported at all.
+ */
+static void dump_debug_unit(output_t *output, const unsigned char *section, unit_header_t *unit,
+                            abbrev_cache_t *abbrevs, debug_strings_t *strings, int dwarf_depth,
+                            unit_result_t *result)
+{
+    abbrev_table_t *table = get_abbrev_table(abbrevs, unit->abbrev_offset);
+    debug_strings_t unit_strings = *strings;
+    bool printing = true;
+    die_reader_t reader;
+    die_status_t status;
+    die_t die;
+
+
+    stringify_debug_unit_header(output, unit);
+
+    result->status = UNIT_OK;
+
+    if(table == NULL)
+    {
+        result->status = UNIT_CORRUPT_ABBREVS;
+        result->offset = unit->abbrev_offset;
+        return;
+    }
+
+    // the strings are shared between units, so the bases go in a copy
+    read_unit_bases(section, unit, table, &unit_strings);
+    init_die_reader(&reader, section, unit, table);
+
+    while((status = read_die(&reader, &die)) == DIE_OK)
+    {
+        if(dwarf_depth >= 0 && die.depth >= dwarf_depth)
+        {
+            if(printing && die.depth > 0)
+            {
+                append_string(output, " <");
+                append_decimal(output, die.depth);
+                append_string(output, "><");
+                append_hex(output, die.offset, 0);
+                append_string(output, ">: ...\n");
+            }
+
+            printing = false;
+
+            if(die.abbrev != NULL && !skip_attributes(&reader, die.abbrev->attributes, die.abbrev->num_attributes))
+            {
+                status = DIE_CORRUPT;
+                break;
+            }
+
+            continue;
+        }
+
+        printing = true;
+        stringify_debug_die(output, &die);
+
+        if(die.abbrev == NULL)
+        {
+            continue;
+        }
+
+        for(uint32_t i = 0; i < die.abbrev->num_attributes; i++)
+        {
+            uint64_t offset = reader.position - section;
+            attribute_value_t value;
+
+            if(!read_attribute(&reader, &die.abbrev->attributes[i], &value))
+            {
+                status = DIE_CORRUPT;
+                break;
+            }
+
+            stringify_debug_attribute(output, offset, &value, &unit_strings);
+        }
+
+        if(status == DIE_CORRUPT)
+        {
+            break;
+        }
+    }
+
+    if(status == DIE_CORRUPT)
+    {
+        result->status = UNIT_CORRUPT_DIE;
+        result->offset = die.offset;
+    }
+}
+
+
+
+/*
+ * The units of .debug_info being dumped as a list of jobs, one
+ * per unit, whose outputs are written out in order.
+ */
+typedef struct
+{
+    const unsigned char *section;
+    unit_header_t *units;
+    abbrev_cache_t *abbrevs;
+    debug_strings_t *strings;
+    int dwarf_depth;
+
+    // one result per unit
+    unit_result_t *results;
+
+} debug_unit_jobs_t;
+
+
+
+/*
+ * Roughly how many bytes of text each byte of .debug_info turns
+ * into when it is dumped, which the output of a unit dumped on
+ * its own is sized from.
+ */
+#define DEBUG_INFO_OUTPUT_RATIO     8
+
+
+
+static void dump_debug_unit_job(void *context, int job_number, output_t *output)
+{
+    debug_unit_jobs_t *jobs = (debug_unit_jobs_t*) context;
+
+    dump_debug_unit(output, jobs->section, &jobs->units[job_number], jobs->abbrevs, jobs->strings,
+                    jobs->dwarf_depth, &jobs->results[job_number]);
+}
+
+
+
+/*
+ * Reports the error of a unit once it has been written. Only
+ * the first unit that fails gets this far, as the units after
+ * it are not written.
+ */
+static int finish_debug_unit_job(void *context, int job_number)
+{
+    debug_unit_jobs_t *jobs = (debug_unit_jobs_t*) context;
+
+    return report_debug_unit_error(&jobs->results[job_number]);
+}
+
+
+
+/*
+ * Dumps the given units on the pool's threads at once. Output
+ * stops after the first unit that fails, as it would if they
+ * were dumped one after another, and RET_NOT_OK is returned.
+ */
+static int dump_debug_units_in_parallel(output_t *output, debug_unit_jobs_t *jobs, int num_units,
+                                        uint64_t size, thread_pool_t *pool)
+{
+    ordered_jobs_t list;
+    uint64_t output_size = size / num_units * DEBUG_INFO_OUTPUT_RATIO;
+    int result;
+
+
+    jobs->results = (unit_result_t*) malloc(num_units * sizeof(unit_result_t));
+
+    list.function = dump_debug_unit_job;
+    list.finish = finish_debug_unit_job;
+    list.context = jobs;
+    list.num_jobs = num_units;
+    list.output_size = (output_size < MEMORY_OUTPUT_SIZE) ? MEMORY_OUTPUT_SIZE :
+                       (output_size > OUTPUT_BUFFER_SIZE) ? OUTPUT_BUFFER_SIZE : output_size;
+
+    list.run_by_caller = NULL;
+
+    result = run_ordered_jobs(pool, output, &list);
+
+    free(jobs->results);
+
+    return result;
+}
+
+
+
+/*
+ * Dumps every unit of .debug_info, in order. The units are
+ * found first from their headers alone, each of which says
+ * where the next one starts; after that they can be decoded
+ * independently, so if .debug_info is at least
+ * parallel_dump_threshold bytes they are spread over the
+ * threads of the pool, if there is one.
+ */
+static int dump_debug_info_units(elf_session_t *session, output_t *output, int dwarf_depth,
+                                 thread_pool_t *pool, uint64_t parallel_dump_threshold)
+{
+    debug_unit_jobs_t jobs;
+    debug_strings_t strings;
+    unit_header_t *units;
+    unsigned char *section;
+    uint64_t size, num_units, units_end;
+    int result = RET_OK;
+
+
+    if((section = get_session_named_section(session, ".debug_info", &size, NULL)) == NULL)
+    {
+        return RET_OK;
+    }
+
+    if((jobs.abbrevs = get_session_abbrev_cache(session)) == NULL)
+    {
+        fprintf(stderr, "Error: .debug_info has no .debug_abbrev section to go with it.\n");
+        return RET_NOT_OK;
+    }
+
+    get_debug_strings(session, &strings);
+
+    append_string(output, "Contents of the .debug_info section:\n\n");
+
+    if(has_relocations(session, ".debug_info"))
+    {
+        append_string(output, "  Note: This section has relocations against it, but these have NOT been applied to this dump.\n");
+    }
+
+
+    num_units = read_unit_headers(section, size, &units);
+    units_end = (num_units > 0) ? units[num_units - 1].end_offset : 0;
+
+    jobs.section = section;
+    jobs.units = units;
+    jobs.strings = &strings;
+    jobs.dwarf_depth = dwarf_depth;
+
+    if(pool != NULL && num_units > 1 && num_units <= INT_MAX && size >= parallel_dump_threshold)
+    {
+        result = dump_debug_units_in_parallel(output, &jobs, (int) num_units, size, pool);
+    }
+    else
+    {
+        for(uint64_t i = 0; i < num_units && result == RET_OK; i++)
+        {
+            unit_result_t unit_result;
+
+            dump_debug_unit(output, section, &units[i], jobs.abbrevs, &strings, dwarf_depth, &unit_result);
+            result = report_debug_unit_error(&unit_result);
+        }
+    }
+
+    free(units);
+
+    if(result != RET_OK)
+    {
+        return RET_NOT_OK;
+    }
+
+    if(units_end < size)
+    {
+        fprintf(stderr, "Error: corrupt unit header at offset 0x%lx of .debug_info.\n", (unsigned long) units_end);
+        return RET_NOT_OK;
+    }
+
+    append_char(output, '\n');
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Dumps every set of address ranges in .debug_aranges, in order,
+ * including the terminating range of each set, as readelf does.
+ */
+static int dump_debug_aranges(elf_session_t *session, output_t *output)
+{
+    aranges_header_t header;
+    unsigned char *section;
+    uint64_t size;
+
+
+    if((section = get_session_named_section(session, ".debug_aranges", &size, NULL)) == NULL)
+    {
+        return RET_OK;
+    }
+
+    append_string(output, "Contents of the .debug_aranges section:\n\n");
+
+    for(uint64_t offset = 0; offset < size; offset = header.end_offset)
+    {
+        const unsigned char *position;
+        uint64_t address, length;
+
+        if(!read_aranges_header(section, size, offset, &header))
+        {
+            fprintf(stderr, "Error: corrupt set of address ranges at offset 0x%lx of .debug_aranges.\n", (unsigned long) offset);
+            return RET_NOT_OK;
+        }
+
+        stringify_debug_aranges_header(output, &header);
+
+        position = section + header.ranges_offset;
+
+        while(read_arange(&position, section + header.end_offset, &header, &address, &length))
+        {
+            stringify_debug_arange(output, address, length, header.address_size);
+        }
+    }
+
+    append_char(output, '\n');
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Gets the machine of the file, which decides the names of the
+ * registers in the call frame information.
+ */
+static int get_machine(elf_session_t *session)
+{
+    switch(session->file_class)
+    {
+        case ELFCLASS32:
+        {
+            ELF32_Header_t *file_header = get_session_ELF32_header(session);
+            return (file_header != NULL) ? file_header->e_machine : EM_NONE;
+        }
+
+        case ELFCLASS64:
+        {
+            ELF64_Header_t *file_header = get_session_ELF64_header(session);
+            return (file_header != NULL) ? file_header->e_machine : EM_NONE;
+        }
+
+        default:
+            return EM_NONE;
+    }
+}
+
+
+
+/*
+ * Dumps the instructions of a CIE or FDE, starting at the
+ * given location. An instruction that is not known or runs
+ * past the end of the entry ends the list, since where the
+ * next one starts is not known.
+ */
+static void dump_cfa_instructions(output_t *output, frame_section_t *section, cie_t *cie, const unsigned char *instructions,
+                                  uint64_t length, uint64_t location, int machine)
+{
+    const unsigned char *position = instructions;
+    const unsigned char *end = instructions + length;
+    cfa_instruction_t instruction;
+
+
+    while(position < end)
+    {
+        const unsigned char *start = position;
+
+        if(!read_cfa_instruction(section, cie, &position, end, &location, &instruction))
+        {
+            append_string(output, "  Unknown or truncated DW_CFA value: 0x");
+            append_hex(output, *start, 2);
+            append_char(output, '\n');
+            return;
+        }
+
+        stringify_debug_cfa_instruction(output, &instruction, section->address_size, machine);
+    }
+}
+
+
+
+/*
+ * Dumps every entry of .eh_frame or .debug_frame in order, the
+ * way readelf --debug-dump=frames does, followed by the sorted
+ * table of FDE ranges from the session's index of the section.
+ */
+static int dump_frame_section(elf_session_t *session, output_t *output, bool is_eh_frame, int machine)
+{
+    const char *name = is_eh_frame ? ".eh_frame" : ".debug_frame";
+    frame_section_t section;
+    range_index_t *index;
+    uint64_t offset = 0;
+    cie_t cie;
+    fde_t fde;
+
+
+    if(!get_session_frame_section(session, is_eh_frame, &section))
+    {
+        return RET_OK;
+    }
+
+    append_string(output, "Contents of the ");
+    append_string(output, name);
+    append_string(output, " section:\n\n");
+
+    if(has_relocations(session, name))
+    {
+        append_string(output, "  Note: This section has relocations against it, but these have NOT been applied to this dump.\n");
+    }
+
+
+    // the last CIE read, which read_fde only rereads when an FDE points at another
+    cie.end_offset = 0;
+
+    while(offset < section.size)
+    {
+        uint64_t end_offset;
+
+        switch(read_frame_entry_type(&section, offset, &end_offset))
+        {
+            case FRAME_ENTRY_TERMINATOR:
+                append_char(output, '\n');
+                append_hex(output, offset, 8);
+                append_string(output, " ZERO terminator\n\n");
+                break;
+
+            case FRAME_ENTRY_CIE:
+                if(!read_cie(&section, offset, &cie))
+                {
+                    cie.end_offset = 0;
+                    fprintf(stderr, "Error: corrupt CIE at offset 0x%lx of %s.\n", (unsigned long) offset, name);
+                    return RET_NOT_OK;
+                }
+
+                stringify_debug_cie(output, &cie, section.address_size);
+                dump_cfa_instructions(output, &section, &cie, cie.instructions, cie.instructions_length, 0, machine);
+                break;
+
+            case FRAME_ENTRY_FDE:
+                if(!read_fde(&section, offset, &cie, &fde))
+                {
+                    fprintf(stderr, "Error: corrupt FDE at offset 0x%lx of %s.\n", (unsigned long) offset, name);
+                    return RET_NOT_OK;
+                }
+
+                stringify_debug_fde(output, &fde, section.address_size);
+                dump_cfa_instructions(output, &section, &cie, fde.instructions, fde.instructions_length, fde.pc_begin, machine);
+                break;
+
+            default:
+                fprintf(stderr, "Error: corrupt entry at offset 0x%lx of %s.\n", (unsigned long) offset, name);
+                return RET_NOT_OK;
+        }
+
+        offset = end_offset;
+    }
+
+    append_char(output, '\n');
+
+
+    if((index = get_session_fde_index(session, is_eh_frame)) != NULL)
+    {
+        stringify_fde_index(output, index, name, section.address_size);
+    }
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Dumps the call frame information of .eh_frame and then of
+ * .debug_frame, whichever of them the file has.
+ */
+static int dump_debug_frames(elf_session_t *session, output_t *output)
+{
+    int machine = get_machine(session);
+
+    if(dump_frame_section(session, output, true, machine) != RET_OK)
+    {
+        return RET_NOT_OK;
+    }
+
+    return dump_frame_section(session, output, false, machine);
+}
+
+
+
+/*
+ * Counts how many buckets of a name index hold names and the
+ * most names any of them holds. The names of a bucket follow
+ * the one the bucket gives, for as long as their hashes fall in
+ * the same bucket.
+ */
+static void count_names_buckets(names_table_t *table, uint64_t *buckets_used, uint64_t *longest_bucket)
+{
+    *buckets_used = 0;
+    *longest_bucket = 0;
+
+    for(uint32_t bucket = 0; bucket < table->bucket_count; bucket++)
+    {
+        uint64_t number = get_names_table_value(table, table->buckets, bucket, 4);
+        uint64_t length = 0;
+
+        if(number == 0)
+            continue;
+
+        for(; number <= table->name_count; number++, length++)
+        {
+            if(get_names_table_value(table, table->hashes, number - 1, 4) % table->bucket_count != bucket)
+                break;
+        }
+
+        (*buckets_used)++;
+
+        if(length > *longest_bucket)
+            *longest_bucket = length;
+    }
+}
+
+
+
+/*
+ * Dumps one name of a name index, with each of its entries.
+ */
+static void dump_debug_name(output_t *output, names_table_t *table, uint64_t number, const unsigned char *str, uint64_t str_size)
+{
+    uint64_t string_offset = get_names_table_value(table, table->string_offsets, number - 1, table->offset_size);
+    uint64_t entry_offset = get_names_table_value(table, table->entry_offsets, number - 1, table->offset_size);
+    uint32_t hash = (table->bucket_count > 0) ? (uint32_t) get_names_table_value(table, table->hashes, number - 1, 4) : 0;
+    const unsigned char *position;
+    names_entry_t entry;
+
+
+    if(str == NULL)
+        stringify_debug_name(output, number, hash, table->bucket_count > 0, "<no .debug_str section>", 23);
+    else if(string_offset >= str_size)
+        stringify_debug_name(output, number, hash, table->bucket_count > 0, "<offset is too big>", 19);
+    else
+        stringify_debug_name(output, number, hash, table->bucket_count > 0, (const char*) str + string_offset,
+                             strnlen((const char*) str + string_offset, str_size - string_offset));
+
+    if(entry_offset >= (uint64_t) (table->end - table->entry_pool))
+    {
+        append_string(output, " <corrupt entry offset>\n");
+        return;
+    }
+
+    position = table->entry_pool + entry_offset;
+
+    while(true)
+    {
+        if(!read_names_entry(table, &position, &entry))
+        {
+            append_string(output, " <corrupt entry>");
+            break;
+        }
+
+        if(entry.abbrev == NULL)
+            break;
+
+        stringify_debug_names_entry(output, &entry);
+    }
+
+    append_char(output, '\n');
+}
+
+
+
+/*
+ * Dumps every name index of .debug_names: its header, units and
+ * abbreviations, how full its buckets are, and every name in it
+ * with its entries, in the order of the names.
+ */
+static int dump_debug_names(elf_session_t *session, output_t *output)
+{
+    const unsigned char *str;
+    unsigned char *section;
+    uint64_t size, str_size;
+    names_table_t table;
+
+
+    if((section = get_session_named_section(session, ".debug_names", &size, NULL)) == NULL)
+    {
+        return RET_OK;
+    }
+
+    str = get_session_named_section(session, ".debug_str", &str_size, NULL);
+
+    append_string(output, "Contents of the .debug_names section:\n\n");
+
+    if(has_relocations(session, ".debug_names"))
+    {
+        append_string(output, "  Note: This section has relocations against it, but these have NOT been applied to this dump.\n");
+    }
+
+
+    for(uint64_t offset = 0; offset < size; offset = table.end_offset)
+    {
+        if(!read_names_table(section, size, offset, &table))
+        {
+            release_names_table(&table);
+            fprintf(stderr, "Error: corrupt name index at offset 0x%lx of .debug_names.\n", (unsigned long) offset);
+            return RET_NOT_OK;
+        }
+
+        stringify_debug_names_header(output, &table);
+
+        if(table.bucket_count > 0)
+        {
+            uint64_t buckets_used, longest_bucket;
+
+            count_names_buckets(&table, &buckets_used, &longest_bucket);
+            stringify_debug_names_buckets(output, &table, buckets_used, longest_bucket);
+        }
+
+        append_string(output, "  Symbol table:\n");
+
+        for(uint64_t number = 1; number <= table.name_count; number++)
+        {
+            dump_debug_name(output, &table, number, str, str_size);
+        }
+
+        append_char(output, '\n');
+
+        release_names_table(&table);
+    }
+
+    return RET_OK;
+}
+
+
+
+int dump_debug_info(elf_session_t *session, output_t *output, debug_command_subtype subtype, int dwarf_depth,
+                    thread_pool_t *pool, uint64_t parallel_dump_threshold)
+{
+    switch(subtype)
+    {
+        case DBG_CMD_DUMP_ABBREV:
+            return dump_debug_abbrev(session, output);
+
+        case DBG_CMD_DUMP_INFO:
+            return dump_debug_info_units(session, output, dwarf_depth, pool, parallel_dump_threshold);
+
+        case DBG_CMD_DUMP_ARANGES:
+            return dump_debug_aranges(session, output);
+
+        case DBG_CMD_DUMP_FRAMES:
+            return dump_debug_frames(session, output);
+
+        case DBG_CMD_DUMP_NAMES:
+            return dump_debug_names(session, output);
+
+        default:
+            fprintf(stderr, "TODO: Dump a section of debugging symbols.\n");
+            return RET_NOT_OK;
+    }
+}
+
+
+
+/*
+ * Looks up each of a comma-separated list of symbol names and
+ * prints the symbols found, in the order the names were given.
+ * The names are not copied or modified, since the same command
+ * may be run over several files at once.
+ */
+int lookup_symbols(elf_session_t *session, output_t *output, char *symbol_names)
+{
+    symbol_index_t *index;
+    char *name = symbol_names;
+
+
+    if(session->file_class != ELFCLASS32 && session->file_class != ELFCLASS64)
+    {
+        append_string(output, "ELF file has no class.\n");
+        return RET_NOT_OK;
+    }
+
+    if((index = get_session_symbol_index(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to build symbol index.\n");
+        return RET_NOT_OK;
+    }
+
+
+    stringify_symbol_lookup_title(output, index);
+
+    while(*name != '\0')
+    {
+        size_t length = strcspn(name, ",");
+        int64_t symbol_number;
+
+        if(length > 0)
+        {
+            symbol_number = find_symbol(index, name, length);
+
+            if(symbol_number < 0)
+                stringify_missing_symbol(output, name, length);
+            else if(session->file_class == ELFCLASS64)
+                stringify_ELF64_symbol(output, &index->symbols, symbol_number);
+            else
+                stringify_ELF32_symbol(output, &index->symbols, symbol_number);
+        }
+
+        name += length;
+
+        if(*name == ',')
+            name++;
+    }
+
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Reads addresses from standard input until it runs out and
+ * prints the symbol containing each one, as name+offset, or ??
+ * if no symbol contains it. The lines are printed in the order
+ * the addresses were read, and go out a buffer at a time as
+ * they are resolved rather than once standard input closes (with
+ * -j too, where a command reading standard input is only run
+ * once everything before it has been written), so the command
+ * can sit at the end of a pipe.
+ */
+int resolve_addresses(elf_session_t *session, output_t *output)
+{
+    address_index_t *index;
+    input_t input;
+    string_view_t token;
+
+
+    if(session->file_class != ELFCLASS32 && session->file_class != ELFCLASS64)
+    {
+        append_string(output, "ELF file has no class.\n");
+        return RET_NOT_OK;
+    }
+
+    if((index = get_session_address_index(session)) == NULL)
+    {
+        fprintf(stderr, "Unable to build address index.\n");
+        return RET_NOT_OK;
+    }
+
+
+    init_input(&input, STDIN_FILENO);
+
+    while(read_token(&input, &token))
+    {
+        uint64_t address;
+        string_view_t *name;
+        int64_t range;
+
+        if(!parse_address(token, &address))
+        {
+            append_bytes(output, token.string, token.length);
+            append_string(output, "\tinvalid address\n");
+            continue;
+        }
+
+        append_string(output, "0x");
+        append_hex(output, address, 0);
+        append_char(output, '\t');
+
+        if((range = find_range(index->ranges, address)) < 0)
+        {
+            append_string(output, "??\n");
+            continue;
+        }
+
+        name = &index->names[index->ranges->payloads[range]];
+
+        append_bytes(output, name->string, name->length);
+        append_string(output, "+0x");
+        append_hex(output, address - index->ranges->starts[range], 0);
+        append_char(output, '\n');
+    }
+
+    release_input(&input);
+
+
+    return RET_OK;
+}
+
+
+
+
+/*
+ * Finds the name of the unit at the given offset of .debug_info,
+ * from the DW_AT_name of its first DIE. Only that one DIE is
+ * read, once for the bases an indexed name is looked up with
+ * and then up to the name.
+ */
+static const char *get_unit_name(const unsigned char *info, uint64_t info_size, uint64_t offset,
+                                 abbrev_cache_t *abbrevs, debug_strings_t *strings, uint64_t *length)
+{
+    abbrev_table_t *table;
+    debug_strings_t unit_strings = *strings;
+    unit_header_t unit;
+    die_reader_t reader;
+    die_t die;
+
+
+    if(!read_unit_header(info, info_size, offset, &unit) || (table = get_abbrev_table(abbrevs, unit.abbrev_offset)) == NULL)
+    {
+        return NULL;
+    }
+
+    read_unit_bases(info, &unit, table, &unit_strings);
+    init_die_reader(&reader, info, &unit, table);
+
+    if(read_die(&reader, &die) != DIE_OK || die.abbrev == NULL)
+    {
+        return NULL;
+    }
+
+    for(uint32_t i = 0; i < die.abbrev->num_attributes; i++)
+    {
+        attribute_value_t value;
+
+        if(die.abbrev->attributes[i].name == DW_AT_name)
+        {
+            return read_attribute(&reader, &die.abbrev->attributes[i], &value) ? get_attribute_string(&value, &unit_strings, length) : NULL;
+        }
+
+        if(!skip_attributes(&reader, &die.abbrev->attributes[i], 1))
+        {
+            return NULL;
+        }
+    }
+
+    return NULL;
+}
+
+
+
+/*
+ * Reads addresses from standard input until it runs out and
+ * prints the unit of .debug_info covering each one, found
+ * through .debug_aranges without reading .debug_info: the
+ * unit's offset, then its name where it has one, or ?? if no
+ * unit covers the address.
+ */
+int resolve_unit_addresses(elf_session_t *session, output_t *output)
+{
+    range_index_t *index;
+    abbrev_cache_t *abbrevs;
+    debug_strings_t strings;
+    unsigned char *info;
+    uint64_t info_size;
+    input_t input;
+    string_view_t token;
+
+
+    if((index = get_session_unit_address_index(session)) == NULL)
+    {
+        fprintf(stderr, "No .debug_aranges section to find units by address with.\n");
+        return RET_NOT_OK;
+    }
+
+    info = get_session_named_section(session, ".debug_info", &info_size, NULL);
+    abbrevs = get_session_abbrev_cache(session);
+    get_debug_strings(session, &strings);
+
+
+    init_input(&input, STDIN_FILENO);
+
+    while(read_token(&input, &token))
+    {
+        const char *name = NULL;
+        uint64_t address, length;
+        int64_t range;
+
+        if(!parse_address(token, &address))
+        {
+            append_bytes(output, token.string, token.length);
+            append_string(output, "\tinvalid address\n");
+            continue;
+        }
+
+        append_string(output, "0x");
+        append_hex(output, address, 0);
+        append_char(output, '\t');
+
+        if((range = find_range(index, address)) < 0)
+        {
+            append_string(output, "??\n");
+            continue;
+        }
+
+        append_string(output, "0x");
+        append_hex(output, index->payloads[range], 0);
+
+        if(info != NULL && abbrevs != NULL)
+        {
+            name = get_unit_name(info, info_size, index->payloads[range], abbrevs, &strings, &length);
+        }
+
+        if(name != NULL)
+        {
+            append_char(output, '\t');
+            append_bytes(output, name, length);
+        }
+
+        append_char(output, '\n');
+    }
+
+    release_input(&input);
+
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Appends the line for an address whose FDE has been found:
+ * the address, the offset of the FDE in its section, and the
+ * range the FDE covers.
+ */
+static void append_fde_match(output_t *output, uint64_t address, uint64_t fde_offset, uint64_t start, uint64_t end)
+{
+    append_string(output, "0x");
+    append_hex(output, address, 0);
+    append_string(output, "\t0x");
+    append_hex(output, fde_offset, 0);
+    append_string(output, "\t0x");
+    append_hex(output, start, 0);
+    append_string(output, "..0x");
+    append_hex(output, end, 0);
+    append_char(output, '\n');
+}
+
+
+
+/*
+ * Finds the FDE covering an address through the search table of
+ * .eh_frame_hdr, reading only the one FDE the table leads to, to
+ * check that its range does cover the address.
+ */
+static bool find_fde_through_header(eh_frame_hdr_t *header, frame_section_t *eh_frame, cie_t *cie,
+                                    uint64_t address, fde_t *fde)
+{
+    uint64_t fde_address;
+
+
+    if(find_eh_frame_hdr_entry(header, address, &fde_address) < 0 ||
+       fde_address < eh_frame->address || fde_address - eh_frame->address >= eh_frame->size)
+    {
+        return false;
+    }
+
+    if(!read_fde(eh_frame, fde_address - eh_frame->address, cie, fde))
+    {
+        return false;
+    }
+
+    return address >= fde->pc_begin && address - fde->pc_begin < fde->pc_range;
+}
+
+
+
+/*
+ * Finds the FDE covering each of a comma-separated list of
+ * addresses and prints it, or ?? if none covers the address.
+ *
+ * When the file has an .eh_frame_hdr with a search table, the
+ * table is binary-searched where it is in the mapped file, so
+ * nothing has to be set up however big .eh_frame is. Otherwise
+ * the session's index of the FDEs of .eh_frame (or of
+ * .debug_frame, when there is no .eh_frame) is built and
+ * searched instead. The line before the results says which.
+ */
+int find_fdes(elf_session_t *session, output_t *output, char *addresses)
+{
+    frame_section_t header_section, eh_frame;
+    eh_frame_hdr_t header;
+    range_index_t *index = NULL;
+    bool use_header = false;
+    bool is_eh_frame = true;
+    char *token = addresses;
+    cie_t cie;
+    fde_t fde;
+
+
+    if(session->file_class != ELFCLASS32 && session->file_class != ELFCLASS64)
+    {
+        append_string(output, "ELF file has no class.\n");
+        return RET_NOT_OK;
+    }
+
+    header_section.is_eh_frame = true;
+    header_section.address_size = (session->file_class == ELFCLASS32) ? 4 : 8;
+    header_section.data = get_session_named_section(session, ".eh_frame_hdr", &header_section.size, &header_section.address);
+
+    if(header_section.data != NULL && get_session_frame_section(session, true, &eh_frame))
+    {
+        use_header = read_eh_frame_hdr(&header_section, &header);
+    }
+
+    if(!use_header)
+    {
+        if((index = get_session_fde_index(session, true)) == NULL)
+        {
+            is_eh_frame = false;
+            index = get_session_fde_index(session, false);
+        }
+
+        if(index == NULL)
+        {
+            fprintf(stderr, "No .eh_frame or .debug_frame section to find FDEs in.\n");
+            return RET_NOT_OK;
+        }
+    }
+
+
+    if(use_header)
+        append_string(output, "FDEs found through the search table of .eh_frame_hdr:\n");
+    else
+        append_string(output, is_eh_frame ? "FDEs found through an index of .eh_frame:\n" : "FDEs found through an index of .debug_frame:\n");
+
+    cie.end_offset = 0;
+
+    while(*token != '\0')
+    {
+        size_t length = strcspn(token, ",");
+        string_view_t address_string = {token, length};
+        uint64_t address;
+        int64_t entry;
+
+        if(length > 0)
+        {
+            if(!parse_address(address_string, &address))
+            {
+                append_bytes(output, token, length);
+                append_string(output, "\tinvalid address\n");
+            }
+            else if(use_header && find_fde_through_header(&header, &eh_frame, &cie, address, &fde))
+            {
+                append_fde_match(output, address, fde.offset, fde.pc_begin, fde.pc_begin + fde.pc_range);
+            }
+            else if(!use_header && (entry = find_range(index, address)) >= 0)
+            {
+                append_fde_match(output, address, index->payloads[entry], index->starts[entry], index->ends[entry]);
+            }
+            else
+            {
+                append_string(output, "0x");
+                append_hex(output, address, 0);
+                append_string(output, "\t??\n");
+            }
+        }
+
+        token += length;
+
+        if(*token == ',')
+            token++;
+    }
+
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Looks up each of a comma-separated list of names in every
+ * name index of .debug_names and prints each DIE with the name:
+ * its offset in .debug_info and its tag, or ?? if there is no
+ * DIE with the name. Only the hash table of each index and the
+ * entries of the name are read, never .debug_info itself. DIEs
+ * in type units of other files are left out.
+ */
+int find_debug_names(elf_session_t *session, output_t *output, char *names)
+{
+    names_index_t *index;
+    const unsigned char *str;
+    uint64_t str_size;
+    char *name = names;
+
+
+    if((index = get_session_names_index(session)) == NULL)
+    {
+        fprintf(stderr, "No .debug_names section to find names in.\n");
+        return RET_NOT_OK;
+    }
+
+    str = get_session_named_section(session, ".debug_str", &str_size, NULL);
+
+
+    while(*name != '\0')
+    {
+        size_t length = strcspn(name, ",");
+        bool found = false;
+
+        for(uint64_t i = 0; i < index->num_tables && length > 0; i++)
+        {
+            names_table_t *table = &index->tables[i];
+            int64_t number = find_debug_name(table, str, str_size, name, length);
+            const unsigned char *position;
+            uint64_t entry_offset, die_offset;
+            names_entry_t entry;
+
+            if(number < 0)
+                continue;
+
+            entry_offset = get_names_table_value(table, table->entry_offsets, number - 1, table->offset_size);
+
+            if(entry_offset >= (uint64_t) (table->end - table->entry_pool))
+                continue;
+
+            position = table->entry_pool + entry_offset;
+
+            while(read_names_entry(table, &position, &entry) && entry.abbrev != NULL)
+            {
+                if(get_names_entry_die(table, &entry, &die_offset))
+                {
+                    stringify_debug_name_match(output, name, length, die_offset, entry.abbrev->tag);
+                    found = true;
+                }
+            }
+        }
+
+        if(length > 0 && !found)
+        {
+            append_bytes(output, name, length);
+            append_string(output, "\t??\n");
+        }
+
+        name += length;
+
+        if(*name == ',')
+            name++;
+    }
+
+
+    return RET_OK;
+}
@@ -0,0 +1,1423 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Implementation file for decoding DWARF debugging information
+ * straight out of the mapped debugging sections.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#include "debug.h"
+
+
+
+
+/*
+ * Reads an unsigned LEB128 number, moving position past it.
+ * Returns false if the number runs past end. Bits beyond the
+ * 64 that fit in the result are dropped.
+ */
+bool read_uleb128(const unsigned char **position, const unsigned char *end, uint64_t *value)
+{
+    const unsigned char *byte = *position;
+    uint64_t result = 0;
+    int shift = 0;
+
+
+    while(byte < end)
+    {
+        if(shift < 64)
+        {
+            result |= (uint64_t) (*byte & 0x7f) << shift;
+        }
+
+        shift += 7;
+
+        if((*byte++ & 0x80) == 0)
+        {
+            *position = byte;
+            *value = result;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+
+/*
+ * Reads a signed LEB128 number, moving position past it.
+ */
+bool read_sleb128(const unsigned char **position, const unsigned char *end, int64_t *value)
+{
+    const unsigned char *byte = *position;
+    uint64_t result = 0;
+    int shift = 0;
+
+
+    while(byte < end)
+    {
+        unsigned char current = *byte++;
+
+        if(shift < 64)
+        {
+            result |= (uint64_t) (current & 0x7f) << shift;
+        }
+
+        shift += 7;
+
+        if((current & 0x80) == 0)
+        {
+            // extend the sign bit of the last byte
+            if(shift < 64 && (current & 0x40))
+            {
+                result |= ~(uint64_t) 0 << shift;
+            }
+
+            *position = byte;
+            *value = (int64_t) result;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+
+
+/*
+ * Reads an unsigned LEB128 number the way the DIE reader does.
+ * Nearly every one in .debug_info (abbreviation codes, small
+ * constants, indices) fits in one or two bytes, and those are
+ * decoded without branching on the bytes themselves: the
+ * second byte is masked in only if the first one continues.
+ * Anything longer, or too close to the end, goes the slow way.
+ */
+static inline bool read_short_uleb128(const unsigned char **position, const unsigned char *end, uint64_t *value)
+{
+    const unsigned char *byte = *position;
+
+
+    if(__builtin_expect(end - byte >= 2 && (byte[0] & byte[1] & 0x80) == 0, 1))
+    {
+        uint64_t continued = byte[0] >> 7;
+
+        *value = (byte[0] & 0x7f) | (((uint64_t) (byte[1] & 0x7f) << 7) & -continued);
+        *position = byte + 1 + continued;
+        return true;
+    }
+
+    return read_uleb128(position, end, value);
+}
+
+
+
+/*
+ * Reads an unsigned number of the given size in bytes, which
+ * like the rest of the file is taken to be in host byte order.
+ */
+bool read_unsigned(const unsigned char **position, const unsigned char *end, int size, uint64_t *value)
+{
+    uint8_t value8;
+    uint16_t value16;
+    uint32_t value32;
+
+
+    if(end - *position < size)
+    {
+        return false;
+    }
+
+    switch(size)
+    {
+        case 1:
+            memcpy(&value8, *position, 1);
+            *value = value8;
+            break;
+
+        case 2:
+            memcpy(&value16, *position, 2);
+            *value = value16;
+            break;
+
+        case 4:
+            memcpy(&value32, *position, 4);
+            *value = value32;
+            break;
+
+        case 8:
+            memcpy(value, *position, 8);
+            break;
+
+        default:
+            *value = 0;
+            memcpy(value, *position, size);
+            break;
+    }
+
+    *position += size;
+    return true;
+}
+
+
+
+/*
+ * Spreads abbreviation codes and table offsets over the slots
+ * of the open-addressing tables below.
+ */
+static uint64_t hash_key(uint64_t key)
+{
+    return (key * 0x9e3779b97f4a7c15ULL) >> 32;
+}
+
+
+
+/*
+ * Reads the header of one abbreviation (its code, tag and
+ * children flag) and counts its attribute specifications,
+ * leaving position just past them. A code of 0 ends the set.
+ * Returns false if the section ends in the middle.
+ */
+static bool scan_abbrev(const unsigned char **position, const unsigned char *end, uint64_t *code, uint64_t *num_attributes)
+{
+    uint64_t tag, name, form;
+    int64_t implicit_const;
+
+
+    *num_attributes = 0;
+
+    if(!read_uleb128(position, end, code))
+    {
+        return false;
+    }
+
+    if(*code == 0)
+    {
+        return true;
+    }
+
+    if(!read_uleb128(position, end, &tag) || *position >= end)
+    {
+        return false;
+    }
+
+    (*position)++;
+
+    for(;;)
+    {
+        if(!read_uleb128(position, end, &name) || !read_uleb128(position, end, &form))
+        {
+            return false;
+        }
+
+        if(name == 0 && form == 0)
+        {
+            return true;
+        }
+
+        if(form == DW_FORM_implicit_const && !read_sleb128(position, end, &implicit_const))
+        {
+            return false;
+        }
+
+        (*num_attributes)++;
+    }
+}
+
+
+
+/*
+ * Reads the set of abbreviations starting at the given offset
+ * of .debug_abbrev. The set is walked twice, first to count the
+ * abbreviations and attribute specifications so that they can
+ * be stored in two arrays, then to fill them in. Returns NULL if
+ * the set runs past the end of the section.
+ */
+abbrev_table_t *parse_abbrev_table(const unsigned char *section, uint64_t section_size, uint64_t offset)
+{
+    const unsigned char *end = section + section_size;
+    const unsigned char *position;
+    abbrev_table_t *table;
+    uint64_t num_attributes = 0;
+    uint64_t max_code = 0;
+
+
+    if(offset >= section_size)
+    {
+        return NULL;
+    }
+
+    if((table = (abbrev_table_t*) calloc(1, sizeof(abbrev_table_t))) == NULL)
+    {
+        return NULL;
+    }
+
+    table->offset = offset;
+
+
+    // count the abbreviations
+    position = section + offset;
+
+    for(;;)
+    {
+        uint64_t code, count;
+
+        if(!scan_abbrev(&position, end, &code, &count))
+        {
+            free(table);
+            return NULL;
+        }
+
+        if(code == 0)
+        {
+            break;
+        }
+
+        table->num_abbrevs++;
+        num_attributes += count;
+        max_code = (code > max_code) ? code : max_code;
+    }
+
+    table->end_offset = position - section;
+    table->abbrevs = (abbrev_t*) malloc((table->num_abbrevs + 1) * sizeof(abbrev_t));
+    table->attributes = (abbrev_attribute_t*) malloc((num_attributes + 1) * sizeof(abbrev_attribute_t));
+
+
+    // read them, now that they are known to be in the section
+    position = section + offset;
+    num_attributes = 0;
+
+    for(uint64_t i = 0; i < table->num_abbrevs; i++)
+    {
+        abbrev_t *abbrev = &table->abbrevs[i];
+        uint64_t tag = 0;
+
+        read_uleb128(&position, end, &abbrev->code);
+        read_uleb128(&position, end, &tag);
+
+        abbrev->tag = (uint32_t) tag;
+        abbrev->has_children = (*position++ == DW_CHILDREN_yes);
+        abbrev->attributes = &table->attributes[num_attributes];
+        abbrev->num_attributes = 0;
+
+        for(;;)
+        {
+            abbrev_attribute_t *attribute = &table->attributes[num_attributes];
+            uint64_t name = 0, form = 0;
+
+            read_uleb128(&position, end, &name);
+            read_uleb128(&position, end, &form);
+
+            if(name == 0 && form == 0)
+            {
+                break;
+            }
+
+            attribute->name = (uint32_t) name;
+            attribute->form = (uint32_t) form;
+            attribute->implicit_const = 0;
+
+            if(form == DW_FORM_implicit_const)
+            {
+                read_sleb128(&position, end, &attribute->implicit_const);
+            }
+
+            abbrev->num_attributes++;
+            num_attributes++;
+        }
+    }
+
+
+    /*
+     * Index the abbreviations by code. If a code is used twice,
+     * the first abbreviation with it is the one found.
+     */
+    if(max_code < 2*table->num_abbrevs + 64)
+    {
+        table->num_codes = max_code + 1;
+        table->by_code = (abbrev_t**) calloc(table->num_codes, sizeof(abbrev_t*));
+
+        for(uint64_t i = table->num_abbrevs; i > 0; i--)
+        {
+            table->by_code[table->abbrevs[i - 1].code] = &table->abbrevs[i - 1];
+        }
+    }
+    else
+    {
+        uint64_t num_slots = 16;
+
+        while(num_slots < 2*table->num_abbrevs)
+        {
+            num_slots *= 2;
+        }
+
+        table->slot_mask = num_slots - 1;
+        table->slots = (abbrev_t**) calloc(num_slots, sizeof(abbrev_t*));
+
+        for(uint64_t i = 0; i < table->num_abbrevs; i++)
+        {
+            uint64_t slot = hash_key(table->abbrevs[i].code) & table->slot_mask;
+
+            while(table->slots[slot] != NULL && table->slots[slot]->code != table->abbrevs[i].code)
+            {
+                slot = (slot + 1) & table->slot_mask;
+            }
+
+            if(table->slots[slot] == NULL)
+            {
+                table->slots[slot] = &table->abbrevs[i];
+            }
+        }
+    }
+
+    return table;
+}
+
+
+
+void release_abbrev_table(abbrev_table_t *table)
+{
+    if(table == NULL)
+    {
+        return;
+    }
+
+    free(table->abbrevs);
+    free(table->attributes);
+    free(table->by_code);
+    free(table->slots);
+    free(table);
+}
+
+
+
+/*
+ * Returns the abbreviation with the given code, or NULL if
+ * there is none in the table.
+ */
+abbrev_t *find_abbrev(abbrev_table_t *table, uint64_t code)
+{
+    if(code < table->num_codes)
+    {
+        return table->by_code[code];
+    }
+
+    if(table->slots == NULL)
+    {
+        return NULL;
+    }
+
+    for(uint64_t slot = hash_key(code) & table->slot_mask; table->slots[slot] != NULL; slot = (slot + 1) & table->slot_mask)
+    {
+        if(table->slots[slot]->code == code)
+        {
+            return table->slots[slot];
+        }
+    }
+
+    return NULL;
+}
+
+
+
+
+abbrev_cache_t *create_abbrev_cache(const unsigned char *section, uint64_t section_size)
+{
+    abbrev_cache_t *cache;
+
+
+    if((cache = (abbrev_cache_t*) calloc(1, sizeof(abbrev_cache_t))) == NULL)
+    {
+        return NULL;
+    }
+
+    pthread_mutex_init(&cache->lock, NULL);
+
+    cache->section = section;
+    cache->section_size = section_size;
+    cache->slot_mask = 15;
+    cache->slots = (abbrev_table_t**) calloc(cache->slot_mask + 1, sizeof(abbrev_table_t*));
+
+    return cache;
+}
+
+
+
+void release_abbrev_cache(abbrev_cache_t *cache)
+{
+    if(cache == NULL)
+    {
+        return;
+    }
+
+    for(uint64_t slot = 0; slot <= cache->slot_mask; slot++)
+    {
+        release_abbrev_table(cache->slots[slot]);
+    }
+
+    pthread_mutex_destroy(&cache->lock);
+    free(cache->slots);
+    free(cache);
+}
+
+
+
+/*
+ * Returns the slot of the table at the given offset, or the
+ * empty slot where it would go. The cache must be locked.
+ */
+static uint64_t find_cache_slot(abbrev_cache_t *cache, uint64_t offset)
+{
+    uint64_t slot = hash_key(offset) & cache->slot_mask;
+
+    while(cache->slots[slot] != NULL && cache->slots[slot]->offset != offset)
+    {
+        slot = (slot + 1) & cache->slot_mask;
+    }
+
+    return slot;
+}
+
+
+
+/*
+ * Doubles the number of slots, rehashing the tables into them.
+ * The cache must be locked.
+ */
+static void grow_abbrev_cache(abbrev_cache_t *cache)
+{
+    abbrev_table_t **old_slots = cache->slots;
+    uint64_t old_num_slots = cache->slot_mask + 1;
+
+
+    cache->slot_mask = 2*old_num_slots - 1;
+    cache->slots = (abbrev_table_t**) calloc(2*old_num_slots, sizeof(abbrev_table_t*));
+
+    for(uint64_t slot = 0; slot < old_num_slots; slot++)
+    {
+        if(old_slots[slot] != NULL)
+        {
+            cache->slots[find_cache_slot(cache, old_slots[slot]->offset)] = old_slots[slot];
+        }
+    }
+
+    free(old_slots);
+}
+
+
+
+/*
+ * Returns the abbreviation table at the given offset of
+ * .debug_abbrev, parsing it the first time it is asked for.
+ * The parsing is done without the lock held, so threads
+ * decoding different units do not wait on each other; if two
+ * of them parse the same table at once, the second copy is
+ * thrown away. Returns NULL if the table is corrupt.
+ */
+abbrev_table_t *get_abbrev_table(abbrev_cache_t *cache, uint64_t offset)
+{
+    abbrev_table_t *table;
+    uint64_t slot;
+
+
+    pthread_mutex_lock(&cache->lock);
+    table = cache->slots[find_cache_slot(cache, offset)];
+    pthread_mutex_unlock(&cache->lock);
+
+    if(table != NULL)
+    {
+        return table;
+    }
+
+    if((table = parse_abbrev_table(cache->section, cache->section_size, offset)) == NULL)
+    {
+        return NULL;
+    }
+
+
+    pthread_mutex_lock(&cache->lock);
+
+    slot = find_cache_slot(cache, offset);
+
+    if(cache->slots[slot] != NULL)
+    {
+        release_abbrev_table(table);
+        table = cache->slots[slot];
+    }
+    else
+    {
+        cache->slots[slot] = table;
+        cache->num_tables++;
+
+        if(2*cache->num_tables > cache->slot_mask + 1)
+        {
+            grow_abbrev_cache(cache);
+        }
+    }
+
+    pthread_mutex_unlock(&cache->lock);
+
+    return table;
+}
+
+
+
+
+
+/*
+ * Size of each form, for skipping attributes, where it does not
+ * depend on the value. Sizes that depend on the unit are filled
+ * in by init_die_reader from these markers.
+ */
+#define FORM_SIZE_ADDRESS       -2
+#define FORM_SIZE_OFFSET        -3
+#define FORM_SIZE_REF_ADDR      -4
+
+
+static const int8_t form_sizes[NUM_DWARF_FORMS] = {
+    [0] = FORM_SIZE_VARIABLE,
+    [DW_FORM_addr] = FORM_SIZE_ADDRESS,
+    [0x02] = FORM_SIZE_VARIABLE,
+    [DW_FORM_block2] = FORM_SIZE_VARIABLE,
+    [DW_FORM_block4] = FORM_SIZE_VARIABLE,
+    [DW_FORM_data2] = 2,
+    [DW_FORM_data4] = 4,
+    [DW_FORM_data8] = 8,
+    [DW_FORM_string] = FORM_SIZE_VARIABLE,
+    [DW_FORM_block] = FORM_SIZE_VARIABLE,
+    [DW_FORM_block1] = FORM_SIZE_VARIABLE,
+    [DW_FORM_data1] = 1,
+    [DW_FORM_flag] = 1,
+    [DW_FORM_sdata] = FORM_SIZE_VARIABLE,
+    [DW_FORM_strp] = FORM_SIZE_OFFSET,
+    [DW_FORM_udata] = FORM_SIZE_VARIABLE,
+    [DW_FORM_ref_addr] = FORM_SIZE_REF_ADDR,
+    [DW_FORM_ref1] = 1,
+    [DW_FORM_ref2] = 2,
+    [DW_FORM_ref4] = 4,
+    [DW_FORM_ref8] = 8,
+    [DW_FORM_ref_udata] = FORM_SIZE_VARIABLE,
+    [DW_FORM_indirect] = FORM_SIZE_VARIABLE,
+    [DW_FORM_sec_offset] = FORM_SIZE_OFFSET,
+    [DW_FORM_exprloc] = FORM_SIZE_VARIABLE,
+    [DW_FORM_flag_present] = 0,
+    [DW_FORM_strx] = FORM_SIZE_VARIABLE,
+    [DW_FORM_addrx] = FORM_SIZE_VARIABLE,
+    [DW_FORM_ref_sup4] = 4,
+    [DW_FORM_strp_sup] = FORM_SIZE_OFFSET,
+    [DW_FORM_data16] = 16,
+    [DW_FORM_line_strp] = FORM_SIZE_OFFSET,
+    [DW_FORM_ref_sig8] = 8,
+    [DW_FORM_implicit_const] = 0,
+    [DW_FORM_loclistx] = FORM_SIZE_VARIABLE,
+    [DW_FORM_rnglistx] = FORM_SIZE_VARIABLE,
+    [DW_FORM_ref_sup8] = 8,
+    [DW_FORM_strx1] = 1,
+    [DW_FORM_strx2] = 2,
+    [DW_FORM_strx3] = 3,
+    [DW_FORM_strx4] = 4,
+    [DW_FORM_addrx1] = 1,
+    [DW_FORM_addrx2] = 2,
+    [DW_FORM_addrx3] = 3,
+    [DW_FORM_addrx4] = 4
+};
+
+
+
+/*
+ * Reads the header of the unit at the given offset of
+ * .debug_info. Returns false if the header is cut short, the
+ * unit runs past the end of the section, or the version is
+ * not one from 2 to 5.
+ */
+bool read_unit_header(const unsigned char *section, uint64_t section_size, uint64_t offset, unit_header_t *unit)
+{
+    const unsigned char *position = section + offset;
+    const unsigned char *end = section + section_size;
+    uint64_t value;
+
+
+    memset(unit, 0, sizeof(unit_header_t));
+    unit->offset = offset;
+
+    if(offset >= section_size || !read_unsigned(&position, end, 4, &unit->length))
+    {
+        return false;
+    }
+
+    unit->offset_size = 4;
+
+    if(unit->length == 0xffffffff)
+    {
+        unit->offset_size = 8;
+
+        if(!read_unsigned(&position, end, 8, &unit->length))
+        {
+            return false;
+        }
+    }
+    else if(unit->length >= 0xfffffff0)
+    {
+        return false;
+    }
+
+    if(unit->length > (uint64_t) (end - position))
+    {
+        return false;
+    }
+
+    end = position + unit->length;
+    unit->end_offset = end - section;
+
+    if(!read_unsigned(&position, end, 2, &value) || value < 2 || value > 5)
+    {
+        return false;
+    }
+
+    unit->version = (uint16_t) value;
+
+
+    // DWARF 5 moved the address size before the abbreviation offset
+    if(unit->version >= 5)
+    {
+        if(!read_unsigned(&position, end, 1, &value))
+        {
+            return false;
+        }
+
+        unit->unit_type = (uint8_t) value;
+
+        if(!read_unsigned(&position, end, 1, &value) ||
+           !read_unsigned(&position, end, unit->offset_size, &unit->abbrev_offset))
+        {
+            return false;
+        }
+
+        unit->address_size = (uint8_t) value;
+    }
+    else
+    {
+        unit->unit_type = DW_UT_compile;
+
+        if(!read_unsigned(&position, end, unit->offset_size, &unit->abbrev_offset) ||
+           !read_unsigned(&position, end, 1, &value))
+        {
+            return false;
+        }
+
+        unit->address_size = (uint8_t) value;
+    }
+
+    switch(unit->unit_type)
+    {
+        case DW_UT_skeleton:
+        case DW_UT_split_compile:
+            if(!read_unsigned(&position, end, 8, &unit->dwo_id))
+            {
+                return false;
+            }
+
+            break;
+
+        case DW_UT_type:
+        case DW_UT_split_type:
+            if(!read_unsigned(&position, end, 8, &unit->type_signature) ||
+               !read_unsigned(&position, end, unit->offset_size, &unit->type_offset))
+            {
+                return false;
+            }
+
+            break;
+    }
+
+    if(unit->address_size != 4 && unit->address_size != 8)
+    {
+        return false;
+    }
+
+    unit->die_offset = position - section;
+
+    return true;
+}
+
+
+
+/*
+ * Finds every unit of .debug_info by reading only their headers,
+ * each of which gives where the next unit starts, and returns
+ * them in an array the caller frees. Stops at the first header
+ * that is corrupt; the caller can tell that happened from the
+ * last unit ending short of the end of the section.
+ */
+uint64_t read_unit_headers(const unsigned char *section, uint64_t section_size, unit_header_t **units)
+{
+    uint64_t num_units = 0;
+    uint64_t capacity = 64;
+    uint64_t offset = 0;
+
+
+    *units = (unit_header_t*) malloc(capacity * sizeof(unit_header_t));
+
+    while(offset < section_size)
+    {
+        if(num_units == capacity)
+        {
+            capacity *= 2;
+            *units = (unit_header_t*) realloc(*units, capacity * sizeof(unit_header_t));
+        }
+
+        if(!read_unit_header(section, section_size, offset, &(*units)[num_units]))
+        {
+            break;
+        }
+
+        offset = (*units)[num_units++].end_offset;
+    }
+
+    return num_units;
+}
+
+
+
+/*
+ * Sets a reader up at the first DIE of a unit, working out
+ * the sizes of the forms that depend on the unit.
+ */
+void init_die_reader(die_reader_t *reader, const unsigned char *section, unit_header_t *unit, abbrev_table_t *abbrevs)
+{
+    reader->section = section;
+    reader->position = section + unit->die_offset;
+    reader->end = section + unit->end_offset;
+    reader->unit = unit;
+    reader->abbrevs = abbrevs;
+    reader->depth = 0;
+
+    for(int form = 0; form < NUM_DWARF_FORMS; form++)
+    {
+        switch(form_sizes[form])
+        {
+            case FORM_SIZE_ADDRESS:
+                reader->form_sizes[form] = unit->address_size;
+                break;
+
+            case FORM_SIZE_OFFSET:
+                reader->form_sizes[form] = unit->offset_size;
+                break;
+
+            // DWARF 2 made references to other units address-sized
+            case FORM_SIZE_REF_ADDR:
+                reader->form_sizes[form] = (unit->version <= 2) ? unit->address_size : unit->offset_size;
+                break;
+
+            default:
+                reader->form_sizes[form] = form_sizes[form];
+                break;
+        }
+    }
+}
+
+
+
+/*
+ * Reads the abbreviation code of the next DIE. A code of 0 is a
+ * null entry, which ends the children of the DIE before it at
+ * one less depth; it is returned as a DIE with no abbreviation.
+ * Returns DIE_END_OF_UNIT once the unit is used up.
+ */
+die_status_t read_die(die_reader_t *reader, die_t *die)
+{
+    uint64_t code;
+
+
+    if(reader->position >= reader->end)
+    {
+        return DIE_END_OF_UNIT;
+    }
+
+    die->offset = reader->position - reader->section;
+    die->depth = reader->depth;
+
+    if(!read_short_uleb128(&reader->position, reader->end, &code))
+    {
+        return DIE_CORRUPT;
+    }
+
+    if(code == 0)
+    {
+        die->abbrev = NULL;
+
+        if(reader->depth > 0)
+        {
+            reader->depth--;
+        }
+
+        return DIE_OK;
+    }
+
+    if((die->abbrev = find_abbrev(reader->abbrevs, code)) == NULL)
+    {
+        return DIE_CORRUPT;
+    }
+
+    if(die->abbrev->has_children)
+    {
+        reader->depth++;
+    }
+
+    return DIE_OK;
+}
+
+
+
+/*
+ * Reads the value of the next attribute of the current DIE,
+ * whose specification in the abbreviation is given. References
+ * within the unit are turned into offsets in .debug_info.
+ * Returns false if the value runs past the end of the unit or
+ * the form is not known.
+ */
+bool read_attribute(die_reader_t *reader, abbrev_attribute_t *attribute, attribute_value_t *value)
+{
+    const unsigned char **position = &reader->position;
+    const unsigned char *end = reader->end;
+    uint64_t form = attribute->form;
+    int64_t signed_value;
+
+
+    // the form may be given in the DIE instead of the abbreviation
+    while(form == DW_FORM_indirect)
+    {
+        if(!read_short_uleb128(position, end, &form))
+        {
+            return false;
+        }
+    }
+
+    value->name = attribute->name;
+    value->form = (uint32_t) form;
+    value->data = NULL;
+
+    switch(form)
+    {
+        case DW_FORM_addr:
+            return read_unsigned(position, end, reader->unit->address_size, &value->value);
+
+        case DW_FORM_data1:
+        case DW_FORM_flag:
+        case DW_FORM_strx1:
+        case DW_FORM_addrx1:
+            return read_unsigned(position, end, 1, &value->value);
+
+        case DW_FORM_data2:
+        case DW_FORM_strx2:
+        case DW_FORM_addrx2:
+            return read_unsigned(position, end, 2, &value->value);
+
+        case DW_FORM_strx3:
+        case DW_FORM_addrx3:
+            return read_unsigned(position, end, 3, &value->value);
+
+        case DW_FORM_data4:
+        case DW_FORM_strx4:
+        case DW_FORM_addrx4:
+        case DW_FORM_ref_sup4:
+            return read_unsigned(position, end, 4, &value->value);
+
+        case DW_FORM_data8:
+        case DW_FORM_ref_sig8:
+        case DW_FORM_ref_sup8:
+            return read_unsigned(position, end, 8, &value->value);
+
+        case DW_FORM_strp:
+        case DW_FORM_sec_offset:
+        case DW_FORM_line_strp:
+        case DW_FORM_strp_sup:
+        case DW_FORM_GNU_ref_alt:
+        case DW_FORM_GNU_strp_alt:
+        case DW_FORM_ref_addr:
+            return read_unsigned(position, end, reader->form_sizes[(form < NUM_DWARF_FORMS) ? form : DW_FORM_strp], &value->value);
+
+        case DW_FORM_udata:
+        case DW_FORM_strx:
+        case DW_FORM_addrx:
+        case DW_FORM_loclistx:
+        case DW_FORM_rnglistx:
+        case DW_FORM_GNU_addr_index:
+        case DW_FORM_GNU_str_index:
+            return read_short_uleb128(position, end, &value->value);
+
+        case DW_FORM_sdata:
+            if(!read_sleb128(position, end, &signed_value))
+            {
+                return false;
+            }
+
+            value->value = (uint64_t) signed_value;
+            return true;
+
+        case DW_FORM_implicit_const:
+            value->value = (uint64_t) attribute->implicit_const;
+            return true;
+
+        case DW_FORM_flag_present:
+            value->value = 1;
+            return true;
+
+        case DW_FORM_ref1:
+        case DW_FORM_ref2:
+        case DW_FORM_ref4:
+        case DW_FORM_ref8:
+            if(!read_unsigned(position, end, reader->form_sizes[form], &value->value))
+            {
+                return false;
+            }
+
+            value->value += reader->unit->offset;
+            return true;
+
+        case DW_FORM_ref_udata:
+            if(!read_short_uleb128(position, end, &value->value))
+            {
+                return false;
+            }
+
+            value->value += reader->unit->offset;
+            return true;
+
+        case DW_FORM_string:
+        {
+            const unsigned char *terminator = memchr(*position, '\0', end - *position);
+
+            if(terminator == NULL)
+            {
+                return false;
+            }
+
+            value->data = *position;
+            value->value = terminator - *position;
+            *position = terminator + 1;
+            return true;
+        }
+
+        case DW_FORM_block1:
+        case DW_FORM_block2:
+        case DW_FORM_block4:
+        case DW_FORM_block:
+        case DW_FORM_exprloc:
+        case DW_FORM_data16:
+        {
+            bool valid;
+
+            switch(form)
+            {
+                case DW_FORM_block1:
+                    valid = read_unsigned(position, end, 1, &value->value);
+                    break;
+
+                case DW_FORM_block2:
+                    valid = read_unsigned(position, end, 2, &value->value);
+                    break;
+
+                case DW_FORM_block4:
+                    valid = read_unsigned(position, end, 4, &value->value);
+                    break;
+
+                case DW_FORM_data16:
+                    value->value = 16;
+                    valid = true;
+                    break;
+
+                default:
+                    valid = read_short_uleb128(position, end, &value->value);
+                    break;
+            }
+
+            if(!valid || value->value > (uint64_t) (end - *position))
+            {
+                return false;
+            }
+
+            value->data = *position;
+            *position += value->value;
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+
+
+/*
+ * Passes over the next num_attributes attributes of the current
+ * DIE, given by their specifications. Forms of a size known for
+ * the unit are skipped by adding the size; only the others are
+ * decoded.
+ */
+bool skip_attributes(die_reader_t *reader, abbrev_attribute_t *attributes, uint32_t num_attributes)
+{
+    for(uint32_t i = 0; i < num_attributes; i++)
+    {
+        uint32_t form = attributes[i].form;
+        int size = (form < NUM_DWARF_FORMS) ? reader->form_sizes[form] : FORM_SIZE_VARIABLE;
+
+        if(size >= 0)
+        {
+            if(size > reader->end - reader->position)
+            {
+                return false;
+            }
+
+            reader->position += size;
+        }
+        else
+        {
+            attribute_value_t value;
+
+            if(!read_attribute(reader, &attributes[i], &value))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+
+
+
+/*
+ * Returns the string an attribute value holds, inline or in one
+ * of the string sections, and its length. Indexed strings are
+ * looked up through .debug_str_offsets. Returns NULL if the
+ * value is not a string, or is one that cannot be found.
+ */
+const char *get_attribute_string(attribute_value_t *value, debug_strings_t *strings, uint64_t *length)
+{
+    const unsigned char *section;
+    uint64_t section_size;
+    uint64_t offset = value->value;
+
+
+    switch(value->form)
+    {
+        case DW_FORM_string:
+            *length = value->value;
+            return (const char*) value->data;
+
+        case DW_FORM_strx:
+        case DW_FORM_strx1:
+        case DW_FORM_strx2:
+        case DW_FORM_strx3:
+        case DW_FORM_strx4:
+        case DW_FORM_GNU_str_index:
+            if(!get_indexed_string_offset(strings, value->value, &offset))
+            {
+                return NULL;
+            }
+
+            section = strings->str;
+            section_size = strings->str_size;
+            break;
+
+        case DW_FORM_strp:
+            section = strings->str;
+            section_size = strings->str_size;
+            break;
+
+        case DW_FORM_line_strp:
+            section = strings->line_str;
+            section_size = strings->line_str_size;
+            break;
+
+        default:
+            return NULL;
+    }
+
+    if(section == NULL || offset >= section_size)
+    {
+        return NULL;
+    }
+
+    *length = strnlen((const char*) section + offset, section_size - offset);
+    return (const char*) section + offset;
+}
+
+
+
+/*
+ * Fills in where the given unit's entries start in
+ * .debug_str_offsets and .debug_addr, from the DW_AT_str_offsets_base
+ * and DW_AT_addr_base (or DW_AT_GNU_addr_base) attributes of its
+ * unit DIE, and the sizes of those entries. The bases often come
+ * after the attributes that need them, so the unit DIE is read
+ * through for them on its own before anything is printed. Without
+ * them, a DWARF 5 unit's entries start just past the header of
+ * the section (as in a split unit) and a GNU split unit's at the
+ * start of the section.
+ */
+void read_unit_bases(const unsigned char *section, unit_header_t *unit, abbrev_table_t *abbrevs, debug_strings_t *strings)
+{
+    die_reader_t reader;
+    die_t die;
+
+
+    strings->offset_size = unit->offset_size;
+    strings->address_size = unit->address_size;
+
+    // past the unit length, version and padding of the section headers
+    strings->str_offsets_base = (unit->version >= 5) ? 2*unit->offset_size : 0;
+    strings->addr_base = strings->str_offsets_base;
+
+    init_die_reader(&reader, section, unit, abbrevs);
+
+    if(read_die(&reader, &die) != DIE_OK || die.abbrev == NULL)
+    {
+        return;
+    }
+
+    for(uint32_t i = 0; i < die.abbrev->num_attributes; i++)
+    {
+        attribute_value_t value;
+
+        if(!read_attribute(&reader, &die.abbrev->attributes[i], &value))
+        {
+            return;
+        }
+
+        switch(value.name)
+        {
+            case DW_AT_str_offsets_base:
+                strings->str_offsets_base = value.value;
+                break;
+
+            case DW_AT_addr_base:
+            case DW_AT_GNU_addr_base:
+                strings->addr_base = value.value;
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+
+
+/*
+ * Reads entry index of the current unit's entries in a section
+ * of equally sized entries, such as .debug_str_offsets. Returns
+ * false if the section is missing or the entry lies outside it.
+ */
+static bool read_indexed_entry(const unsigned char *section, uint64_t section_size, uint64_t base,
+                               int entry_size, uint64_t index, uint64_t *value)
+{
+    const unsigned char *position;
+
+
+    if(section == NULL || entry_size == 0 || base > section_size || index >= (section_size - base) / entry_size)
+    {
+        return false;
+    }
+
+    position = section + base + index*entry_size;
+
+    return read_unsigned(&position, section + section_size, entry_size, value);
+}
+
+
+
+/*
+ * Looks the offset in .debug_str of an indexed string up in
+ * .debug_str_offsets.
+ */
+bool get_indexed_string_offset(debug_strings_t *strings, uint64_t index, uint64_t *offset)
+{
+    return read_indexed_entry(strings->str_offsets, strings->str_offsets_size, strings->str_offsets_base,
+                              strings->offset_size, index, offset);
+}
+
+
+
+/*
+ * Looks an indexed address up in .debug_addr.
+ */
+bool get_indexed_address(debug_strings_t *strings, uint64_t index, uint64_t *address)
+{
+    return read_indexed_entry(strings->addr, strings->addr_size, strings->addr_base,
+                              strings->address_size, index, address);
+}
+
+
+
+
+/*
+ * Reads the header of the set of address ranges at the given
+ * offset of .debug_aranges. The ranges start at the first
+ * multiple of twice the address size, counted from the start
+ * of the set. Returns false if the header is cut short or the
+ * set runs past the end of the section.
+ */
+bool read_aranges_header(const unsigned char *section, uint64_t section_size, uint64_t offset, aranges_header_t *header)
+{
+    const unsigned char *position = section + offset;
+    const unsigned char *end = section + section_size;
+    uint64_t value, tuple_size;
+
+
+    memset(header, 0, sizeof(aranges_header_t));
+    header->offset = offset;
+
+    if(offset >= section_size || !read_unsigned(&position, end, 4, &header->length))
+    {
+        return false;
+    }
+
+    header->offset_size = 4;
+
+    if(header->length == 0xffffffff)
+    {
+        header->offset_size = 8;
+
+        if(!read_unsigned(&position, end, 8, &header->length))
+        {
+            return false;
+        }
+    }
+
+    if(header->length > (uint64_t) (end - position))
+    {
+        return false;
+    }
+
+    end = position + header->length;
+    header->end_offset = end - section;
+
+    if(!read_unsigned(&position, end, 2, &value) ||
+       !read_unsigned(&position, end, header->offset_size, &header->info_offset))
+    {
+        return false;
+    }
+
+    header->version = (uint16_t) value;
+
+    if(!read_unsigned(&position, end, 1, &value))
+    {
+        return false;
+    }
+
+    header->address_size = (uint8_t) value;
+
+    if(!read_unsigned(&position, end, 1, &value))
+    {
+        return false;
+    }
+
+    header->segment_size = (uint8_t) value;
+
+    if(header->address_size != 4 && header->address_size != 8)
+    {
+        return false;
+    }
+
+    tuple_size = 2*header->address_size;
+    header->ranges_offset = offset + ((position - (section + offset)) + tuple_size - 1) / tuple_size * tuple_size;
+
+    if(header->ranges_offset > header->end_offset)
+    {
+        header->ranges_offset = header->end_offset;
+    }
+
+    return true;
+}
+
+
+
+/*
+ * Reads the next range of a set, moving position past it (and
+ * past its segment selector, which is ignored). Returns false
+ * once there is not a whole range left before end.
+ */
+bool read_arange(const unsigned char **position, const unsigned char *end, aranges_header_t *header, uint64_t *address, uint64_t *length)
+{
+    if(*position > end || (uint64_t) (end - *position) < (uint64_t) header->segment_size + 2*header->address_size)
+    {
+        return false;
+    }
+
+    *position += header->segment_size;
+
+    read_unsigned(position, end, header->address_size, address);
+    read_unsigned(position, end, header->address_size, length);
+
+    return true;
+}
+
+
+
+/*
+ * Builds the index for finding the unit covering an address from
+ * every set of .debug_aranges, with the offset in .debug_info of
+ * its unit as the payload of each range. Empty ranges (and the
+ * terminating one of each set) are left out, and ranges of the
+ * same unit that touch or overlap are merged, so that there are
+ * as few as possible to search. Where ranges of different units
+ * overlap, which they should not, the one starting first keeps
+ * the addresses in common. The sets are read up to the first
+ * corrupt one. The index must be released with
+ * release_range_index.
+ */
+range_index_t *build_unit_address_index(const unsigned char *section, uint64_t section_size)
+{
+    range_index_t *index;
+    range_t *ranges;
+    uint64_t num_ranges = 0;
+    uint64_t capacity = 64;
+    aranges_header_t header;
+
+
+    ranges = (range_t*) malloc(capacity * sizeof(range_t));
+
+    for(uint64_t offset = 0; offset < section_size && read_aranges_header(section, section_size, offset, &header);
+        offset = header.end_offset)
+    {
+        const unsigned char *position = section + header.ranges_offset;
+        uint64_t address, length;
+
+        while(read_arange(&position, section + header.end_offset, &header, &address, &length))
+        {
+            if(length == 0 || address + length < address)
+            {
+                continue;
+            }
+
+            if(num_ranges == capacity)
+            {
+                capacity *= 2;
+                ranges = (range_t*) realloc(ranges, capacity * sizeof(range_t));
+            }
+
+            ranges[num_ranges].start = address;
+            ranges[num_ranges].end = address + length;
+            ranges[num_ranges].payload = header.info_offset;
+            num_ranges++;
+        }
+    }
+
+    sort_ranges(ranges, num_ranges);
+
+    index = build_range_index(ranges, num_ranges, RANGES_MERGE);
+    free(ranges);
+
+    return index;
+}
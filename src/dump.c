@@ -0,0 +1,836 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Implementation file for dumping the raw contents of a section.
+ * The bytes are turned into hex digits and printable characters
+ * a block at a time by kernels picked once, at runtime, for the
+ * processor the program is running on: AVX2 or SSE2 on x86, and
+ * plain loops everywhere else. The rows are then put together
+ * directly in the output buffer. The string dump uses kernels of
+ * the same kind to find where each string starts and ends, and
+ * copies the strings out in one piece.
+ */
+
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <string.h>
+
+
+#include "dump.h"
+#include "format.h"
+#include "pool.h"
+#include "readelf.h"
+
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define USE_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+
+
+/*
+ * Number of rows converted by each call to the kernels. The hex
+ * digits and characters for a whole block are kept on the stack.
+ */
+#define HEX_DUMP_BLOCK_ROWS     256
+#define HEX_DUMP_BLOCK_SIZE     (HEX_DUMP_BLOCK_ROWS * HEX_DUMP_ROW_SIZE)
+
+
+/*
+ * The longest a row can get: "  0x", a 16 digit address and a
+ * space, four groups of eight hex digits each followed by a space,
+ * the characters and the newline.
+ */
+#define HEX_DUMP_MAX_ROW_LENGTH (4 + 16 + 1 + 4*9 + HEX_DUMP_ROW_SIZE + 1)
+
+
+
+/*
+ * A kernel converts num_bytes bytes into either 2*num_bytes hex
+ * digits or num_bytes characters, in which bytes that are not
+ * printable ASCII are replaced by '.'.
+ */
+typedef void (*dump_kernel_t)(char *destination, const unsigned char *bytes, size_t num_bytes);
+
+
+/*
+ * A scanning kernel returns the offset of the first of num_bytes
+ * bytes in some class, or num_bytes if none of them are. The two
+ * classes are the printable ASCII characters (0x20 to 0x7e) and
+ * the control characters (0x00 to 0x1f, and 0x7f). Bytes from 0x80
+ * up are in neither.
+ */
+typedef size_t (*scan_kernel_t)(const unsigned char *bytes, size_t num_bytes);
+
+
+static dump_kernel_t hex_kernel;
+static dump_kernel_t text_kernel;
+static scan_kernel_t find_printable;
+static scan_kernel_t find_control;
+static pthread_once_t kernels_chosen = PTHREAD_ONCE_INIT;
+
+
+
+
+static void scalar_hex_kernel(char *destination, const unsigned char *bytes, size_t num_bytes)
+{
+    format_hex_bytes(destination, bytes, num_bytes);
+}
+
+
+
+static void scalar_text_kernel(char *destination, const unsigned char *bytes, size_t num_bytes)
+{
+    for(size_t i = 0; i < num_bytes; i++)
+    {
+        destination[i] = (bytes[i] >= 0x20 && bytes[i] < 0x7f) ? bytes[i] : '.';
+    }
+}
+
+
+
+static size_t scalar_find_printable(const unsigned char *bytes, size_t num_bytes)
+{
+    size_t i = 0;
+
+    while(i < num_bytes && (bytes[i] < 0x20 || bytes[i] >= 0x7f))
+    {
+        i++;
+    }
+
+    return i;
+}
+
+
+
+static size_t scalar_find_control(const unsigned char *bytes, size_t num_bytes)
+{
+    size_t i = 0;
+
+    while(i < num_bytes && bytes[i] >= 0x20 && bytes[i] != 0x7f)
+    {
+        i++;
+    }
+
+    return i;
+}
+
+
+
+#ifdef USE_X86_KERNELS
+
+/*
+ * The SSE2 kernels. Each byte is split into its two nibbles, the
+ * nibbles are interleaved high first, and each nibble becomes
+ * '0' + nibble, plus the distance from '9' + 1 to 'a' when it is
+ * above 9. Whatever is left over at the end is done by the scalar
+ * kernels.
+ */
+__attribute__((target("sse2")))
+static void sse2_hex_kernel(char *destination, const unsigned char *bytes, size_t num_bytes)
+{
+    const __m128i low_nibble = _mm_set1_epi8(0x0f);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i letter_offset = _mm_set1_epi8('a' - '0' - 10);
+    size_t i = 0;
+
+
+    for(; i + 16 <= num_bytes; i += 16)
+    {
+        __m128i data = _mm_loadu_si128((const __m128i *) (bytes + i));
+        __m128i high = _mm_and_si128(_mm_srli_epi16(data, 4), low_nibble);
+        __m128i low = _mm_and_si128(data, low_nibble);
+
+        __m128i first = _mm_unpacklo_epi8(high, low);
+        __m128i second = _mm_unpackhi_epi8(high, low);
+
+        first = _mm_add_epi8(_mm_add_epi8(first, zero), _mm_and_si128(_mm_cmpgt_epi8(first, nine), letter_offset));
+        second = _mm_add_epi8(_mm_add_epi8(second, zero), _mm_and_si128(_mm_cmpgt_epi8(second, nine), letter_offset));
+
+        _mm_storeu_si128((__m128i *) (destination + 2*i), first);
+        _mm_storeu_si128((__m128i *) (destination + 2*i + 16), second);
+    }
+
+    scalar_hex_kernel(destination + 2*i, bytes + i, num_bytes - i);
+}
+
+
+
+/*
+ * Bytes from 0x80 up are negative as signed chars, so a single
+ * signed comparison on each side picks out 0x20 to 0x7e.
+ */
+__attribute__((target("sse2")))
+static void sse2_text_kernel(char *destination, const unsigned char *bytes, size_t num_bytes)
+{
+    const __m128i below_printable = _mm_set1_epi8(0x1f);
+    const __m128i above_printable = _mm_set1_epi8(0x7f);
+    const __m128i dot = _mm_set1_epi8('.');
+    size_t i = 0;
+
+
+    for(; i + 16 <= num_bytes; i += 16)
+    {
+        __m128i data = _mm_loadu_si128((const __m128i *) (bytes + i));
+        __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(data, below_printable), _mm_cmplt_epi8(data, above_printable));
+
+        data = _mm_or_si128(_mm_and_si128(printable, data), _mm_andnot_si128(printable, dot));
+        _mm_storeu_si128((__m128i *) (destination + i), data);
+    }
+
+    scalar_text_kernel(destination + i, bytes + i, num_bytes - i);
+}
+
+
+
+/*
+ * The AVX2 kernels do the same 32 bytes at a time. Unpacking works
+ * within each 128-bit lane, so the two halves of the unpacked
+ * digits are swapped back into order before they are stored.
+ */
+__attribute__((target("avx2")))
+static void avx2_hex_kernel(char *destination, const unsigned char *bytes, size_t num_bytes)
+{
+    const __m256i low_nibble = _mm256_set1_epi8(0x0f);
+    const __m256i nine = _mm256_set1_epi8(9);
+    const __m256i zero = _mm256_set1_epi8('0');
+    const __m256i letter_offset = _mm256_set1_epi8('a' - '0' - 10);
+    size_t i = 0;
+
+
+    for(; i + 32 <= num_bytes; i += 32)
+    {
+        __m256i data = _mm256_loadu_si256((const __m256i *) (bytes + i));
+        __m256i high = _mm256_and_si256(_mm256_srli_epi16(data, 4), low_nibble);
+        __m256i low = _mm256_and_si256(data, low_nibble);
+
+        __m256i first = _mm256_unpacklo_epi8(high, low);
+        __m256i second = _mm256_unpackhi_epi8(high, low);
+
+        first = _mm256_add_epi8(_mm256_add_epi8(first, zero), _mm256_and_si256(_mm256_cmpgt_epi8(first, nine), letter_offset));
+        second = _mm256_add_epi8(_mm256_add_epi8(second, zero), _mm256_and_si256(_mm256_cmpgt_epi8(second, nine), letter_offset));
+
+        _mm256_storeu_si256((__m256i *) (destination + 2*i), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256((__m256i *) (destination + 2*i + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+
+    sse2_hex_kernel(destination + 2*i, bytes + i, num_bytes - i);
+}
+
+
+
+__attribute__((target("avx2")))
+static void avx2_text_kernel(char *destination, const unsigned char *bytes, size_t num_bytes)
+{
+    const __m256i below_printable = _mm256_set1_epi8(0x1f);
+    const __m256i above_printable = _mm256_set1_epi8(0x7f);
+    const __m256i dot = _mm256_set1_epi8('.');
+    size_t i = 0;
+
+
+    for(; i + 32 <= num_bytes; i += 32)
+    {
+        __m256i data = _mm256_loadu_si256((const __m256i *) (bytes + i));
+        __m256i printable = _mm256_and_si256(_mm256_cmpgt_epi8(data, below_printable), _mm256_cmpgt_epi8(above_printable, data));
+
+        data = _mm256_blendv_epi8(dot, data, printable);
+        _mm256_storeu_si256((__m256i *) (destination + i), data);
+    }
+
+    sse2_text_kernel(destination + i, bytes + i, num_bytes - i);
+}
+
+
+
+/*
+ * The scanning kernels classify a whole vector of bytes at once
+ * and turn the comparison into a bit mask, one bit per byte, so
+ * the first byte of a class is the lowest set bit. A byte is a
+ * control character when it is neither printable nor from 0x80
+ * up (negative).
+ */
+__attribute__((target("sse2")))
+static unsigned int sse2_printable_mask(__m128i data)
+{
+    __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(data, _mm_set1_epi8(0x1f)),
+                                      _mm_cmplt_epi8(data, _mm_set1_epi8(0x7f)));
+
+    return _mm_movemask_epi8(printable);
+}
+
+
+
+__attribute__((target("sse2")))
+static size_t sse2_find_printable(const unsigned char *bytes, size_t num_bytes)
+{
+    size_t i = 0;
+
+    for(; i + 16 <= num_bytes; i += 16)
+    {
+        unsigned int mask = sse2_printable_mask(_mm_loadu_si128((const __m128i *) (bytes + i)));
+
+        if(mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    return i + scalar_find_printable(bytes + i, num_bytes - i);
+}
+
+
+
+__attribute__((target("sse2")))
+static size_t sse2_find_control(const unsigned char *bytes, size_t num_bytes)
+{
+    size_t i = 0;
+
+    for(; i + 16 <= num_bytes; i += 16)
+    {
+        __m128i data = _mm_loadu_si128((const __m128i *) (bytes + i));
+        unsigned int mask = ~(sse2_printable_mask(data) | _mm_movemask_epi8(data)) & 0xffff;
+
+        if(mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    return i + scalar_find_control(bytes + i, num_bytes - i);
+}
+
+
+
+/*
+ * The AVX2 scanning kernels look at 64 bytes per iteration, as
+ * two vectors whose masks are joined into one 64-bit mask.
+ */
+__attribute__((target("avx2")))
+static uint32_t avx2_printable_mask(__m256i data)
+{
+    __m256i printable = _mm256_and_si256(_mm256_cmpgt_epi8(data, _mm256_set1_epi8(0x1f)),
+                                         _mm256_cmpgt_epi8(_mm256_set1_epi8(0x7f), data));
+
+    return (uint32_t) _mm256_movemask_epi8(printable);
+}
+
+
+
+__attribute__((target("avx2")))
+static uint32_t avx2_control_mask(__m256i data)
+{
+    return ~(avx2_printable_mask(data) | (uint32_t) _mm256_movemask_epi8(data));
+}
+
+
+
+__attribute__((target("avx2")))
+static size_t avx2_find_printable(const unsigned char *bytes, size_t num_bytes)
+{
+    size_t i = 0;
+
+    for(; i + 64 <= num_bytes; i += 64)
+    {
+        uint64_t mask = avx2_printable_mask(_mm256_loadu_si256((const __m256i *) (bytes + i))) |
+                        (uint64_t) avx2_printable_mask(_mm256_loadu_si256((const __m256i *) (bytes + i + 32))) << 32;
+
+        if(mask != 0)
+        {
+            return i + __builtin_ctzll(mask);
+        }
+    }
+
+    return i + sse2_find_printable(bytes + i, num_bytes - i);
+}
+
+
+
+__attribute__((target("avx2")))
+static size_t avx2_find_control(const unsigned char *bytes, size_t num_bytes)
+{
+    size_t i = 0;
+
+    for(; i + 64 <= num_bytes; i += 64)
+    {
+        uint64_t mask = avx2_control_mask(_mm256_loadu_si256((const __m256i *) (bytes + i))) |
+                        (uint64_t) avx2_control_mask(_mm256_loadu_si256((const __m256i *) (bytes + i + 32))) << 32;
+
+        if(mask != 0)
+        {
+            return i + __builtin_ctzll(mask);
+        }
+    }
+
+    return i + sse2_find_control(bytes + i, num_bytes - i);
+}
+
+#endif
+
+
+
+/*
+ * Picks the kernels for the processor we are running on. This is
+ * done once, by whichever thread dumps a section first.
+ */
+static void choose_kernels(void)
+{
+    hex_kernel = scalar_hex_kernel;
+    text_kernel = scalar_text_kernel;
+    find_printable = scalar_find_printable;
+    find_control = scalar_find_control;
+
+#ifdef USE_X86_KERNELS
+    __builtin_cpu_init();
+
+    if(__builtin_cpu_supports("avx2"))
+    {
+        hex_kernel = avx2_hex_kernel;
+        text_kernel = avx2_text_kernel;
+        find_printable = avx2_find_printable;
+        find_control = avx2_find_control;
+    }
+    else if(__builtin_cpu_supports("sse2"))
+    {
+        hex_kernel = sse2_hex_kernel;
+        text_kernel = sse2_text_kernel;
+        find_printable = sse2_find_printable;
+        find_control = sse2_find_control;
+    }
+#endif
+}
+
+
+
+/*
+ * Puts together one row from its hex digits (two per byte, with
+ * spaces standing in for bytes past the end of the data) and the
+ * num_characters characters of its bytes, in the same layout as
+ * readelf -x. Returns the length of the row.
+ */
+static size_t write_hex_dump_row(char *destination, uint64_t address, const char *digits,
+                                 const char *characters, int num_characters)
+{
+    char *start = destination;
+
+    memcpy(destination, "  0x", 4);
+    destination += 4;
+    destination += format_hex(destination, address, 8);
+    *destination++ = ' ';
+
+    for(int group = 0; group < 4; group++)
+    {
+        memcpy(destination, digits + 8*group, 8);
+        destination[8] = ' ';
+        destination += 9;
+    }
+
+    memcpy(destination, characters, num_characters);
+    destination += num_characters;
+    *destination++ = '\n';
+
+    return destination - start;
+}
+
+
+
+/*
+ * Appends the rows of a hex dump of size bytes of data, the
+ * first of which is at the given address. Only the rows are
+ * written, so a large section can be dumped in pieces as long
+ * as each piece but the last is a whole number of rows.
+ */
+void hex_dump(output_t *output, const unsigned char *data, uint64_t size, uint64_t address)
+{
+    char digits[2*HEX_DUMP_BLOCK_SIZE];
+    char characters[HEX_DUMP_BLOCK_SIZE];
+
+
+    pthread_once(&kernels_chosen, choose_kernels);
+
+    while(size > 0)
+    {
+        size_t block_size = (size < HEX_DUMP_BLOCK_SIZE) ? size : HEX_DUMP_BLOCK_SIZE;
+        size_t num_full_rows = block_size / HEX_DUMP_ROW_SIZE;
+        size_t leftover = block_size % HEX_DUMP_ROW_SIZE;
+        char *destination;
+
+
+        hex_kernel(digits, data, block_size);
+        text_kernel(characters, data, block_size);
+
+        destination = reserve_output(output, (num_full_rows + 1) * HEX_DUMP_MAX_ROW_LENGTH);
+
+        for(size_t row = 0; row < num_full_rows; row++)
+        {
+            destination += write_hex_dump_row(destination, address + row*HEX_DUMP_ROW_SIZE,
+                                              digits + 2*row*HEX_DUMP_ROW_SIZE,
+                                              characters + row*HEX_DUMP_ROW_SIZE,
+                                              HEX_DUMP_ROW_SIZE);
+        }
+
+        // the last row of the section may be short
+        if(leftover != 0)
+        {
+            char *last_digits = digits + 2*num_full_rows*HEX_DUMP_ROW_SIZE;
+
+            memset(last_digits + 2*leftover, ' ', 2*(HEX_DUMP_ROW_SIZE - leftover));
+            destination += write_hex_dump_row(destination, address + num_full_rows*HEX_DUMP_ROW_SIZE,
+                                              last_digits, characters + num_full_rows*HEX_DUMP_ROW_SIZE,
+                                              leftover);
+        }
+
+        output->size = destination - output->buffer;
+
+        data += block_size;
+        address += block_size;
+        size -= block_size;
+    }
+}
+
+
+
+/*
+ * Appends the start of a line of the string dump: the offset of
+ * the string in the section, like "  [%6lx]  ", or blank space
+ * of the same width when the string carries on from a line that
+ * ended in a newline.
+ */
+static void append_string_dump_prefix(output_t *output, uint64_t offset, bool continued)
+{
+    char digits[FORMAT_MAX_DIGITS];
+    int num_digits;
+
+
+    if(continued)
+    {
+        append_padding(output, 12);
+        return;
+    }
+
+    num_digits = format_hex(digits, offset, 0);
+
+    append_string(output, "  [");
+    append_padding(output, 6 - num_digits);
+    append_bytes(output, digits, num_digits);
+    append_string(output, "]  ");
+}
+
+
+
+/*
+ * Whether a position in a section is inside a string, and if
+ * not, whether the next string carries on from a line that
+ * ended in a newline.
+ */
+typedef enum
+{
+    BETWEEN_STRINGS,
+    AFTER_NEWLINE,
+    INSIDE_STRING
+
+} string_dump_state_t;
+
+
+
+/*
+ * Finds the end of the string that position is inside of: the
+ * first NULL or newline from position on, before end. Returns
+ * the position just past it, and sets the state there, or
+ * returns end if the string goes on past it.
+ */
+static uint64_t skip_rest_of_string(const unsigned char *data, uint64_t size, uint64_t position, uint64_t end,
+                                    string_dump_state_t *state)
+{
+    while(position < end)
+    {
+        unsigned char byte = data[position++];
+
+        if(byte == '\0')
+        {
+            *state = BETWEEN_STRINGS;
+            return position;
+        }
+
+        if(byte == '\n')
+        {
+            *state = (position < size && data[position] != '\0') ? AFTER_NEWLINE : BETWEEN_STRINGS;
+            return position;
+        }
+    }
+
+    return end;
+}
+
+
+
+/*
+ * Works out the state at end, given the state at start. Every
+ * printable character is part of a string, so only what comes
+ * after the last one before end matters, and that is usually a
+ * few bytes back.
+ */
+static string_dump_state_t get_string_dump_state(const unsigned char *data, uint64_t size, uint64_t start, uint64_t end,
+                                                 string_dump_state_t state)
+{
+    uint64_t position = end;
+
+    while(position > start && (data[position - 1] < 0x20 || data[position - 1] >= 0x7f))
+    {
+        position--;
+    }
+
+    if(position > start)
+    {
+        state = INSIDE_STRING;
+    }
+
+    if(state == INSIDE_STRING)
+    {
+        skip_rest_of_string(data, size, position, end, &state);
+    }
+
+    return state;
+}
+
+
+
+/*
+ * Appends the lines of the string dump that start between start
+ * and end in size bytes of data, in the same form as readelf -p,
+ * and returns how many there are. state is the state at start. A
+ * line that starts before end is finished even if it runs past it.
+ *
+ * A string begins at a printable character and runs up to a NULL
+ * or the end of the data. Control characters in a string are shown
+ * as ^ and a letter, except for newlines, which are shown as \n and
+ * end the line; the string then carries on at the next printable
+ * character, on a line with no offset, unless a NULL came first.
+ */
+static uint64_t string_dump_range(output_t *output, const unsigned char *data, uint64_t size, uint64_t start, uint64_t end,
+                                  string_dump_state_t state)
+{
+    uint64_t position = start;
+    uint64_t num_lines = 0;
+
+
+    pthread_once(&kernels_chosen, choose_kernels);
+
+    // the string an earlier range started is printed by that range
+    if(state == INSIDE_STRING)
+    {
+        position = skip_rest_of_string(data, size, position, end, &state);
+    }
+
+    while(position < end)
+    {
+        bool ended_in_newline = false;
+
+        position += find_printable(data + position, end - position);
+
+        if(position >= end)
+        {
+            break;
+        }
+
+        append_string_dump_prefix(output, position, state == AFTER_NEWLINE);
+        state = BETWEEN_STRINGS;
+        num_lines++;
+
+        while(position < size)
+        {
+            // everything up to the next control character is shown as it is
+            size_t length = find_control(data + position, size - position);
+            unsigned char control;
+
+            append_bytes(output, (const char *) data + position, length);
+            position += length;
+
+            if(position >= size)
+            {
+                break;
+            }
+
+            control = data[position++];
+
+            if(control == '\0')
+            {
+                break;
+            }
+
+            if(control == '\n')
+            {
+                append_string(output, "\\n\n");
+                ended_in_newline = true;
+
+                if(position < size && data[position] != '\0')
+                {
+                    state = AFTER_NEWLINE;
+                }
+
+                break;
+            }
+
+            append_char(output, '^');
+            append_char(output, control + 0x40);
+        }
+
+        if(!ended_in_newline)
+        {
+            append_char(output, '\n');
+        }
+    }
+
+    return num_lines;
+}
+
+
+
+/*
+ * Appends the strings found in size bytes of data, and returns
+ * how many lines were printed.
+ */
+uint64_t string_dump(output_t *output, const unsigned char *data, uint64_t size)
+{
+    return string_dump_range(output, data, size, 0, size, BETWEEN_STRINGS);
+}
+
+
+
+/*
+ * A section being dumped in chunks of DUMP_CHUNK_SIZE bytes,
+ * one job per chunk, whose outputs are written out in order.
+ */
+typedef struct
+{
+    const unsigned char *data;
+    uint64_t size;
+    uint64_t address;
+
+    // for the string dump, the state at the start of each chunk and the lines in it
+    string_dump_state_t *states;
+    uint64_t *num_lines;
+
+} dump_chunks_t;
+
+
+
+/*
+ * What the output of one chunk takes up: a hex dump needs no
+ * more than a row of text for each row of data, plus one more
+ * as reserve_output is asked for, and a string dump is mostly
+ * the strings themselves.
+ */
+#define HEX_DUMP_CHUNK_OUTPUT_SIZE      ((DUMP_CHUNK_SIZE/HEX_DUMP_ROW_SIZE + 1) * HEX_DUMP_MAX_ROW_LENGTH)
+#define STRING_DUMP_CHUNK_OUTPUT_SIZE   (2 * DUMP_CHUNK_SIZE)
+
+
+
+static void hex_dump_chunk(void *context, int job_number, output_t *output)
+{
+    dump_chunks_t *chunks = (dump_chunks_t*) context;
+    uint64_t start = (uint64_t) job_number * DUMP_CHUNK_SIZE;
+    uint64_t size = (chunks->size - start < DUMP_CHUNK_SIZE) ? chunks->size - start : DUMP_CHUNK_SIZE;
+
+    hex_dump(output, chunks->data + start, size, chunks->address + start);
+}
+
+
+
+static void string_dump_chunk(void *context, int job_number, output_t *output)
+{
+    dump_chunks_t *chunks = (dump_chunks_t*) context;
+    uint64_t start = (uint64_t) job_number * DUMP_CHUNK_SIZE;
+    uint64_t end = (chunks->size - start < DUMP_CHUNK_SIZE) ? chunks->size : start + DUMP_CHUNK_SIZE;
+
+    chunks->num_lines[job_number] = string_dump_range(output, chunks->data, chunks->size,
+                                                      start, end, chunks->states[job_number]);
+}
+
+
+
+/*
+ * Runs one of the chunk functions above over every chunk on
+ * the pool, writing the chunks to output in order.
+ */
+static void dump_chunks(output_t *output, dump_chunks_t *chunks, int num_chunks, job_function_t function,
+                        size_t output_size, thread_pool_t *pool)
+{
+    ordered_jobs_t jobs;
+
+    jobs.function = function;
+    jobs.finish = NULL;
+    jobs.context = chunks;
+    jobs.num_jobs = num_chunks;
+    jobs.output_size = output_size;
+    jobs.run_by_caller = NULL;
+
+    run_ordered_jobs(pool, output, &jobs);
+}
+
+
+
+/*
+ * Does the same as hex_dump, with the section split into chunks
+ * that are formatted on the pool's threads at once. Every chunk
+ * is a whole number of rows, so the rows come out the same.
+ */
+void hex_dump_in_parallel(output_t *output, const unsigned char *data, uint64_t size, uint64_t address, thread_pool_t *pool)
+{
+    dump_chunks_t chunks;
+    int num_chunks = (size + DUMP_CHUNK_SIZE - 1) / DUMP_CHUNK_SIZE;
+
+
+    chunks.data = data;
+    chunks.size = size;
+    chunks.address = address;
+
+    dump_chunks(output, &chunks, num_chunks, hex_dump_chunk, HEX_DUMP_CHUNK_OUTPUT_SIZE, pool);
+}
+
+
+
+/*
+ * Does the same as string_dump, with the section split into
+ * chunks that are formatted on the pool's threads at once. Each
+ * chunk prints the lines that start in it, finishing the last one
+ * even if it runs on into later chunks, and skips whatever is
+ * left of a line begun before it. For that, the state at the start
+ * of each chunk is worked out before any of them are formatted.
+ */
+uint64_t string_dump_in_parallel(output_t *output, const unsigned char *data, uint64_t size, thread_pool_t *pool)
+{
+    dump_chunks_t chunks;
+    int num_chunks = (size + DUMP_CHUNK_SIZE - 1) / DUMP_CHUNK_SIZE;
+    uint64_t num_lines = 0;
+
+
+    chunks.data = data;
+    chunks.size = size;
+    chunks.states = (string_dump_state_t*) malloc((num_chunks + 1) * sizeof(string_dump_state_t));
+    chunks.num_lines = (uint64_t*) malloc((num_chunks + 1) * sizeof(uint64_t));
+
+    chunks.states[0] = BETWEEN_STRINGS;
+
+    for(int i = 1; i < num_chunks; i++)
+    {
+        chunks.states[i] = get_string_dump_state(data, size, (uint64_t) (i - 1) * DUMP_CHUNK_SIZE,
+                                                 (uint64_t) i * DUMP_CHUNK_SIZE, chunks.states[i - 1]);
+    }
+
+
+    dump_chunks(output, &chunks, num_chunks, string_dump_chunk, STRING_DUMP_CHUNK_OUTPUT_SIZE, pool);
+
+    for(int i = 0; i < num_chunks; i++)
+    {
+        num_lines += chunks.num_lines[i];
+    }
+
+    free(chunks.states);
+    free(chunks.num_lines);
+
+    return num_lines;
+}
@@ -0,0 +1,153 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Implementation file for the number formatting routines. These
+ * do the same job as the %x, %u and %d conversions of sprintf,
+ * but without parsing a format string and by producing two digits
+ * per step out of a lookup table.
+ */
+
+
+#include <stdint.h>
+#include <string.h>
+
+
+#include "format.h"
+
+
+
+
+/*
+ * The two lowercase hex digits of every byte value,
+ * so byte b is hex_digit_pairs[2*b] and [2*b + 1].
+ */
+static const char hex_digit_pairs[513] =
+    "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+    "202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f"
+    "404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f"
+    "606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f"
+    "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f"
+    "a0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+    "c0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+    "e0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+
+
+
+/*
+ * The two decimal digits of every number from 0 to 99.
+ */
+static const char decimal_digit_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+
+
+
+/*
+ * Writes value in lowercase hex, padded on the left with zeros
+ * to at least min_width digits, like "%0*lx". No NULL character
+ * is written. Returns the number of characters written, which is
+ * at most 16 unless min_width is larger.
+ */
+int format_hex(char *destination, uint64_t value, int min_width)
+{
+    char digits[16];
+    int num_digits = 0;
+    int length;
+
+
+    /*
+     * Produce the digits from least to most significant,
+     * a byte (two digits) at a time, into the end of the
+     * scratch array.
+     */
+    do
+    {
+        num_digits += 2;
+        memcpy(digits + 16 - num_digits, hex_digit_pairs + 2*(value & 0xff), 2);
+        value >>= 8;
+    }
+    while(value != 0);
+
+
+    // a whole byte was written, so drop a leading zero digit
+    if(num_digits > 1 && digits[16 - num_digits] == '0')
+        num_digits--;
+
+    length = (num_digits > min_width) ? num_digits : min_width;
+
+    memset(destination, '0', length - num_digits);
+    memcpy(destination + length - num_digits, digits + 16 - num_digits, num_digits);
+
+    return length;
+}
+
+
+
+/*
+ * Writes value in decimal, like "%lu". No NULL character is
+ * written. Returns the number of characters written.
+ */
+int format_decimal(char *destination, uint64_t value)
+{
+    char digits[20];
+    int num_digits = 0;
+
+
+    // two digits at a time from the least significant end
+    while(value >= 100)
+    {
+        num_digits += 2;
+        memcpy(digits + 20 - num_digits, decimal_digit_pairs + 2*(value % 100), 2);
+        value /= 100;
+    }
+
+    if(value >= 10)
+    {
+        num_digits += 2;
+        memcpy(digits + 20 - num_digits, decimal_digit_pairs + 2*value, 2);
+    }
+    else
+    {
+        num_digits++;
+        digits[20 - num_digits] = '0' + value;
+    }
+
+    memcpy(destination, digits + 20 - num_digits, num_digits);
+
+    return num_digits;
+}
+
+
+
+/*
+ * Writes a signed value in decimal, like "%ld".
+ */
+int format_signed_decimal(char *destination, int64_t value)
+{
+    if(value < 0)
+    {
+        destination[0] = '-';
+
+        // negate as unsigned so INT64_MIN does not overflow
+        return 1 + format_decimal(destination + 1, -(uint64_t) value);
+    }
+
+    return format_decimal(destination, value);
+}
+
+
+
+/*
+ * Writes each of the given bytes as two lowercase hex digits,
+ * so 2*num_bytes characters in all, with nothing between them.
+ */
+void format_hex_bytes(char *destination, const unsigned char *bytes, size_t num_bytes)
+{
+    for(size_t i = 0; i < num_bytes; i++)
+    {
+        memcpy(destination + 2*i, hex_digit_pairs + 2*bytes[i], 2);
+    }
+}
@@ -0,0 +1,856 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Implementation file for reading the call frame information
+ * of .debug_frame and .eh_frame straight out of the mapped
+ * sections, and for the index of the FDEs by address.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#include "frame.h"
+#include "debug.h"
+
+
+
+
+/*
+ * Reads a pointer encoded the way .eh_frame and .eh_frame_hdr
+ * encode them. Pointers relative to where they are stored
+ * (pcrel) or to the section (datarel, as .eh_frame_hdr uses)
+ * are turned into addresses; text- and function-relative ones
+ * are left as they are, and indirect ones give the address the
+ * pointer is stored at, since the file is not running.
+ */
+bool read_encoded_pointer(frame_section_t *section, const unsigned char **position, const unsigned char *end,
+                          uint8_t encoding, uint64_t *value)
+{
+    const unsigned char *start;
+    int64_t signed_value;
+    bool valid;
+
+
+    if(encoding == DW_EH_PE_omit)
+    {
+        *value = 0;
+        return true;
+    }
+
+    // aligned pointers sit at the next multiple of the address size
+    if((encoding & DW_EH_PE_APPLICATION_MASK) == DW_EH_PE_aligned)
+    {
+        uint64_t address = section->address + (*position - section->data);
+        uint64_t padding = (section->address_size - address % section->address_size) % section->address_size;
+
+        if(padding > (uint64_t) (end - *position))
+        {
+            return false;
+        }
+
+        *position += padding;
+    }
+
+    start = *position;
+
+    switch(encoding & DW_EH_PE_FORMAT_MASK)
+    {
+        case DW_EH_PE_absptr:
+            valid = read_unsigned(position, end, section->address_size, value);
+            break;
+
+        case DW_EH_PE_uleb128:
+            valid = read_uleb128(position, end, value);
+            break;
+
+        case DW_EH_PE_udata2:
+            valid = read_unsigned(position, end, 2, value);
+            break;
+
+        case DW_EH_PE_udata4:
+            valid = read_unsigned(position, end, 4, value);
+            break;
+
+        case DW_EH_PE_udata8:
+            valid = read_unsigned(position, end, 8, value);
+            break;
+
+        case DW_EH_PE_sleb128:
+            valid = read_sleb128(position, end, &signed_value);
+            *value = (uint64_t) signed_value;
+            break;
+
+        case DW_EH_PE_sdata2:
+            valid = read_unsigned(position, end, 2, value);
+            *value = (uint64_t) (int64_t) (int16_t) *value;
+            break;
+
+        case DW_EH_PE_sdata4:
+            valid = read_unsigned(position, end, 4, value);
+            *value = (uint64_t) (int64_t) (int32_t) *value;
+            break;
+
+        case DW_EH_PE_sdata8:
+            valid = read_unsigned(position, end, 8, value);
+            break;
+
+        default:
+            return false;
+    }
+
+    if(!valid)
+    {
+        return false;
+    }
+
+    switch(encoding & DW_EH_PE_APPLICATION_MASK)
+    {
+        case DW_EH_PE_pcrel:
+            *value += section->address + (start - section->data);
+            break;
+
+        case DW_EH_PE_datarel:
+            *value += section->address;
+            break;
+    }
+
+    // a 32-bit file's addresses wrap around at 32 bits
+    if(section->address_size == 4)
+    {
+        *value &= 0xffffffff;
+    }
+
+    return true;
+}
+
+
+
+/*
+ * Reads the length and the CIE id (or CIE pointer) that every
+ * entry starts with, leaving position after the id and end at
+ * the end of the entry. A length of 0 (with no id after it) is
+ * the terminator of .eh_frame.
+ */
+static frame_entry_type_t read_entry_header(frame_section_t *section, uint64_t offset, const unsigned char **position,
+                                            const unsigned char **end, uint64_t *length, uint64_t *id)
+{
+    const unsigned char *section_end = section->data + section->size;
+    int offset_size = 4;
+
+
+    *position = section->data + offset;
+
+    if(offset >= section->size || !read_unsigned(position, section_end, 4, length))
+    {
+        return FRAME_ENTRY_CORRUPT;
+    }
+
+    if(*length == 0)
+    {
+        *end = *position;
+        *id = 0;
+        return FRAME_ENTRY_TERMINATOR;
+    }
+
+    if(*length == 0xffffffff)
+    {
+        offset_size = 8;
+
+        if(!read_unsigned(position, section_end, 8, length))
+        {
+            return FRAME_ENTRY_CORRUPT;
+        }
+    }
+
+    if(*length > (uint64_t) (section_end - *position))
+    {
+        return FRAME_ENTRY_CORRUPT;
+    }
+
+    *end = *position + *length;
+
+    if(!read_unsigned(position, *end, offset_size, id))
+    {
+        return FRAME_ENTRY_CORRUPT;
+    }
+
+    /*
+     * In .eh_frame a CIE has an id of 0, and an FDE gives the
+     * distance back to its CIE. In .debug_frame a CIE has an id
+     * of all ones, and an FDE gives the offset of its CIE.
+     */
+    if(section->is_eh_frame)
+    {
+        return (*id == 0) ? FRAME_ENTRY_CIE : FRAME_ENTRY_FDE;
+    }
+
+    return (*id == ((offset_size == 4) ? 0xffffffff : UINT64_MAX)) ? FRAME_ENTRY_CIE : FRAME_ENTRY_FDE;
+}
+
+
+
+/*
+ * Finds what kind of entry is at the given offset and where it
+ * ends, without reading the rest of it.
+ */
+frame_entry_type_t read_frame_entry_type(frame_section_t *section, uint64_t offset, uint64_t *end_offset)
+{
+    const unsigned char *position, *end;
+    uint64_t length, id;
+    frame_entry_type_t type = read_entry_header(section, offset, &position, &end, &length, &id);
+
+
+    *end_offset = end - section->data;
+
+    return type;
+}
+
+
+
+/*
+ * Reads the CIE at the given offset. Returns false if the entry
+ * is not a CIE, runs past its end, or has a version that is not
+ * known.
+ */
+bool read_cie(frame_section_t *section, uint64_t offset, cie_t *cie)
+{
+    const unsigned char *position, *end, *terminator;
+    uint64_t value;
+
+
+    memset(cie, 0, sizeof(cie_t));
+    cie->offset = offset;
+
+    if(read_entry_header(section, offset, &position, &end, &cie->length, &cie->id) != FRAME_ENTRY_CIE ||
+       !read_unsigned(&position, end, 1, &value))
+    {
+        return false;
+    }
+
+    cie->version = (uint8_t) value;
+    cie->end_offset = end - section->data;
+
+    if(cie->version != 1 && cie->version != 3 && cie->version != 4)
+    {
+        return false;
+    }
+
+    if((terminator = memchr(position, '\0', end - position)) == NULL)
+    {
+        return false;
+    }
+
+    cie->augmentation = (const char*) position;
+    position = terminator + 1;
+
+
+    // very old GCC put the address of its exception table here
+    if(cie->augmentation[0] == 'e' && cie->augmentation[1] == 'h')
+    {
+        if(!read_unsigned(&position, end, section->address_size, &value))
+        {
+            return false;
+        }
+    }
+
+    cie->address_size = (uint8_t) section->address_size;
+
+    if(cie->version == 4)
+    {
+        if(!read_unsigned(&position, end, 1, &value))
+        {
+            return false;
+        }
+
+        cie->address_size = (uint8_t) value;
+
+        if(!read_unsigned(&position, end, 1, &value))
+        {
+            return false;
+        }
+
+        cie->segment_size = (uint8_t) value;
+
+        if(cie->address_size != 4 && cie->address_size != 8)
+        {
+            return false;
+        }
+    }
+
+    if(!read_uleb128(&position, end, &cie->code_alignment) || !read_sleb128(&position, end, &cie->data_alignment))
+    {
+        return false;
+    }
+
+    if(cie->version == 1)
+    {
+        if(!read_unsigned(&position, end, 1, &cie->return_address_register))
+        {
+            return false;
+        }
+    }
+    else if(!read_uleb128(&position, end, &cie->return_address_register))
+    {
+        return false;
+    }
+
+
+    cie->fde_encoding = DW_EH_PE_absptr;
+    cie->lsda_encoding = DW_EH_PE_omit;
+    cie->personality_encoding = DW_EH_PE_omit;
+
+    /*
+     * With a 'z' augmentation the length of the augmentation
+     * data comes first, so letters that are not known can be
+     * passed over along with the rest of the data.
+     */
+    if(cie->augmentation[0] == 'z')
+    {
+        const unsigned char *data_end;
+
+        if(!read_uleb128(&position, end, &cie->augmentation_data_length) ||
+           cie->augmentation_data_length > (uint64_t) (end - position))
+        {
+            return false;
+        }
+
+        cie->has_augmentation_data = true;
+        cie->augmentation_data = position;
+        data_end = position + cie->augmentation_data_length;
+
+        for(const char *letter = cie->augmentation + 1; *letter != '\0'; letter++)
+        {
+            bool valid = true;
+
+            switch(*letter)
+            {
+                case 'L':
+                    valid = read_unsigned(&position, data_end, 1, &value);
+                    cie->lsda_encoding = (uint8_t) value;
+                    break;
+
+                case 'R':
+                    valid = read_unsigned(&position, data_end, 1, &value);
+                    cie->fde_encoding = (uint8_t) value;
+                    break;
+
+                case 'P':
+                    valid = read_unsigned(&position, data_end, 1, &value);
+                    cie->personality_encoding = (uint8_t) value;
+                    valid = valid && read_encoded_pointer(section, &position, data_end, cie->personality_encoding, &cie->personality);
+                    break;
+
+                case 'S':
+                    cie->is_signal_frame = true;
+                    break;
+            }
+
+            if(!valid)
+            {
+                return false;
+            }
+        }
+
+        position = data_end;
+    }
+
+    cie->instructions = position;
+    cie->instructions_length = end - position;
+
+    return true;
+}
+
+
+
+/*
+ * Reads the FDE at the given offset. The CIE passed in is used
+ * as a cache of one: if it is not the FDE's CIE (or has not been
+ * read yet, with an end_offset of 0), the FDE's CIE is read into
+ * it. FDEs mostly share the CIE of the one before them, so going
+ * through the FDEs in order reads each CIE about once.
+ */
+bool read_fde(frame_section_t *section, uint64_t offset, cie_t *cie, fde_t *fde)
+{
+    const unsigned char *position, *end, *id_position;
+    uint8_t encoding;
+
+
+    memset(fde, 0, sizeof(fde_t));
+    fde->offset = offset;
+
+    if(read_entry_header(section, offset, &position, &end, &fde->length, &fde->cie_pointer) != FRAME_ENTRY_FDE)
+    {
+        return false;
+    }
+
+    fde->end_offset = end - section->data;
+
+    if(section->is_eh_frame)
+    {
+        // the pointer counts back from where it is stored
+        id_position = position - 4;
+
+        if((uint64_t) (id_position - section->data) < fde->cie_pointer)
+        {
+            return false;
+        }
+
+        fde->cie_offset = (id_position - section->data) - fde->cie_pointer;
+    }
+    else
+    {
+        fde->cie_offset = fde->cie_pointer;
+    }
+
+    if(cie->end_offset == 0 || cie->offset != fde->cie_offset)
+    {
+        if(!read_cie(section, fde->cie_offset, cie))
+        {
+            cie->end_offset = 0;
+            return false;
+        }
+    }
+
+
+    if(section->is_eh_frame)
+    {
+        // the range has the format of the start, but is not relative to anything
+        encoding = cie->fde_encoding;
+
+        if(!read_encoded_pointer(section, &position, end, encoding, &fde->pc_begin) ||
+           !read_encoded_pointer(section, &position, end, encoding & DW_EH_PE_FORMAT_MASK, &fde->pc_range))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        if((uint64_t) (end - position) < cie->segment_size)
+        {
+            return false;
+        }
+
+        position += cie->segment_size;
+
+        if(!read_unsigned(&position, end, cie->address_size, &fde->pc_begin) ||
+           !read_unsigned(&position, end, cie->address_size, &fde->pc_range))
+        {
+            return false;
+        }
+    }
+
+    if(cie->has_augmentation_data)
+    {
+        if(!read_uleb128(&position, end, &fde->augmentation_data_length) ||
+           fde->augmentation_data_length > (uint64_t) (end - position))
+        {
+            return false;
+        }
+
+        fde->augmentation_data = position;
+        position += fde->augmentation_data_length;
+    }
+
+    fde->instructions = position;
+    fde->instructions_length = end - position;
+
+    return true;
+}
+
+
+
+/*
+ * Reads the length-prefixed DWARF expression of a call frame
+ * instruction, leaving it in place in the section.
+ */
+static bool read_cfa_expression(const unsigned char **position, const unsigned char *end, cfa_instruction_t *instruction)
+{
+    if(!read_uleb128(position, end, &instruction->expression_length) ||
+       instruction->expression_length > (uint64_t) (end - *position))
+    {
+        return false;
+    }
+
+    instruction->expression = *position;
+    *position += instruction->expression_length;
+
+    return true;
+}
+
+
+
+/*
+ * Reads one call frame instruction and its operands, moving
+ * position past it. location is the address the rules apply
+ * from, which advances and DW_CFA_set_loc move on. Returns false
+ * if the instruction runs past end or is not known.
+ */
+bool read_cfa_instruction(frame_section_t *section, cie_t *cie, const unsigned char **position, const unsigned char *end,
+                          uint64_t *location, cfa_instruction_t *instruction)
+{
+    uint64_t value;
+    int64_t signed_value;
+    uint8_t opcode;
+    bool valid = true;
+
+
+    if(*position >= end)
+    {
+        return false;
+    }
+
+    memset(instruction, 0, sizeof(cfa_instruction_t));
+    opcode = *(*position)++;
+
+    // the three primary instructions keep an operand in the low six bits
+    switch(opcode & 0xc0)
+    {
+        case DW_CFA_advance_loc:
+            instruction->opcode = DW_CFA_advance_loc;
+            instruction->offset = (int64_t) ((opcode & 0x3f) * cie->code_alignment);
+            *location += instruction->offset;
+            instruction->address = *location;
+            return true;
+
+        case DW_CFA_offset:
+            instruction->opcode = DW_CFA_offset;
+            instruction->register_number = opcode & 0x3f;
+
+            if(!read_uleb128(position, end, &value))
+            {
+                return false;
+            }
+
+            instruction->offset = (int64_t) value * cie->data_alignment;
+            return true;
+
+        case DW_CFA_restore:
+            instruction->opcode = DW_CFA_restore;
+            instruction->register_number = opcode & 0x3f;
+            return true;
+    }
+
+
+    instruction->opcode = opcode;
+
+    switch(opcode)
+    {
+        case DW_CFA_nop:
+        case DW_CFA_remember_state:
+        case DW_CFA_restore_state:
+        case DW_CFA_GNU_window_save:
+            break;
+
+        case DW_CFA_set_loc:
+            if(section->is_eh_frame)
+            {
+                valid = read_encoded_pointer(section, position, end, cie->fde_encoding, location);
+            }
+            else
+            {
+                valid = read_unsigned(position, end, cie->address_size, location);
+            }
+
+            instruction->address = *location;
+            break;
+
+        case DW_CFA_advance_loc1:
+        case DW_CFA_advance_loc2:
+        case DW_CFA_advance_loc4:
+            valid = read_unsigned(position, end, 1 << (opcode - DW_CFA_advance_loc1), &value);
+            instruction->offset = (int64_t) (value * cie->code_alignment);
+            *location += instruction->offset;
+            instruction->address = *location;
+            break;
+
+        case DW_CFA_offset_extended:
+        case DW_CFA_val_offset:
+        case DW_CFA_GNU_negative_offset_extended:
+            valid = read_uleb128(position, end, &instruction->register_number) && read_uleb128(position, end, &value);
+            instruction->offset = (int64_t) value * cie->data_alignment;
+
+            if(opcode == DW_CFA_GNU_negative_offset_extended)
+            {
+                instruction->offset = -instruction->offset;
+            }
+
+            break;
+
+        case DW_CFA_offset_extended_sf:
+        case DW_CFA_val_offset_sf:
+            valid = read_uleb128(position, end, &instruction->register_number) && read_sleb128(position, end, &signed_value);
+            instruction->offset = signed_value * cie->data_alignment;
+            break;
+
+        case DW_CFA_restore_extended:
+        case DW_CFA_undefined:
+        case DW_CFA_same_value:
+        case DW_CFA_def_cfa_register:
+            valid = read_uleb128(position, end, &instruction->register_number);
+            break;
+
+        case DW_CFA_register:
+            valid = read_uleb128(position, end, &instruction->register_number) &&
+                    read_uleb128(position, end, &instruction->second_register);
+            break;
+
+        case DW_CFA_def_cfa:
+            valid = read_uleb128(position, end, &instruction->register_number) && read_uleb128(position, end, &value);
+            instruction->offset = (int64_t) value;
+            break;
+
+        case DW_CFA_def_cfa_sf:
+            valid = read_uleb128(position, end, &instruction->register_number) && read_sleb128(position, end, &signed_value);
+            instruction->offset = signed_value * cie->data_alignment;
+            break;
+
+        case DW_CFA_def_cfa_offset:
+        case DW_CFA_GNU_args_size:
+            valid = read_uleb128(position, end, &value);
+            instruction->offset = (int64_t) value;
+            break;
+
+        case DW_CFA_def_cfa_offset_sf:
+            valid = read_sleb128(position, end, &signed_value);
+            instruction->offset = signed_value * cie->data_alignment;
+            break;
+
+        case DW_CFA_expression:
+        case DW_CFA_val_expression:
+            valid = read_uleb128(position, end, &instruction->register_number) &&
+                    read_cfa_expression(position, end, instruction);
+            break;
+
+        case DW_CFA_def_cfa_expression:
+            valid = read_cfa_expression(position, end, instruction);
+            break;
+
+        default:
+            return false;
+    }
+
+    return valid;
+}
+
+
+
+
+/*
+ * Builds the index for finding the FDE covering an address from
+ * every FDE of a section, read up to the first corrupt entry (or
+ * the terminator of .eh_frame), with the offset of the FDE in the
+ * section as the payload of each range. FDEs with an empty range
+ * are left out, and of several starting at the same address the
+ * first in the section is kept. The index must be released with
+ * release_range_index.
+ */
+range_index_t *build_fde_index(frame_section_t *section)
+{
+    range_index_t *index;
+    range_t *ranges;
+    uint64_t num_ranges = 0;
+    uint64_t capacity = 64;
+    uint64_t offset = 0;
+    cie_t cie;
+    fde_t fde;
+
+
+    ranges = (range_t*) malloc(capacity * sizeof(range_t));
+    cie.end_offset = 0;
+
+    while(offset < section->size)
+    {
+        uint64_t end_offset;
+        frame_entry_type_t type = read_frame_entry_type(section, offset, &end_offset);
+
+        if(type == FRAME_ENTRY_CORRUPT || type == FRAME_ENTRY_TERMINATOR)
+        {
+            break;
+        }
+
+        if(type == FRAME_ENTRY_FDE && read_fde(section, offset, &cie, &fde) && fde.pc_range != 0)
+        {
+            if(num_ranges == capacity)
+            {
+                capacity *= 2;
+                ranges = (range_t*) realloc(ranges, capacity * sizeof(range_t));
+            }
+
+            ranges[num_ranges].start = fde.pc_begin;
+            ranges[num_ranges].end = fde.pc_begin + fde.pc_range;
+            ranges[num_ranges].payload = offset;
+            num_ranges++;
+        }
+
+        offset = end_offset;
+    }
+
+    sort_ranges(ranges, num_ranges);
+
+    index = build_range_index(ranges, num_ranges, RANGES_KEEP_FIRST);
+    free(ranges);
+
+    return index;
+}
+
+
+
+/*
+ * Gets the size of a pointer of the given encoding if it is the
+ * same for every pointer, or 0 if it is not (for the LEB128
+ * formats) or is not known.
+ */
+static int get_encoded_pointer_size(uint8_t encoding, int address_size)
+{
+    switch(encoding & DW_EH_PE_FORMAT_MASK)
+    {
+        case DW_EH_PE_absptr:
+            return address_size;
+
+        case DW_EH_PE_udata2:
+        case DW_EH_PE_sdata2:
+            return 2;
+
+        case DW_EH_PE_udata4:
+        case DW_EH_PE_sdata4:
+            return 4;
+
+        case DW_EH_PE_udata8:
+        case DW_EH_PE_sdata8:
+            return 8;
+
+        default:
+            return 0;
+    }
+}
+
+
+
+/*
+ * Reads the header of .eh_frame_hdr. Returns false if the
+ * section has no search table that can be searched in place:
+ * if it is corrupt or of an unknown version, or if the linker
+ * left the table out (giving DW_EH_PE_omit for its encoding),
+ * which it does when it could not sort the FDEs. Tables whose
+ * fields are not all the same size cannot be searched either.
+ */
+bool read_eh_frame_hdr(frame_section_t *section, eh_frame_hdr_t *header)
+{
+    const unsigned char *position = section->data;
+    const unsigned char *end = section->data + section->size;
+    uint8_t version, eh_frame_encoding, count_encoding;
+    uint64_t value;
+
+
+    memset(header, 0, sizeof(eh_frame_hdr_t));
+    header->section = *section;
+
+    if(section->size < 4)
+    {
+        return false;
+    }
+
+    version = position[0];
+    eh_frame_encoding = position[1];
+    count_encoding = position[2];
+    header->table_encoding = position[3];
+    position += 4;
+
+    if(version != 1 || count_encoding == DW_EH_PE_omit || header->table_encoding == DW_EH_PE_omit)
+    {
+        return false;
+    }
+
+    if(!read_encoded_pointer(section, &position, end, eh_frame_encoding, &header->eh_frame_address) ||
+       !read_encoded_pointer(section, &position, end, count_encoding & DW_EH_PE_FORMAT_MASK, &value))
+    {
+        return false;
+    }
+
+
+    // only fields relative to nothing, to themselves or to the header can be decoded on their own
+    switch(header->table_encoding & DW_EH_PE_APPLICATION_MASK)
+    {
+        case DW_EH_PE_absptr:
+        case DW_EH_PE_pcrel:
+        case DW_EH_PE_datarel:
+            break;
+
+        default:
+            return false;
+    }
+
+    if((header->table_encoding & DW_EH_PE_indirect) ||
+       (header->field_size = get_encoded_pointer_size(header->table_encoding, section->address_size)) == 0)
+    {
+        return false;
+    }
+
+    if(value > (uint64_t) (end - position) / (2*header->field_size))
+    {
+        return false;
+    }
+
+    header->num_entries = value;
+    header->table = position;
+
+    return true;
+}
+
+
+
+/*
+ * Decodes one field of the search table of .eh_frame_hdr, which
+ * read_eh_frame_hdr has checked is of a fixed size.
+ */
+static uint64_t read_eh_frame_hdr_field(eh_frame_hdr_t *header, const unsigned char *field)
+{
+    const unsigned char *position = field;
+    uint64_t value;
+
+
+    read_encoded_pointer(&header->section, &position, field + header->field_size, header->table_encoding, &value);
+
+    return value;
+}
+
+
+
+/*
+ * Finds the entry of the search table of .eh_frame_hdr with
+ * the last start address at or before the given address, with
+ * the same search as find_range. The table only has the starts of
+ * the ranges, so whether the address is inside the range is up
+ * to the caller to check in the FDE. Returns the number of the
+ * entry, giving the address of its FDE, or -1 if the address is
+ * before every entry.
+ */
+int64_t find_eh_frame_hdr_entry(eh_frame_hdr_t *header, uint64_t address, uint64_t *fde_address)
+{
+    uint64_t entry_size = 2*header->field_size;
+    uint64_t low = 0;
+    uint64_t count = header->num_entries;
+
+
+    if(count == 0 || address < read_eh_frame_hdr_field(header, header->table))
+    {
+        return -1;
+    }
+
+    while(count > 1)
+    {
+        uint64_t half = count / 2;
+        uint64_t start = read_eh_frame_hdr_field(header, header->table + (low + half)*entry_size);
+
+        low = (start <= address) ? low + half : low;
+        count -= half;
+    }
+
+    *fde_address = read_eh_frame_hdr_field(header, header->table + low*entry_size + header->field_size);
+
+    return (int64_t) low;
+}
@@ -0,0 +1,182 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Implementation file for reading queries from a file descriptor.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+
+#include "input.h"
+
+
+
+
+void init_input(input_t *input, int file_descriptor)
+{
+    input->file_descriptor = file_descriptor;
+    input->buffer = (char*) malloc(INPUT_BUFFER_SIZE);
+    input->size = 0;
+    input->position = 0;
+    input->end_of_input = false;
+}
+
+
+
+void release_input(input_t *input)
+{
+    free(input->buffer);
+    input->buffer = NULL;
+}
+
+
+
+/*
+ * Moves whatever has not been consumed yet to the front of the
+ * buffer and fills the rest with more input. Returns false once
+ * there is no more input to read.
+ */
+static bool refill_input(input_t *input)
+{
+    ssize_t bytes_read;
+
+
+    if(input->end_of_input)
+    {
+        return false;
+    }
+
+    memmove(input->buffer, input->buffer + input->position, input->size - input->position);
+    input->size -= input->position;
+    input->position = 0;
+
+    do
+    {
+        bytes_read = read(input->file_descriptor, input->buffer + input->size, INPUT_BUFFER_SIZE - input->size);
+    }
+    while(bytes_read < 0 && errno == EINTR);
+
+    if(bytes_read <= 0)
+    {
+        input->end_of_input = true;
+        return false;
+    }
+
+    input->size += bytes_read;
+
+    return true;
+}
+
+
+
+static bool is_separator(char character)
+{
+    return character == ' ' || character == '\t' || character == '\n' || character == '\r' || character == ',';
+}
+
+
+
+/*
+ * Reads the next token, where tokens are separated by white space
+ * or commas. The token is a view into the input buffer, so it is
+ * only valid until the next call. A token longer than the whole
+ * buffer is split. Returns false at the end of the input.
+ */
+bool read_token(input_t *input, string_view_t *token)
+{
+    size_t end;
+
+
+    // skip separators, reading more input as needed
+    while(true)
+    {
+        while(input->position < input->size && is_separator(input->buffer[input->position]))
+        {
+            input->position++;
+        }
+
+        if(input->position < input->size)
+            break;
+
+        if(!refill_input(input))
+            return false;
+    }
+
+
+    // find the end of the token, making sure all of it is in the buffer
+    end = input->position;
+
+    while(true)
+    {
+        while(end < input->size && !is_separator(input->buffer[end]))
+        {
+            end++;
+        }
+
+        if(end < input->size || input->size - input->position == INPUT_BUFFER_SIZE)
+            break;
+
+        end -= input->position;
+
+        if(!refill_input(input))
+        {
+            end = input->size;
+            break;
+        }
+    }
+
+    token->string = input->buffer + input->position;
+    token->length = end - input->position;
+    input->position = end;
+
+    return true;
+}
+
+
+
+/*
+ * Parses a token as a hex address, with or without a leading
+ * 0x. Returns false if it is not one.
+ */
+bool parse_address(string_view_t token, uint64_t *address)
+{
+    const char *digits = token.string;
+    size_t length = token.length;
+    uint64_t value = 0;
+
+
+    if(length > 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X'))
+    {
+        digits += 2;
+        length -= 2;
+    }
+
+    if(length == 0 || length > 16)
+    {
+        return false;
+    }
+
+    for(size_t i = 0; i < length; i++)
+    {
+        char digit = digits[i];
+
+        if(digit >= '0' && digit <= '9')
+            value = (value << 4) | (digit - '0');
+        else if(digit >= 'a' && digit <= 'f')
+            value = (value << 4) | (digit - 'a' + 10);
+        else if(digit >= 'A' && digit <= 'F')
+            value = (value << 4) | (digit - 'A' + 10);
+        else
+            return false;
+    }
+
+    *address = value;
+
+    return true;
+}
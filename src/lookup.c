@@ -0,0 +1,1250 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Implementation file for looking symbols up by name, either
+ * through the hash tables the file carries for the dynamic
+ * linker or through a table built over a symbol table section,
+ * and for looking sections up by name.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#include "lookup.h"
+
+
+
+
+/*
+ * The hash function of DT_GNU_HASH tables (Bernstein's).
+ */
+static uint32_t gnu_hash(const char *name, size_t length)
+{
+    uint32_t hash = 5381;
+
+    for(size_t i = 0; i < length; i++)
+    {
+        hash = hash*33 + (unsigned char) name[i];
+    }
+
+    return hash;
+}
+
+
+
+/*
+ * The hash function of DT_HASH tables, from the System V ABI.
+ */
+static uint32_t sysv_hash(const char *name, size_t length)
+{
+    uint32_t hash = 0;
+    uint32_t high;
+
+    for(size_t i = 0; i < length; i++)
+    {
+        hash = (hash << 4) + (unsigned char) name[i];
+
+        if((high = hash & 0xf0000000) != 0)
+        {
+            hash ^= high >> 24;
+        }
+
+        hash &= ~high;
+    }
+
+    return hash;
+}
+
+
+
+/*
+ * Reads the members of a symbol the lookup needs, whatever
+ * the class of the file.
+ */
+static void read_symbol(symbol_index_t *index, uint64_t symbol_number, uint32_t *name, uint16_t *section_index, unsigned char *info)
+{
+    if(index->file_class == ELFCLASS64)
+    {
+        ELF64_Sym_t *symbol = &((ELF64_Sym_t*) index->symbols.symbols)[symbol_number];
+
+        *name = symbol->st_name;
+        *section_index = symbol->st_shndx;
+        *info = symbol->st_info;
+    }
+    else
+    {
+        ELF32_Sym_t *symbol = &((ELF32_Sym_t*) index->symbols.symbols)[symbol_number];
+
+        *name = symbol->st_name;
+        *section_index = symbol->st_shndx;
+        *info = symbol->st_info;
+    }
+}
+
+
+
+/*
+ * Checks whether the given symbol is defined and has the given
+ * name. Undefined symbols are references to other files, so they
+ * never count as a match, and neither do hidden versions: as in
+ * the dynamic linker, a name on its own means the default
+ * version of a versioned symbol (name@@VERSION), not any of the
+ * older ones (name@VERSION) kept alongside it.
+ */
+static bool symbol_matches(symbol_index_t *index, uint64_t symbol_number, const char *name, size_t length)
+{
+    uint32_t name_offset;
+    uint16_t section_index;
+    unsigned char info;
+    string_view_t symbol_name;
+
+
+    if(symbol_number >= index->symbols.num_symbols)
+    {
+        return false;
+    }
+
+    read_symbol(index, symbol_number, &name_offset, &section_index, &info);
+
+    if(section_index == SHN_UNDEF)
+    {
+        return false;
+    }
+
+    if(index->versions != NULL && (index->versions[symbol_number] & VERSYM_HIDDEN))
+    {
+        return false;
+    }
+
+    symbol_name = get_string_table_entry(index->symbols.string_table, index->symbols.string_table_size, name_offset);
+
+    return symbol_name.length == length && memcmp(symbol_name.string, name, length) == 0;
+}
+
+
+
+
+/*
+ * Builds an open-addressing table over the named, defined symbols
+ * of the index's symbol table. Global and weak symbols go in first
+ * so that, when a local symbol shares a name with one of them, the
+ * lookup finds the one other files can see.
+ */
+static void build_hash_table(symbol_index_t *index)
+{
+    uint64_t num_slots = 16;
+
+
+    while(num_slots < 2*index->symbols.num_symbols)
+    {
+        num_slots *= 2;
+    }
+
+    index->slot_mask = num_slots - 1;
+    index->slot_symbols = (uint32_t*) calloc(num_slots, sizeof(uint32_t));
+    index->slot_hashes = (uint32_t*) malloc(num_slots * sizeof(uint32_t));
+
+
+    for(int pass = 0; pass < 2; pass++)
+    {
+        for(uint64_t i = 1; i < index->symbols.num_symbols; i++)
+        {
+            uint32_t name_offset;
+            uint16_t section_index;
+            unsigned char info;
+            string_view_t name;
+            uint32_t hash;
+            uint64_t slot;
+
+            read_symbol(index, i, &name_offset, &section_index, &info);
+
+            // locals on the second pass only
+            if((ELF_ST_BIND(info) == STB_LOCAL) != (pass == 1))
+            {
+                continue;
+            }
+
+            name = get_string_table_entry(index->symbols.string_table, index->symbols.string_table_size, name_offset);
+
+            if(section_index == SHN_UNDEF || name.length == 0)
+            {
+                continue;
+            }
+
+            hash = gnu_hash(name.string, name.length);
+
+            for(slot = hash & index->slot_mask; index->slot_symbols[slot] != 0; slot = (slot + 1) & index->slot_mask)
+                ;
+
+            index->slot_symbols[slot] = (uint32_t) i + 1;
+            index->slot_hashes[slot] = hash;
+        }
+    }
+}
+
+
+
+
+/*
+ * Points the index at the dynamic symbol table of a 32-bit ELF
+ * file and the GNU or SysV hash table over it (GNU if it has
+ * both, since it is faster to search), all used in place. Returns
+ * RET_NOT_OK if the file has no dynamic section or no hash table,
+ * or if any of the tables lies outside the file.
+ */
+static int use_ELF32_dynamic_hash_table(symbol_index_t *index, elf_image_t *image, ELF32_Header_t *file_header,
+                                         ELF32_Program_Header_t *program_header_table)
+{
+    ELF32_Dyn_t *dynamic_table;
+    uint64_t num_entries;
+
+    uint64_t gnu_hash_address = 0, sysv_hash_address = 0;
+    uint64_t symbol_table_address = 0, string_table_address = 0, string_table_size = 0;
+    uint64_t versions_address = 0;
+
+    uint64_t num_symbols;
+
+
+    if((dynamic_table = get_ELF32_dynamic_table(image, file_header, program_header_table, &num_entries)) == NULL)
+    {
+        return RET_NOT_OK;
+    }
+
+    for(uint64_t i = 0; i < num_entries; i++)
+    {
+        switch(dynamic_table[i].d_tag)
+        {
+            case DT_GNU_HASH:
+                gnu_hash_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case DT_HASH:
+                sysv_hash_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case DT_SYMTAB:
+                symbol_table_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case DT_STRTAB:
+                string_table_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case DT_STRSZ:
+                string_table_size = dynamic_table[i].d_un.d_val;
+                break;
+            case DT_VERSYM:
+                versions_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if(symbol_table_address == 0 || string_table_address == 0 || (gnu_hash_address == 0 && sysv_hash_address == 0))
+    {
+        return RET_NOT_OK;
+    }
+
+
+    if(gnu_hash_address != 0)
+    {
+        /*
+         * The table is a header of four words, the Bloom filter,
+         * the buckets, and then one chain entry per symbol from
+         * symbol_offset on. Its length is not recorded anywhere,
+         * so the number of symbols is found by following the
+         * chain of the highest bucket to its end (the entry with
+         * the low bit set).
+         */
+        uint32_t *header = get_ELF32_address_range(image, file_header, program_header_table, gnu_hash_address, 4*sizeof(uint32_t));
+        uint64_t tables_size;
+        uint64_t chain_address;
+        uint32_t last_symbol = 0;
+
+        // the words of the Bloom filter are read in place, so they must be aligned
+        if(header == NULL || !is_aligned(header, _Alignof(ELF32_Addr_t)) || header[0] == 0 || header[2] == 0)
+        {
+            return RET_NOT_OK;
+        }
+
+        index->num_gnu_buckets = header[0];
+        index->symbol_offset = header[1];
+        index->bloom_size = header[2];
+        index->bloom_shift = header[3];
+
+        tables_size = 4*sizeof(uint32_t) + (uint64_t) index->bloom_size*sizeof(ELF32_Addr_t) + (uint64_t) index->num_gnu_buckets*sizeof(uint32_t);
+
+        if((header = get_ELF32_address_range(image, file_header, program_header_table, gnu_hash_address, tables_size)) == NULL)
+        {
+            return RET_NOT_OK;
+        }
+
+        index->bloom = header + 4;
+        index->gnu_buckets = (uint32_t*) ((ELF32_Addr_t*) index->bloom + index->bloom_size);
+        chain_address = gnu_hash_address + tables_size;
+
+        for(uint32_t i = 0; i < index->num_gnu_buckets; i++)
+        {
+            if(index->gnu_buckets[i] > last_symbol)
+                last_symbol = index->gnu_buckets[i];
+        }
+
+        num_symbols = index->symbol_offset;
+
+        if(last_symbol >= index->symbol_offset)
+        {
+            while(true)
+            {
+                uint32_t *entry = get_ELF32_address_range(image, file_header, program_header_table,
+                                                          chain_address + (uint64_t) (last_symbol - index->symbol_offset)*sizeof(uint32_t), sizeof(uint32_t));
+
+                if(entry == NULL)
+                    return RET_NOT_OK;
+
+                if(*entry & 1)
+                    break;
+
+                last_symbol++;
+            }
+
+            num_symbols = (uint64_t) last_symbol + 1;
+        }
+
+        index->gnu_chain = get_ELF32_address_range(image, file_header, program_header_table, chain_address,
+                                                    (num_symbols - index->symbol_offset)*sizeof(uint32_t));
+        index->method = LOOKUP_GNU_HASH;
+
+        if(index->gnu_chain == NULL && num_symbols > index->symbol_offset)
+        {
+            return RET_NOT_OK;
+        }
+    }
+    else
+    {
+        // a header of two words (the counts), the buckets and the chain
+        uint32_t *header = get_ELF32_address_range(image, file_header, program_header_table, sysv_hash_address, 2*sizeof(uint32_t));
+
+        if(header == NULL || !is_aligned(header, _Alignof(uint32_t)))
+        {
+            return RET_NOT_OK;
+        }
+
+        index->num_sysv_buckets = header[0];
+        num_symbols = header[1];
+
+        if((header = get_ELF32_address_range(image, file_header, program_header_table, sysv_hash_address,
+                                             (2 + (uint64_t) index->num_sysv_buckets + num_symbols)*sizeof(uint32_t))) == NULL)
+        {
+            return RET_NOT_OK;
+        }
+
+        index->sysv_buckets = header + 2;
+        index->sysv_chain = index->sysv_buckets + index->num_sysv_buckets;
+        index->method = LOOKUP_SYSV_HASH;
+    }
+
+
+    index->symbols.num_symbols = num_symbols;
+    index->symbols.symbols = get_ELF32_address_range(image, file_header, program_header_table, symbol_table_address, num_symbols*sizeof(ELF32_Sym_t));
+    index->symbols.string_table = get_ELF32_address_range(image, file_header, program_header_table, string_table_address, string_table_size);
+    index->symbols.string_table_size = string_table_size;
+
+    if(index->symbols.symbols == NULL || index->symbols.string_table == NULL || !is_aligned(index->symbols.symbols, _Alignof(ELF32_Sym_t)))
+    {
+        return RET_NOT_OK;
+    }
+
+    if(versions_address != 0)
+    {
+        index->versions = get_ELF32_address_range(image, file_header, program_header_table, versions_address, num_symbols*sizeof(uint16_t));
+
+        if(index->versions == NULL || !is_aligned(index->versions, _Alignof(uint16_t)))
+        {
+            return RET_NOT_OK;
+        }
+    }
+
+    index->table_name.string = ".dynsym";
+    index->table_name.length = strlen(".dynsym");
+
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Builds the index for finding symbols of a 32-bit ELF file by
+ * name. Either table may be NULL if the file lacks it. The index
+ * must be released with release_symbol_index.
+ */
+symbol_index_t *build_ELF32_symbol_index(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                                         ELF32_Program_Header_t *program_header_table, section_name_table_t *section_names)
+{
+    symbol_index_t *index;
+    int symbol_table_section = -1;
+
+
+    if(file_header == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to build_ELF32_symbol_index.\n");
+        return NULL;
+    }
+
+    index = (symbol_index_t*) calloc(1, sizeof(symbol_index_t));
+    index->file_class = ELFCLASS32;
+
+
+    if(program_header_table != NULL && use_ELF32_dynamic_hash_table(index, image, file_header, program_header_table) == RET_OK)
+    {
+        return index;
+    }
+
+
+    /*
+     * No usable hash table, so build one over .symtab,
+     * which holds every symbol, or failing that .dynsym.
+     */
+    memset(index, 0, sizeof(symbol_index_t));
+    index->file_class = ELFCLASS32;
+
+    for(int i = 0; section_header_table != NULL && i < get_ELF32_num_sections(file_header, section_header_table); i++)
+    {
+        if(section_header_table[i].sh_type == SHT_SYMTAB)
+        {
+            symbol_table_section = i;
+            break;
+        }
+
+        if(section_header_table[i].sh_type == SHT_DYNSYM && symbol_table_section < 0)
+        {
+            symbol_table_section = i;
+        }
+    }
+
+    if(symbol_table_section < 0 || get_ELF32_symbol_table(image, file_header, section_header_table, symbol_table_section, &index->symbols) != RET_OK)
+    {
+        fprintf(stderr, "No symbol table to search.\n");
+        free(index);
+        return NULL;
+    }
+
+    if(section_names != NULL)
+    {
+        index->table_name = section_names->names[symbol_table_section];
+    }
+
+    index->method = LOOKUP_BUILT_HASH;
+    build_hash_table(index);
+
+
+    return index;
+}
+
+
+
+
+/*
+ * Points the index at the dynamic symbol table of a 64-bit ELF
+ * file and the GNU or SysV hash table over it (GNU if it has
+ * both, since it is faster to search), all used in place. Returns
+ * RET_NOT_OK if the file has no dynamic section or no hash table,
+ * or if any of the tables lies outside the file.
+ */
+static int use_ELF64_dynamic_hash_table(symbol_index_t *index, elf_image_t *image, ELF64_Header_t *file_header,
+                                         ELF64_Program_Header_t *program_header_table)
+{
+    ELF64_Dyn_t *dynamic_table;
+    uint64_t num_entries;
+
+    uint64_t gnu_hash_address = 0, sysv_hash_address = 0;
+    uint64_t symbol_table_address = 0, string_table_address = 0, string_table_size = 0;
+    uint64_t versions_address = 0;
+
+    uint64_t num_symbols;
+
+
+    if((dynamic_table = get_ELF64_dynamic_table(image, file_header, program_header_table, &num_entries)) == NULL)
+    {
+        return RET_NOT_OK;
+    }
+
+    for(uint64_t i = 0; i < num_entries; i++)
+    {
+        switch(dynamic_table[i].d_tag)
+        {
+            case DT_GNU_HASH:
+                gnu_hash_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case DT_HASH:
+                sysv_hash_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case DT_SYMTAB:
+                symbol_table_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case DT_STRTAB:
+                string_table_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            case DT_STRSZ:
+                string_table_size = dynamic_table[i].d_un.d_val;
+                break;
+            case DT_VERSYM:
+                versions_address = dynamic_table[i].d_un.d_ptr;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if(symbol_table_address == 0 || string_table_address == 0 || (gnu_hash_address == 0 && sysv_hash_address == 0))
+    {
+        return RET_NOT_OK;
+    }
+
+
+    if(gnu_hash_address != 0)
+    {
+        /*
+         * The table is a header of four words, the Bloom filter,
+         * the buckets, and then one chain entry per symbol from
+         * symbol_offset on. Its length is not recorded anywhere,
+         * so the number of symbols is found by following the
+         * chain of the highest bucket to its end (the entry with
+         * the low bit set).
+         */
+        uint32_t *header = get_ELF64_address_range(image, file_header, program_header_table, gnu_hash_address, 4*sizeof(uint32_t));
+        uint64_t tables_size;
+        uint64_t chain_address;
+        uint32_t last_symbol = 0;
+
+        // the words of the Bloom filter are read in place, so they must be aligned
+        if(header == NULL || !is_aligned(header, _Alignof(ELF64_Addr_t)) || header[0] == 0 || header[2] == 0)
+        {
+            return RET_NOT_OK;
+        }
+
+        index->num_gnu_buckets = header[0];
+        index->symbol_offset = header[1];
+        index->bloom_size = header[2];
+        index->bloom_shift = header[3];
+
+        tables_size = 4*sizeof(uint32_t) + (uint64_t) index->bloom_size*sizeof(ELF64_Addr_t) + (uint64_t) index->num_gnu_buckets*sizeof(uint32_t);
+
+        if((header = get_ELF64_address_range(image, file_header, program_header_table, gnu_hash_address, tables_size)) == NULL)
+        {
+            return RET_NOT_OK;
+        }
+
+        index->bloom = header + 4;
+        index->gnu_buckets = (uint32_t*) ((ELF64_Addr_t*) index->bloom + index->bloom_size);
+        chain_address = gnu_hash_address + tables_size;
+
+        for(uint32_t i = 0; i < index->num_gnu_buckets; i++)
+        {
+            if(index->gnu_buckets[i] > last_symbol)
+                last_symbol = index->gnu_buckets[i];
+        }
+
+        num_symbols = index->symbol_offset;
+
+        if(last_symbol >= index->symbol_offset)
+        {
+            while(true)
+            {
+                uint32_t *entry = get_ELF64_address_range(image, file_header, program_header_table,
+                                                          chain_address + (uint64_t) (last_symbol - index->symbol_offset)*sizeof(uint32_t), sizeof(uint32_t));
+
+                if(entry == NULL)
+                    return RET_NOT_OK;
+
+                if(*entry & 1)
+                    break;
+
+                last_symbol++;
+            }
+
+            num_symbols = (uint64_t) last_symbol + 1;
+        }
+
+        index->gnu_chain = get_ELF64_address_range(image, file_header, program_header_table, chain_address,
+                                                    (num_symbols - index->symbol_offset)*sizeof(uint32_t));
+        index->method = LOOKUP_GNU_HASH;
+
+        if(index->gnu_chain == NULL && num_symbols > index->symbol_offset)
+        {
+            return RET_NOT_OK;
+        }
+    }
+    else
+    {
+        // a header of two words (the counts), the buckets and the chain
+        uint32_t *header = get_ELF64_address_range(image, file_header, program_header_table, sysv_hash_address, 2*sizeof(uint32_t));
+
+        if(header == NULL || !is_aligned(header, _Alignof(uint32_t)))
+        {
+            return RET_NOT_OK;
+        }
+
+        index->num_sysv_buckets = header[0];
+        num_symbols = header[1];
+
+        if((header = get_ELF64_address_range(image, file_header, program_header_table, sysv_hash_address,
+                                             (2 + (uint64_t) index->num_sysv_buckets + num_symbols)*sizeof(uint32_t))) == NULL)
+        {
+            return RET_NOT_OK;
+        }
+
+        index->sysv_buckets = header + 2;
+        index->sysv_chain = index->sysv_buckets + index->num_sysv_buckets;
+        index->method = LOOKUP_SYSV_HASH;
+    }
+
+
+    index->symbols.num_symbols = num_symbols;
+    index->symbols.symbols = get_ELF64_address_range(image, file_header, program_header_table, symbol_table_address, num_symbols*sizeof(ELF64_Sym_t));
+    index->symbols.string_table = get_ELF64_address_range(image, file_header, program_header_table, string_table_address, string_table_size);
+    index->symbols.string_table_size = string_table_size;
+
+    if(index->symbols.symbols == NULL || index->symbols.string_table == NULL || !is_aligned(index->symbols.symbols, _Alignof(ELF64_Sym_t)))
+    {
+        return RET_NOT_OK;
+    }
+
+    if(versions_address != 0)
+    {
+        index->versions = get_ELF64_address_range(image, file_header, program_header_table, versions_address, num_symbols*sizeof(uint16_t));
+
+        if(index->versions == NULL || !is_aligned(index->versions, _Alignof(uint16_t)))
+        {
+            return RET_NOT_OK;
+        }
+    }
+
+    index->table_name.string = ".dynsym";
+    index->table_name.length = strlen(".dynsym");
+
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Builds the index for finding symbols of a 64-bit ELF file by
+ * name. Either table may be NULL if the file lacks it. The index
+ * must be released with release_symbol_index.
+ */
+symbol_index_t *build_ELF64_symbol_index(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                                         ELF64_Program_Header_t *program_header_table, section_name_table_t *section_names)
+{
+    symbol_index_t *index;
+    int symbol_table_section = -1;
+
+
+    if(file_header == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to build_ELF64_symbol_index.\n");
+        return NULL;
+    }
+
+    index = (symbol_index_t*) calloc(1, sizeof(symbol_index_t));
+    index->file_class = ELFCLASS64;
+
+
+    if(program_header_table != NULL && use_ELF64_dynamic_hash_table(index, image, file_header, program_header_table) == RET_OK)
+    {
+        return index;
+    }
+
+
+    /*
+     * No usable hash table, so build one over .symtab,
+     * which holds every symbol, or failing that .dynsym.
+     */
+    memset(index, 0, sizeof(symbol_index_t));
+    index->file_class = ELFCLASS64;
+
+    for(int i = 0; section_header_table != NULL && i < get_ELF64_num_sections(file_header, section_header_table); i++)
+    {
+        if(section_header_table[i].sh_type == SHT_SYMTAB)
+        {
+            symbol_table_section = i;
+            break;
+        }
+
+        if(section_header_table[i].sh_type == SHT_DYNSYM && symbol_table_section < 0)
+        {
+            symbol_table_section = i;
+        }
+    }
+
+    if(symbol_table_section < 0 || get_ELF64_symbol_table(image, file_header, section_header_table, symbol_table_section, &index->symbols) != RET_OK)
+    {
+        fprintf(stderr, "No symbol table to search.\n");
+        free(index);
+        return NULL;
+    }
+
+    if(section_names != NULL)
+    {
+        index->table_name = section_names->names[symbol_table_section];
+    }
+
+    index->method = LOOKUP_BUILT_HASH;
+    build_hash_table(index);
+
+
+    return index;
+}
+
+
+
+
+/*
+ * A symbol's range while the address index is being built,
+ * before it goes into the range index.
+ */
+typedef struct
+{
+    uint64_t start;
+    uint64_t end;
+    string_view_t name;
+
+    // preference when several symbols start at the same address
+    int rank;
+
+    // where the symbol was found: its table first, then its index in the table
+    uint64_t order;
+
+} address_range_t;
+
+
+
+/*
+ * Orders ranges by start address and, for equal starts, puts
+ * the preferred one first: the higher rank, then the longer
+ * range, then the symbol found first. No two ranges compare
+ * equal, so the one kept does not depend on how qsort orders
+ * ties.
+ */
+static int compare_address_ranges(const void *first, const void *second)
+{
+    const address_range_t *range1 = (const address_range_t*) first;
+    const address_range_t *range2 = (const address_range_t*) second;
+
+    if(range1->start != range2->start)
+        return (range1->start < range2->start) ? -1 : 1;
+
+    if(range1->rank != range2->rank)
+        return (range1->rank > range2->rank) ? -1 : 1;
+
+    if(range1->end != range2->end)
+        return (range1->end > range2->end) ? -1 : 1;
+
+    if(range1->order != range2->order)
+        return (range1->order < range2->order) ? -1 : 1;
+
+    return 0;
+}
+
+
+
+/*
+ * Decides whether a symbol gets a range in the address index, and
+ * how strongly its binding makes it preferred over others at the
+ * same address: global over weak over local.
+ */
+static bool symbol_has_range(unsigned char info, uint16_t section_index, uint64_t size, int *rank)
+{
+    unsigned char type = ELF_ST_TYPE(info);
+
+    if(section_index == SHN_UNDEF || section_index == SHN_ABS || size == 0)
+        return false;
+
+    if(type != STT_FUNC && type != STT_OBJECT && type != STT_GNU_IFUNC && type != STT_NOTYPE)
+        return false;
+
+    switch(ELF_ST_BIND(info))
+    {
+        case STB_GLOBAL:
+            *rank = 2;
+            break;
+        case STB_WEAK:
+            *rank = 1;
+            break;
+        default:
+            *rank = 0;
+            break;
+    }
+
+    return true;
+}
+
+
+
+/*
+ * Sorts the collected ranges, keeps the preferred one of each
+ * group with the same start address (.symtab and .dynsym list
+ * most exported symbols twice), and builds the range index over
+ * them, with the names kept in sorted order. Takes ownership of
+ * the ranges.
+ */
+static address_index_t *finish_address_index(address_range_t *ranges, uint64_t num_ranges)
+{
+    address_index_t *index = (address_index_t*) malloc(sizeof(address_index_t));
+    range_t *sorted = (range_t*) malloc((num_ranges + 1) * sizeof(range_t));
+
+
+    qsort(ranges, num_ranges, sizeof(address_range_t), compare_address_ranges);
+
+    index->names = (string_view_t*) malloc((num_ranges + 1) * sizeof(string_view_t));
+
+    for(uint64_t i = 0; i < num_ranges; i++)
+    {
+        sorted[i].start = ranges[i].start;
+        sorted[i].end = ranges[i].end;
+        sorted[i].payload = i;
+        index->names[i] = ranges[i].name;
+    }
+
+    index->ranges = build_range_index(sorted, num_ranges, RANGES_KEEP_FIRST);
+
+    free(sorted);
+    free(ranges);
+
+    return index;
+}
+
+
+
+
+/*
+ * Builds the index for finding the symbol containing an address
+ * in a 32-bit ELF file, from the function and object symbols
+ * of both .symtab and .dynsym. The index must be released with
+ * release_address_index.
+ */
+address_index_t *build_ELF32_address_index(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table)
+{
+    address_range_t *ranges;
+    uint64_t num_ranges = 0;
+    uint64_t capacity = 0;
+    symbol_table_t tables[2];
+    int num_tables = 0;
+
+
+    if(file_header == NULL || section_header_table == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to build_ELF32_address_index.\n");
+        return NULL;
+    }
+
+
+    for(int i = 0; i < get_ELF32_num_sections(file_header, section_header_table) && num_tables < 2; i++)
+    {
+        if(section_header_table[i].sh_type != SHT_SYMTAB && section_header_table[i].sh_type != SHT_DYNSYM)
+            continue;
+
+        if(get_ELF32_symbol_table(image, file_header, section_header_table, i, &tables[num_tables]) != RET_OK)
+            continue;
+
+        capacity += tables[num_tables].num_symbols;
+        num_tables++;
+    }
+
+    if(num_tables == 0)
+    {
+        fprintf(stderr, "No symbol table to search.\n");
+        return NULL;
+    }
+
+
+    ranges = (address_range_t*) malloc((capacity + 1) * sizeof(address_range_t));
+
+    for(int t = 0; t < num_tables; t++)
+    {
+        ELF32_Sym_t *symbols = (ELF32_Sym_t*) tables[t].symbols;
+
+        for(uint64_t i = 0; i < tables[t].num_symbols; i++)
+        {
+            int rank;
+
+            if(!symbol_has_range(symbols[i].st_info, symbols[i].st_shndx, symbols[i].st_size, &rank))
+                continue;
+
+            ranges[num_ranges].start = symbols[i].st_value;
+            ranges[num_ranges].end = symbols[i].st_value + symbols[i].st_size;
+            ranges[num_ranges].name = get_string_table_entry(tables[t].string_table, tables[t].string_table_size, symbols[i].st_name);
+            ranges[num_ranges].rank = rank;
+            ranges[num_ranges].order = num_ranges;
+            num_ranges++;
+        }
+    }
+
+
+    return finish_address_index(ranges, num_ranges);
+}
+
+
+
+
+/*
+ * Builds the index for finding the symbol containing an address
+ * in a 64-bit ELF file, from the function and object symbols
+ * of both .symtab and .dynsym. The index must be released with
+ * release_address_index.
+ */
+address_index_t *build_ELF64_address_index(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table)
+{
+    address_range_t *ranges;
+    uint64_t num_ranges = 0;
+    uint64_t capacity = 0;
+    symbol_table_t tables[2];
+    int num_tables = 0;
+
+
+    if(file_header == NULL || section_header_table == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to build_ELF64_address_index.\n");
+        return NULL;
+    }
+
+
+    for(int i = 0; i < get_ELF64_num_sections(file_header, section_header_table) && num_tables < 2; i++)
+    {
+        if(section_header_table[i].sh_type != SHT_SYMTAB && section_header_table[i].sh_type != SHT_DYNSYM)
+            continue;
+
+        if(get_ELF64_symbol_table(image, file_header, section_header_table, i, &tables[num_tables]) != RET_OK)
+            continue;
+
+        capacity += tables[num_tables].num_symbols;
+        num_tables++;
+    }
+
+    if(num_tables == 0)
+    {
+        fprintf(stderr, "No symbol table to search.\n");
+        return NULL;
+    }
+
+
+    ranges = (address_range_t*) malloc((capacity + 1) * sizeof(address_range_t));
+
+    for(int t = 0; t < num_tables; t++)
+    {
+        ELF64_Sym_t *symbols = (ELF64_Sym_t*) tables[t].symbols;
+
+        for(uint64_t i = 0; i < tables[t].num_symbols; i++)
+        {
+            int rank;
+
+            if(!symbol_has_range(symbols[i].st_info, symbols[i].st_shndx, symbols[i].st_size, &rank))
+                continue;
+
+            ranges[num_ranges].start = symbols[i].st_value;
+            ranges[num_ranges].end = symbols[i].st_value + symbols[i].st_size;
+            ranges[num_ranges].name = get_string_table_entry(tables[t].string_table, tables[t].string_table_size, symbols[i].st_name);
+            ranges[num_ranges].rank = rank;
+            ranges[num_ranges].order = num_ranges;
+            num_ranges++;
+        }
+    }
+
+
+    return finish_address_index(ranges, num_ranges);
+}
+
+
+
+
+void release_symbol_index(symbol_index_t *index)
+{
+    if(index == NULL)
+    {
+        return;
+    }
+
+    free(index->slot_symbols);
+    free(index->slot_hashes);
+    free(index);
+}
+
+
+
+
+/*
+ * Looks a defined symbol up by name. The name is given with its
+ * length, so it need not be NULL-terminated. Returns the symbol's
+ * index in index->symbols, or -1 if there is no such symbol.
+ */
+int64_t find_symbol(symbol_index_t *index, const char *name, size_t length)
+{
+    switch(index->method)
+    {
+        case LOOKUP_GNU_HASH:
+        {
+            uint32_t hash = gnu_hash(name, length);
+            uint32_t word_bits = (index->file_class == ELFCLASS64) ? 64 : 32;
+            uint32_t word_index = (hash / word_bits) % index->bloom_size;
+            uint64_t word;
+            uint64_t mask;
+
+            /*
+             * The Bloom filter rules most missing names out
+             * before any bucket or string is looked at.
+             */
+            if(index->file_class == ELFCLASS64)
+                word = ((uint64_t*) index->bloom)[word_index];
+            else
+                word = ((uint32_t*) index->bloom)[word_index];
+
+            mask = ((uint64_t) 1 << (hash % word_bits)) | ((uint64_t) 1 << ((hash >> index->bloom_shift) % word_bits));
+
+            if((word & mask) != mask)
+            {
+                return -1;
+            }
+
+
+            // the chain stores each symbol's hash with the low bit marking the end
+            for(uint64_t i = index->gnu_buckets[hash % index->num_gnu_buckets];
+                i >= index->symbol_offset && i < index->symbols.num_symbols; i++)
+            {
+                uint32_t chain_hash = index->gnu_chain[i - index->symbol_offset];
+
+                if((chain_hash | 1) == (hash | 1) && symbol_matches(index, i, name, length))
+                {
+                    return (int64_t) i;
+                }
+
+                if(chain_hash & 1)
+                {
+                    break;
+                }
+            }
+
+            return -1;
+        }
+
+        case LOOKUP_SYSV_HASH:
+        {
+            uint32_t hash = sysv_hash(name, length);
+            uint32_t i;
+
+            if(index->num_sysv_buckets == 0)
+            {
+                return -1;
+            }
+
+            /*
+             * The steps are counted so that a corrupt chain
+             * that loops cannot hang the lookup.
+             */
+            i = index->sysv_buckets[hash % index->num_sysv_buckets];
+
+            for(uint64_t steps = 0; i != STN_UNDEF && i < index->symbols.num_symbols && steps < index->symbols.num_symbols; steps++)
+            {
+                if(symbol_matches(index, i, name, length))
+                {
+                    return (int64_t) i;
+                }
+
+                i = index->sysv_chain[i];
+            }
+
+            return -1;
+        }
+
+        case LOOKUP_BUILT_HASH:
+        {
+            uint32_t hash = gnu_hash(name, length);
+
+            for(uint64_t slot = hash & index->slot_mask; index->slot_symbols[slot] != 0; slot = (slot + 1) & index->slot_mask)
+            {
+                if(index->slot_hashes[slot] == hash && symbol_matches(index, index->slot_symbols[slot] - 1, name, length))
+                {
+                    return (int64_t) index->slot_symbols[slot] - 1;
+                }
+            }
+
+            return -1;
+        }
+
+        default:
+            return -1;
+    }
+}
+
+
+
+
+void release_address_index(address_index_t *index)
+{
+    if(index == NULL)
+    {
+        return;
+    }
+
+    release_range_index(index->ranges);
+    free(index->names);
+    free(index);
+}
+
+
+
+
+/*
+ * Returns the slot for a section name: the slot holding the
+ * name's group if there is one, and otherwise the empty slot
+ * where the group would go.
+ */
+static uint64_t find_section_name_slot(section_name_index_t *index, const char *name, size_t length, uint32_t hash)
+{
+    uint64_t slot;
+
+    for(slot = hash & index->slot_mask; index->slot_starts[slot] != 0; slot = (slot + 1) & index->slot_mask)
+    {
+        string_view_t *group_name = &index->section_names->names[index->sections[index->slot_starts[slot] - 1]];
+
+        if(index->slot_hashes[slot] == hash && group_name->length == length && memcmp(group_name->string, name, length) == 0)
+        {
+            break;
+        }
+    }
+
+    return slot;
+}
+
+
+
+/*
+ * Builds the index over a table of section names. The names are
+ * used in place, so the table must outlive the index. The groups
+ * are laid out in the order their names first appear, by counting
+ * the sections with each name and then placing each section in
+ * its group.
+ */
+section_name_index_t *build_section_name_index(section_name_table_t *section_names)
+{
+    section_name_index_t *index;
+    uint64_t num_slots = 16;
+    uint64_t *section_slots;
+    uint32_t *next_positions;
+    uint32_t num_placed = 0;
+
+
+    if((index = (section_name_index_t*) calloc(1, sizeof(section_name_index_t))) == NULL)
+    {
+        return NULL;
+    }
+
+    while(num_slots < 2 * (uint64_t) section_names->num_names)
+    {
+        num_slots *= 2;
+    }
+
+    index->section_names = section_names;
+    index->sections = (int*) malloc((section_names->num_names + 1) * sizeof(int));
+    index->slot_mask = num_slots - 1;
+    index->slot_starts = (uint32_t*) calloc(num_slots, sizeof(uint32_t));
+    index->slot_counts = (uint32_t*) calloc(num_slots, sizeof(uint32_t));
+    index->slot_hashes = (uint32_t*) malloc(num_slots * sizeof(uint32_t));
+
+    section_slots = (uint64_t*) malloc((section_names->num_names + 1) * sizeof(uint64_t));
+    next_positions = (uint32_t*) malloc(num_slots * sizeof(uint32_t));
+
+
+    /*
+     * Count the sections with each name. Until every group has
+     * been counted, a group's start is the first section with
+     * its name, which is where its name is read from.
+     */
+    for(int i = 0; i < section_names->num_names; i++)
+    {
+        string_view_t *name = &section_names->names[i];
+        uint32_t hash = gnu_hash(name->string, name->length);
+        uint64_t slot;
+
+        index->sections[i] = i;
+        slot = find_section_name_slot(index, name->string, name->length, hash);
+
+        if(index->slot_starts[slot] == 0)
+        {
+            index->slot_starts[slot] = i + 1;
+            index->slot_hashes[slot] = hash;
+        }
+
+        index->slot_counts[slot]++;
+        section_slots[i] = slot;
+    }
+
+
+    // give each group its place, in the order the names first appear
+    for(int i = 0; i < section_names->num_names; i++)
+    {
+        uint64_t slot = section_slots[i];
+
+        if(index->slot_starts[slot] == (uint32_t) i + 1)
+        {
+            next_positions[slot] = num_placed;
+            num_placed += index->slot_counts[slot];
+        }
+    }
+
+    for(uint64_t slot = 0; slot < num_slots; slot++)
+    {
+        if(index->slot_starts[slot] != 0)
+        {
+            index->slot_starts[slot] = next_positions[slot] + 1;
+        }
+    }
+
+    for(int i = 0; i < section_names->num_names; i++)
+    {
+        index->sections[next_positions[section_slots[i]]++] = i;
+    }
+
+
+    free(section_slots);
+    free(next_positions);
+
+    return index;
+}
+
+
+
+void release_section_name_index(section_name_index_t *index)
+{
+    if(index == NULL)
+    {
+        return;
+    }
+
+    free(index->sections);
+    free(index->slot_starts);
+    free(index->slot_counts);
+    free(index->slot_hashes);
+    free(index);
+}
+
+
+
+/*
+ * Finds the sections with a given name, which need not be
+ * NULL-terminated. Returns how many there are, and points
+ * sections at their indices, in increasing order.
+ */
+int find_sections(section_name_index_t *index, const char *name, size_t length, const int **sections)
+{
+    uint64_t slot = find_section_name_slot(index, name, length, gnu_hash(name, length));
+
+    if(index->slot_starts[slot] == 0)
+    {
+        return 0;
+    }
+
+    *sections = &index->sections[index->slot_starts[slot] - 1];
+    return (int) index->slot_counts[slot];
+}
@@ -12,16 +12,18 @@
 #include <errno.h>
 #include <string.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 
 #include "elf.h"
 #include "readelf.h"
 #include "debug.h"
 #include "commands.h"
-
-
-
-#define MAX_FILENAME_LENGTH     1024
+#include "session.h"
+#include "output.h"
+#include "pool.h"
+#include "scan.h"
+#include "dump.h"
 
 
 
@@ -39,12 +41,14 @@ void finish_up_and_free_things()
 int is_substring(char *string1, char *string2)
 {
     int index = 0;
-    while( string1[index] != '\0' || string2[index] != '\0' )
+    while( string1[index] != '\0' && string2[index] != '\0' )
     {
         if(string1[index] != string2[index])
         {
             return false;
         }
+
+        index++;
     }
 
     return true;
@@ -59,10 +63,15 @@ int is_substring(char *string1, char *string2)
  */
 int is_int(char *string)
 {
+    if(*string == '\0')
+    {
+        return false;
+    }
+
     while(*string != '\0')
     {
         // if char is out of range 0-9, it is not an integer
-        if( (int)(*string) - (int)'0' >= 10 )
+        if( *string < '0' || *string > '9' )
         {
             return false;
         }
@@ -81,8 +90,10 @@ int is_int(char *string)
  */
 void print_usage_message()
 {
-    fprintf(stderr, "Usage: dumpelf [OPTIONS] [FILENAME]\n");
+    fprintf(stderr, "Usage: dumpelf [OPTIONS] [FILENAME...]\n");
     fprintf(stderr, "OPTIONS:\n");
+    fprintf(stderr, "\t[-j <number of threads>]\t\t\t\t\tProcess several files at once\n");
+    fprintf(stderr, "\t[--recursive <directory>]\t\t\t\t\tDump every ELF file under a directory\n");
     fprintf(stderr, "\t[-h | --file-header]\t\t\t\t\t\tDump ELF file header\n");
     fprintf(stderr, "\t[-S | --sections | --section-headers]\t\t\t\tDump section header table\n");
     fprintf(stderr, "\t[-l | --segments | --program-headers]\t\t\t\tDump program header table if it exists\n");
@@ -91,13 +102,20 @@ void print_usage_message()
     fprintf(stderr, "\t[-r | --relocs]\t\t\t\t\t\t\tDump the relocation information\n");
     fprintf(stderr, "\t[--hex-dump=<section name or number>]\t\t\t\tHex dump a particular section\n");
     fprintf(stderr, "\t[--string-dump=<section name or number>]\t\t\tString dump a particular section\n");
+    fprintf(stderr, "\t[--parallel-dump-threshold=<bytes>]\t\t\t\tDump sections this large on all -j threads\n");
+    fprintf(stderr, "\t[--lookup-symbol=<name>[,<name>...]]\t\t\t\tLook up defined symbols by name\n");
+    fprintf(stderr, "\t[--addr2sym]\t\t\t\t\t\t\tFind the symbols containing addresses read from stdin\n");
+    fprintf(stderr, "\t[--addr2cu]\t\t\t\t\t\t\tFind the compilation units containing addresses read from stdin\n");
+    fprintf(stderr, "\t[--find-fde=<address>[,<address>...]]\t\t\t\tFind the FDEs covering addresses\n");
+    fprintf(stderr, "\t[--find-name=<name>[,<name>...]]\t\t\t\tFind DIEs by name through .debug_names\n");
     fprintf(stderr, "\t[--debug-dump=<abbrev, addr, frames, names, info, aranges>]\tDump debug info\n\n");
     fprintf(stderr, "\t\t<abbrev>\tDump contents of .debug_abbrev section\n");
     fprintf(stderr, "\t\t<addr>\t\tDump the contents of .debug_addr section\n");
-    fprintf(stderr, "\t\t<frames>\tDump the contents of .debug_frame section\n");
+    fprintf(stderr, "\t\t<frames>\tDump the contents of .eh_frame and .debug_frame sections\n");
     fprintf(stderr, "\t\t<names>\t\tDump the contents of .debug_names section\n");
     fprintf(stderr, "\t\t<info>\t\tDump the contents of .debug_info section\n");
     fprintf(stderr, "\t\t<aranges>\tDump the contents of .debug_aranges section\n");
+    fprintf(stderr, "\t[--dwarf-depth=<depth>]\t\t\t\t\t\tOnly dump DIEs nested less deeply than this\n");
 }
 
 
@@ -138,13 +156,120 @@ int get_debug_subtype(char *string)
 }
 
 
-int parse_command_line_options(int argc, char *argv[], command_list_t *commands, char *filename)
+/*
+ * Parses the command-line options into the list of commands.
+ * Every argument that is not an option is the name of a file
+ * to run the commands on, and is added to the file list along
+ * with the files under any directory given to --recursive.
+ */
+int parse_command_line_options(int argc, char *argv[], command_list_t *commands, file_list_t *files, int *num_threads,
+                               uint64_t *parallel_dump_threshold, int *dwarf_depth)
 {
 
+    *num_threads = 1;
+    *parallel_dump_threshold = DEFAULT_PARALLEL_DUMP_THRESHOLD;
+    *dwarf_depth = -1;
     
     for(int i = 1; i < argc; i++)
     {
-        command_t *new_command = (command_t*)malloc(sizeof(command_t));
+        /*
+         * The number of threads is not a command, so it is
+         * handled before a command is allocated. It may be
+         * given either as -j N or as -jN.
+         */
+        if(strncmp(argv[i], "-j", 2) == 0)
+        {
+            char *number = argv[i] + 2;
+
+            if(*number == '\0' && i + 1 < argc)
+            {
+                i++;
+                number = argv[i];
+            }
+
+            if(!is_int(number) || atoi(number) <= 0)
+            {
+                fprintf(stderr, "Invalid number of threads for -j: %s\n", number);
+                print_usage_message();
+                finish_up_and_free_things();
+                return RET_NOT_OK;
+            }
+
+            *num_threads = atoi(number);
+            continue;
+        }
+
+
+        // and the size from which a section is dumped on several threads
+        if(is_substring("--parallel-dump-threshold=", argv[i]))
+        {
+            char *number = argv[i] + strlen("--parallel-dump-threshold=");
+
+            if(!is_int(number))
+            {
+                fprintf(stderr, "Invalid size for --parallel-dump-threshold: %s\n", number);
+                print_usage_message();
+                finish_up_and_free_things();
+                return RET_NOT_OK;
+            }
+
+            *parallel_dump_threshold = strtoull(number, NULL, 10);
+            continue;
+        }
+
+
+        // and how deep into the DIEs --debug-dump=info goes
+        if(is_substring("--dwarf-depth=", argv[i]))
+        {
+            char *number = argv[i] + strlen("--dwarf-depth=");
+
+            if(!is_int(number))
+            {
+                fprintf(stderr, "Invalid depth for --dwarf-depth: %s\n", number);
+                print_usage_message();
+                finish_up_and_free_things();
+                return RET_NOT_OK;
+            }
+
+            *dwarf_depth = atoi(number);
+            continue;
+        }
+
+
+        // likewise the directories, as --recursive dir or --recursive=dir
+        if(is_substring("--recursive", argv[i]))
+        {
+            char *directory = NULL;
+
+            if(strcmp(argv[i], "--recursive") == 0 && i + 1 < argc)
+            {
+                i++;
+                directory = argv[i];
+            }
+            else if(strncmp(argv[i], "--recursive=", strlen("--recursive=")) == 0)
+            {
+                directory = argv[i] + strlen("--recursive=");
+            }
+
+            if(directory == NULL || *directory == '\0')
+            {
+                fprintf(stderr, "Unspecified directory for --recursive.\n");
+                print_usage_message();
+                finish_up_and_free_things();
+                return RET_NOT_OK;
+            }
+
+            if(add_directory(files, directory) != RET_OK)
+            {
+                finish_up_and_free_things();
+                return RET_NOT_OK;
+            }
+
+            continue;
+        }
+
+
+        command_t *new_command = (command_t*)calloc(1, sizeof(command_t));
 
         if( (strcmp(argv[i], "-h") == 0) || (strcmp(argv[i], "--file-header") == 0) )
         {
@@ -210,7 +335,7 @@ int parse_command_line_options(int argc, char *argv[], command_list_t *commands,
             }
             else
             {
-                new_command->section_name = (char *)malloc(strlen(ptr)*sizeof(char));
+                new_command->section_name = (char *)malloc((strlen(ptr)+1)*sizeof(char));
                 strncpy(new_command->section_name, ptr, strlen(ptr)+1);
             }
 
@@ -239,7 +364,7 @@ int parse_command_line_options(int argc, char *argv[], command_list_t *commands,
             }
             else
             {
-                new_command->section_name = (char *)malloc(strlen(ptr)*sizeof(char));
+                new_command->section_name = (char *)malloc((strlen(ptr)+1)*sizeof(char));
                 strncpy(new_command->section_name, ptr, strlen(ptr)+1);
             }
 
@@ -273,12 +398,77 @@ int parse_command_line_options(int argc, char *argv[], command_list_t *commands,
             add_command(commands, new_command);
         }
 
+        else if(strcmp(argv[i], "--addr2sym") == 0)
+        {
+            new_command->type = CMD_ADDRESS_TO_SYMBOL;
+            new_command->invoking_option = argv[i];
+            add_command(commands, new_command);
+        }
+
+        else if(strcmp(argv[i], "--addr2cu") == 0)
+        {
+            new_command->type = CMD_ADDRESS_TO_UNIT;
+            new_command->invoking_option = argv[i];
+            add_command(commands, new_command);
+        }
+
+        else if(is_substring("--lookup-symbol=", argv[i]))
+        {
+            if(strlen("--lookup-symbol=") >= strlen(argv[i]))
+            {
+                fprintf(stderr, "Unspecified symbol for --lookup-symbol.\n");
+                print_usage_message();
+                finish_up_and_free_things();
+                return RET_NOT_OK;
+            }
+
+            new_command->type = CMD_LOOKUP_SYMBOL;
+            new_command->invoking_option = argv[i];
+            new_command->symbol_names = argv[i] + strlen("--lookup-symbol=");
+
+            add_command(commands, new_command);
+        }
+
+        else if(is_substring("--find-fde=", argv[i]))
+        {
+            if(strlen("--find-fde=") >= strlen(argv[i]))
+            {
+                fprintf(stderr, "Unspecified address for --find-fde.\n");
+                print_usage_message();
+                finish_up_and_free_things();
+                return RET_NOT_OK;
+            }
+
+            new_command->type = CMD_FIND_FDE;
+            new_command->invoking_option = argv[i];
+            new_command->fde_addresses = argv[i] + strlen("--find-fde=");
+
+            add_command(commands, new_command);
+        }
+
+        else if(is_substring("--find-name=", argv[i]))
+        {
+            if(strlen("--find-name=") >= strlen(argv[i]))
+            {
+                fprintf(stderr, "Unspecified name for --find-name.\n");
+                print_usage_message();
+                finish_up_and_free_things();
+                return RET_NOT_OK;
+            }
+
+            new_command->type = CMD_FIND_NAME;
+            new_command->invoking_option = argv[i];
+            new_command->debug_names = argv[i] + strlen("--find-name=");
+
+            add_command(commands, new_command);
+        }
+
         else if( argv[i][0] != '-' )
         {
             // any command-line argument without a begining '-'
             // is interpreted as a filename
             
-            strcpy(filename, argv[i]);
+            add_file(files, argv[i], false);
             free(new_command);
         }
 
@@ -291,33 +481,399 @@ int parse_command_line_options(int argc, char *argv[], command_list_t *commands,
         }
     }
 
-    if (filename == NULL)
+    return RET_OK;
+}
+
+
+
+
+/*
+ * Counts the commands that read queries from standard
+ * input.
+ */
+int count_standard_input_readers(command_list_t *commands)
+{
+    int num_readers = 0;
+
+    for(int i = 0; i < commands->num_commands; i++)
+    {
+        if(commands->command_array[i]->type == CMD_ADDRESS_TO_SYMBOL ||
+           commands->command_array[i]->type == CMD_ADDRESS_TO_UNIT)
+        {
+            num_readers++;
+        }
+    }
+
+    return num_readers;
+}
+
+
+
+
+/*
+ * Runs one command over a file, writing what it prints to
+ * the given output.
+ */
+int run_command(elf_session_t *session, output_t *output, command_t *command)
+{
+    switch(command->type)
+    {
+        case CMD_DUMP_ELF_HEADER:
+            dump_elf_header(session, output);
+            break;
+        case CMD_DUMP_SECTION_HEADERS:
+            dump_section_headers(session, output);
+            break;
+        case CMD_DUMP_PROGRAM_HEADERS:
+            dump_program_headers(session, output);
+            break;
+        case CMD_DUMP_SYMBOL_TABLE:
+            dump_symbol_table(session, output);
+            break;
+        case CMD_DUMP_RELOCATION_INFO:
+            dump_relocation_info(session, output);
+            break;
+        case CMD_HEX_DUMP_SECTION:
+            hex_dump_section(session, output, command->section_number, command->section_name,
+                             command->pool, command->parallel_dump_threshold);
+            break;
+        case CMD_STRING_DUMP_SECTION:
+            string_dump_section(session, output, command->section_number, command->section_name,
+                                command->pool, command->parallel_dump_threshold);
+            break;
+        case CMD_DUMP_DEBUG_INFO:
+            dump_debug_info(session, output, command->subtype, command->dwarf_depth,
+                            command->pool, command->parallel_dump_threshold);
+            break;
+        case CMD_LOOKUP_SYMBOL:
+            lookup_symbols(session, output, command->symbol_names);
+            break;
+        case CMD_ADDRESS_TO_SYMBOL:
+            resolve_addresses(session, output);
+            break;
+        case CMD_ADDRESS_TO_UNIT:
+            resolve_unit_addresses(session, output);
+            break;
+        case CMD_FIND_FDE:
+            find_fdes(session, output, command->fde_addresses);
+            break;
+        case CMD_FIND_NAME:
+            find_debug_names(session, output, command->debug_names);
+            break;
+        default:
+            return RET_NOT_OK;
+            break;
+    }
+
+    return RET_OK;
+}
+
+
+
+
+/*
+ * Whether a command may only be run once every command before
+ * it has been written. The dumps that split a large section
+ * over the pool do so as the command is written, rather than
+ * holding the whole dump in memory until then, and standard
+ * input is read as the answers are written.
+ */
+bool is_run_by_caller(command_t *command)
+{
+    switch(command->type)
+    {
+        case CMD_HEX_DUMP_SECTION:
+        case CMD_STRING_DUMP_SECTION:
+        case CMD_ADDRESS_TO_SYMBOL:
+        case CMD_ADDRESS_TO_UNIT:
+            return true;
+        case CMD_DUMP_DEBUG_INFO:
+            return command->subtype == DBG_CMD_DUMP_INFO;
+        default:
+            return false;
+    }
+}
+
+
+
+/*
+ * The commands of one file being run as a list of jobs, one
+ * per command, whose outputs are written out in command order.
+ */
+typedef struct
+{
+    elf_session_t *session;
+    command_list_t *commands;
+
+    // one result per command
+    int *results;
+
+} command_batch_t;
+
+
+
+void run_command_job(void *context, int job_number, output_t *output)
+{
+    command_batch_t *batch = (command_batch_t*) context;
+
+    batch->results[job_number] = run_command(batch->session, output, batch->commands->command_array[job_number]);
+}
+
+
+
+int finish_command_job(void *context, int job_number)
+{
+    command_batch_t *batch = (command_batch_t*) context;
+
+    return batch->results[job_number];
+}
+
+
+
+/*
+ * Runs every command in the list over one file, writing what
+ * they print to the given output in command order, and stopping
+ * at the first command that fails. With a pool the commands run
+ * at the same time, which is safe since they only read the mapped
+ * file and the session's cache is locked.
+ */
+int run_commands(elf_session_t *session, output_t *output, command_list_t *commands, thread_pool_t *pool)
+{
+    command_batch_t batch;
+    ordered_jobs_t jobs;
+    bool *run_by_caller;
+    int result;
+
+
+    batch.session = session;
+    batch.commands = commands;
+    batch.results = (int*) malloc(commands->num_commands * sizeof(int));
+    run_by_caller = (bool*) malloc(commands->num_commands * sizeof(bool));
+
+    for(int i = 0; i < commands->num_commands; i++)
+    {
+        run_by_caller[i] = is_run_by_caller(commands->command_array[i]);
+    }
+
+    jobs.function = run_command_job;
+    jobs.finish = finish_command_job;
+    jobs.context = &batch;
+    jobs.num_jobs = commands->num_commands;
+    jobs.output_size = MEMORY_OUTPUT_SIZE;
+    jobs.run_by_caller = run_by_caller;
+
+    result = run_ordered_jobs(pool, output, &jobs);
+
+    free(batch.results);
+    free(run_by_caller);
+
+
+    return result;
+}
+
+
+
+
+/*
+ * One file of a batch. A worker that takes the file ahead of
+ * the main thread renders its whole report into a memory output,
+ * which is copied to standard output once every earlier file has
+ * been written, so the reports come out in the order the files
+ * were given no matter which finishes first.
+ */
+typedef struct
+{
+    char *filename;
+
+    // set for files found by --recursive, which are skipped unless they are ELF files
+    bool must_be_ELF;
+
+    // errno from opening the file, or 0 if it opened
+    int error;
+
+    // set if a command could not be run
+    bool failed;
+
+} file_job_t;
+
+
+
+/*
+ * Everything the workers share. Nothing here is written once
+ * the files are being processed, apart from each worker's own
+ * job and, by the thread writing the reports, the failed flag.
+ */
+typedef struct
+{
+    command_list_t *commands;
+    file_job_t *jobs;
+
+    // whether each report starts with the file name
+    bool print_filenames;
+
+    /*
+     * Pool to spread the commands for each file over, or NULL.
+     * Only a single file has its commands run in parallel; a
+     * batch is spread over the files instead.
+     */
+    thread_pool_t *command_pool;
+
+    // set once a file could not be processed
+    bool failed;
+
+} batch_t;
+
+
+
+/*
+ * Opens a file and runs the commands over it. Each file gets a
+ * session of its own, so nothing parsed is shared between
+ * threads.
+ */
+void process_file(batch_t *batch, file_job_t *job, output_t *output)
+{
+    elf_session_t session;
+
+
+    if(open_session(&session, job->filename) != RET_OK)
+    {
+        // files in a directory tree that are too short to be ELF are not errors
+        if(!(job->must_be_ELF && errno == ENOEXEC))
+        {
+            job->error = errno;
+        }
+
+        return;
+    }
+
+    if(job->must_be_ELF && !has_ELF_magic(&session.image))
+    {
+        close_session(&session);
+        return;
+    }
+
+    if(batch->print_filenames)
+    {
+        append_string(output, "\nFile: ");
+        append_string(output, job->filename);
+        append_char(output, '\n');
+    }
+
+    if(run_commands(&session, output, batch->commands, batch->command_pool) != RET_OK)
+    {
+        job->failed = true;
+    }
+
+    close_session(&session);
+}
+
+
+
+void process_file_job(void *context, int job_number, output_t *output)
+{
+    batch_t *batch = (batch_t*) context;
+
+    process_file(batch, &batch->jobs[job_number], output);
+}
+
+
+
+/*
+ * Reports a file that could not be processed. Returns RET_OK
+ * if the file was processed.
+ */
+int report_file_errors(file_job_t *job)
+{
+    if(job->error != 0)
+    {
+        fprintf(stderr, "%s: %s\n", job->filename, strerror(job->error));
+        return RET_NOT_OK;
+    }
+
+    if(job->failed)
     {
-        printf("Filename not specified.\n");
         print_usage_message();
-        finish_up_and_free_things();
         return RET_NOT_OK;
     }
 
+    return RET_OK;
+}
+
+
+
+/*
+ * Reports a file that could not be processed, once its report
+ * has been written. Every file is processed whatever happened
+ * to the ones before it; the failures are only remembered, for
+ * the exit status.
+ */
+int finish_file_job(void *context, int job_number)
+{
+    batch_t *batch = (batch_t*) context;
+
+    if(report_file_errors(&batch->jobs[job_number]) != RET_OK)
+    {
+        batch->failed = true;
+    }
 
     return RET_OK;
 }
 
 
 
+/*
+ * Processes every file in the batch, writing the reports to
+ * output in order. Without a pool (or with one file) each file
+ * is written straight to output as it is processed. Otherwise the
+ * files are spread over the pool, and each finished report is
+ * written to output in turn.
+ */
+int process_files(batch_t *batch, int num_files, thread_pool_t *pool, output_t *output)
+{
+    ordered_jobs_t jobs;
+
+
+    jobs.function = process_file_job;
+    jobs.finish = finish_file_job;
+    jobs.context = batch;
+    jobs.num_jobs = num_files;
+    jobs.output_size = MEMORY_OUTPUT_SIZE;
+    jobs.run_by_caller = NULL;
+
+    batch->failed = false;
+
+    run_ordered_jobs(pool, output, &jobs);
+
+
+    return batch->failed ? RET_NOT_OK : RET_OK;
+}
+
+
+
 
 int main(int argc, char *argv[])
 {
-    // file name and file pointer to
-    // the specified file
-    char filename[MAX_FILENAME_LENGTH];
-    FILE *file_handle = NULL;
+    // the files to dump
+    file_list_t files;
+    int num_threads;
 
+    // sections at least this large are dumped on several threads
+    uint64_t parallel_dump_threshold;
+
+    // DIEs nested this deep are not dumped, unless it is -1
+    int dwarf_depth;
 
-    command_list_t commands;
 
+    // everything the commands print goes through here
+    output_t output;
 
-    sprintf(filename, "None");
+
+    command_list_t commands;
+    batch_t batch;
+    thread_pool_t pool;
+    thread_pool_t *workers = NULL;
+    int num_stdin_readers;
+    int result;
 
 
     /*
@@ -326,80 +882,109 @@ int main(int argc, char *argv[])
      * of commands to dumpelf
      */
     init_command_list(&commands, argc);
+    init_file_list(&files);
 
 
     /*
      * parse the command-line options
      * if they are not used correctly, then print error message
      */
-    if(parse_command_line_options(argc, argv, &commands, filename) != RET_OK)
+    if(parse_command_line_options(argc, argv, &commands, &files, &num_threads, &parallel_dump_threshold, &dwarf_depth) != RET_OK)
     {
         return RET_NOT_OK;
     }
 
 
-    if(strcmp(filename, "None") == 0)
+    if(files.num_files == 0)
     {
         fprintf(stderr, "No file name given.\n");
         print_usage_message();
         return RET_NOT_OK;
     }
 
+    if(commands.num_commands == 0)
+    {
+        fprintf(stderr, "No options specified.\n\n");
+        print_usage_message();
+        return RET_NOT_OK;
+    }
+
+
+    /*
+     * Standard input can only be read through once, so
+     * only one command may read it, and that command
+     * needs a file to itself.
+     */
+    num_stdin_readers = count_standard_input_readers(&commands);
 
-    // try to open file and return early if not found
-    if((file_handle = fopen(filename, "r")) == NULL)
+    if(num_stdin_readers > 1)
     {
-        printf("%s\n", strerror(errno));
+        fprintf(stderr, "Only one command that reads standard input (--addr2sym, --addr2cu) can be given at a time.\n");
         return RET_NOT_OK;
     }
 
-    if(commands.num_commands == 0)
+    if(files.num_files > 1 && num_stdin_readers > 0)
     {
-        fprintf(stderr, "No options specified.\n\n");
-        print_usage_message();
+        fprintf(stderr, "Commands that read standard input can only be run on a single file.\n");
         return RET_NOT_OK;
     }
 
 
-    // iterate over all of the different commands passed
+    batch.commands = &commands;
+    batch.jobs = (file_job_t*) calloc(files.num_files, sizeof(file_job_t));
+    batch.print_filenames = (files.num_files > 1 || files.files[0].found_in_directory);
+
+    for(int i = 0; i < files.num_files; i++)
+    {
+        batch.jobs[i].filename = files.files[i].name;
+        batch.jobs[i].must_be_ELF = files.files[i].found_in_directory;
+    }
+
+    /*
+     * One pool serves the files, the commands of a single file
+     * and the chunks a large section is split into when it is
+     * dumped, so there are never more than num_threads threads
+     * at work, counting this one.
+     */
+    if(num_threads > 1 && start_thread_pool(&pool, num_threads - 1) == RET_OK)
+    {
+        workers = &pool;
+    }
+
+    batch.command_pool = (files.num_files == 1) ? workers : NULL;
+
     for(int i = 0; i < commands.num_commands; i++)
     {
-        switch(commands.command_array[i]->type)
-        {
-            case CMD_DUMP_ELF_HEADER:
-                dump_elf_header(file_handle);
-                break;
-            case CMD_DUMP_SECTION_HEADERS:
-                dump_section_headers(file_handle);
-                break;
-            case CMD_DUMP_PROGRAM_HEADERS:
-                dump_program_headers(file_handle);
-                break;
-            case CMD_DUMP_SYMBOL_TABLE:
-                dump_symbol_table(file_handle);
-                break;
-            case CMD_DUMP_RELOCATION_INFO:
-                dump_relocation_info(file_handle);
-                break;
-            case CMD_HEX_DUMP_SECTION:
-                hex_dump_section(file_handle, commands.command_array[i]->section_number, commands.command_array[i]->section_name);
-                break;
-            case CMD_STRING_DUMP_SECTION:
-                string_dump_section(file_handle, commands.command_array[i]->section_number, commands.command_array[i]->section_name);
-                break;
-            case CMD_DUMP_DEBUG_INFO:
-                dump_debug_info(file_handle, commands.command_array[i]->subtype);
-                break;
-            default:
-                print_usage_message();
-                finish_up_and_free_things();
-                return RET_NOT_OK;
-                break;
-        }
+        commands.command_array[i]->pool = batch.command_pool;
+        commands.command_array[i]->parallel_dump_threshold = parallel_dump_threshold;
+        commands.command_array[i]->dwarf_depth = dwarf_depth;
     }
 
-    fclose(file_handle);
 
+    init_output(&output, STDOUT_FILENO);
 
-    return RET_OK;
-}
\ No newline at end of file
+    result = process_files(&batch, files.num_files, workers, &output);
+
+    if(workers != NULL)
+    {
+        join_thread_pool(workers);
+    }
+
+    free(batch.jobs);
+    release_file_list(&files);
+
+
+    /*
+     * Write out whatever is left in the buffer. If that
+     * (or any earlier write) failed, the output is
+     * incomplete.
+     */
+    if(release_output(&output) != RET_OK)
+    {
+        fprintf(stderr, "%s\n", strerror(errno));
+        return RET_NOT_OK;
+    }
+
+
+    return result;
+}
@@ -0,0 +1,571 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Implementation file for reading the name indexes of
+ * .debug_names and looking names up through their hash tables,
+ * straight out of the mapped section.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#include "names.h"
+
+
+
+
+/*
+ * Reads the abbreviations of a name index, which run from
+ * position up to end. They are read twice: once to count them
+ * and their attributes, and once to fill in the arrays, which
+ * are then allocated all at once. Returns false if they are
+ * corrupt.
+ */
+static bool read_names_abbrevs(const unsigned char *position, const unsigned char *end, names_table_t *table)
+{
+    const unsigned char *start = position;
+    uint64_t code, value, name, form;
+
+
+    table->num_abbrevs = 0;
+
+    for(int pass = 0; pass < 2; pass++)
+    {
+        names_abbrev_t *abbrev = NULL;
+        uint64_t num_abbrevs = 0;
+        uint64_t attribute = 0;
+
+        position = start;
+
+        while(read_uleb128(&position, end, &code) && code != 0)
+        {
+            if(!read_uleb128(&position, end, &value))
+            {
+                return false;
+            }
+
+            if(pass == 1)
+            {
+                abbrev = &table->abbrevs[num_abbrevs];
+                abbrev->code = code;
+                abbrev->tag = (uint32_t) value;
+                abbrev->num_attributes = 0;
+                abbrev->attributes = &table->attributes[attribute];
+            }
+
+            num_abbrevs++;
+
+            while(true)
+            {
+                int64_t implicit_const = 0;
+
+                if(!read_uleb128(&position, end, &name) || !read_uleb128(&position, end, &form))
+                {
+                    return false;
+                }
+
+                if(name == 0 && form == 0)
+                {
+                    break;
+                }
+
+                if(form == DW_FORM_implicit_const && !read_sleb128(&position, end, &implicit_const))
+                {
+                    return false;
+                }
+
+                if(pass == 1)
+                {
+                    table->attributes[attribute].name = (uint32_t) name;
+                    table->attributes[attribute].form = (uint32_t) form;
+                    table->attributes[attribute].implicit_const = implicit_const;
+                    abbrev->num_attributes++;
+                }
+
+                attribute++;
+            }
+        }
+
+        if(pass == 0)
+        {
+            table->num_abbrevs = num_abbrevs;
+            table->abbrevs = (names_abbrev_t*) malloc((num_abbrevs + 1) * sizeof(names_abbrev_t));
+            table->attributes = (abbrev_attribute_t*) malloc((attribute + 1) * sizeof(abbrev_attribute_t));
+        }
+    }
+
+    return true;
+}
+
+
+
+/*
+ * Reads the header of the name index at the given offset of
+ * .debug_names, finds where its arrays are, and decodes its
+ * abbreviations. Returns false if the index is corrupt, runs
+ * past the end of the section, or is not of version 5. The
+ * index must be released with release_names_table, even when
+ * reading it failed.
+ */
+bool read_names_table(const unsigned char *section, uint64_t section_size, uint64_t offset, names_table_t *table)
+{
+    const unsigned char *position = section + offset;
+    const unsigned char *end = section + section_size;
+    uint64_t value, size;
+    uint32_t *counts[] = {&table->comp_unit_count, &table->local_type_unit_count, &table->foreign_type_unit_count,
+                          &table->bucket_count, &table->name_count, &table->abbrev_table_size, &table->augmentation_size};
+
+
+    memset(table, 0, sizeof(names_table_t));
+    table->offset = offset;
+
+    if(offset >= section_size || !read_unsigned(&position, end, 4, &table->length))
+    {
+        return false;
+    }
+
+    table->offset_size = 4;
+
+    if(table->length == 0xffffffff)
+    {
+        table->offset_size = 8;
+
+        if(!read_unsigned(&position, end, 8, &table->length))
+        {
+            return false;
+        }
+    }
+
+    if(table->length > (uint64_t) (end - position))
+    {
+        return false;
+    }
+
+    end = position + table->length;
+    table->end_offset = end - section;
+    table->end = end;
+
+    // the version is followed by two bytes of padding
+    if(!read_unsigned(&position, end, 2, &value) || !read_unsigned(&position, end, 2, &size))
+    {
+        return false;
+    }
+
+    table->version = (uint16_t) value;
+
+    if(table->version != 5)
+    {
+        return false;
+    }
+
+    for(size_t i = 0; i < sizeof(counts)/sizeof(uint32_t*); i++)
+    {
+        if(!read_unsigned(&position, end, 4, &value))
+        {
+            return false;
+        }
+
+        *counts[i] = (uint32_t) value;
+    }
+
+
+    // the augmentation string is padded out to a multiple of 4 bytes
+    size = ((uint64_t) table->augmentation_size + 3) & ~(uint64_t) 3;
+
+    if(size > (uint64_t) (end - position))
+    {
+        return false;
+    }
+
+    table->augmentation = (const char*) position;
+    position += size;
+
+    /*
+     * The counts are 32 bits each, so none of these sizes can
+     * overflow. Without buckets there are no hashes either.
+     */
+    size = (uint64_t) table->comp_unit_count * table->offset_size +
+           (uint64_t) table->local_type_unit_count * table->offset_size +
+           (uint64_t) table->foreign_type_unit_count * 8 +
+           (uint64_t) table->bucket_count * 4 +
+           ((table->bucket_count > 0) ? (uint64_t) table->name_count * 4 : 0) +
+           (uint64_t) table->name_count * 2 * table->offset_size +
+           (uint64_t) table->abbrev_table_size;
+
+    if(size > (uint64_t) (end - position))
+    {
+        return false;
+    }
+
+    table->comp_units = position;
+    table->local_type_units = table->comp_units + (uint64_t) table->comp_unit_count * table->offset_size;
+    table->foreign_type_units = table->local_type_units + (uint64_t) table->local_type_unit_count * table->offset_size;
+    table->buckets = table->foreign_type_units + (uint64_t) table->foreign_type_unit_count * 8;
+    table->hashes = table->buckets + (uint64_t) table->bucket_count * 4;
+    table->string_offsets = table->hashes + ((table->bucket_count > 0) ? (uint64_t) table->name_count * 4 : 0);
+    table->entry_offsets = table->string_offsets + (uint64_t) table->name_count * table->offset_size;
+    position = table->entry_offsets + (uint64_t) table->name_count * table->offset_size;
+    table->entry_pool = position + table->abbrev_table_size;
+
+    return read_names_abbrevs(position, table->entry_pool, table);
+}
+
+
+
+void release_names_table(names_table_t *table)
+{
+    free(table->abbrevs);
+    free(table->attributes);
+
+    table->abbrevs = NULL;
+    table->attributes = NULL;
+}
+
+
+
+/*
+ * Reads every name index of .debug_names, stopping at the first
+ * one that is corrupt. The indexes must be released with
+ * release_names_index.
+ */
+names_index_t *build_names_index(const unsigned char *section, uint64_t section_size)
+{
+    names_index_t *index = (names_index_t*) malloc(sizeof(names_index_t));
+    uint64_t capacity = 4;
+    uint64_t offset = 0;
+
+
+    index->num_tables = 0;
+    index->tables = (names_table_t*) malloc(capacity * sizeof(names_table_t));
+
+    while(offset < section_size)
+    {
+        if(index->num_tables == capacity)
+        {
+            capacity *= 2;
+            index->tables = (names_table_t*) realloc(index->tables, capacity * sizeof(names_table_t));
+        }
+
+        if(!read_names_table(section, section_size, offset, &index->tables[index->num_tables]))
+        {
+            release_names_table(&index->tables[index->num_tables]);
+            break;
+        }
+
+        offset = index->tables[index->num_tables].end_offset;
+        index->num_tables++;
+    }
+
+    return index;
+}
+
+
+
+void release_names_index(names_index_t *index)
+{
+    if(index == NULL)
+    {
+        return;
+    }
+
+    for(uint64_t i = 0; i < index->num_tables; i++)
+    {
+        release_names_table(&index->tables[i]);
+    }
+
+    free(index->tables);
+    free(index);
+}
+
+
+
+/*
+ * The hash of a name in .debug_names: the DJB hash of the name
+ * with its ASCII letters folded to lower case, so that names
+ * differing only in case land in the same bucket.
+ */
+uint32_t hash_debug_name(const char *name, size_t length)
+{
+    uint32_t hash = 5381;
+
+
+    for(size_t i = 0; i < length; i++)
+    {
+        unsigned char c = (unsigned char) name[i];
+
+        if(c >= 'A' && c <= 'Z')
+            c += 'a' - 'A';
+
+        hash = hash*33 + c;
+    }
+
+    return hash;
+}
+
+
+
+/*
+ * Gets the element with the given number (from 0) of one of
+ * the arrays of a name index, where each element is size bytes.
+ */
+uint64_t get_names_table_value(names_table_t *table, const unsigned char *array, uint64_t number, int size)
+{
+    const unsigned char *position = array + number*size;
+    uint64_t value = 0;
+
+
+    read_unsigned(&position, table->end, size, &value);
+
+    return value;
+}
+
+
+
+/*
+ * Checks whether the string at the given offset of .debug_str
+ * is the name.
+ */
+static bool is_name_at(const unsigned char *str, uint64_t str_size, uint64_t offset, const char *name, size_t length)
+{
+    return offset < str_size && str_size - offset > length &&
+           memcmp(str + offset, name, length) == 0 && str[offset + length] == '\0';
+}
+
+
+
+/*
+ * Looks a name up in a name index. The name's hash picks a
+ * bucket, which gives the first name in it; the names of a
+ * bucket are next to each other, so the ones after it are
+ * checked until one falls in another bucket, comparing the
+ * strings only when the whole hashes match. An index without
+ * buckets has to be searched name by name. Returns the number
+ * of the name (from 1), or -1 if the index does not have it.
+ */
+int64_t find_debug_name(names_table_t *table, const unsigned char *str, uint64_t str_size, const char *name, size_t length)
+{
+    uint32_t hash, bucket;
+    uint64_t number;
+
+
+    if(str == NULL)
+    {
+        return -1;
+    }
+
+    if(table->bucket_count == 0)
+    {
+        for(number = 1; number <= table->name_count; number++)
+        {
+            if(is_name_at(str, str_size, get_names_table_value(table, table->string_offsets, number - 1, table->offset_size), name, length))
+                return (int64_t) number;
+        }
+
+        return -1;
+    }
+
+
+    hash = hash_debug_name(name, length);
+    bucket = hash % table->bucket_count;
+    number = get_names_table_value(table, table->buckets, bucket, 4);
+
+    if(number == 0)
+    {
+        return -1;
+    }
+
+    for(; number <= table->name_count; number++)
+    {
+        uint32_t name_hash = (uint32_t) get_names_table_value(table, table->hashes, number - 1, 4);
+
+        if(name_hash % table->bucket_count != bucket)
+            break;
+
+        if(name_hash == hash &&
+           is_name_at(str, str_size, get_names_table_value(table, table->string_offsets, number - 1, table->offset_size), name, length))
+            return (int64_t) number;
+    }
+
+    return -1;
+}
+
+
+
+/*
+ * Reads the value of one attribute of an entry.
+ */
+static bool read_names_value(names_table_t *table, const unsigned char **position, abbrev_attribute_t *attribute, uint64_t *value)
+{
+    int64_t signed_value;
+
+
+    switch(attribute->form)
+    {
+        case DW_FORM_data1:
+        case DW_FORM_ref1:
+        case DW_FORM_flag:
+            return read_unsigned(position, table->end, 1, value);
+
+        case DW_FORM_data2:
+        case DW_FORM_ref2:
+            return read_unsigned(position, table->end, 2, value);
+
+        case DW_FORM_data4:
+        case DW_FORM_ref4:
+            return read_unsigned(position, table->end, 4, value);
+
+        case DW_FORM_data8:
+        case DW_FORM_ref8:
+        case DW_FORM_ref_sig8:
+            return read_unsigned(position, table->end, 8, value);
+
+        case DW_FORM_udata:
+        case DW_FORM_ref_udata:
+            return read_uleb128(position, table->end, value);
+
+        case DW_FORM_sdata:
+            if(!read_sleb128(position, table->end, &signed_value))
+                return false;
+            *value = (uint64_t) signed_value;
+            return true;
+
+        case DW_FORM_flag_present:
+            *value = 1;
+            return true;
+
+        case DW_FORM_implicit_const:
+            *value = (uint64_t) attribute->implicit_const;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+
+
+/*
+ * Reads the entry at position in the entry pool, moving
+ * position past it. Returns false if it is corrupt or has an
+ * abbreviation code the index does not have.
+ */
+bool read_names_entry(names_table_t *table, const unsigned char **position, names_entry_t *entry)
+{
+    memset(entry, 0, sizeof(names_entry_t));
+    entry->offset = *position - table->entry_pool;
+
+    if(!read_uleb128(position, table->end, &entry->code))
+    {
+        return false;
+    }
+
+    if(entry->code == 0)
+    {
+        return true;
+    }
+
+    // there are only ever a handful of abbreviations, one or two per tag
+    for(uint64_t i = 0; i < table->num_abbrevs; i++)
+    {
+        if(table->abbrevs[i].code == entry->code)
+        {
+            entry->abbrev = &table->abbrevs[i];
+            break;
+        }
+    }
+
+    if(entry->abbrev == NULL)
+    {
+        return false;
+    }
+
+
+    for(uint32_t i = 0; i < entry->abbrev->num_attributes; i++)
+    {
+        abbrev_attribute_t *attribute = &entry->abbrev->attributes[i];
+        uint64_t value;
+
+        if(!read_names_value(table, position, attribute, &value))
+        {
+            return false;
+        }
+
+        switch(attribute->name)
+        {
+            case DW_IDX_compile_unit:
+                entry->has_compile_unit = true;
+                entry->compile_unit = value;
+                break;
+
+            case DW_IDX_type_unit:
+                entry->has_type_unit = true;
+                entry->type_unit = value;
+                break;
+
+            case DW_IDX_die_offset:
+                entry->has_die_offset = true;
+                entry->die_offset = value;
+                break;
+
+            case DW_IDX_parent:
+                // as a flag, it says that the parent is not indexed
+                if(attribute->form != DW_FORM_flag_present)
+                {
+                    entry->has_parent = true;
+                    entry->parent = value;
+                }
+                break;
+        }
+    }
+
+    return true;
+}
+
+
+
+/*
+ * Works out the offset in .debug_info of the DIE of an entry,
+ * from its offset in the unit and the unit it is in. An entry
+ * need not give its compilation unit when the index has only
+ * one. Returns false if the DIE is in a type unit of another
+ * file, or the entry does not lead to a DIE.
+ */
+bool get_names_entry_die(names_table_t *table, names_entry_t *entry, uint64_t *die_offset)
+{
+    uint64_t unit_offset;
+
+
+    if(!entry->has_die_offset)
+    {
+        return false;
+    }
+
+    if(entry->has_type_unit)
+    {
+        if(entry->type_unit >= table->local_type_unit_count)
+            return false;
+
+        unit_offset = get_names_table_value(table, table->local_type_units, entry->type_unit, table->offset_size);
+    }
+    else if(entry->has_compile_unit || table->comp_unit_count == 1)
+    {
+        uint64_t unit = entry->has_compile_unit ? entry->compile_unit : 0;
+
+        if(unit >= table->comp_unit_count)
+            return false;
+
+        unit_offset = get_names_table_value(table, table->comp_units, unit, table->offset_size);
+    }
+    else
+    {
+        return false;
+    }
+
+    *die_offset = unit_offset + entry->die_offset;
+
+    return true;
+}
@@ -0,0 +1,363 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Implementation file for the output sink.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+
+#include "output.h"
+#include "format.h"
+#include "readelf.h"
+
+
+
+
+/*
+ * Initializes an output that writes to the given file descriptor
+ * through a buffer of OUTPUT_BUFFER_SIZE bytes.
+ */
+void init_output(output_t *output, int file_descriptor)
+{
+    output->file_descriptor = file_descriptor;
+    output->capacity = OUTPUT_BUFFER_SIZE;
+    output->size = 0;
+    output->error = false;
+    output->buffer = (char*) malloc(output->capacity);
+}
+
+
+
+/*
+ * Initializes an output that keeps everything appended to it in
+ * memory. The buffer starts out capacity bytes long (at least
+ * one), grows as needed and is never flushed, so the text can be
+ * handed to another output later on.
+ */
+void init_memory_output(output_t *output, size_t capacity)
+{
+    output->file_descriptor = OUTPUT_IN_MEMORY;
+    output->capacity = (capacity > 0) ? capacity : 1;
+    output->size = 0;
+    output->error = false;
+    output->buffer = (char*) malloc(output->capacity);
+}
+
+
+
+/*
+ * Makes room for length more bytes at the end of the buffer.
+ * An output with a file descriptor is flushed, unless length
+ * would not fit even in the empty buffer, in which case false
+ * is returned and nothing is done. A memory output grows its
+ * buffer instead and always succeeds.
+ */
+static bool make_room(output_t *output, size_t length)
+{
+    if(output->file_descriptor == OUTPUT_IN_MEMORY)
+    {
+        while(length > output->capacity - output->size)
+        {
+            output->capacity *= 2;
+        }
+
+        output->buffer = (char*) realloc(output->buffer, output->capacity);
+        return true;
+    }
+
+
+    if(length >= output->capacity)
+    {
+        return false;
+    }
+
+    flush_output(output);
+    return true;
+}
+
+
+
+/*
+ * Writes the given I/O vectors out in full, retrying after
+ * short writes and interrupted system calls.
+ */
+static int write_vectors(output_t *output, struct iovec *vectors, int num_vectors)
+{
+    while(num_vectors > 0)
+    {
+        ssize_t written = writev(output->file_descriptor, vectors, num_vectors);
+
+        if(written < 0)
+        {
+            if(errno == EINTR)
+                continue;
+
+            output->error = true;
+            return RET_NOT_OK;
+        }
+
+
+        // skip over whatever was written
+        while(num_vectors > 0 && (size_t) written >= vectors->iov_len)
+        {
+            written -= vectors->iov_len;
+            vectors++;
+            num_vectors--;
+        }
+
+        if(num_vectors > 0)
+        {
+            vectors->iov_base = (char*) vectors->iov_base + written;
+            vectors->iov_len -= written;
+        }
+    }
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Writes out everything in the buffer and empties it.
+ */
+int flush_output(output_t *output)
+{
+    struct iovec vector;
+
+
+    // there is nowhere to flush a memory output to
+    if(output->file_descriptor == OUTPUT_IN_MEMORY)
+    {
+        return RET_OK;
+    }
+
+    if(output->error)
+    {
+        output->size = 0;
+        return RET_NOT_OK;
+    }
+
+    vector.iov_base = output->buffer;
+    vector.iov_len = output->size;
+    output->size = 0;
+
+    return write_vectors(output, &vector, 1);
+}
+
+
+
+/*
+ * Flushes the output and frees its buffer. Returns RET_NOT_OK
+ * if any write to the file descriptor failed.
+ */
+int release_output(output_t *output)
+{
+    int result = flush_output(output);
+
+    free(output->buffer);
+    output->buffer = NULL;
+    output->capacity = 0;
+
+    return result;
+}
+
+
+
+
+/*
+ * Appends length bytes to the output. Anything too large to
+ * fit in the buffer is written out together with the contents
+ * of the buffer in a single writev rather than being copied
+ * through the buffer piece by piece. A memory output grows its
+ * buffer to fit instead.
+ */
+void append_bytes(output_t *output, const char *bytes, size_t length)
+{
+    // bytes may be NULL when there is nothing to append
+    if(length == 0)
+    {
+        return;
+    }
+
+    if(length <= output->capacity - output->size || make_room(output, length))
+    {
+        memcpy(output->buffer + output->size, bytes, length);
+        output->size += length;
+        return;
+    }
+
+
+    if(!output->error)
+    {
+        struct iovec vectors[2];
+
+        vectors[0].iov_base = output->buffer;
+        vectors[0].iov_len = output->size;
+        vectors[1].iov_base = (void*) bytes;
+        vectors[1].iov_len = length;
+
+        write_vectors(output, vectors, 2);
+    }
+
+    output->size = 0;
+}
+
+
+
+void append_string(output_t *output, const char *string)
+{
+    append_bytes(output, string, strlen(string));
+}
+
+
+
+void append_char(output_t *output, char character)
+{
+    if(output->size == output->capacity)
+    {
+        make_room(output, 1);
+    }
+
+    output->buffer[output->size] = character;
+    output->size++;
+}
+
+
+
+/*
+ * Appends the given number of spaces. Negative counts
+ * append nothing.
+ */
+void append_padding(output_t *output, int num_spaces)
+{
+    static const char spaces[] = "                                                                ";
+
+    while(num_spaces > 0)
+    {
+        int length = (num_spaces < (int) sizeof(spaces) - 1) ? num_spaces : (int) sizeof(spaces) - 1;
+
+        append_bytes(output, spaces, length);
+        num_spaces -= length;
+    }
+}
+
+
+
+/*
+ * Appends printf-style formatted text. The text is formatted
+ * straight into the free space at the end of the buffer; only
+ * if it does not fit is the buffer flushed (or, for text longer
+ * than the whole buffer, a temporary string allocated). A memory
+ * output grows its buffer instead.
+ */
+void append_format(output_t *output, const char *format, ...)
+{
+    va_list arguments;
+    int length;
+
+
+    va_start(arguments, format);
+    length = vsnprintf(output->buffer + output->size, output->capacity - output->size, format, arguments);
+    va_end(arguments);
+
+    if(length < 0)
+    {
+        return;
+    }
+
+
+    // vsnprintf needs room for the NULL character as well
+    if((size_t) length < output->capacity - output->size)
+    {
+        output->size += length;
+        return;
+    }
+
+
+    if(make_room(output, length + 1))
+    {
+        va_start(arguments, format);
+        vsnprintf(output->buffer + output->size, output->capacity - output->size, format, arguments);
+        va_end(arguments);
+
+        output->size += length;
+    }
+    else
+    {
+        char *string = (char*) malloc(length + 1);
+
+        va_start(arguments, format);
+        vsnprintf(string, length + 1, format, arguments);
+        va_end(arguments);
+
+        append_bytes(output, string, length);
+        free(string);
+    }
+}
+
+
+
+
+/*
+ * Makes sure there are at least length free bytes at the end
+ * of the buffer, flushing it if there are not, and returns a
+ * pointer to them. The numbers below, and the rows of the hex
+ * dump, are formatted straight into that space, after which
+ * the caller adds what it wrote to output->size. length must
+ * be smaller than the buffer.
+ */
+char *reserve_output(output_t *output, size_t length)
+{
+    if(length > output->capacity - output->size)
+    {
+        make_room(output, length);
+    }
+
+    return output->buffer + output->size;
+}
+
+
+
+/*
+ * Appends value in lowercase hex, zero-padded to at least
+ * min_width digits (0 for no padding), like "%0*lx".
+ */
+void append_hex(output_t *output, uint64_t value, int min_width)
+{
+    char *destination = reserve_output(output, (min_width > 16) ? min_width : 16);
+
+    output->size += format_hex(destination, value, min_width);
+}
+
+
+
+/*
+ * Appends value in decimal, like "%lu".
+ */
+void append_decimal(output_t *output, uint64_t value)
+{
+    char *destination = reserve_output(output, FORMAT_MAX_DIGITS);
+
+    output->size += format_decimal(destination, value);
+}
+
+
+
+/*
+ * Appends a signed value in decimal, like "%ld".
+ */
+void append_signed_decimal(output_t *output, int64_t value)
+{
+    char *destination = reserve_output(output, FORMAT_MAX_DIGITS);
+
+    output->size += format_signed_decimal(destination, value);
+}
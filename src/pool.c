@@ -0,0 +1,336 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Implementation file for the thread pool.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+
+#include "pool.h"
+#include "readelf.h"
+
+
+
+
+/*
+ * Returned by take_job when every job of the batch has been
+ * claimed (or the caller has stopped), and when every job left
+ * is too far past the one the caller is up to to be started yet.
+ */
+#define NO_JOBS_LEFT        -1
+#define NO_JOBS_READY       -2
+
+
+
+/*
+ * Claims the first job of the batch nobody has claimed yet,
+ * skipping over the ones only the caller may run. The pool must
+ * be locked.
+ */
+static int take_job(job_batch_t *batch)
+{
+    const bool *run_by_caller = batch->jobs->run_by_caller;
+
+
+    while(batch->next_job < batch->jobs->num_jobs &&
+          (batch->states[batch->next_job] != JOB_WAITING ||
+           (run_by_caller != NULL && run_by_caller[batch->next_job])))
+    {
+        batch->next_job++;
+    }
+
+    if(batch->stopping || batch->next_job >= batch->jobs->num_jobs)
+    {
+        return NO_JOBS_LEFT;
+    }
+
+    if(batch->next_job - batch->oldest_job >= batch->max_ahead)
+    {
+        return NO_JOBS_READY;
+    }
+
+    batch->states[batch->next_job] = JOB_RUNNING;
+    batch->num_running++;
+
+    return batch->next_job++;
+}
+
+
+
+/*
+ * The main loop of each worker thread. Runs jobs, from the newest
+ * batch that has one ready, until the pool is stopped, waiting
+ * whenever no batch has a job that can be started.
+ */
+static void *run_worker(void *argument)
+{
+    thread_pool_t *pool = (thread_pool_t*) argument;
+
+
+    pthread_mutex_lock(&pool->lock);
+
+    while(!pool->stopping)
+    {
+        job_batch_t *batch;
+        int job_number = NO_JOBS_LEFT;
+
+        for(batch = pool->batches; batch != NULL; batch = batch->next)
+        {
+            if((job_number = take_job(batch)) >= 0)
+            {
+                break;
+            }
+        }
+
+        if(batch == NULL)
+        {
+            pthread_cond_wait(&pool->work_available, &pool->lock);
+            continue;
+        }
+
+        pthread_mutex_unlock(&pool->lock);
+
+        init_memory_output(&batch->outputs[job_number], batch->jobs->output_size);
+        batch->jobs->function(batch->jobs->context, job_number, &batch->outputs[job_number]);
+
+        pthread_mutex_lock(&pool->lock);
+
+        batch->states[job_number] = JOB_FINISHED;
+        batch->num_running--;
+        pthread_cond_broadcast(&pool->job_finished);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+
+
+/*
+ * Starts num_threads worker threads, which wait for jobs until
+ * the pool is joined. If a thread cannot be created, the pool
+ * carries on with the threads it has; only if none at all can be
+ * created is RET_NOT_OK returned.
+ */
+int start_thread_pool(thread_pool_t *pool, int num_threads)
+{
+    pool->batches = NULL;
+    pool->stopping = false;
+
+    pool->threads = (pthread_t*) malloc(num_threads * sizeof(pthread_t));
+    pool->num_threads = 0;
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->job_finished, NULL);
+    pthread_cond_init(&pool->work_available, NULL);
+
+
+    for(int i = 0; i < num_threads; i++)
+    {
+        int result = pthread_create(&pool->threads[pool->num_threads], NULL, run_worker, pool);
+
+        if(result != 0)
+        {
+            fprintf(stderr, "Could not create worker thread: %s\n", strerror(result));
+            break;
+        }
+
+        pool->num_threads++;
+    }
+
+
+    if(pool->num_threads == 0)
+    {
+        join_thread_pool(pool);
+        return RET_NOT_OK;
+    }
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Stops the workers and frees the pool. Every list of jobs run on
+ * it must have finished.
+ */
+void join_thread_pool(thread_pool_t *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+
+    pool->stopping = true;
+    pthread_cond_broadcast(&pool->work_available);
+
+    pthread_mutex_unlock(&pool->lock);
+
+
+    for(int i = 0; i < pool->num_threads; i++)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->job_finished);
+    pthread_cond_destroy(&pool->work_available);
+
+    free(pool->threads);
+}
+
+
+
+/*
+ * Runs the jobs one after another, straight into output, for
+ * when there is no pool.
+ */
+static int run_jobs_in_turn(output_t *output, ordered_jobs_t *jobs)
+{
+    int result = RET_OK;
+
+    for(int i = 0; i < jobs->num_jobs && result == RET_OK; i++)
+    {
+        jobs->function(jobs->context, i, output);
+
+        if(jobs->finish != NULL)
+        {
+            result = jobs->finish(jobs->context, i);
+        }
+    }
+
+    return result;
+}
+
+
+
+/*
+ * Runs the jobs on the pool's workers and the calling thread, and
+ * writes their outputs to output in job order, calling the finish
+ * function (if there is one) after each. Once a finish function
+ * returns RET_NOT_OK nothing more is written, as if the jobs had
+ * been run one after another and stopped there, and RET_NOT_OK is
+ * returned.
+ *
+ * The job the caller is up to is run by the caller, straight into
+ * output, unless a worker got to it first; only the jobs workers
+ * run ahead of it are held in memory. Without a pool, that is
+ * every job, one after another.
+ */
+int run_ordered_jobs(thread_pool_t *pool, output_t *output, ordered_jobs_t *jobs)
+{
+    job_batch_t batch;
+    int result = RET_OK;
+
+
+    if(pool == NULL || jobs->num_jobs <= 1)
+    {
+        return run_jobs_in_turn(output, jobs);
+    }
+
+    batch.jobs = jobs;
+    batch.outputs = (output_t*) malloc(jobs->num_jobs * sizeof(output_t));
+    batch.states = (job_state_t*) calloc(jobs->num_jobs, sizeof(job_state_t));
+    batch.next_job = 0;
+    batch.oldest_job = 0;
+    batch.max_ahead = 16 * pool->num_threads;
+    batch.num_running = 0;
+    batch.stopping = false;
+
+    pthread_mutex_lock(&pool->lock);
+
+    batch.next = pool->batches;
+    pool->batches = &batch;
+    pthread_cond_broadcast(&pool->work_available);
+
+    pthread_mutex_unlock(&pool->lock);
+
+
+    for(int i = 0; i < jobs->num_jobs && result == RET_OK; i++)
+    {
+        bool claimed;
+
+        pthread_mutex_lock(&pool->lock);
+
+        while(batch.states[i] == JOB_RUNNING)
+        {
+            pthread_cond_wait(&pool->job_finished, &pool->lock);
+        }
+
+        if((claimed = (batch.states[i] == JOB_WAITING)))
+        {
+            batch.states[i] = JOB_RUNNING;
+        }
+
+        pthread_mutex_unlock(&pool->lock);
+
+
+        if(claimed)
+        {
+            jobs->function(jobs->context, i, output);
+        }
+        else
+        {
+            append_bytes(output, batch.outputs[i].buffer, batch.outputs[i].size);
+            release_output(&batch.outputs[i]);
+        }
+
+        pthread_mutex_lock(&pool->lock);
+
+        batch.oldest_job = i + 1;
+        pthread_cond_broadcast(&pool->work_available);
+
+        pthread_mutex_unlock(&pool->lock);
+
+
+        if(jobs->finish != NULL)
+        {
+            result = jobs->finish(jobs->context, i);
+        }
+    }
+
+
+    /*
+     * Take the batch off the pool once the workers are done with
+     * it, and free the outputs of any jobs they finished that
+     * were never written.
+     */
+    pthread_mutex_lock(&pool->lock);
+
+    batch.stopping = true;
+
+    while(batch.num_running > 0)
+    {
+        pthread_cond_wait(&pool->job_finished, &pool->lock);
+    }
+
+    for(job_batch_t **link = &pool->batches; *link != NULL; link = &(*link)->next)
+    {
+        if(*link == &batch)
+        {
+            *link = batch.next;
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+
+    for(int i = batch.oldest_job; i < jobs->num_jobs; i++)
+    {
+        if(batch.states[i] == JOB_FINISHED)
+        {
+            release_output(&batch.outputs[i]);
+        }
+    }
+
+    free(batch.outputs);
+    free(batch.states);
+
+
+    return result;
+}
@@ -0,0 +1,156 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Implementation file for the sorted index of address ranges.
+ */
+
+
+#include <stdlib.h>
+
+
+#include "ranges.h"
+
+
+
+
+static int compare_ranges(const void *first, const void *second)
+{
+    const range_t *range1 = (const range_t*) first;
+    const range_t *range2 = (const range_t*) second;
+
+    if(range1->start != range2->start)
+        return (range1->start < range2->start) ? -1 : 1;
+
+    if(range1->payload != range2->payload)
+        return (range1->payload < range2->payload) ? -1 : 1;
+
+    return 0;
+}
+
+
+
+/*
+ * Sorts ranges by start address and then by payload, the order
+ * build_range_index expects them in. Callers that prefer one
+ * range over another some other way sort the ranges themselves.
+ */
+void sort_ranges(range_t *ranges, uint64_t num_ranges)
+{
+    qsort(ranges, num_ranges, sizeof(range_t), compare_ranges);
+}
+
+
+
+/*
+ * Builds the index from ranges sorted by start address, dealing
+ * with ranges that overlap the one kept before them as overlap
+ * says. Empty ranges are left out. The ranges are copied, so the
+ * caller keeps them. The index must be released with
+ * release_range_index.
+ */
+range_index_t *build_range_index(const range_t *ranges, uint64_t num_ranges, range_overlap_t overlap)
+{
+    range_index_t *index = (range_index_t*) malloc(sizeof(range_index_t));
+    uint64_t num_kept = 0;
+
+
+    index->starts = (uint64_t*) malloc((num_ranges + 1) * sizeof(uint64_t));
+    index->ends = (uint64_t*) malloc((num_ranges + 1) * sizeof(uint64_t));
+    index->payloads = (uint64_t*) malloc((num_ranges + 1) * sizeof(uint64_t));
+
+    for(uint64_t i = 0; i < num_ranges; i++)
+    {
+        uint64_t start = ranges[i].start;
+
+        if(start >= ranges[i].end)
+        {
+            continue;
+        }
+
+        if(overlap == RANGES_KEEP_FIRST && num_kept > 0 && start == index->starts[num_kept - 1])
+        {
+            continue;
+        }
+
+        if(overlap == RANGES_MERGE && num_kept > 0 && start <= index->ends[num_kept - 1])
+        {
+            // touching or overlapping the range before it
+            if(ranges[i].payload == index->payloads[num_kept - 1])
+            {
+                if(ranges[i].end > index->ends[num_kept - 1])
+                {
+                    index->ends[num_kept - 1] = ranges[i].end;
+                }
+
+                continue;
+            }
+
+            start = index->ends[num_kept - 1];
+
+            if(start >= ranges[i].end)
+            {
+                continue;
+            }
+        }
+
+        index->starts[num_kept] = start;
+        index->ends[num_kept] = ranges[i].end;
+        index->payloads[num_kept] = ranges[i].payload;
+        num_kept++;
+    }
+
+    index->num_ranges = num_kept;
+
+    return index;
+}
+
+
+
+void release_range_index(range_index_t *index)
+{
+    if(index == NULL)
+    {
+        return;
+    }
+
+    free(index->starts);
+    free(index->ends);
+    free(index->payloads);
+    free(index);
+}
+
+
+
+/*
+ * Finds the range containing an address. Returns its number in
+ * the index, or -1 if no range contains the address.
+ */
+int64_t find_range(range_index_t *index, uint64_t address)
+{
+    uint64_t low = 0;
+    uint64_t count = index->num_ranges;
+
+
+    /*
+     * Find the last range starting at or before the address.
+     * The loop halves the count each time without branching
+     * on the comparison, which the compiler turns into a
+     * conditional move.
+     */
+    if(count == 0 || address < index->starts[0])
+    {
+        return -1;
+    }
+
+    while(count > 1)
+    {
+        uint64_t half = count / 2;
+
+        low = (index->starts[low + half] <= address) ? low + half : low;
+        count -= half;
+    }
+
+
+    return (address < index->ends[low]) ? (int64_t) low : -1;
+}
@@ -7,8 +7,15 @@
 
 
 #include <stdio.h>
+#include <limits.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 
 #include "elf.h"
@@ -18,728 +25,1783 @@
 
 
 /*
- * Read the identification bits of the file.
+ * Opens the file with the given name and maps the whole
+ * file into memory read-only. The image struct passed in
+ * is filled in with the mapping and must later be released
+ * with close_elf_image. On failure errno is left set by
+ * the system call that failed so the caller can report it.
  */
-int read_ELF_identification(FILE *input_file, unsigned char *buffer)
+int open_elf_image(elf_image_t *image, const char *filename)
 {
-    // set cursor to begining of file
-    fseek(input_file, 0, SEEK_SET);
+    struct stat file_status;
 
 
-    // read the first EI_NIDENT bytes of file into buffer
-    if(fread(buffer, EI_NIDENT, 1,input_file) < 1)
+    /*
+     * Defensive check to prevent a segmentation fault
+     * from NULL pointer being passed to the function.
+     */
+    if(image == NULL || filename == NULL)
     {
+        fprintf(stderr, "NULL pointer passed to open_elf_image.\n");
         return RET_NOT_OK;
     }
 
-    return RET_OK;
-}
-
-
-/*
- * Gets the file's class from the identification
- * bits of the ELF header. Class is either 32-bit,
- * 64-bit, or none.
- */
-int get_file_class(FILE *input_file)
-{
-    unsigned char e_ident[EI_NIDENT];
-
-    read_ELF_identification(input_file, e_ident);
-
-    return (int) e_ident[EI_CLASS];
-}
+    image->file_descriptor = -1;
+    image->size = 0;
+    image->data = NULL;
 
 
+    if((image->file_descriptor = open(filename, O_RDONLY)) < 0)
+    {
+        return RET_NOT_OK;
+    }
 
-static char **get_ELF32_section_names(FILE *input_file)
-{
-    ELF32_Header_t file_header;
-    ELF32_Section_Header_t *section_header_table;
-    char **section_names;
-    ELF32_Off_t string_table_offset;
-    ELF32_Word_t string_table_size;
-    char *buffer;
+    if(fstat(image->file_descriptor, &file_status) != 0)
+    {
+        close(image->file_descriptor);
+        return RET_NOT_OK;
+    }
 
 
     /*
-     * Read the file header. The file header contains
-     * the index into the section header table of the
-     * section header string table section
+     * A file too short to hold the identification
+     * bytes cannot be an ELF file, and mmap refuses
+     * to map empty files anyway.
      */
-    if(read_ELF32_header(input_file, &file_header) != RET_OK)
+    if(file_status.st_size < EI_NIDENT)
     {
-        fprintf(stderr, "Unable to read ELF header.\n");
-        return NULL;
+        close(image->file_descriptor);
+        errno = ENOEXEC;
+        return RET_NOT_OK;
     }
 
+    image->size = (size_t) file_status.st_size;
+    image->data = mmap(NULL, image->size, PROT_READ, MAP_PRIVATE, image->file_descriptor, 0);
 
-    if((section_header_table = read_ELF32_section_header_table(input_file)) == NULL)
+    if(image->data == MAP_FAILED)
     {
-        return NULL;
+        image->data = NULL;
+        close(image->file_descriptor);
+        return RET_NOT_OK;
     }
 
 
-    /*
-     * Get the offset into the ELF file of the section
-     * header string table from the section header at
-     * the index given by the section header string table
-     * index member of the ELF header.
-     */
-    string_table_offset = section_header_table[file_header.e_shstrndx].sh_offset;
-
-
-    /*
-     * Must dynamically allocate one extra string since
-     * the final element in the string array is a NULL
-     * pointer.
-     */
-    section_names = (char**) malloc(sizeof(char*) * (file_header.e_shnum + 1));
-    section_names[file_header.e_shnum] = NULL;
-
+    return RET_OK;
+}
 
-    /*
-     * Read the entire section header string table
-     * into a memory buffer for easier access when
-     * extracting strings from it.
-     */
-    string_table_size = section_header_table[file_header.e_shstrndx].sh_size;
-    buffer = (char*) malloc(string_table_size);
-    fseek(input_file, string_table_offset, SEEK_SET);
-    fread(buffer, string_table_size, 1, input_file);
 
 
-    /*
-     * Extract the section names from the string
-     * table.
-     */
-    for(int i = 0; i < file_header.e_shnum; i++)
+/*
+ * Unmaps the file and closes the underlying descriptor.
+ * Every pointer previously handed out for this image
+ * becomes invalid.
+ */
+void close_elf_image(elf_image_t *image)
+{
+    if(image->data != NULL)
     {
-        // index into string table gives name of section
-        ELF32_Word_t index = section_header_table[i].sh_name;
-
-        // allocate new string based on length in string table
-        section_names[i] = (char*) malloc(strlen(buffer+index)+1);
-
-        // copy from string table into newly allocated string
-        strcpy(section_names[i], buffer+index);
+        munmap(image->data, image->size);
+        image->data = NULL;
     }
 
+    if(image->file_descriptor >= 0)
+    {
+        close(image->file_descriptor);
+        image->file_descriptor = -1;
+    }
 
-    free(buffer);
-
-
-    return section_names;
+    image->size = 0;
 }
 
 
 
-static char **get_ELF64_section_names(FILE *input_file)
+/*
+ * Returns a pointer to size bytes of the mapped file
+ * starting at the given offset, or NULL if any part
+ * of that range lies outside the file. Every access
+ * to the mapping goes through here so that corrupt
+ * offsets and sizes in the file cannot send us off
+ * the end of the mapping.
+ */
+void *get_image_range(elf_image_t *image, uint64_t offset, uint64_t size)
 {
-    ELF64_Header_t file_header;
-    ELF64_Section_Header_t *section_header_table;
-    char **section_names;
-    ELF64_Off_t string_table_offset;
-    ELF64_Word_t string_table_size;
-    char *buffer;
-
-
-    /*
-     * Read the file header. The file header contains
-     * the index into the section header table of the
-     * section header string table section
-     */
-    if(read_ELF64_header(input_file, &file_header) != RET_OK)
+    if(image == NULL || image->data == NULL)
     {
-        fprintf(stderr, "Unable to read ELF header.\n");
         return NULL;
     }
 
-
-    if((section_header_table = read_ELF64_section_header_table(input_file)) == NULL)
+    if(offset > image->size || size > image->size - offset)
     {
         return NULL;
     }
 
-
-    /*
-     * Get the offset into the ELF file of the section
-     * header string table from the section header at
-     * the index given by the section header string table
-     * index member of the ELF header.
-     */
-    string_table_offset = section_header_table[file_header.e_shstrndx].sh_offset;
-
-
-    /*
-     * Must dynamically allocate one extra string since
-     * the final element in the string array is a NULL
-     * pointer.
-     */
-    section_names = (char**) malloc(sizeof(char*) * (file_header.e_shnum + 1));
-    section_names[file_header.e_shnum] = NULL;
+    return image->data + offset;
+}
 
 
-    /*
-     * Read the entire section header string table
-     * into a memory buffer for easier access when
-     * extracting strings from it.
-     */
-    string_table_size = section_header_table[file_header.e_shstrndx].sh_size;
-    buffer = (char*) malloc(string_table_size);
-    fseek(input_file, string_table_offset, SEEK_SET);
-    fread(buffer, string_table_size, 1, input_file);
 
 
-    /*
-     * Extract the section names from the string
-     * table.
-     */
-    for(int i = 0; i < file_header.e_shnum; i++)
+/*
+ * Like get_image_range, but for a range that is read in place
+ * as an array of structures, so the offset must be a multiple
+ * of the alignment of the structure. The mapping itself starts
+ * on a page boundary, so an aligned offset gives an aligned
+ * pointer. A corrupt offset would otherwise give a misaligned
+ * pointer, which is undefined behaviour to read through.
+ */
+void *get_aligned_image_range(elf_image_t *image, uint64_t offset, uint64_t size, uint64_t alignment)
+{
+    if(alignment > 1 && offset % alignment != 0)
     {
-
-        // index into string table gives name of section
-        ELF64_Word_t index = section_header_table[i].sh_name;
-
-        // allocate new string based on length in string table
-        section_names[i] = (char*) malloc(strlen(buffer+index)+1);
-
-        // copy from string table into newly allocated string
-        strcpy(section_names[i], buffer+index);
+        return NULL;
     }
 
+    return get_image_range(image, offset, size);
+}
 
-    free(buffer);
 
 
-    return section_names;
+/*
+ * Checks whether a pointer into the mapping is aligned for
+ * a structure with the given alignment, for the callers that
+ * cast pointers they get some other way than through
+ * get_aligned_image_range.
+ */
+bool is_aligned(const void *pointer, uint64_t alignment)
+{
+    return alignment <= 1 || ((uintptr_t) pointer % alignment) == 0;
 }
 
 
 
 
-
 /*
- * Given the input file, returns a NULL pointer
- * terminated list of strings, each of which gives
- * the name of a given section in the file. The NULL
- * termination is to allow for finding the end of
- * the list without explicitly passing the length.
+ * Returns a view of the string starting at the given offset
+ * into a string table. The length stops at the first NULL
+ * character or at the end of the table, whichever comes first,
+ * so a corrupt table cannot cause a read past its end. An
+ * offset outside the table gives an empty string.
  */
-char **get_section_names(FILE *input_file)
+string_view_t get_string_table_entry(char *string_table, uint64_t string_table_size, uint64_t offset)
 {
-    char **section_names;
-    int fileclass = get_file_class(input_file);
+    string_view_t view;
 
-
-    switch (fileclass)
+    if(string_table == NULL || offset >= string_table_size)
     {
-    case ELFCLASS32:
-        section_names = get_ELF32_section_names(input_file);
-        break;
-    
-    case ELFCLASS64:
-        section_names = get_ELF64_section_names(input_file);
-        break;
-    
-    default:
-        break;
+        view.string = "";
+        view.length = 0;
+        return view;
     }
 
+    view.string = string_table + offset;
+    view.length = strnlen(view.string, string_table_size - offset);
 
-    return section_names;
+    return view;
 }
 
 
 
+/*
+ * Frees a table returned by get_ELF32_section_names or
+ * get_ELF64_section_names. The names themselves live in
+ * the mapping, so there is only the table to free.
+ */
+void release_section_name_table(section_name_table_t *section_names)
+{
+    free(section_names);
+}
+
+
 
 
 /*
- * Reads the ELF file header for 32-bit ELF files. The
- * header parameter must either be a pointer to heap
- * allocated memory or to a struct on the stack and
- * must not be null.
+ * Read the identification bits of the file.
  */
-int read_ELF32_header(FILE *input_file, ELF32_Header_t *header)
+int read_ELF_identification(elf_image_t *image, unsigned char *buffer)
 {
+    unsigned char *e_ident;
 
-    /*
-     * Defensive check to prevent a segmentation fault
-     * from NULL pointer being passed to the function.
-     */
-    if(header == NULL)
+
+    // the identification bytes are the first EI_NIDENT bytes of file
+    if((e_ident = get_image_range(image, 0, EI_NIDENT)) == NULL)
     {
-        fprintf(stderr, "NULL pointer passed to read_ELF32_header.\n");
         return RET_NOT_OK;
     }
 
-    // jump to the beginning of the file where the ELF header is
-    fseek(input_file, 0, SEEK_SET);
+    memcpy(buffer, e_ident, EI_NIDENT);
 
-    if(fread(header, sizeof(ELF32_Header_t), 1, input_file) != 1)
-    {
-        return RET_NOT_OK;
-    }
-    
     return RET_OK;
 }
 
 
-
-
-
 /*
- * Reads the ELF file header for 64-bit ELF files. The
- * header parameter must either be a pointer to heap
- * allocated memory or to a struct on the stack and
- * must not be null.
+ * Checks whether the file starts with the ELF magic number.
+ * Used to pick the ELF files out of a directory tree before
+ * any of their headers are parsed.
  */
-int read_ELF64_header(FILE *input_file, ELF64_Header_t *header)
+bool has_ELF_magic(elf_image_t *image)
 {
+    unsigned char e_ident[EI_NIDENT];
 
-    /*
-     * Defensive check to prevent a segmentation fault
-     * from NULL pointer being passed to the function.
-     */
-    if(header == NULL)
+    if(read_ELF_identification(image, e_ident) != RET_OK)
     {
-        fprintf(stderr, "NULL pointer passed to read_ELF64_header.\n");
-        return RET_NOT_OK;
+        return false;
     }
 
+    return e_ident[EI_MAG0] == ELFMAG0 && e_ident[EI_MAG1] == ELFMAG1 &&
+           e_ident[EI_MAG2] == ELFMAG2 && e_ident[EI_MAG3] == ELFMAG3;
+}
+
 
-    // jump to the beginning of the file where the ELF header is
-    fseek(input_file, 0, SEEK_SET);
+/*
+ * Gets the file's class from the identification
+ * bits of the ELF header. Class is either 32-bit,
+ * 64-bit, or none.
+ */
+int get_file_class(elf_image_t *image)
+{
+    unsigned char e_ident[EI_NIDENT];
 
-    if(fread(header, sizeof(ELF64_Header_t), 1, input_file) != 1)
+    if(read_ELF_identification(image, e_ident) != RET_OK)
     {
-        return RET_NOT_OK;
+        return ELFCLASSNONE;
     }
 
-    return RET_OK;
+    return (int) e_ident[EI_CLASS];
 }
 
 
 
-
 /*
- * Reads the section header table for 32-bit ELF files.
- * The function reads the section header table from the
- * file and returns a pointer to a dynamically-allocated
- * array of section header structs which contain the
- * file section headers. Since this function does not
- * return the number of section headers, that must be known
- * beforehand or read from the ELF header.
+ * Given the file header and section header table of a 32-bit
+ * ELF file, returns the table of section names. The names are
+ * views into the section header string table in the mapping,
+ * so none of them are copied. The table must be released with
+ * release_section_name_table.
  */
-ELF32_Section_Header_t *read_ELF32_section_header_table(FILE *input_file)
+section_name_table_t *get_ELF32_section_names(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table)
 {
-    ELF32_Header_t file_header;
-    ELF32_Section_Header_t *section_header_table;
+    section_name_table_t *section_names;
+    char *buffer;
+    uint64_t buffer_size;
+    int num_sections;
+    uint32_t string_table_index;
 
 
     /*
-     * Defensive check against NULL
-     * file pointer being passed in.
+     * Defensive check to prevent a segmentation fault
+     * from NULL pointer being passed to the function.
      */
-    if(input_file == NULL)
+    if(file_header == NULL || section_header_table == NULL)
     {
-        fprintf(stderr, "No file given to read_ELF32_section_header_table.\n");
+        fprintf(stderr, "NULL pointer passed to get_ELF32_section_names.\n");
         return NULL;
     }
 
 
     /*
-     * Read the ELF header to get the offset
-     * and entry size of the section header
-     * table.
+     * The section header string table is used in place,
+     * straight out of the mapping. Its offset and size
+     * come from the section header at the index given by
+     * the section header string table index member of
+     * the ELF header, or from section 0 if the index is
+     * too large to fit there.
      */
-    fseek(input_file, 0, SEEK_SET);
-    if(fread(&file_header, sizeof(ELF32_Header_t), 1, input_file) != 1)
+    num_sections = get_ELF32_num_sections(file_header, section_header_table);
+    string_table_index = get_ELF32_section_string_table_index(file_header, section_header_table);
+
+    if(string_table_index >= (uint32_t) num_sections)
+    {
+        fprintf(stderr, "Section header string table index out of range.\n");
+        return NULL;
+    }
+
+    buffer_size = section_header_table[string_table_index].sh_size;
+    buffer = get_image_range(image, section_header_table[string_table_index].sh_offset, buffer_size);
+
+    if(buffer == NULL)
     {
+        fprintf(stderr, "Section header string table lies outside the file.\n");
         return NULL;
     }
 
 
     /*
-     * Section header table must be dynamically allocated
+     * The table and its array of views are allocated
+     * together so the whole thing is a single allocation.
      */
-    section_header_table = (ELF32_Section_Header_t*) malloc(file_header.e_shentsize*file_header.e_shnum);
+    section_names = (section_name_table_t*) malloc(sizeof(section_name_table_t) + sizeof(string_view_t)*num_sections);
+    section_names->num_names = num_sections;
+    section_names->max_length = 0;
+    section_names->names = (string_view_t*) (section_names + 1);
 
 
     /*
-     * Read the ELF file starting at the offset to
-     * the section header table into the pointer
-     * to the previously allocated section header
-     * table.
+     * Point each name into the string table
+     * and remember the longest one.
      */
-    fseek(input_file, file_header.e_shoff, SEEK_SET);
-    if(fread(section_header_table, file_header.e_shentsize, file_header.e_shnum, input_file) != file_header.e_shnum)
+    for(int i = 0; i < num_sections; i++)
     {
-        free(section_header_table);
-        return NULL;
+        // index into string table gives name of section
+        section_names->names[i] = get_string_table_entry(buffer, buffer_size, section_header_table[i].sh_name);
+
+        if(section_names->names[i].length > section_names->max_length)
+            section_names->max_length = section_names->names[i].length;
     }
 
 
-    return section_header_table;
+    return section_names;
 }
 
 
 
-
-
 /*
- * Reads the section header table for 64-bit ELF files.
- * The function reads the section header table from the
- * file and returns a pointer to a dynamically-allocated
- * array of section header structs which contain the
- * file section headers. Since this function does not
- * return the number of section headers, that must be known
- * beforehand or read from the ELF header.
+ * Given the file header and section header table of a 64-bit
+ * ELF file, returns the table of section names. The names are
+ * views into the section header string table in the mapping,
+ * so none of them are copied. The table must be released with
+ * release_section_name_table.
  */
-ELF64_Section_Header_t *read_ELF64_section_header_table(FILE *input_file)
+section_name_table_t *get_ELF64_section_names(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table)
 {
-    ELF64_Header_t file_header;
-    ELF64_Section_Header_t *section_header_table;
+    section_name_table_t *section_names;
+    char *buffer;
+    uint64_t buffer_size;
+    int num_sections;
+    uint32_t string_table_index;
 
 
     /*
-     * Defensive check in case NULL file
-     * pointer is passed to function.
+     * Defensive check to prevent a segmentation fault
+     * from NULL pointer being passed to the function.
      */
-    if(input_file == NULL)
+    if(file_header == NULL || section_header_table == NULL)
     {
-        fprintf(stderr, "NULL pointer passed to read_ELF64_section_header_table.\n");
+        fprintf(stderr, "NULL pointer passed to get_ELF64_section_names.\n");
         return NULL;
     }
 
 
     /*
-     * Read the ELF header to get the offset
-     * and entry size of the section header
-     * table.
+     * The section header string table is used in place,
+     * straight out of the mapping. Its offset and size
+     * come from the section header at the index given by
+     * the section header string table index member of
+     * the ELF header, or from section 0 if the index is
+     * too large to fit there.
      */
-    fseek(input_file, 0, SEEK_SET);
-    if(fread(&file_header, sizeof(ELF64_Header_t), 1, input_file) != 1)
+    num_sections = get_ELF64_num_sections(file_header, section_header_table);
+    string_table_index = get_ELF64_section_string_table_index(file_header, section_header_table);
+
+    if(string_table_index >= (uint32_t) num_sections)
     {
+        fprintf(stderr, "Section header string table index out of range.\n");
+        return NULL;
+    }
+
+    buffer_size = section_header_table[string_table_index].sh_size;
+    buffer = get_image_range(image, section_header_table[string_table_index].sh_offset, buffer_size);
+
+    if(buffer == NULL)
+    {
+        fprintf(stderr, "Section header string table lies outside the file.\n");
         return NULL;
     }
 
 
     /*
-     * Section header table must be dynamically allocated
+     * The table and its array of views are allocated
+     * together so the whole thing is a single allocation.
      */
-    section_header_table = (ELF64_Section_Header_t*) malloc(file_header.e_shentsize*file_header.e_shnum);
+    section_names = (section_name_table_t*) malloc(sizeof(section_name_table_t) + sizeof(string_view_t)*num_sections);
+    section_names->num_names = num_sections;
+    section_names->max_length = 0;
+    section_names->names = (string_view_t*) (section_names + 1);
 
 
     /*
-     * Read the ELF file starting at the offset to
-     * the section header table into the pointer
-     * to the previously allocated section header
-     * table.
+     * Point each name into the string table
+     * and remember the longest one.
      */
-    fseek(input_file, file_header.e_shoff, SEEK_SET);
-    if(fread(section_header_table, file_header.e_shentsize, file_header.e_shnum, input_file) != file_header.e_shnum)
+    for(int i = 0; i < num_sections; i++)
     {
-        free(section_header_table);
-        return NULL;
+        // index into string table gives name of section
+        section_names->names[i] = get_string_table_entry(buffer, buffer_size, section_header_table[i].sh_name);
+
+        if(section_names->names[i].length > section_names->max_length)
+            section_names->max_length = section_names->names[i].length;
     }
 
 
-    return section_header_table;
+    return section_names;
 }
 
 
 
 
+
 /*
- * Reads the program header table for 32-bit ELF files.
- * The input file stream is passed as a parameter to read
- * as well as a pointer to a previously allocated memory
- * buffer large enough to store the entire program header
- * table. The number of program headers or segments is also
- * passed as a parameter, meaning it must be known before
- * calling this function.
+ * Returns a pointer to the ELF file header of a 32-bit
+ * ELF file inside the mapping, or NULL if the file is
+ * too short to hold one.
  */
-ELF32_Program_Header_t *read_ELF32_program_header_table(FILE *input_file)
+ELF32_Header_t *get_ELF32_header(elf_image_t *image)
 {
-    ELF32_Header_t file_header;
-    ELF32_Program_Header_t *program_header_table;
-
 
     /*
-     * Defensive check to prevent a
-     * segmentation fault from a NULL
-     * pointer being passed in.
+     * Defensive check to prevent a segmentation fault
+     * from NULL pointer being passed to the function.
      */
-    if(input_file == NULL)
+    if(image == NULL)
     {
-        fprintf(stderr, "NULL pointer passed to read_ELF32_program_header_table.\n");
+        fprintf(stderr, "NULL pointer passed to get_ELF32_header.\n");
         return NULL;
     }
 
+    // the ELF header is at the beginning of the file
+    return get_image_range(image, 0, sizeof(ELF32_Header_t));
+}
+
 
-    /*
-     * Read the ELF header to get the offset
-     * and entry size of the program header
-     * table.
-     */
-    fseek(input_file, 0, SEEK_SET);
-    if(fread(&file_header, sizeof(ELF32_Header_t), 1, input_file) != 1)
-    {
-        return NULL;
-    }
 
 
-    /*
-     * Program header table must be dynamically-allocated.
-     */
-    program_header_table = (ELF32_Program_Header_t*) malloc(file_header.e_phentsize*file_header.e_phnum);
 
+/*
+ * Returns a pointer to the ELF file header of a 64-bit
+ * ELF file inside the mapping, or NULL if the file is
+ * too short to hold one.
+ */
+ELF64_Header_t *get_ELF64_header(elf_image_t *image)
+{
 
     /*
-     * Read the ELF file starting at the offset to
-     * the program header table into the pointer
-     * to the previously allocated program header
-     * table passed to the function.
+     * Defensive check to prevent a segmentation fault
+     * from NULL pointer being passed to the function.
      */
-    fseek(input_file, file_header.e_phoff, SEEK_SET);
-    if(fread(program_header_table, file_header.e_phentsize, file_header.e_phnum, input_file) != file_header.e_phnum)
+    if(image == NULL)
     {
-        free(program_header_table);
+        fprintf(stderr, "NULL pointer passed to get_ELF64_header.\n");
         return NULL;
     }
 
-    return program_header_table;
+    // the ELF header is at the beginning of the file
+    return get_image_range(image, 0, sizeof(ELF64_Header_t));
 }
 
 
 
 
 /*
- * Reads the program header table for 64-bit ELF files.
- * The input file stream is passed as a parameter to read
- * as well as a pointer to a previously allocated memory
- * buffer large enough to store the entire program header
- * table. The number of program headers or segments is also
- * passed as a parameter, meaning it must be known before
- * calling this function.
+ * Returns a pointer to the section header table of a 32-bit
+ * ELF file inside the mapping. The table is not copied, so
+ * the pointer must not be freed and is only valid while the
+ * image is open. Since this function does not return the
+ * number of section headers, that must be read from the
+ * ELF header.
  */
-ELF64_Program_Header_t *read_ELF64_program_header_table(FILE *input_file)
+ELF32_Section_Header_t *get_ELF32_section_header_table(elf_image_t *image)
 {
-    ELF64_Header_t file_header;
-    ELF64_Program_Header_t *program_header_table;
+    ELF32_Header_t *file_header;
+    ELF32_Section_Header_t *first_section;
+    uint64_t num_sections;
 
 
     /*
-     * Defensive check to prevent a
-     * segmentation fault from a NULL
-     * pointer being passed in.
+     * Get the ELF header for the offset
+     * and entry size of the section header
+     * table.
      */
-    if(input_file == NULL)
+    if((file_header = get_ELF32_header(image)) == NULL)
     {
-        fprintf(stderr, "NULL pointer passed to read_ELF64_program_header_table.\n");
         return NULL;
     }
 
 
     /*
-     * Read the ELF header to get the offset
-     * and entry size of the program header
-     * table.
+     * A file with SHN_LORESERVE or more sections sets
+     * e_shnum to 0 and keeps the real count in the sh_size
+     * member of section 0, so section 0 is read first to
+     * find out how long the table really is.
      */
-    fseek(input_file, 0, SEEK_SET);
-    if(fread(&file_header, sizeof(ELF64_Header_t), 1, input_file) != 1)
+    num_sections = file_header->e_shnum;
+
+    if(num_sections == 0 && file_header->e_shoff != 0)
     {
-        return NULL;
-    }
+        if((first_section = get_aligned_image_range(image, file_header->e_shoff, sizeof(ELF32_Section_Header_t), _Alignof(ELF32_Section_Header_t))) == NULL)
+        {
+            fprintf(stderr, "Section header table is misaligned or lies outside the file.\n");
+            return NULL;
+        }
 
+        num_sections = first_section->sh_size;
+    }
 
-    program_header_table = (ELF64_Program_Header_t*) malloc(file_header.e_phentsize*file_header.e_phnum);
-    
 
     /*
-     * Read the ELF file starting at the offset to
-     * the program header table into the pointer
-     * to the previously allocated program header
-     * table passed to the function.
+     * The table is indexed as an array of structs,
+     * so its entries must be exactly struct-sized.
      */
-    fseek(input_file, file_header.e_phoff, SEEK_SET);
-    if(fread(program_header_table, file_header.e_phentsize, file_header.e_phnum, input_file) != file_header.e_phnum)
+    if(num_sections > 0 && file_header->e_shentsize != sizeof(ELF32_Section_Header_t))
     {
-        free(program_header_table);
+        fprintf(stderr, "Unexpected section header size %d.\n", file_header->e_shentsize);
         return NULL;
     }
 
-    return program_header_table;
-}
-
-
+    if(num_sections > INT_MAX || num_sections > image->size / sizeof(ELF32_Section_Header_t))
+    {
+        fprintf(stderr, "Section header table lies outside the file.\n");
+        return NULL;
+    }
 
 
-char ***get_ELF32_section_to_segment_mapping(FILE *input_file)
-{
-    return NULL;        // TODO: Implement 32-bit version
+    return get_aligned_image_range(image, file_header->e_shoff, (uint64_t) sizeof(ELF32_Section_Header_t)*num_sections,
+                                   _Alignof(ELF32_Section_Header_t));
 }
 
 
 
-
-char ***get_ELF64_section_to_segment_mapping(FILE *input_file)
+/*
+ * Returns the number of sections in a 32-bit ELF file. When
+ * e_shnum is 0 and there is a section header table, the count
+ * is the sh_size member of section 0 instead. The table must be
+ * the one get_ELF32_section_header_table returned, which has
+ * already checked that the count fits in the file.
+ */
+int get_ELF32_num_sections(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table)
 {
-    ELF64_Header_t file_header;
-    ELF64_Section_Header_t *section_header_table;
-    ELF64_Program_Header_t *program_header_table;
+    if(file_header == NULL)
+    {
+        return 0;
+    }
 
-    char **section_names;
-    char ***section_to_segment_mapping;
-    
+    if(file_header->e_shnum != 0 || file_header->e_shoff == 0 || section_header_table == NULL)
+    {
+        return file_header->e_shnum;
+    }
 
-    // ELF header has important information
-    fseek(input_file, 0, SEEK_SET);
-    fread(&file_header, sizeof(ELF64_Header_t), 1, input_file);
+    return (int) section_header_table[0].sh_size;
+}
 
 
-    /*
-     * Get the section headers, program headers, and section
-     * header names to create the mapping.
-     */
-    section_header_table = read_ELF64_section_header_table(input_file);
-    program_header_table = read_ELF64_program_header_table(input_file);
-    section_names = get_section_names(input_file);
 
+/*
+ * Returns the index of the section header string table of a
+ * 32-bit ELF file. An index that does not fit below
+ * SHN_LORESERVE is stored as SHN_XINDEX, with the real index
+ * in the sh_link member of section 0.
+ */
+uint32_t get_ELF32_section_string_table_index(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table)
+{
+    if(file_header == NULL)
+    {
+        return SHN_UNDEF;
+    }
 
-    // allocate space for mapping
-    section_to_segment_mapping = malloc(sizeof(*section_to_segment_mapping)*file_header.e_phnum);
+    if(file_header->e_shstrndx != SHN_XINDEX || get_ELF32_num_sections(file_header, section_header_table) == 0)
+    {
+        return file_header->e_shstrndx;
+    }
 
+    return section_header_table[0].sh_link;
+}
 
-    // build the mapping one program header at a time
-    for(int i = 0; i < file_header.e_phnum; i++)
-    {
-        ELF64_Off_t segment_offset = program_header_table[i].p_offset;
-        ELF64_Xword_t segment_size = program_header_table[i].p_filesz;
 
 
-        // for determining segment membership for NOBITS sections
-        ELF64_Addr_t segment_address = program_header_table[i].p_vaddr;
-        ELF64_Addr_t segment_mem_size = program_header_table[i].p_memsz;
 
 
+/*
+ * Returns a pointer to the section header table of a 64-bit
+ * ELF file inside the mapping. The table is not copied, so
+ * the pointer must not be freed and is only valid while the
+ * image is open. Since this function does not return the
+ * number of section headers, that must be read from the
+ * ELF header.
+ */
+ELF64_Section_Header_t *get_ELF64_section_header_table(elf_image_t *image)
+{
+    ELF64_Header_t *file_header;
+    ELF64_Section_Header_t *first_section;
+    uint64_t num_sections;
 
-        /* 
-         * To avoid repeated reallocation, simply
-         * allocate per program header an array
-         * of char* pointers of size equal to the
-         * number of section headers (plus 1 for
-         * the terminating NULL pointer), since the
-         * number of sections in a given segment
-         * cannot be more than the total number of
-         * sections in the file.
-         */
-        section_to_segment_mapping[i] = malloc(sizeof(char*)*(file_header.e_shnum + 1));
 
+    /*
+     * Get the ELF header for the offset
+     * and entry size of the section header
+     * table.
+     */
+    if((file_header = get_ELF64_header(image)) == NULL)
+    {
+        return NULL;
+    }
 
-        /*
-         * Index of the next element in the section
-         * to segment mapping array to add a section
-         * name to.
-         */
-        int current_segment_index = 0;
 
+    /*
+     * A file with SHN_LORESERVE or more sections sets
+     * e_shnum to 0 and keeps the real count in the sh_size
+     * member of section 0, so section 0 is read first to
+     * find out how long the table really is.
+     */
+    num_sections = file_header->e_shnum;
 
-        for(int j = 0; j < file_header.e_shnum; j++)
+    if(num_sections == 0 && file_header->e_shoff != 0)
+    {
+        if((first_section = get_aligned_image_range(image, file_header->e_shoff, sizeof(ELF64_Section_Header_t), _Alignof(ELF64_Section_Header_t))) == NULL)
         {
+            fprintf(stderr, "Section header table is misaligned or lies outside the file.\n");
+            return NULL;
+        }
 
-            ELF64_Off_t section_offset = section_header_table[j].sh_offset;
-            ELF64_Xword_t section_size = section_header_table[j].sh_size;
-
-            // for NOBITS sections
-            ELF64_Addr_t section_address = section_header_table[j].sh_addr;
+        num_sections = first_section->sh_size;
+    }
 
-            if( (section_offset >= segment_offset) && (section_offset + section_size <= segment_offset + segment_size) )
-            {
-                char *section_name = section_names[j];
 
-                section_to_segment_mapping[i][current_segment_index] = malloc(sizeof(char)*(strlen(section_name)+1));
+    /*
+     * The table is indexed as an array of structs,
+     * so its entries must be exactly struct-sized.
+     */
+    if(num_sections > 0 && file_header->e_shentsize != sizeof(ELF64_Section_Header_t))
+    {
+        fprintf(stderr, "Unexpected section header size %d.\n", file_header->e_shentsize);
+        return NULL;
+    }
 
-                strcpy(section_to_segment_mapping[i][current_segment_index], section_name);
+    if(num_sections > INT_MAX || num_sections > image->size / sizeof(ELF64_Section_Header_t))
+    {
+        fprintf(stderr, "Section header table lies outside the file.\n");
+        return NULL;
+    }
+
+
+    return get_aligned_image_range(image, file_header->e_shoff, (uint64_t) sizeof(ELF64_Section_Header_t)*num_sections,
+                                   _Alignof(ELF64_Section_Header_t));
+}
+
+
+
+/*
+ * Returns the number of sections in a 64-bit ELF file. When
+ * e_shnum is 0 and there is a section header table, the count
+ * is the sh_size member of section 0 instead. The table must be
+ * the one get_ELF64_section_header_table returned, which has
+ * already checked that the count fits in the file.
+ */
+int get_ELF64_num_sections(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table)
+{
+    if(file_header == NULL)
+    {
+        return 0;
+    }
+
+    if(file_header->e_shnum != 0 || file_header->e_shoff == 0 || section_header_table == NULL)
+    {
+        return file_header->e_shnum;
+    }
+
+    return (int) section_header_table[0].sh_size;
+}
+
+
+
+/*
+ * Returns the index of the section header string table of a
+ * 64-bit ELF file. An index that does not fit below
+ * SHN_LORESERVE is stored as SHN_XINDEX, with the real index
+ * in the sh_link member of section 0.
+ */
+uint32_t get_ELF64_section_string_table_index(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table)
+{
+    if(file_header == NULL)
+    {
+        return SHN_UNDEF;
+    }
+
+    if(file_header->e_shstrndx != SHN_XINDEX || get_ELF64_num_sections(file_header, section_header_table) == 0)
+    {
+        return file_header->e_shstrndx;
+    }
+
+    return section_header_table[0].sh_link;
+}
+
+
+
+
+/*
+ * Returns a pointer to a single section header of
+ * a 32-bit ELF file, or NULL if the index is out of
+ * range.
+ */
+ELF32_Section_Header_t *get_ELF32_section_header(elf_image_t *image, int index)
+{
+    ELF32_Header_t *file_header;
+    ELF32_Section_Header_t *section_header_table;
+
+    if((file_header = get_ELF32_header(image)) == NULL || (section_header_table = get_ELF32_section_header_table(image)) == NULL)
+    {
+        return NULL;
+    }
+
+    if(index < 0 || index >= get_ELF32_num_sections(file_header, section_header_table))
+    {
+        return NULL;
+    }
+
+    return &section_header_table[index];
+}
+
+
+
+
+/*
+ * Returns a pointer to a single section header of
+ * a 64-bit ELF file, or NULL if the index is out of
+ * range.
+ */
+ELF64_Section_Header_t *get_ELF64_section_header(elf_image_t *image, int index)
+{
+    ELF64_Header_t *file_header;
+    ELF64_Section_Header_t *section_header_table;
+
+    if((file_header = get_ELF64_header(image)) == NULL || (section_header_table = get_ELF64_section_header_table(image)) == NULL)
+    {
+        return NULL;
+    }
+
+    if(index < 0 || index >= get_ELF64_num_sections(file_header, section_header_table))
+    {
+        return NULL;
+    }
+
+    return &section_header_table[index];
+}
+
+
+
+
+/*
+ * Returns a pointer to the program header table of a 32-bit
+ * ELF file inside the mapping. As with the section header
+ * table, nothing is copied and the pointer must not be freed.
+ * The number of program headers (segments) is read from the
+ * ELF header.
+ */
+ELF32_Program_Header_t *get_ELF32_program_header_table(elf_image_t *image)
+{
+    ELF32_Header_t *file_header;
+
+
+    /*
+     * Get the ELF header for the offset
+     * and entry size of the program header
+     * table.
+     */
+    if((file_header = get_ELF32_header(image)) == NULL)
+    {
+        return NULL;
+    }
+
+
+    if(file_header->e_phnum > 0 && file_header->e_phentsize != sizeof(ELF32_Program_Header_t))
+    {
+        fprintf(stderr, "Unexpected program header size %d.\n", file_header->e_phentsize);
+        return NULL;
+    }
+
+
+    return get_aligned_image_range(image, file_header->e_phoff, (uint64_t) sizeof(ELF32_Program_Header_t)*file_header->e_phnum,
+                                   _Alignof(ELF32_Program_Header_t));
+}
+
+
+
+
+/*
+ * Returns a pointer to the program header table of a 64-bit
+ * ELF file inside the mapping. As with the section header
+ * table, nothing is copied and the pointer must not be freed.
+ * The number of program headers (segments) is read from the
+ * ELF header.
+ */
+ELF64_Program_Header_t *get_ELF64_program_header_table(elf_image_t *image)
+{
+    ELF64_Header_t *file_header;
+
+
+    /*
+     * Get the ELF header for the offset
+     * and entry size of the program header
+     * table.
+     */
+    if((file_header = get_ELF64_header(image)) == NULL)
+    {
+        return NULL;
+    }
+
+
+    if(file_header->e_phnum > 0 && file_header->e_phentsize != sizeof(ELF64_Program_Header_t))
+    {
+        fprintf(stderr, "Unexpected program header size %d.\n", file_header->e_phentsize);
+        return NULL;
+    }
+
+
+    return get_aligned_image_range(image, file_header->e_phoff, (uint64_t) sizeof(ELF64_Program_Header_t)*file_header->e_phnum,
+                                   _Alignof(ELF64_Program_Header_t));
+}
+
+
+
+
+/*
+ * Returns a pointer to a single program header of
+ * a 32-bit ELF file, or NULL if the index is out of
+ * range.
+ */
+ELF32_Program_Header_t *get_ELF32_program_header(elf_image_t *image, int index)
+{
+    ELF32_Header_t *file_header;
+    ELF32_Program_Header_t *program_header_table;
+
+    if((file_header = get_ELF32_header(image)) == NULL || (program_header_table = get_ELF32_program_header_table(image)) == NULL)
+    {
+        return NULL;
+    }
+
+    if(index < 0 || index >= file_header->e_phnum)
+    {
+        return NULL;
+    }
+
+    return &program_header_table[index];
+}
+
+
+
+
+/*
+ * Returns a pointer to a single program header of
+ * a 64-bit ELF file, or NULL if the index is out of
+ * range.
+ */
+ELF64_Program_Header_t *get_ELF64_program_header(elf_image_t *image, int index)
+{
+    ELF64_Header_t *file_header;
+    ELF64_Program_Header_t *program_header_table;
+
+    if((file_header = get_ELF64_header(image)) == NULL || (program_header_table = get_ELF64_program_header_table(image)) == NULL)
+    {
+        return NULL;
+    }
+
+    if(index < 0 || index >= file_header->e_phnum)
+    {
+        return NULL;
+    }
+
+    return &program_header_table[index];
+}
+
+
+
+
+/*
+ * A range of file offsets or virtual addresses occupied by a
+ * section or a segment. The mapping is built from these so that
+ * the same code serves both 32-bit and 64-bit files.
+ */
+typedef struct
+{
+    uint64_t start;
+    uint64_t size;
+    int index;
+
+} interval_t;
+
+
+
+/*
+ * Orders intervals by starting point, breaking ties by index
+ * so that the order does not depend on the sorting algorithm.
+ */
+static int compare_intervals(const void *first, const void *second)
+{
+    const interval_t *a = first;
+    const interval_t *b = second;
+
+    if(a->start != b->start)
+        return (a->start < b->start) ? -1 : 1;
+
+    return a->index - b->index;
+}
+
+
+static int compare_ints(const void *first, const void *second)
+{
+    return *(const int*)first - *(const int*)second;
+}
+
+
+
+/*
+ * Returns the position of the first interval in the sorted array
+ * that starts at or after the given point (or num_intervals if
+ * there is none).
+ */
+static int find_first_interval(interval_t *intervals, int num_intervals, uint64_t start)
+{
+    int low = 0, high = num_intervals;
+
+    while(low < high)
+    {
+        int middle = low + (high - low)/2;
+
+        if(intervals[middle].start < start)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+
+
+/*
+ * Appends a section index to the segment currently being built
+ * (the one after the last complete segment), doubling the index
+ * array whenever it fills up.
+ */
+static void add_section_to_mapping(section_to_segment_mapping_t *mapping, int *array_size, int section_index)
+{
+    int num_entries = mapping->segment_start[mapping->num_segments + 1];
+
+    if(num_entries == *array_size)
+    {
+        *array_size = (*array_size == 0) ? 16 : *array_size*2;
+        mapping->section_indices = (int*) realloc(mapping->section_indices, sizeof(int)*(*array_size));
+    }
+
+    mapping->section_indices[num_entries] = section_index;
+    mapping->segment_start[mapping->num_segments + 1]++;
+}
+
+
+
+/*
+ * Adds every section whose interval lies entirely within the
+ * given segment interval to the segment currently being built.
+ * Since the section intervals are sorted by start, the candidates
+ * are found with a binary search and a sweep that stops at the
+ * first section starting past the end of the segment, so only
+ * sections that start inside the segment are ever looked at.
+ */
+static void add_contained_sections(section_to_segment_mapping_t *mapping, int *array_size,
+                                   interval_t *sections, int num_sections, interval_t *segment)
+{
+    uint64_t segment_end = segment->start + segment->size;
+
+    for(int i = find_first_interval(sections, num_sections, segment->start); i < num_sections; i++)
+    {
+        if(sections[i].start > segment_end)
+            break;
+
+        // written this way around so that huge sizes cannot overflow
+        if(sections[i].size <= segment_end - sections[i].start)
+            add_section_to_mapping(mapping, array_size, sections[i].index);
+    }
+}
+
+
+
+/*
+ * Builds the mapping from the section and segment intervals.
+ * A section belongs to a segment if its file contents lie within
+ * the file contents of the segment, or, for NOBITS sections (which
+ * occupy no space in the file), if its addresses lie within the
+ * memory image of the segment. Both section arrays are sorted once,
+ * after which each segment costs a binary search plus its matches,
+ * so the mapping is built in O((n+m) log n) rather than O(n*m).
+ * All of the interval arrays are indexed by section or segment
+ * number on entry and the section arrays are sorted in place.
+ */
+static section_to_segment_mapping_t *build_section_to_segment_mapping(interval_t *section_offsets, int num_sections,
+                                                                      interval_t *nobits_addresses, int num_nobits,
+                                                                      interval_t *segment_offsets, interval_t *segment_addresses,
+                                                                      int num_segments)
+{
+    section_to_segment_mapping_t *mapping;
+    int array_size = 0;
+
+
+    // the arrays may be empty, in which case there is nothing to sort
+    if(num_sections > 1)
+    {
+        qsort(section_offsets, num_sections, sizeof(interval_t), compare_intervals);
+    }
+
+    if(num_nobits > 1)
+    {
+        qsort(nobits_addresses, num_nobits, sizeof(interval_t), compare_intervals);
+    }
+
+
+    // allocate space for mapping
+    mapping = (section_to_segment_mapping_t*) malloc(sizeof(section_to_segment_mapping_t));
+    mapping->segment_start = (int*) malloc(sizeof(int)*(num_segments + 1));
+    mapping->section_indices = NULL;
+    mapping->num_segments = 0;
+    mapping->segment_start[0] = 0;
+
+
+    // build the mapping one segment at a time
+    for(int i = 0; i < num_segments; i++)
+    {
+        int first = mapping->segment_start[i];
+        int num_matches;
+
+
+        /*
+         * The next segment starts where this one
+         * ends, so begin it with no sections and
+         * let add_section_to_mapping grow it.
+         */
+        mapping->segment_start[i+1] = first;
+
+        add_contained_sections(mapping, &array_size, section_offsets, num_sections, &segment_offsets[i]);
+        add_contained_sections(mapping, &array_size, nobits_addresses, num_nobits, &segment_addresses[i]);
+
+
+        /*
+         * The sweeps produce sections in offset and address
+         * order, but they are listed in section header table
+         * order. A NOBITS section can match on both offset and
+         * address, so drop any duplicates after sorting. A
+         * segment with no sections may have no array to sort.
+         */
+        num_matches = mapping->segment_start[i+1] - first;
+
+        if(num_matches > 1)
+        {
+            qsort(mapping->section_indices + first, num_matches, sizeof(int), compare_ints);
+        }
+
+        mapping->segment_start[i+1] = first;
+        for(int j = first; j < first + num_matches; j++)
+        {
+            if(j == first || mapping->section_indices[j] != mapping->section_indices[j-1])
+            {
+                mapping->section_indices[mapping->segment_start[i+1]] = mapping->section_indices[j];
+                mapping->segment_start[i+1]++;
+            }
+        }
+
+        mapping->num_segments++;
+    }
+
+
+    return mapping;
+}
+
+
+
+/*
+ * Gets the section to segment mapping of a 32-bit ELF file.
+ * See get_ELF64_section_to_segment_mapping for the details.
+ */
+section_to_segment_mapping_t *get_ELF32_section_to_segment_mapping(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                                                                   ELF32_Program_Header_t *program_header_table)
+{
+    section_to_segment_mapping_t *mapping;
+    interval_t *section_offsets, *nobits_addresses, *segment_offsets, *segment_addresses;
+    int num_nobits = 0;
+    int num_sections;
+
+
+    /*
+     * The file header, section headers and program
+     * headers are all needed to create the mapping.
+     */
+    if(file_header == NULL || section_header_table == NULL || program_header_table == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to get_ELF32_section_to_segment_mapping.\n");
+        return NULL;
+    }
+
+    num_sections = get_ELF32_num_sections(file_header, section_header_table);
+
+
+    section_offsets = (interval_t*) malloc(sizeof(interval_t)*(2*num_sections + 2*file_header->e_phnum));
+    nobits_addresses = section_offsets + num_sections;
+    segment_offsets = nobits_addresses + num_sections;
+    segment_addresses = segment_offsets + file_header->e_phnum;
+
+
+    for(int i = 0; i < num_sections; i++)
+    {
+        section_offsets[i] = (interval_t) {section_header_table[i].sh_offset, section_header_table[i].sh_size, i};
+
+        if(section_header_table[i].sh_type == SHT_NOBITS)
+        {
+            nobits_addresses[num_nobits] = (interval_t) {section_header_table[i].sh_addr, section_header_table[i].sh_size, i};
+            num_nobits++;
+        }
+    }
+
+    for(int i = 0; i < file_header->e_phnum; i++)
+    {
+        segment_offsets[i] = (interval_t) {program_header_table[i].p_offset, program_header_table[i].p_filesz, i};
+        segment_addresses[i] = (interval_t) {program_header_table[i].p_vaddr, program_header_table[i].p_memsz, i};
+    }
+
+
+    mapping = build_section_to_segment_mapping(section_offsets, num_sections, nobits_addresses, num_nobits,
+                                               segment_offsets, segment_addresses, file_header->e_phnum);
+
+    free(section_offsets);
+
+    return mapping;
+}
+
+
+
+/*
+ * Fills in the symbol table held by the given SHT_SYMTAB or
+ * SHT_DYNSYM section of a 32-bit ELF file, along with its string
+ * table. Nothing is copied; the symbols and the names are used
+ * in place in the mapping.
+ */
+int get_ELF32_symbol_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                           int section_index, symbol_table_t *symbol_table)
+{
+    ELF32_Section_Header_t *section_header;
+    ELF32_Section_Header_t *string_table_header;
+
+
+    /*
+     * Defensive check to prevent a segmentation fault
+     * from NULL pointer being passed to the function.
+     */
+    if(file_header == NULL || section_header_table == NULL || symbol_table == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to get_ELF32_symbol_table.\n");
+        return RET_NOT_OK;
+    }
+
+    if(section_index < 0 || section_index >= get_ELF32_num_sections(file_header, section_header_table))
+    {
+        fprintf(stderr, "Symbol table section index out of range.\n");
+        return RET_NOT_OK;
+    }
+
+    section_header = &section_header_table[section_index];
+
+
+    /*
+     * The symbols are read straight out of the mapping,
+     * so the entries must be laid out exactly as the
+     * structure is.
+     */
+    if(section_header->sh_entsize != sizeof(ELF32_Sym_t))
+    {
+        fprintf(stderr, "Symbol table entry size %lu does not match ELF32_Sym_t.\n", (uint64_t) section_header->sh_entsize);
+        return RET_NOT_OK;
+    }
+
+    symbol_table->num_symbols = section_header->sh_size / sizeof(ELF32_Sym_t);
+    symbol_table->symbols = get_aligned_image_range(image, section_header->sh_offset, symbol_table->num_symbols * sizeof(ELF32_Sym_t),
+                                                    _Alignof(ELF32_Sym_t));
+
+    if(symbol_table->symbols == NULL)
+    {
+        fprintf(stderr, "Symbol table is misaligned or lies outside the file.\n");
+        return RET_NOT_OK;
+    }
+
+
+    /*
+     * A symbol table without a usable string table can
+     * still be dumped, just without names.
+     */
+    symbol_table->string_table = NULL;
+    symbol_table->string_table_size = 0;
+
+    if(section_header->sh_link < (uint32_t) get_ELF32_num_sections(file_header, section_header_table))
+    {
+        string_table_header = &section_header_table[section_header->sh_link];
+
+        symbol_table->string_table = get_image_range(image, string_table_header->sh_offset, string_table_header->sh_size);
+
+        if(symbol_table->string_table != NULL)
+        {
+            symbol_table->string_table_size = string_table_header->sh_size;
+        }
+    }
+
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Fills in the relocations held by the given SHT_REL or SHT_RELA
+ * section of a 32-bit ELF file, along with the symbol table they
+ * refer to. Like the symbol table, the entries are used in place,
+ * however many there are.
+ */
+int get_ELF32_relocation_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table,
+                               int section_index, relocation_table_t *relocation_table)
+{
+    ELF32_Section_Header_t *section_header;
+    uint64_t entry_size;
+
+
+    /*
+     * Defensive check to prevent a segmentation fault
+     * from NULL pointer being passed to the function.
+     */
+    if(file_header == NULL || section_header_table == NULL || relocation_table == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to get_ELF32_relocation_table.\n");
+        return RET_NOT_OK;
+    }
+
+    if(section_index < 0 || section_index >= get_ELF32_num_sections(file_header, section_header_table))
+    {
+        fprintf(stderr, "Relocation section index out of range.\n");
+        return RET_NOT_OK;
+    }
+
+    section_header = &section_header_table[section_index];
+
+    relocation_table->has_addends = (section_header->sh_type == SHT_RELA);
+    entry_size = relocation_table->has_addends ? sizeof(ELF32_Rela_t) : sizeof(ELF32_Rel_t);
+
+    if(section_header->sh_entsize != entry_size)
+    {
+        fprintf(stderr, "Relocation entry size %lu does not match the %s structure.\n", (uint64_t) section_header->sh_entsize,
+                relocation_table->has_addends ? "ELF32_Rela_t" : "ELF32_Rel_t");
+        return RET_NOT_OK;
+    }
+
+    relocation_table->num_entries = section_header->sh_size / entry_size;
+    relocation_table->entries = get_aligned_image_range(image, section_header->sh_offset, relocation_table->num_entries * entry_size,
+                                                         _Alignof(ELF32_Rela_t));
+
+    if(relocation_table->entries == NULL)
+    {
+        fprintf(stderr, "Relocation section is misaligned or lies outside the file.\n");
+        return RET_NOT_OK;
+    }
 
-                current_segment_index++;
-            }
 
-            if(section_header_table[j].sh_type == SHT_NOBITS 
-                        && section_address >= segment_address 
-                        && section_address + section_size <= segment_address + segment_mem_size)
-            {
-                char *section_name = section_names[j];
+    /*
+     * Relocations that refer to no symbol (sh_link 0) are
+     * still dumped, just without symbol values or names.
+     */
+    relocation_table->has_symbols = false;
+
+    if(section_header->sh_link != SHN_UNDEF && section_header->sh_link < (uint32_t) get_ELF32_num_sections(file_header, section_header_table))
+    {
+        relocation_table->has_symbols = (get_ELF32_symbol_table(image, file_header, section_header_table, section_header->sh_link,
+                                                                 &relocation_table->symbols) == RET_OK);
+    }
+
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Returns a pointer to size bytes of a 32-bit ELF file at the
+ * given virtual address, or NULL if that range does not lie in
+ * the file part of a single PT_LOAD segment. The dynamic section
+ * refers to its tables by address, and this is how they are
+ * found in the mapping.
+ */
+void *get_ELF32_address_range(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Program_Header_t *program_header_table,
+                              uint64_t address, uint64_t size)
+{
+    if(file_header == NULL || program_header_table == NULL)
+    {
+        return NULL;
+    }
+
+    for(int i = 0; i < file_header->e_phnum; i++)
+    {
+        ELF32_Program_Header_t *segment = &program_header_table[i];
+
+        if(segment->p_type != PT_LOAD || address < segment->p_vaddr)
+        {
+            continue;
+        }
+
+        if(address - segment->p_vaddr > segment->p_filesz || size > segment->p_filesz - (address - segment->p_vaddr))
+        {
+            continue;
+        }
+
+        return get_image_range(image, segment->p_offset + (address - segment->p_vaddr), size);
+    }
+
+    return NULL;
+}
+
+
+
+/*
+ * Returns the dynamic section of a 32-bit ELF file, found through
+ * its PT_DYNAMIC segment, and stores the number of entries up to
+ * and including the DT_NULL entry in num_entries. Returns NULL if
+ * the file has no dynamic section.
+ */
+ELF32_Dyn_t *get_ELF32_dynamic_table(elf_image_t *image, ELF32_Header_t *file_header, ELF32_Program_Header_t *program_header_table,
+                                     uint64_t *num_entries)
+{
+    if(file_header == NULL || program_header_table == NULL)
+    {
+        return NULL;
+    }
+
+    for(int i = 0; i < file_header->e_phnum; i++)
+    {
+        ELF32_Dyn_t *dynamic_table;
+        uint64_t count;
+
+        if(program_header_table[i].p_type != PT_DYNAMIC)
+        {
+            continue;
+        }
+
+        count = program_header_table[i].p_filesz / sizeof(ELF32_Dyn_t);
 
-                section_to_segment_mapping[i][current_segment_index] = malloc(sizeof(char)*(strlen(section_name)+1));
+        if((dynamic_table = get_aligned_image_range(image, program_header_table[i].p_offset, count * sizeof(ELF32_Dyn_t),
+                                                     _Alignof(ELF32_Dyn_t))) == NULL)
+        {
+            return NULL;
+        }
 
-                strcpy(section_to_segment_mapping[i][current_segment_index], section_name);
 
-                current_segment_index++;
+        // the segment is often padded past the DT_NULL entry
+        for(uint64_t j = 0; j < count; j++)
+        {
+            if(dynamic_table[j].d_tag == DT_NULL)
+            {
+                count = j + 1;
+                break;
             }
+        }
+
+        *num_entries = count;
+        return dynamic_table;
+    }
+
+    return NULL;
+}
+
+
+
+
+/*
+ * Finds the sections that relocation sections apply to (the
+ * sections their sh_info members give). Returns an array with
+ * one flag per section header, which the caller must free.
+ */
+bool *get_ELF32_relocated_sections(ELF32_Header_t *file_header, ELF32_Section_Header_t *section_header_table)
+{
+    bool *relocated;
+    int num_sections;
 
+
+    if(file_header == NULL || section_header_table == NULL)
+    {
+        return NULL;
+    }
+
+    num_sections = get_ELF32_num_sections(file_header, section_header_table);
+
+    if((relocated = (bool*) calloc(num_sections + 1, sizeof(bool))) == NULL)
+    {
+        return NULL;
+    }
+
+    for(int i = 0; i < num_sections; i++)
+    {
+        if((section_header_table[i].sh_type == SHT_REL || section_header_table[i].sh_type == SHT_RELA) &&
+           section_header_table[i].sh_info < (uint32_t) num_sections)
+        {
+            relocated[section_header_table[i].sh_info] = true;
         }
+    }
+
+    return relocated;
+}
+
 
-        section_to_segment_mapping[i][current_segment_index] = NULL;
+
+
+/*
+ * Gets the section to segment mapping. Rather than holding the
+ * names of the sections in each segment, the mapping holds their
+ * indices into the section header table, in compressed sparse row
+ * form: the indices of the sections in segment i are
+ *
+ *     section_indices[segment_start[i]] ... section_indices[segment_start[i+1] - 1]
+ *
+ * so the whole mapping is two arrays and takes memory proportional
+ * to the number of (section, segment) pairs rather than to the
+ * number of segments times the number of sections. Names can be
+ * looked up in the section name table by index when printing.
+ * The mapping must be released with release_section_to_segment_mapping.
+ */
+section_to_segment_mapping_t *get_ELF64_section_to_segment_mapping(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                                                                   ELF64_Program_Header_t *program_header_table)
+{
+    section_to_segment_mapping_t *mapping;
+    interval_t *section_offsets, *nobits_addresses, *segment_offsets, *segment_addresses;
+    int num_nobits = 0;
+    int num_sections;
+
+
+    /*
+     * The file header, section headers and program
+     * headers are all needed to create the mapping.
+     */
+    if(file_header == NULL || section_header_table == NULL || program_header_table == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to get_ELF64_section_to_segment_mapping.\n");
+        return NULL;
     }
 
+    num_sections = get_ELF64_num_sections(file_header, section_header_table);
+
+
+    /*
+     * All four interval arrays come out of one allocation:
+     * the file ranges of every section, the address ranges
+     * of the NOBITS sections, and the file and address ranges
+     * of every segment.
+     */
+    section_offsets = (interval_t*) malloc(sizeof(interval_t)*(2*num_sections + 2*file_header->e_phnum));
+    nobits_addresses = section_offsets + num_sections;
+    segment_offsets = nobits_addresses + num_sections;
+    segment_addresses = segment_offsets + file_header->e_phnum;
+
 
-    free(section_header_table);
-    free(program_header_table);
+    for(int i = 0; i < num_sections; i++)
+    {
+        section_offsets[i] = (interval_t) {section_header_table[i].sh_offset, section_header_table[i].sh_size, i};
+
+        // only NOBITS sections are matched by address
+        if(section_header_table[i].sh_type == SHT_NOBITS)
+        {
+            nobits_addresses[num_nobits] = (interval_t) {section_header_table[i].sh_addr, section_header_table[i].sh_size, i};
+            num_nobits++;
+        }
+    }
 
-    for(int i = 0; i < file_header.e_shnum; i++)
+    for(int i = 0; i < file_header->e_phnum; i++)
     {
-        free(section_names[i]);
+        segment_offsets[i] = (interval_t) {program_header_table[i].p_offset, program_header_table[i].p_filesz, i};
+        segment_addresses[i] = (interval_t) {program_header_table[i].p_vaddr, program_header_table[i].p_memsz, i};
     }
 
-    free(section_names);
 
+    mapping = build_section_to_segment_mapping(section_offsets, num_sections, nobits_addresses, num_nobits,
+                                               segment_offsets, segment_addresses, file_header->e_phnum);
 
-    return section_to_segment_mapping;
+    free(section_offsets);
+
+    return mapping;
 }
 
 
 
 /*
- * Gets the section to segment mapping. It is returned in the form of
- * a list of NULL pointer terminated lists of (NULL character terminated)
- * strings (kinda confusing, right?). The returned data type is an array
- * with one element per program header, where each element is itself an array
- * of strings, where each string is the name of a section contained
- * in the given segment. Thus, index 4 of the array would have an array of
- * section names that are to be placed in segment 4 at run time.
- * 
- * The NULL termination allows the user to find the end of the list without
- * having to have an explicitlength for each index of the list. The top-level
- * list (list of string lists) does not have any NULL termination since
- * its length is the same as the number of program headers (segments),
- * which is readily available to the user.
+ * Fills in the symbol table held by the given SHT_SYMTAB or
+ * SHT_DYNSYM section of a 64-bit ELF file, along with its string
+ * table. Nothing is copied; the symbols and the names are used
+ * in place in the mapping.
+ */
+int get_ELF64_symbol_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                           int section_index, symbol_table_t *symbol_table)
+{
+    ELF64_Section_Header_t *section_header;
+    ELF64_Section_Header_t *string_table_header;
+
+
+    /*
+     * Defensive check to prevent a segmentation fault
+     * from NULL pointer being passed to the function.
+     */
+    if(file_header == NULL || section_header_table == NULL || symbol_table == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to get_ELF64_symbol_table.\n");
+        return RET_NOT_OK;
+    }
+
+    if(section_index < 0 || section_index >= get_ELF64_num_sections(file_header, section_header_table))
+    {
+        fprintf(stderr, "Symbol table section index out of range.\n");
+        return RET_NOT_OK;
+    }
+
+    section_header = &section_header_table[section_index];
+
+
+    /*
+     * The symbols are read straight out of the mapping,
+     * so the entries must be laid out exactly as the
+     * structure is.
+     */
+    if(section_header->sh_entsize != sizeof(ELF64_Sym_t))
+    {
+        fprintf(stderr, "Symbol table entry size %lu does not match ELF64_Sym_t.\n", (uint64_t) section_header->sh_entsize);
+        return RET_NOT_OK;
+    }
+
+    symbol_table->num_symbols = section_header->sh_size / sizeof(ELF64_Sym_t);
+    symbol_table->symbols = get_aligned_image_range(image, section_header->sh_offset, symbol_table->num_symbols * sizeof(ELF64_Sym_t),
+                                                    _Alignof(ELF64_Sym_t));
+
+    if(symbol_table->symbols == NULL)
+    {
+        fprintf(stderr, "Symbol table is misaligned or lies outside the file.\n");
+        return RET_NOT_OK;
+    }
+
+
+    /*
+     * A symbol table without a usable string table can
+     * still be dumped, just without names.
+     */
+    symbol_table->string_table = NULL;
+    symbol_table->string_table_size = 0;
+
+    if(section_header->sh_link < (uint32_t) get_ELF64_num_sections(file_header, section_header_table))
+    {
+        string_table_header = &section_header_table[section_header->sh_link];
+
+        symbol_table->string_table = get_image_range(image, string_table_header->sh_offset, string_table_header->sh_size);
+
+        if(symbol_table->string_table != NULL)
+        {
+            symbol_table->string_table_size = string_table_header->sh_size;
+        }
+    }
+
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Fills in the relocations held by the given SHT_REL or SHT_RELA
+ * section of a 64-bit ELF file, along with the symbol table they
+ * refer to. Like the symbol table, the entries are used in place,
+ * however many there are.
+ */
+int get_ELF64_relocation_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table,
+                               int section_index, relocation_table_t *relocation_table)
+{
+    ELF64_Section_Header_t *section_header;
+    uint64_t entry_size;
+
+
+    /*
+     * Defensive check to prevent a segmentation fault
+     * from NULL pointer being passed to the function.
+     */
+    if(file_header == NULL || section_header_table == NULL || relocation_table == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to get_ELF64_relocation_table.\n");
+        return RET_NOT_OK;
+    }
+
+    if(section_index < 0 || section_index >= get_ELF64_num_sections(file_header, section_header_table))
+    {
+        fprintf(stderr, "Relocation section index out of range.\n");
+        return RET_NOT_OK;
+    }
+
+    section_header = &section_header_table[section_index];
+
+    relocation_table->has_addends = (section_header->sh_type == SHT_RELA);
+    entry_size = relocation_table->has_addends ? sizeof(ELF64_Rela_t) : sizeof(ELF64_Rel_t);
+
+    if(section_header->sh_entsize != entry_size)
+    {
+        fprintf(stderr, "Relocation entry size %lu does not match the %s structure.\n", (uint64_t) section_header->sh_entsize,
+                relocation_table->has_addends ? "ELF64_Rela_t" : "ELF64_Rel_t");
+        return RET_NOT_OK;
+    }
+
+    relocation_table->num_entries = section_header->sh_size / entry_size;
+    relocation_table->entries = get_aligned_image_range(image, section_header->sh_offset, relocation_table->num_entries * entry_size,
+                                                         _Alignof(ELF64_Rela_t));
+
+    if(relocation_table->entries == NULL)
+    {
+        fprintf(stderr, "Relocation section is misaligned or lies outside the file.\n");
+        return RET_NOT_OK;
+    }
+
+
+    /*
+     * Relocations that refer to no symbol (sh_link 0) are
+     * still dumped, just without symbol values or names.
+     */
+    relocation_table->has_symbols = false;
+
+    if(section_header->sh_link != SHN_UNDEF && section_header->sh_link < (uint32_t) get_ELF64_num_sections(file_header, section_header_table))
+    {
+        relocation_table->has_symbols = (get_ELF64_symbol_table(image, file_header, section_header_table, section_header->sh_link,
+                                                                 &relocation_table->symbols) == RET_OK);
+    }
+
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Returns a pointer to size bytes of a 64-bit ELF file at the
+ * given virtual address, or NULL if that range does not lie in
+ * the file part of a single PT_LOAD segment. The dynamic section
+ * refers to its tables by address, and this is how they are
+ * found in the mapping.
  */
-char ***get_section_to_segment_mapping(FILE *input_file)
+void *get_ELF64_address_range(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Program_Header_t *program_header_table,
+                              uint64_t address, uint64_t size)
 {
-    char ***section_to_segment_mapping;
-    int file_class = get_file_class(input_file);
+    if(file_header == NULL || program_header_table == NULL)
+    {
+        return NULL;
+    }
+
+    for(int i = 0; i < file_header->e_phnum; i++)
+    {
+        ELF64_Program_Header_t *segment = &program_header_table[i];
+
+        if(segment->p_type != PT_LOAD || address < segment->p_vaddr)
+        {
+            continue;
+        }
+
+        if(address - segment->p_vaddr > segment->p_filesz || size > segment->p_filesz - (address - segment->p_vaddr))
+        {
+            continue;
+        }
+
+        return get_image_range(image, segment->p_offset + (address - segment->p_vaddr), size);
+    }
+
+    return NULL;
+}
+
+
+
+/*
+ * Returns the dynamic section of a 64-bit ELF file, found through
+ * its PT_DYNAMIC segment, and stores the number of entries up to
+ * and including the DT_NULL entry in num_entries. Returns NULL if
+ * the file has no dynamic section.
+ */
+ELF64_Dyn_t *get_ELF64_dynamic_table(elf_image_t *image, ELF64_Header_t *file_header, ELF64_Program_Header_t *program_header_table,
+                                     uint64_t *num_entries)
+{
+    if(file_header == NULL || program_header_table == NULL)
+    {
+        return NULL;
+    }
+
+    for(int i = 0; i < file_header->e_phnum; i++)
+    {
+        ELF64_Dyn_t *dynamic_table;
+        uint64_t count;
+
+        if(program_header_table[i].p_type != PT_DYNAMIC)
+        {
+            continue;
+        }
+
+        count = program_header_table[i].p_filesz / sizeof(ELF64_Dyn_t);
+
+        if((dynamic_table = get_aligned_image_range(image, program_header_table[i].p_offset, count * sizeof(ELF64_Dyn_t),
+                                                     _Alignof(ELF64_Dyn_t))) == NULL)
+        {
+            return NULL;
+        }
+
+
+        // the segment is often padded past the DT_NULL entry
+        for(uint64_t j = 0; j < count; j++)
+        {
+            if(dynamic_table[j].d_tag == DT_NULL)
+            {
+                count = j + 1;
+                break;
+            }
+        }
+
+        *num_entries = count;
+        return dynamic_table;
+    }
+
+    return NULL;
+}
+
+
+
+
+/*
+ * Finds the sections that relocation sections apply to (the
+ * sections their sh_info members give). Returns an array with
+ * one flag per section header, which the caller must free.
+ */
+bool *get_ELF64_relocated_sections(ELF64_Header_t *file_header, ELF64_Section_Header_t *section_header_table)
+{
+    bool *relocated;
+    int num_sections;
+
+
+    if(file_header == NULL || section_header_table == NULL)
+    {
+        return NULL;
+    }
 
+    num_sections = get_ELF64_num_sections(file_header, section_header_table);
 
-    switch (file_class)
+    if((relocated = (bool*) calloc(num_sections + 1, sizeof(bool))) == NULL)
     {
-    case ELFCLASS32:
-        section_to_segment_mapping = get_ELF32_section_to_segment_mapping(input_file);
-        break;
-    
-    case ELFCLASS64:
-        section_to_segment_mapping = get_ELF64_section_to_segment_mapping(input_file);
-        break;
-    
-    default:
-        break;
+        return NULL;
     }
 
+    for(int i = 0; i < num_sections; i++)
+    {
+        if((section_header_table[i].sh_type == SHT_REL || section_header_table[i].sh_type == SHT_RELA) &&
+           section_header_table[i].sh_info < (uint32_t) num_sections)
+        {
+            relocated[section_header_table[i].sh_info] = true;
+        }
+    }
 
-    return section_to_segment_mapping;
+    return relocated;
 }
 
 
 
 
+/*
+ * Frees a mapping returned by get_ELF32_section_to_segment_mapping
+ * or get_ELF64_section_to_segment_mapping.
+ */
+void release_section_to_segment_mapping(section_to_segment_mapping_t *mapping)
+{
+    free(mapping->segment_start);
+    free(mapping->section_indices);
+    free(mapping);
+}
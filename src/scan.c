@@ -0,0 +1,181 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Implementation file for the file list and the directory walk
+ * used by --recursive.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+
+#include "scan.h"
+#include "readelf.h"
+
+
+
+
+void init_file_list(file_list_t *list)
+{
+    list->num_files = 0;
+    list->capacity = 16;
+    list->files = (file_entry_t*) malloc(list->capacity * sizeof(file_entry_t));
+}
+
+
+
+void release_file_list(file_list_t *list)
+{
+    for(int i = 0; i < list->num_files; i++)
+    {
+        if(list->files[i].found_in_directory)
+        {
+            free(list->files[i].name);
+        }
+    }
+
+    free(list->files);
+    list->files = NULL;
+    list->num_files = 0;
+    list->capacity = 0;
+}
+
+
+
+void add_file(file_list_t *list, char *name, bool found_in_directory)
+{
+    if(list->num_files == list->capacity)
+    {
+        list->capacity *= 2;
+        list->files = (file_entry_t*) realloc(list->files, list->capacity * sizeof(file_entry_t));
+    }
+
+    list->files[list->num_files].name = name;
+    list->files[list->num_files].found_in_directory = found_in_directory;
+    list->num_files++;
+}
+
+
+
+
+static int compare_names(const void *first, const void *second)
+{
+    return strcmp(*(char * const *) first, *(char * const *) second);
+}
+
+
+
+/*
+ * Joins a directory and the name of an entry in it into a
+ * newly allocated path.
+ */
+static char *join_path(const char *directory, const char *name)
+{
+    size_t directory_length = strlen(directory);
+    size_t name_length = strlen(name);
+    char *path = (char*) malloc(directory_length + name_length + 2);
+
+    memcpy(path, directory, directory_length);
+
+    // avoid doubling the slash when given "dir/"
+    if(directory_length == 0 || directory[directory_length - 1] != '/')
+    {
+        path[directory_length] = '/';
+        directory_length++;
+    }
+
+    memcpy(path + directory_length, name, name_length + 1);
+
+    return path;
+}
+
+
+
+/*
+ * Adds every regular file under the given directory to the list,
+ * descending into subdirectories. The entries of each directory
+ * are sorted by name so that the reports always come out in the
+ * same order, whatever order the file system lists them in.
+ *
+ * Symbolic links are not followed, so a link cannot make the walk
+ * loop or dump the same file twice. A subdirectory that cannot be
+ * read is reported and skipped; only a failure to read the top
+ * directory itself makes this return RET_NOT_OK.
+ */
+int add_directory(file_list_t *list, const char *directory)
+{
+    DIR *stream;
+    struct dirent *entry;
+
+    char **paths;
+    int num_paths = 0;
+    int capacity = 16;
+
+
+    if((stream = opendir(directory)) == NULL)
+    {
+        fprintf(stderr, "%s: %s\n", directory, strerror(errno));
+        return RET_NOT_OK;
+    }
+
+    paths = (char**) malloc(capacity * sizeof(char*));
+
+    while((entry = readdir(stream)) != NULL)
+    {
+        if(strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+        {
+            continue;
+        }
+
+        if(num_paths == capacity)
+        {
+            capacity *= 2;
+            paths = (char**) realloc(paths, capacity * sizeof(char*));
+        }
+
+        paths[num_paths] = join_path(directory, entry->d_name);
+        num_paths++;
+    }
+
+    closedir(stream);
+
+
+    qsort(paths, num_paths, sizeof(char*), compare_names);
+
+
+    for(int i = 0; i < num_paths; i++)
+    {
+        struct stat status;
+
+        if(lstat(paths[i], &status) != 0)
+        {
+            fprintf(stderr, "%s: %s\n", paths[i], strerror(errno));
+            free(paths[i]);
+        }
+        else if(S_ISDIR(status.st_mode))
+        {
+            add_directory(list, paths[i]);
+            free(paths[i]);
+        }
+        else if(S_ISREG(status.st_mode))
+        {
+            // the list takes ownership of the path
+            add_file(list, paths[i], true);
+        }
+        else
+        {
+            free(paths[i]);
+        }
+    }
+
+    free(paths);
+
+
+    return RET_OK;
+}
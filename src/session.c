@@ -0,0 +1,813 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Implementation file for the session, which lazily parses
+ * and caches the structures of an ELF file.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#include "session.h"
+
+
+
+
+/*
+ * Opens and maps the given file and initializes the session
+ * with nothing parsed yet. Returns RET_NOT_OK (with errno set)
+ * if the file could not be opened or mapped.
+ */
+int open_session(elf_session_t *session, const char *filename)
+{
+    pthread_mutexattr_t attributes;
+
+
+    memset(session, 0, sizeof(*session));
+
+    if(open_elf_image(&session->image, filename) != RET_OK)
+    {
+        return RET_NOT_OK;
+    }
+
+    session->file_class = get_file_class(&session->image);
+
+
+    pthread_mutexattr_init(&attributes);
+    pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&session->lock, &attributes);
+    pthread_mutexattr_destroy(&attributes);
+
+    return RET_OK;
+}
+
+
+
+/*
+ * Frees every cached structure that was dynamically allocated
+ * and unmaps the file. The headers, tables and names point into
+ * the mapping and are not freed. What is freed is the name
+ * table itself, the section to segment mapping, the symbol and
+ * address indices, the section name index, the relocated
+ * sections, the abbreviation cache, the unit address index,
+ * the FDE indexes and the .debug_names index.
+ */
+void close_session(elf_session_t *session)
+{
+    if(session->eh_frame_index != NULL)
+    {
+        release_range_index(session->eh_frame_index);
+    }
+
+    if(session->debug_frame_index != NULL)
+    {
+        release_range_index(session->debug_frame_index);
+    }
+
+    if(session->names_index != NULL)
+    {
+        release_names_index(session->names_index);
+    }
+
+    if(session->unit_address_index != NULL)
+    {
+        release_range_index(session->unit_address_index);
+    }
+
+    if(session->abbrev_cache != NULL)
+    {
+        release_abbrev_cache(session->abbrev_cache);
+    }
+
+    free(session->relocated_sections);
+
+    if(session->section_name_index != NULL)
+    {
+        release_section_name_index(session->section_name_index);
+    }
+
+
+    if(session->address_index != NULL)
+    {
+        release_address_index(session->address_index);
+    }
+
+
+    if(session->symbol_index != NULL)
+    {
+        release_symbol_index(session->symbol_index);
+    }
+
+
+    if(session->section_to_segment_mapping != NULL)
+    {
+        release_section_to_segment_mapping(session->section_to_segment_mapping);
+    }
+
+
+    if(session->section_names != NULL)
+    {
+        release_section_name_table(session->section_names);
+    }
+
+
+    close_elf_image(&session->image);
+    pthread_mutex_destroy(&session->lock);
+    memset(session, 0, sizeof(*session));
+}
+
+
+
+
+/*
+ * Parses the file header on first use. The header getters
+ * for the two classes share this, and each checks the class
+ * of the file before handing the header out.
+ */
+static void *get_session_file_header(elf_session_t *session)
+{
+    pthread_mutex_lock(&session->lock);
+
+    if(!session->file_header_parsed)
+    {
+        session->file_header_parsed = true;
+
+        switch(session->file_class)
+        {
+            case ELFCLASS32:
+                session->file_header = get_ELF32_header(&session->image);
+                break;
+
+            case ELFCLASS64:
+                session->file_header = get_ELF64_header(&session->image);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void *file_header = session->file_header;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return file_header;
+}
+
+
+
+static void *get_session_section_header_table(elf_session_t *session)
+{
+    pthread_mutex_lock(&session->lock);
+
+    if(!session->section_header_table_parsed)
+    {
+        session->section_header_table_parsed = true;
+
+        switch(session->file_class)
+        {
+            case ELFCLASS32:
+                session->section_header_table = get_ELF32_section_header_table(&session->image);
+                break;
+
+            case ELFCLASS64:
+                session->section_header_table = get_ELF64_section_header_table(&session->image);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void *section_header_table = session->section_header_table;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return section_header_table;
+}
+
+
+
+static void *get_session_program_header_table(elf_session_t *session)
+{
+    pthread_mutex_lock(&session->lock);
+
+    if(!session->program_header_table_parsed)
+    {
+        session->program_header_table_parsed = true;
+
+        switch(session->file_class)
+        {
+            case ELFCLASS32:
+                session->program_header_table = get_ELF32_program_header_table(&session->image);
+                break;
+
+            case ELFCLASS64:
+                session->program_header_table = get_ELF64_program_header_table(&session->image);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void *program_header_table = session->program_header_table;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return program_header_table;
+}
+
+
+
+
+ELF32_Header_t *get_session_ELF32_header(elf_session_t *session)
+{
+    if(session->file_class != ELFCLASS32)
+    {
+        return NULL;
+    }
+
+    return (ELF32_Header_t*) get_session_file_header(session);
+}
+
+
+
+ELF32_Section_Header_t *get_session_ELF32_section_header_table(elf_session_t *session)
+{
+    if(session->file_class != ELFCLASS32 || get_session_file_header(session) == NULL)
+    {
+        return NULL;
+    }
+
+    return (ELF32_Section_Header_t*) get_session_section_header_table(session);
+}
+
+
+
+ELF32_Program_Header_t *get_session_ELF32_program_header_table(elf_session_t *session)
+{
+    if(session->file_class != ELFCLASS32 || get_session_file_header(session) == NULL)
+    {
+        return NULL;
+    }
+
+    return (ELF32_Program_Header_t*) get_session_program_header_table(session);
+}
+
+
+
+ELF64_Header_t *get_session_ELF64_header(elf_session_t *session)
+{
+    if(session->file_class != ELFCLASS64)
+    {
+        return NULL;
+    }
+
+    return (ELF64_Header_t*) get_session_file_header(session);
+}
+
+
+
+ELF64_Section_Header_t *get_session_ELF64_section_header_table(elf_session_t *session)
+{
+    if(session->file_class != ELFCLASS64 || get_session_file_header(session) == NULL)
+    {
+        return NULL;
+    }
+
+    return (ELF64_Section_Header_t*) get_session_section_header_table(session);
+}
+
+
+
+ELF64_Program_Header_t *get_session_ELF64_program_header_table(elf_session_t *session)
+{
+    if(session->file_class != ELFCLASS64 || get_session_file_header(session) == NULL)
+    {
+        return NULL;
+    }
+
+    return (ELF64_Program_Header_t*) get_session_program_header_table(session);
+}
+
+
+
+
+/*
+ * Returns the number of sections in the file. This is the
+ * e_shnum member of the file header unless the file has too
+ * many sections for it to hold, in which case the count comes
+ * from section 0. Commands should use this rather than e_shnum.
+ */
+int get_session_num_sections(elf_session_t *session)
+{
+    switch(session->file_class)
+    {
+        case ELFCLASS32:
+            return get_ELF32_num_sections(get_session_ELF32_header(session), get_session_ELF32_section_header_table(session));
+
+        case ELFCLASS64:
+            return get_ELF64_num_sections(get_session_ELF64_header(session), get_session_ELF64_section_header_table(session));
+
+        default:
+            return 0;
+    }
+}
+
+
+
+/*
+ * Returns the index of the section header string table,
+ * reading it from section 0 when e_shstrndx is SHN_XINDEX.
+ */
+uint32_t get_session_section_string_table_index(elf_session_t *session)
+{
+    switch(session->file_class)
+    {
+        case ELFCLASS32:
+            return get_ELF32_section_string_table_index(get_session_ELF32_header(session), get_session_ELF32_section_header_table(session));
+
+        case ELFCLASS64:
+            return get_ELF64_section_string_table_index(get_session_ELF64_header(session), get_session_ELF64_section_header_table(session));
+
+        default:
+            return SHN_UNDEF;
+    }
+}
+
+
+
+
+/*
+ * Returns the table of section names, building it from
+ * the cached file header and section header table the
+ * first time it is asked for. The table is owned by
+ * the session.
+ */
+section_name_table_t *get_session_section_names(elf_session_t *session)
+{
+    pthread_mutex_lock(&session->lock);
+
+    if(!session->section_names_parsed)
+    {
+        session->section_names_parsed = true;
+
+        switch(session->file_class)
+        {
+            case ELFCLASS32:
+                session->section_names = get_ELF32_section_names(&session->image,
+                                                                 get_session_ELF32_header(session),
+                                                                 get_session_ELF32_section_header_table(session));
+                break;
+
+            case ELFCLASS64:
+                session->section_names = get_ELF64_section_names(&session->image,
+                                                                 get_session_ELF64_header(session),
+                                                                 get_session_ELF64_section_header_table(session));
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    section_name_table_t *section_names = session->section_names;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return section_names;
+}
+
+
+
+/*
+ * Returns the section to segment mapping, building it
+ * from the cached tables the first time it is asked
+ * for. The mapping is owned by the session.
+ */
+section_to_segment_mapping_t *get_session_section_to_segment_mapping(elf_session_t *session)
+{
+    pthread_mutex_lock(&session->lock);
+
+    if(!session->section_to_segment_mapping_parsed)
+    {
+        session->section_to_segment_mapping_parsed = true;
+
+        switch(session->file_class)
+        {
+            case ELFCLASS32:
+                session->section_to_segment_mapping = get_ELF32_section_to_segment_mapping(get_session_ELF32_header(session),
+                                                                                           get_session_ELF32_section_header_table(session),
+                                                                                           get_session_ELF32_program_header_table(session));
+                break;
+
+            case ELFCLASS64:
+                session->section_to_segment_mapping = get_ELF64_section_to_segment_mapping(get_session_ELF64_header(session),
+                                                                                           get_session_ELF64_section_header_table(session),
+                                                                                           get_session_ELF64_program_header_table(session));
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    section_to_segment_mapping_t *section_to_segment_mapping = session->section_to_segment_mapping;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return section_to_segment_mapping;
+}
+
+
+
+/*
+ * Returns the index for looking symbols up by name, building
+ * it the first time it is asked for. Building it may mean
+ * hashing every symbol in .symtab, so it is done once and
+ * shared by every lookup. The index is owned by the session.
+ */
+symbol_index_t *get_session_symbol_index(elf_session_t *session)
+{
+    pthread_mutex_lock(&session->lock);
+
+    if(!session->symbol_index_parsed)
+    {
+        session->symbol_index_parsed = true;
+
+        switch(session->file_class)
+        {
+            case ELFCLASS32:
+                session->symbol_index = build_ELF32_symbol_index(&session->image,
+                                                                 get_session_ELF32_header(session),
+                                                                 get_session_ELF32_section_header_table(session),
+                                                                 get_session_ELF32_program_header_table(session),
+                                                                 get_session_section_names(session));
+                break;
+
+            case ELFCLASS64:
+                session->symbol_index = build_ELF64_symbol_index(&session->image,
+                                                                 get_session_ELF64_header(session),
+                                                                 get_session_ELF64_section_header_table(session),
+                                                                 get_session_ELF64_program_header_table(session),
+                                                                 get_session_section_names(session));
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    symbol_index_t *symbol_index = session->symbol_index;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return symbol_index;
+}
+
+
+
+/*
+ * Returns the index for finding the symbol that contains an
+ * address, building it the first time it is asked for. The
+ * index is owned by the session.
+ */
+address_index_t *get_session_address_index(elf_session_t *session)
+{
+    pthread_mutex_lock(&session->lock);
+
+    if(!session->address_index_parsed)
+    {
+        session->address_index_parsed = true;
+
+        switch(session->file_class)
+        {
+            case ELFCLASS32:
+                session->address_index = build_ELF32_address_index(&session->image,
+                                                                   get_session_ELF32_header(session),
+                                                                   get_session_ELF32_section_header_table(session));
+                break;
+
+            case ELFCLASS64:
+                session->address_index = build_ELF64_address_index(&session->image,
+                                                                   get_session_ELF64_header(session),
+                                                                   get_session_ELF64_section_header_table(session));
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    address_index_t *address_index = session->address_index;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return address_index;
+}
+
+
+
+/*
+ * Returns the index of the file's sections by name, building it
+ * the first time it is asked for, so that however many sections
+ * the commands name, the file's names are only hashed once. The
+ * index is owned by the session.
+ */
+section_name_index_t *get_session_section_name_index(elf_session_t *session)
+{
+    pthread_mutex_lock(&session->lock);
+
+    if(!session->section_name_index_parsed)
+    {
+        section_name_table_t *section_names = get_session_section_names(session);
+
+        session->section_name_index_parsed = true;
+
+        if(section_names != NULL)
+        {
+            session->section_name_index = build_section_name_index(section_names);
+        }
+    }
+
+    section_name_index_t *section_name_index = session->section_name_index;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return section_name_index;
+}
+
+
+
+/*
+ * Returns one flag per section, set for the sections that
+ * relocation sections apply to, working them out the first
+ * time they are asked for. The flags are owned by the session.
+ */
+bool *get_session_relocated_sections(elf_session_t *session)
+{
+    pthread_mutex_lock(&session->lock);
+
+    if(!session->relocated_sections_parsed)
+    {
+        session->relocated_sections_parsed = true;
+
+        switch(session->file_class)
+        {
+            case ELFCLASS32:
+                session->relocated_sections = get_ELF32_relocated_sections(get_session_ELF32_header(session),
+                                                                           get_session_ELF32_section_header_table(session));
+                break;
+
+            case ELFCLASS64:
+                session->relocated_sections = get_ELF64_relocated_sections(get_session_ELF64_header(session),
+                                                                           get_session_ELF64_section_header_table(session));
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    bool *relocated_sections = session->relocated_sections;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return relocated_sections;
+}
+
+
+
+/*
+ * Finds the contents of the first section with the given name
+ * (the debugging sections are found by name), setting size to
+ * its size and, if address is not NULL, address to its address.
+ * Returns NULL if there is no such section or it has no contents
+ * in the file. Compressed sections are not supported.
+ */
+unsigned char *get_session_named_section(elf_session_t *session, const char *name, uint64_t *size, uint64_t *address)
+{
+    section_name_index_t *index;
+    const int *sections;
+    uint64_t offset, flags;
+    uint32_t type;
+
+
+    if((index = get_session_section_name_index(session)) == NULL ||
+       find_sections(index, name, strlen(name), &sections) == 0)
+    {
+        return NULL;
+    }
+
+    switch(session->file_class)
+    {
+        case ELFCLASS32:
+        {
+            ELF32_Section_Header_t *section_header = &get_session_ELF32_section_header_table(session)[sections[0]];
+
+            type = section_header->sh_type;
+            flags = section_header->sh_flags;
+            offset = section_header->sh_offset;
+            *size = section_header->sh_size;
+
+            if(address != NULL)
+            {
+                *address = section_header->sh_addr;
+            }
+
+            break;
+        }
+
+        case ELFCLASS64:
+        {
+            ELF64_Section_Header_t *section_header = &get_session_ELF64_section_header_table(session)[sections[0]];
+
+            type = section_header->sh_type;
+            flags = section_header->sh_flags;
+            offset = section_header->sh_offset;
+            *size = section_header->sh_size;
+
+            if(address != NULL)
+            {
+                *address = section_header->sh_addr;
+            }
+
+            break;
+        }
+
+        default:
+            return NULL;
+    }
+
+
+    if(type == SHT_NOBITS)
+    {
+        return NULL;
+    }
+
+    if(flags & SHF_COMPRESSED)
+    {
+        fprintf(stderr, "Section %s is compressed, which is not supported.\n", name);
+        return NULL;
+    }
+
+    return (unsigned char*) get_image_range(&session->image, offset, *size);
+}
+
+
+
+/*
+ * Returns the cache of abbreviation tables over .debug_abbrev,
+ * creating it (empty) the first time it is asked for. Returns
+ * NULL if the file has no .debug_abbrev section. The cache is
+ * owned by the session.
+ */
+abbrev_cache_t *get_session_abbrev_cache(elf_session_t *session)
+{
+    pthread_mutex_lock(&session->lock);
+
+    if(!session->abbrev_cache_parsed)
+    {
+        unsigned char *section;
+        uint64_t size;
+
+        session->abbrev_cache_parsed = true;
+
+        if((section = get_session_named_section(session, ".debug_abbrev", &size, NULL)) != NULL)
+        {
+            session->abbrev_cache = create_abbrev_cache(section, size);
+        }
+    }
+
+    abbrev_cache_t *abbrev_cache = session->abbrev_cache;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return abbrev_cache;
+}
+
+
+
+/*
+ * Returns the index from addresses to units of .debug_info,
+ * building it from .debug_aranges the first time it is asked
+ * for. Returns NULL if the file has no .debug_aranges section.
+ * The index is owned by the session.
+ */
+range_index_t *get_session_unit_address_index(elf_session_t *session)
+{
+    pthread_mutex_lock(&session->lock);
+
+    if(!session->unit_address_index_parsed)
+    {
+        unsigned char *section;
+        uint64_t size;
+
+        session->unit_address_index_parsed = true;
+
+        if((section = get_session_named_section(session, ".debug_aranges", &size, NULL)) != NULL)
+        {
+            session->unit_address_index = build_unit_address_index(section, size);
+        }
+    }
+
+    range_index_t *unit_address_index = session->unit_address_index;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return unit_address_index;
+}
+
+
+
+/*
+ * Fills in the description of .eh_frame or .debug_frame that
+ * the frame reader needs. Returns false if the file does not
+ * have the section.
+ */
+bool get_session_frame_section(elf_session_t *session, bool is_eh_frame, frame_section_t *section)
+{
+    const char *name = is_eh_frame ? ".eh_frame" : ".debug_frame";
+
+
+    if((section->data = get_session_named_section(session, name, &section->size, &section->address)) == NULL)
+    {
+        return false;
+    }
+
+    section->is_eh_frame = is_eh_frame;
+    section->address_size = (session->file_class == ELFCLASS32) ? 4 : 8;
+
+    return true;
+}
+
+
+
+/*
+ * Returns the index from addresses to the FDEs of .eh_frame or
+ * .debug_frame, building it the first time it is asked for.
+ * Returns NULL if the file does not have the section. The index
+ * is owned by the session.
+ */
+range_index_t *get_session_fde_index(elf_session_t *session, bool is_eh_frame)
+{
+    range_index_t **index = is_eh_frame ? &session->eh_frame_index : &session->debug_frame_index;
+    bool *parsed = is_eh_frame ? &session->eh_frame_index_parsed : &session->debug_frame_index_parsed;
+
+
+    pthread_mutex_lock(&session->lock);
+
+    if(!*parsed)
+    {
+        frame_section_t section;
+
+        *parsed = true;
+
+        if(get_session_frame_section(session, is_eh_frame, &section))
+        {
+            *index = build_fde_index(&section);
+        }
+    }
+
+    range_index_t *fde_index = *index;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return fde_index;
+}
+
+
+
+/*
+ * Returns the name indexes of .debug_names, reading them the
+ * first time they are asked for. Returns NULL if the file has no
+ * .debug_names section. The indexes are owned by the session.
+ */
+names_index_t *get_session_names_index(elf_session_t *session)
+{
+    pthread_mutex_lock(&session->lock);
+
+    if(!session->names_index_parsed)
+    {
+        unsigned char *section;
+        uint64_t size;
+
+        session->names_index_parsed = true;
+
+        if((section = get_session_named_section(session, ".debug_names", &size, NULL)) != NULL)
+        {
+            session->names_index = build_names_index(section, size);
+        }
+    }
+
+    names_index_t *names_index = session->names_index;
+
+    pthread_mutex_unlock(&session->lock);
+
+    return names_index;
+}
@@ -2,8 +2,8 @@
  * Date: December 14, 2023
  *
  * 
- * Implementation file for turning the ELF file data structures into strings
- * to be printed to stdout for the user.
+ * Implementation file for turning the ELF file data structures into text
+ * written to an output for the user.
  */
 
 #include <stdio.h>
@@ -13,74 +13,2040 @@
 
 
 #include "stringify.h"
+#include "format.h"
 
 
 
 
+/*
+ * Number of relocations decoded at a time before their
+ * rows are written out.
+ */
+#define RELOCATION_BATCH_SIZE       256
+
+
+
+
+
+/*
+ * Section types, with their lengths, so that the rows of the
+ * section header table can copy them without measuring them.
+ * Types past SHT_DYNSYM are shown as UNKNOWN.
+ */
+#define SECTION_TYPE(name)          { name, sizeof(name) - 1 }
+#define SECTION_TYPE_MAX_LENGTH     8
+
+static string_view_t section_types[] = {
+    [SHT_NULL] = SECTION_TYPE("NULL"),
+    [SHT_PROGBITS] = SECTION_TYPE("PROGBITS"),
+    [SHT_SYMTAB] = SECTION_TYPE("SYMTAB"),
+    [SHT_STRTAB] = SECTION_TYPE("STRTAB"),
+    [SHT_RELA] = SECTION_TYPE("RELA"),
+    [SHT_HASH] = SECTION_TYPE("HASH"),
+    [SHT_DYNAMIC] = SECTION_TYPE("DYNAMIC"),
+    [SHT_NOTE] = SECTION_TYPE("NOTE"),
+    [SHT_NOBITS] = SECTION_TYPE("NOBITS"),
+    [SHT_REL] = SECTION_TYPE("REL"),
+    [SHT_SHLIB] = SECTION_TYPE("SHLIB"),
+    [SHT_DYNSYM] = SECTION_TYPE("DYNSYM"),
+    [SHT_DYNSYM + 1] = SECTION_TYPE("UNKNOWN")
+};
+
+
+
+/*
+ * Segment types
+ */
+static char *segment_types[] = {
+    [PT_NULL] = "NULL",
+    [PT_LOAD] = "LOAD",
+    [PT_DYNAMIC] = "DYNAMIC",
+    [PT_INTERP] = "INTERP",
+    [PT_NOTE] = "NOTE",
+    [PT_SHLIB] = "SHLIB",
+    [PT_PHDR] = "PHDR"
+};
+
+
+
+/*
+ * Symbol types, bindings and visibilities
+ */
+static char *symbol_types[] = {
+    [STT_NOTYPE] = "NOTYPE",
+    [STT_OBJECT] = "OBJECT",
+    [STT_FUNC] = "FUNC",
+    [STT_SECTION] = "SECTION",
+    [STT_FILE] = "FILE",
+    [STT_COMMON] = "COMMON",
+    [STT_TLS] = "TLS",
+    [STT_GNU_IFUNC] = "IFUNC"
+};
+
+
+static char *symbol_bindings[] = {
+    [STB_LOCAL] = "LOCAL",
+    [STB_GLOBAL] = "GLOBAL",
+    [STB_WEAK] = "WEAK",
+    [STB_GNU_UNIQUE] = "UNIQUE"
+};
+
+
+static char *symbol_visibilities[] = {
+    [STV_DEFAULT] = "DEFAULT",
+    [STV_INTERNAL] = "INTERNAL",
+    [STV_HIDDEN] = "HIDDEN",
+    [STV_PROTECTED] = "PROTECTED"
+};
+
+
+
+/*
+ * Relocation types. These depend on the machine
+ * architecture, so there is one table per machine.
+ */
+static char *x86_64_relocation_types[] = {
+    [0] = "R_X86_64_NONE",
+    [1] = "R_X86_64_64",
+    [2] = "R_X86_64_PC32",
+    [3] = "R_X86_64_GOT32",
+    [4] = "R_X86_64_PLT32",
+    [5] = "R_X86_64_COPY",
+    [6] = "R_X86_64_GLOB_DAT",
+    [7] = "R_X86_64_JUMP_SLOT",
+    [8] = "R_X86_64_RELATIVE",
+    [9] = "R_X86_64_GOTPCREL",
+    [10] = "R_X86_64_32",
+    [11] = "R_X86_64_32S",
+    [12] = "R_X86_64_16",
+    [13] = "R_X86_64_PC16",
+    [14] = "R_X86_64_8",
+    [15] = "R_X86_64_PC8",
+    [16] = "R_X86_64_DTPMOD64",
+    [17] = "R_X86_64_DTPOFF64",
+    [18] = "R_X86_64_TPOFF64",
+    [19] = "R_X86_64_TLSGD",
+    [20] = "R_X86_64_TLSLD",
+    [21] = "R_X86_64_DTPOFF32",
+    [22] = "R_X86_64_GOTTPOFF",
+    [23] = "R_X86_64_TPOFF32",
+    [24] = "R_X86_64_PC64",
+    [25] = "R_X86_64_GOTOFF64",
+    [26] = "R_X86_64_GOTPC32",
+    [27] = "R_X86_64_GOT64",
+    [28] = "R_X86_64_GOTPCREL64",
+    [29] = "R_X86_64_GOTPC64",
+    [30] = "R_X86_64_GOTPLT64",
+    [31] = "R_X86_64_PLTOFF64",
+    [32] = "R_X86_64_SIZE32",
+    [33] = "R_X86_64_SIZE64",
+    [34] = "R_X86_64_GOTPC32_TLSDESC",
+    [35] = "R_X86_64_TLSDESC_CALL",
+    [36] = "R_X86_64_TLSDESC",
+    [37] = "R_X86_64_IRELATIVE",
+    [38] = "R_X86_64_RELATIVE64",
+    [41] = "R_X86_64_GOTPCRELX",
+    [42] = "R_X86_64_REX_GOTPCRELX"
+};
+
+
+static char *i386_relocation_types[] = {
+    [0] = "R_386_NONE",
+    [1] = "R_386_32",
+    [2] = "R_386_PC32",
+    [3] = "R_386_GOT32",
+    [4] = "R_386_PLT32",
+    [5] = "R_386_COPY",
+    [6] = "R_386_GLOB_DAT",
+    [7] = "R_386_JUMP_SLOT",
+    [8] = "R_386_RELATIVE",
+    [9] = "R_386_GOTOFF",
+    [10] = "R_386_GOTPC",
+    [11] = "R_386_32PLT",
+    [14] = "R_386_TLS_TPOFF",
+    [15] = "R_386_TLS_IE",
+    [16] = "R_386_TLS_GOTIE",
+    [17] = "R_386_TLS_LE",
+    [18] = "R_386_TLS_GD",
+    [19] = "R_386_TLS_LDM",
+    [20] = "R_386_16",
+    [21] = "R_386_PC16",
+    [22] = "R_386_8",
+    [23] = "R_386_PC8",
+    [24] = "R_386_TLS_GD_32",
+    [25] = "R_386_TLS_GD_PUSH",
+    [26] = "R_386_TLS_GD_CALL",
+    [27] = "R_386_TLS_GD_POP",
+    [28] = "R_386_TLS_LDM_32",
+    [29] = "R_386_TLS_LDM_PUSH",
+    [30] = "R_386_TLS_LDM_CALL",
+    [31] = "R_386_TLS_LDM_POP",
+    [32] = "R_386_TLS_LDO_32",
+    [33] = "R_386_TLS_IE_32",
+    [34] = "R_386_TLS_LE_32",
+    [35] = "R_386_TLS_DTPMOD32",
+    [36] = "R_386_TLS_DTPOFF32",
+    [37] = "R_386_TLS_TPOFF32",
+    [38] = "R_386_SIZE32",
+    [39] = "R_386_TLS_GOTDESC",
+    [40] = "R_386_TLS_DESC_CALL",
+    [41] = "R_386_TLS_DESC",
+    [42] = "R_386_IRELATIVE",
+    [43] = "R_386_GOT32X"
+};
+
+
+
+/*
+ * Names of the DWARF tags, attributes and forms. The standard
+ * values are small enough to index tables by; the vendor ones
+ * are spread far apart above them, so they are searched for.
+ */
+typedef struct
+{
+    uint32_t value;
+    char *name;
+
+} dwarf_name_t;
+
+
+static char *dwarf_unit_types[] = {
+    [DW_UT_compile] = "DW_UT_compile",
+    [DW_UT_type] = "DW_UT_type",
+    [DW_UT_partial] = "DW_UT_partial",
+    [DW_UT_skeleton] = "DW_UT_skeleton",
+    [DW_UT_split_compile] = "DW_UT_split_compile",
+    [DW_UT_split_type] = "DW_UT_split_type"
+};
+
+
+static char *dwarf_tags[] = {
+    [DW_TAG_array_type] = "DW_TAG_array_type",
+    [DW_TAG_class_type] = "DW_TAG_class_type",
+    [DW_TAG_entry_point] = "DW_TAG_entry_point",
+    [DW_TAG_enumeration_type] = "DW_TAG_enumeration_type",
+    [DW_TAG_formal_parameter] = "DW_TAG_formal_parameter",
+    [DW_TAG_imported_declaration] = "DW_TAG_imported_declaration",
+    [DW_TAG_label] = "DW_TAG_label",
+    [DW_TAG_lexical_block] = "DW_TAG_lexical_block",
+    [DW_TAG_member] = "DW_TAG_member",
+    [DW_TAG_pointer_type] = "DW_TAG_pointer_type",
+    [DW_TAG_reference_type] = "DW_TAG_reference_type",
+    [DW_TAG_compile_unit] = "DW_TAG_compile_unit",
+    [DW_TAG_string_type] = "DW_TAG_string_type",
+    [DW_TAG_structure_type] = "DW_TAG_structure_type",
+    [DW_TAG_subroutine_type] = "DW_TAG_subroutine_type",
+    [DW_TAG_typedef] = "DW_TAG_typedef",
+    [DW_TAG_union_type] = "DW_TAG_union_type",
+    [DW_TAG_unspecified_parameters] = "DW_TAG_unspecified_parameters",
+    [DW_TAG_variant] = "DW_TAG_variant",
+    [DW_TAG_common_block] = "DW_TAG_common_block",
+    [DW_TAG_common_inclusion] = "DW_TAG_common_inclusion",
+    [DW_TAG_inheritance] = "DW_TAG_inheritance",
+    [DW_TAG_inlined_subroutine] = "DW_TAG_inlined_subroutine",
+    [DW_TAG_module] = "DW_TAG_module",
+    [DW_TAG_ptr_to_member_type] = "DW_TAG_ptr_to_member_type",
+    [DW_TAG_set_type] = "DW_TAG_set_type",
+    [DW_TAG_subrange_type] = "DW_TAG_subrange_type",
+    [DW_TAG_with_stmt] = "DW_TAG_with_stmt",
+    [DW_TAG_access_declaration] = "DW_TAG_access_declaration",
+    [DW_TAG_base_type] = "DW_TAG_base_type",
+    [DW_TAG_catch_block] = "DW_TAG_catch_block",
+    [DW_TAG_const_type] = "DW_TAG_const_type",
+    [DW_TAG_constant] = "DW_TAG_constant",
+    [DW_TAG_enumerator] = "DW_TAG_enumerator",
+    [DW_TAG_file_type] = "DW_TAG_file_type",
+    [DW_TAG_friend] = "DW_TAG_friend",
+    [DW_TAG_namelist] = "DW_TAG_namelist",
+    [DW_TAG_namelist_item] = "DW_TAG_namelist_item",
+    [DW_TAG_packed_type] = "DW_TAG_packed_type",
+    [DW_TAG_subprogram] = "DW_TAG_subprogram",
+    [DW_TAG_template_type_param] = "DW_TAG_template_type_param",
+    [DW_TAG_template_value_param] = "DW_TAG_template_value_param",
+    [DW_TAG_thrown_type] = "DW_TAG_thrown_type",
+    [DW_TAG_try_block] = "DW_TAG_try_block",
+    [DW_TAG_variant_part] = "DW_TAG_variant_part",
+    [DW_TAG_variable] = "DW_TAG_variable",
+    [DW_TAG_volatile_type] = "DW_TAG_volatile_type",
+    [DW_TAG_dwarf_procedure] = "DW_TAG_dwarf_procedure",
+    [DW_TAG_restrict_type] = "DW_TAG_restrict_type",
+    [DW_TAG_interface_type] = "DW_TAG_interface_type",
+    [DW_TAG_namespace] = "DW_TAG_namespace",
+    [DW_TAG_imported_module] = "DW_TAG_imported_module",
+    [DW_TAG_unspecified_type] = "DW_TAG_unspecified_type",
+    [DW_TAG_partial_unit] = "DW_TAG_partial_unit",
+    [DW_TAG_imported_unit] = "DW_TAG_imported_unit",
+    [DW_TAG_condition] = "DW_TAG_condition",
+    [DW_TAG_shared_type] = "DW_TAG_shared_type",
+    [DW_TAG_type_unit] = "DW_TAG_type_unit",
+    [DW_TAG_rvalue_reference_type] = "DW_TAG_rvalue_reference_type",
+    [DW_TAG_template_alias] = "DW_TAG_template_alias",
+    [DW_TAG_coarray_type] = "DW_TAG_coarray_type",
+    [DW_TAG_generic_subrange] = "DW_TAG_generic_subrange",
+    [DW_TAG_dynamic_type] = "DW_TAG_dynamic_type",
+    [DW_TAG_atomic_type] = "DW_TAG_atomic_type",
+    [DW_TAG_call_site] = "DW_TAG_call_site",
+    [DW_TAG_call_site_parameter] = "DW_TAG_call_site_parameter",
+    [DW_TAG_skeleton_unit] = "DW_TAG_skeleton_unit",
+    [DW_TAG_immutable_type] = "DW_TAG_immutable_type"
+};
+
+
+static dwarf_name_t vendor_dwarf_tags[] = {
+    {DW_TAG_format_label, "DW_TAG_format_label"},
+    {DW_TAG_function_template, "DW_TAG_function_template"},
+    {DW_TAG_class_template, "DW_TAG_class_template"},
+    {DW_TAG_GNU_BINCL, "DW_TAG_GNU_BINCL"},
+    {DW_TAG_GNU_EINCL, "DW_TAG_GNU_EINCL"},
+    {DW_TAG_GNU_template_template_param, "DW_TAG_GNU_template_template_param"},
+    {DW_TAG_GNU_template_parameter_pack, "DW_TAG_GNU_template_parameter_pack"},
+    {DW_TAG_GNU_formal_parameter_pack, "DW_TAG_GNU_formal_parameter_pack"},
+    {DW_TAG_GNU_call_site, "DW_TAG_GNU_call_site"},
+    {DW_TAG_GNU_call_site_parameter, "DW_TAG_GNU_call_site_parameter"}
+};
+
+
+
+static char *dwarf_attributes[] = {
+    [DW_AT_sibling] = "DW_AT_sibling",
+    [DW_AT_location] = "DW_AT_location",
+    [DW_AT_name] = "DW_AT_name",
+    [DW_AT_ordering] = "DW_AT_ordering",
+    [DW_AT_byte_size] = "DW_AT_byte_size",
+    [DW_AT_bit_offset] = "DW_AT_bit_offset",
+    [DW_AT_bit_size] = "DW_AT_bit_size",
+    [DW_AT_stmt_list] = "DW_AT_stmt_list",
+    [DW_AT_low_pc] = "DW_AT_low_pc",
+    [DW_AT_high_pc] = "DW_AT_high_pc",
+    [DW_AT_language] = "DW_AT_language",
+    [DW_AT_discr] = "DW_AT_discr",
+    [DW_AT_discr_value] = "DW_AT_discr_value",
+    [DW_AT_visibility] = "DW_AT_visibility",
+    [DW_AT_import] = "DW_AT_import",
+    [DW_AT_string_length] = "DW_AT_string_length",
+    [DW_AT_common_reference] = "DW_AT_common_reference",
+    [DW_AT_comp_dir] = "DW_AT_comp_dir",
+    [DW_AT_const_value] = "DW_AT_const_value",
+    [DW_AT_containing_type] = "DW_AT_containing_type",
+    [DW_AT_default_value] = "DW_AT_default_value",
+    [DW_AT_inline] = "DW_AT_inline",
+    [DW_AT_is_optional] = "DW_AT_is_optional",
+    [DW_AT_lower_bound] = "DW_AT_lower_bound",
+    [DW_AT_producer] = "DW_AT_producer",
+    [DW_AT_prototyped] = "DW_AT_prototyped",
+    [DW_AT_return_addr] = "DW_AT_return_addr",
+    [DW_AT_start_scope] = "DW_AT_start_scope",
+    [DW_AT_bit_stride] = "DW_AT_bit_stride",
+    [DW_AT_upper_bound] = "DW_AT_upper_bound",
+    [DW_AT_abstract_origin] = "DW_AT_abstract_origin",
+    [DW_AT_accessibility] = "DW_AT_accessibility",
+    [DW_AT_address_class] = "DW_AT_address_class",
+    [DW_AT_artificial] = "DW_AT_artificial",
+    [DW_AT_base_types] = "DW_AT_base_types",
+    [DW_AT_calling_convention] = "DW_AT_calling_convention",
+    [DW_AT_count] = "DW_AT_count",
+    [DW_AT_data_member_location] = "DW_AT_data_member_location",
+    [DW_AT_decl_column] = "DW_AT_decl_column",
+    [DW_AT_decl_file] = "DW_AT_decl_file",
+    [DW_AT_decl_line] = "DW_AT_decl_line",
+    [DW_AT_declaration] = "DW_AT_declaration",
+    [DW_AT_discr_list] = "DW_AT_discr_list",
+    [DW_AT_encoding] = "DW_AT_encoding",
+    [DW_AT_external] = "DW_AT_external",
+    [DW_AT_frame_base] = "DW_AT_frame_base",
+    [DW_AT_friend] = "DW_AT_friend",
+    [DW_AT_identifier_case] = "DW_AT_identifier_case",
+    [DW_AT_macro_info] = "DW_AT_macro_info",
+    [DW_AT_namelist_item] = "DW_AT_namelist_item",
+    [DW_AT_priority] = "DW_AT_priority",
+    [DW_AT_segment] = "DW_AT_segment",
+    [DW_AT_specification] = "DW_AT_specification",
+    [DW_AT_static_link] = "DW_AT_static_link",
+    [DW_AT_type] = "DW_AT_type",
+    [DW_AT_use_location] = "DW_AT_use_location",
+    [DW_AT_variable_parameter] = "DW_AT_variable_parameter",
+    [DW_AT_virtuality] = "DW_AT_virtuality",
+    [DW_AT_vtable_elem_location] = "DW_AT_vtable_elem_location",
+    [DW_AT_allocated] = "DW_AT_allocated",
+    [DW_AT_associated] = "DW_AT_associated",
+    [DW_AT_data_location] = "DW_AT_data_location",
+    [DW_AT_byte_stride] = "DW_AT_byte_stride",
+    [DW_AT_entry_pc] = "DW_AT_entry_pc",
+    [DW_AT_use_UTF8] = "DW_AT_use_UTF8",
+    [DW_AT_extension] = "DW_AT_extension",
+    [DW_AT_ranges] = "DW_AT_ranges",
+    [DW_AT_trampoline] = "DW_AT_trampoline",
+    [DW_AT_call_column] = "DW_AT_call_column",
+    [DW_AT_call_file] = "DW_AT_call_file",
+    [DW_AT_call_line] = "DW_AT_call_line",
+    [DW_AT_description] = "DW_AT_description",
+    [DW_AT_binary_scale] = "DW_AT_binary_scale",
+    [DW_AT_decimal_scale] = "DW_AT_decimal_scale",
+    [DW_AT_small] = "DW_AT_small",
+    [DW_AT_decimal_sign] = "DW_AT_decimal_sign",
+    [DW_AT_digit_count] = "DW_AT_digit_count",
+    [DW_AT_picture_string] = "DW_AT_picture_string",
+    [DW_AT_mutable] = "DW_AT_mutable",
+    [DW_AT_threads_scaled] = "DW_AT_threads_scaled",
+    [DW_AT_explicit] = "DW_AT_explicit",
+    [DW_AT_object_pointer] = "DW_AT_object_pointer",
+    [DW_AT_endianity] = "DW_AT_endianity",
+    [DW_AT_elemental] = "DW_AT_elemental",
+    [DW_AT_pure] = "DW_AT_pure",
+    [DW_AT_recursive] = "DW_AT_recursive",
+    [DW_AT_signature] = "DW_AT_signature",
+    [DW_AT_main_subprogram] = "DW_AT_main_subprogram",
+    [DW_AT_data_bit_offset] = "DW_AT_data_bit_offset",
+    [DW_AT_const_expr] = "DW_AT_const_expr",
+    [DW_AT_enum_class] = "DW_AT_enum_class",
+    [DW_AT_linkage_name] = "DW_AT_linkage_name",
+    [DW_AT_string_length_bit_size] = "DW_AT_string_length_bit_size",
+    [DW_AT_string_length_byte_size] = "DW_AT_string_length_byte_size",
+    [DW_AT_rank] = "DW_AT_rank",
+    [DW_AT_str_offsets_base] = "DW_AT_str_offsets_base",
+    [DW_AT_addr_base] = "DW_AT_addr_base",
+    [DW_AT_rnglists_base] = "DW_AT_rnglists_base",
+    [DW_AT_dwo_name] = "DW_AT_dwo_name",
+    [DW_AT_reference] = "DW_AT_reference",
+    [DW_AT_rvalue_reference] = "DW_AT_rvalue_reference",
+    [DW_AT_macros] = "DW_AT_macros",
+    [DW_AT_call_all_calls] = "DW_AT_call_all_calls",
+    [DW_AT_call_all_source_calls] = "DW_AT_call_all_source_calls",
+    [DW_AT_call_all_tail_calls] = "DW_AT_call_all_tail_calls",
+    [DW_AT_call_return_pc] = "DW_AT_call_return_pc",
+    [DW_AT_call_value] = "DW_AT_call_value",
+    [DW_AT_call_origin] = "DW_AT_call_origin",
+    [DW_AT_call_parameter] = "DW_AT_call_parameter",
+    [DW_AT_call_pc] = "DW_AT_call_pc",
+    [DW_AT_call_tail_call] = "DW_AT_call_tail_call",
+    [DW_AT_call_target] = "DW_AT_call_target",
+    [DW_AT_call_target_clobbered] = "DW_AT_call_target_clobbered",
+    [DW_AT_call_data_location] = "DW_AT_call_data_location",
+    [DW_AT_call_data_value] = "DW_AT_call_data_value",
+    [DW_AT_noreturn] = "DW_AT_noreturn",
+    [DW_AT_alignment] = "DW_AT_alignment",
+    [DW_AT_export_symbols] = "DW_AT_export_symbols",
+    [DW_AT_deleted] = "DW_AT_deleted",
+    [DW_AT_defaulted] = "DW_AT_defaulted",
+    [DW_AT_loclists_base] = "DW_AT_loclists_base"
+};
+
+
+static dwarf_name_t vendor_dwarf_attributes[] = {
+    {DW_AT_MIPS_linkage_name, "DW_AT_MIPS_linkage_name"},
+    {DW_AT_sf_names, "DW_AT_sf_names"},
+    {DW_AT_src_info, "DW_AT_src_info"},
+    {DW_AT_mac_info, "DW_AT_mac_info"},
+    {DW_AT_src_coords, "DW_AT_src_coords"},
+    {DW_AT_body_begin, "DW_AT_body_begin"},
+    {DW_AT_body_end, "DW_AT_body_end"},
+    {DW_AT_GNU_vector, "DW_AT_GNU_vector"},
+    {DW_AT_GNU_guarded_by, "DW_AT_GNU_guarded_by"},
+    {DW_AT_GNU_pt_guarded_by, "DW_AT_GNU_pt_guarded_by"},
+    {DW_AT_GNU_guarded, "DW_AT_GNU_guarded"},
+    {DW_AT_GNU_pt_guarded, "DW_AT_GNU_pt_guarded"},
+    {DW_AT_GNU_locks_excluded, "DW_AT_GNU_locks_excluded"},
+    {DW_AT_GNU_exclusive_locks_required, "DW_AT_GNU_exclusive_locks_required"},
+    {DW_AT_GNU_shared_locks_required, "DW_AT_GNU_shared_locks_required"},
+    {DW_AT_GNU_odr_signature, "DW_AT_GNU_odr_signature"},
+    {DW_AT_GNU_template_name, "DW_AT_GNU_template_name"},
+    {DW_AT_GNU_call_site_value, "DW_AT_GNU_call_site_value"},
+    {DW_AT_GNU_call_site_data_value, "DW_AT_GNU_call_site_data_value"},
+    {DW_AT_GNU_call_site_target, "DW_AT_GNU_call_site_target"},
+    {DW_AT_GNU_call_site_target_clobbered, "DW_AT_GNU_call_site_target_clobbered"},
+    {DW_AT_GNU_tail_call, "DW_AT_GNU_tail_call"},
+    {DW_AT_GNU_all_tail_call_sites, "DW_AT_GNU_all_tail_call_sites"},
+    {DW_AT_GNU_all_call_sites, "DW_AT_GNU_all_call_sites"},
+    {DW_AT_GNU_all_source_call_sites, "DW_AT_GNU_all_source_call_sites"},
+    {DW_AT_GNU_macros, "DW_AT_GNU_macros"},
+    {DW_AT_GNU_deleted, "DW_AT_GNU_deleted"},
+    {DW_AT_GNU_dwo_name, "DW_AT_GNU_dwo_name"},
+    {DW_AT_GNU_dwo_id, "DW_AT_GNU_dwo_id"},
+    {DW_AT_GNU_ranges_base, "DW_AT_GNU_ranges_base"},
+    {DW_AT_GNU_addr_base, "DW_AT_GNU_addr_base"},
+    {DW_AT_GNU_pubnames, "DW_AT_GNU_pubnames"},
+    {DW_AT_GNU_pubtypes, "DW_AT_GNU_pubtypes"},
+    {DW_AT_GNU_discriminator, "DW_AT_GNU_discriminator"},
+    {DW_AT_GNU_locviews, "DW_AT_GNU_locviews"},
+    {DW_AT_GNU_entry_view, "DW_AT_GNU_entry_view"}
+};
+
+
+
+static char *dwarf_forms[] = {
+    [DW_FORM_addr] = "DW_FORM_addr",
+    [DW_FORM_block2] = "DW_FORM_block2",
+    [DW_FORM_block4] = "DW_FORM_block4",
+    [DW_FORM_data2] = "DW_FORM_data2",
+    [DW_FORM_data4] = "DW_FORM_data4",
+    [DW_FORM_data8] = "DW_FORM_data8",
+    [DW_FORM_string] = "DW_FORM_string",
+    [DW_FORM_block] = "DW_FORM_block",
+    [DW_FORM_block1] = "DW_FORM_block1",
+    [DW_FORM_data1] = "DW_FORM_data1",
+    [DW_FORM_flag] = "DW_FORM_flag",
+    [DW_FORM_sdata] = "DW_FORM_sdata",
+    [DW_FORM_strp] = "DW_FORM_strp",
+    [DW_FORM_udata] = "DW_FORM_udata",
+    [DW_FORM_ref_addr] = "DW_FORM_ref_addr",
+    [DW_FORM_ref1] = "DW_FORM_ref1",
+    [DW_FORM_ref2] = "DW_FORM_ref2",
+    [DW_FORM_ref4] = "DW_FORM_ref4",
+    [DW_FORM_ref8] = "DW_FORM_ref8",
+    [DW_FORM_ref_udata] = "DW_FORM_ref_udata",
+    [DW_FORM_indirect] = "DW_FORM_indirect",
+    [DW_FORM_sec_offset] = "DW_FORM_sec_offset",
+    [DW_FORM_exprloc] = "DW_FORM_exprloc",
+    [DW_FORM_flag_present] = "DW_FORM_flag_present",
+    [DW_FORM_strx] = "DW_FORM_strx",
+    [DW_FORM_addrx] = "DW_FORM_addrx",
+    [DW_FORM_ref_sup4] = "DW_FORM_ref_sup4",
+    [DW_FORM_strp_sup] = "DW_FORM_strp_sup",
+    [DW_FORM_data16] = "DW_FORM_data16",
+    [DW_FORM_line_strp] = "DW_FORM_line_strp",
+    [DW_FORM_ref_sig8] = "DW_FORM_ref_sig8",
+    [DW_FORM_implicit_const] = "DW_FORM_implicit_const",
+    [DW_FORM_loclistx] = "DW_FORM_loclistx",
+    [DW_FORM_rnglistx] = "DW_FORM_rnglistx",
+    [DW_FORM_ref_sup8] = "DW_FORM_ref_sup8",
+    [DW_FORM_strx1] = "DW_FORM_strx1",
+    [DW_FORM_strx2] = "DW_FORM_strx2",
+    [DW_FORM_strx3] = "DW_FORM_strx3",
+    [DW_FORM_strx4] = "DW_FORM_strx4",
+    [DW_FORM_addrx1] = "DW_FORM_addrx1",
+    [DW_FORM_addrx2] = "DW_FORM_addrx2",
+    [DW_FORM_addrx3] = "DW_FORM_addrx3",
+    [DW_FORM_addrx4] = "DW_FORM_addrx4"
+};
+
+
+static dwarf_name_t vendor_dwarf_forms[] = {
+    {DW_FORM_GNU_addr_index, "DW_FORM_GNU_addr_index"},
+    {DW_FORM_GNU_str_index, "DW_FORM_GNU_str_index"},
+    {DW_FORM_GNU_ref_alt, "DW_FORM_GNU_ref_alt"},
+    {DW_FORM_GNU_strp_alt, "DW_FORM_GNU_strp_alt"}
+};
+
+
+static char *dwarf_name_index_attributes[] = {
+    [DW_IDX_compile_unit] = "DW_IDX_compile_unit",
+    [DW_IDX_type_unit] = "DW_IDX_type_unit",
+    [DW_IDX_die_offset] = "DW_IDX_die_offset",
+    [DW_IDX_parent] = "DW_IDX_parent",
+    [DW_IDX_type_hash] = "DW_IDX_type_hash"
+};
+
+
+static dwarf_name_t vendor_dwarf_name_index_attributes[] = {
+    {DW_IDX_GNU_internal, "DW_IDX_GNU_internal"},
+    {DW_IDX_GNU_external, "DW_IDX_GNU_external"}
+};
+
+
+static char *dwarf_cfa_instructions[] = {
+    [DW_CFA_nop] = "DW_CFA_nop",
+    [DW_CFA_set_loc] = "DW_CFA_set_loc",
+    [DW_CFA_advance_loc1] = "DW_CFA_advance_loc1",
+    [DW_CFA_advance_loc2] = "DW_CFA_advance_loc2",
+    [DW_CFA_advance_loc4] = "DW_CFA_advance_loc4",
+    [DW_CFA_offset_extended] = "DW_CFA_offset_extended",
+    [DW_CFA_restore_extended] = "DW_CFA_restore_extended",
+    [DW_CFA_undefined] = "DW_CFA_undefined",
+    [DW_CFA_same_value] = "DW_CFA_same_value",
+    [DW_CFA_register] = "DW_CFA_register",
+    [DW_CFA_remember_state] = "DW_CFA_remember_state",
+    [DW_CFA_restore_state] = "DW_CFA_restore_state",
+    [DW_CFA_def_cfa] = "DW_CFA_def_cfa",
+    [DW_CFA_def_cfa_register] = "DW_CFA_def_cfa_register",
+    [DW_CFA_def_cfa_offset] = "DW_CFA_def_cfa_offset",
+    [DW_CFA_def_cfa_expression] = "DW_CFA_def_cfa_expression",
+    [DW_CFA_expression] = "DW_CFA_expression",
+    [DW_CFA_offset_extended_sf] = "DW_CFA_offset_extended_sf",
+    [DW_CFA_def_cfa_sf] = "DW_CFA_def_cfa_sf",
+    [DW_CFA_def_cfa_offset_sf] = "DW_CFA_def_cfa_offset_sf",
+    [DW_CFA_val_offset] = "DW_CFA_val_offset",
+    [DW_CFA_val_offset_sf] = "DW_CFA_val_offset_sf",
+    [DW_CFA_val_expression] = "DW_CFA_val_expression",
+    [DW_CFA_advance_loc] = "DW_CFA_advance_loc",
+    [DW_CFA_offset] = "DW_CFA_offset",
+    [DW_CFA_restore] = "DW_CFA_restore"
+};
+
+
+static dwarf_name_t vendor_dwarf_cfa_instructions[] = {
+    {DW_CFA_GNU_window_save, "DW_CFA_GNU_window_save"},
+    {DW_CFA_GNU_args_size, "DW_CFA_GNU_args_size"},
+    {DW_CFA_GNU_negative_offset_extended, "DW_CFA_GNU_negative_offset_extended"}
+};
+
+
+/*
+ * The operations numbered in a range (DW_OP_lit0 ... DW_OP_lit31,
+ * DW_OP_reg0 ... and DW_OP_breg0 ...) are named from the number.
+ */
+static char *dwarf_operations[] = {
+    [DW_OP_addr] = "DW_OP_addr",
+    [DW_OP_deref] = "DW_OP_deref",
+    [DW_OP_const1u] = "DW_OP_const1u",
+    [DW_OP_const1s] = "DW_OP_const1s",
+    [DW_OP_const2u] = "DW_OP_const2u",
+    [DW_OP_const2s] = "DW_OP_const2s",
+    [DW_OP_const4u] = "DW_OP_const4u",
+    [DW_OP_const4s] = "DW_OP_const4s",
+    [DW_OP_const8u] = "DW_OP_const8u",
+    [DW_OP_const8s] = "DW_OP_const8s",
+    [DW_OP_constu] = "DW_OP_constu",
+    [DW_OP_consts] = "DW_OP_consts",
+    [DW_OP_dup] = "DW_OP_dup",
+    [DW_OP_drop] = "DW_OP_drop",
+    [DW_OP_over] = "DW_OP_over",
+    [DW_OP_pick] = "DW_OP_pick",
+    [DW_OP_swap] = "DW_OP_swap",
+    [DW_OP_rot] = "DW_OP_rot",
+    [DW_OP_xderef] = "DW_OP_xderef",
+    [DW_OP_abs] = "DW_OP_abs",
+    [DW_OP_and] = "DW_OP_and",
+    [DW_OP_div] = "DW_OP_div",
+    [DW_OP_minus] = "DW_OP_minus",
+    [DW_OP_mod] = "DW_OP_mod",
+    [DW_OP_mul] = "DW_OP_mul",
+    [DW_OP_neg] = "DW_OP_neg",
+    [DW_OP_not] = "DW_OP_not",
+    [DW_OP_or] = "DW_OP_or",
+    [DW_OP_plus] = "DW_OP_plus",
+    [DW_OP_plus_uconst] = "DW_OP_plus_uconst",
+    [DW_OP_shl] = "DW_OP_shl",
+    [DW_OP_shr] = "DW_OP_shr",
+    [DW_OP_shra] = "DW_OP_shra",
+    [DW_OP_xor] = "DW_OP_xor",
+    [DW_OP_bra] = "DW_OP_bra",
+    [DW_OP_eq] = "DW_OP_eq",
+    [DW_OP_ge] = "DW_OP_ge",
+    [DW_OP_gt] = "DW_OP_gt",
+    [DW_OP_le] = "DW_OP_le",
+    [DW_OP_lt] = "DW_OP_lt",
+    [DW_OP_ne] = "DW_OP_ne",
+    [DW_OP_skip] = "DW_OP_skip",
+    [DW_OP_regx] = "DW_OP_regx",
+    [DW_OP_fbreg] = "DW_OP_fbreg",
+    [DW_OP_bregx] = "DW_OP_bregx",
+    [DW_OP_piece] = "DW_OP_piece",
+    [DW_OP_deref_size] = "DW_OP_deref_size",
+    [DW_OP_xderef_size] = "DW_OP_xderef_size",
+    [DW_OP_nop] = "DW_OP_nop",
+    [DW_OP_push_object_address] = "DW_OP_push_object_address",
+    [DW_OP_call2] = "DW_OP_call2",
+    [DW_OP_call4] = "DW_OP_call4",
+    [DW_OP_call_ref] = "DW_OP_call_ref",
+    [DW_OP_form_tls_address] = "DW_OP_form_tls_address",
+    [DW_OP_call_frame_cfa] = "DW_OP_call_frame_cfa",
+    [DW_OP_bit_piece] = "DW_OP_bit_piece",
+    [DW_OP_implicit_value] = "DW_OP_implicit_value",
+    [DW_OP_stack_value] = "DW_OP_stack_value",
+    [DW_OP_implicit_pointer] = "DW_OP_implicit_pointer",
+    [DW_OP_addrx] = "DW_OP_addrx",
+    [DW_OP_constx] = "DW_OP_constx",
+    [DW_OP_entry_value] = "DW_OP_entry_value",
+    [DW_OP_const_type] = "DW_OP_const_type",
+    [DW_OP_regval_type] = "DW_OP_regval_type",
+    [DW_OP_deref_type] = "DW_OP_deref_type",
+    [DW_OP_xderef_type] = "DW_OP_xderef_type",
+    [DW_OP_convert] = "DW_OP_convert",
+    [DW_OP_reinterpret] = "DW_OP_reinterpret"
+};
+
+
+static dwarf_name_t vendor_dwarf_operations[] = {
+    {DW_OP_GNU_push_tls_address, "DW_OP_GNU_push_tls_address"},
+    {DW_OP_GNU_uninit, "DW_OP_GNU_uninit"}
+};
+
+
+
+/*
+ * Names of the DWARF register numbers of the machines whose
+ * relocations are named above.
+ */
+static char *x86_64_registers[] = {
+    "rax", "rdx", "rcx", "rbx", "rsi", "rdi", "rbp", "rsp",
+    "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "rip",
+    "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7",
+    "xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13", "xmm14", "xmm15",
+    "st0", "st1", "st2", "st3", "st4", "st5", "st6", "st7",
+    "mm0", "mm1", "mm2", "mm3", "mm4", "mm5", "mm6", "mm7",
+    "rflags", "es", "cs", "ss", "ds", "fs", "gs", NULL, NULL,
+    "fs.base", "gs.base", NULL, NULL, "tr", "ldtr", "mxcsr", "fcw", "fsw"
+};
+
+
+static char *i386_registers[] = {
+    "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi", "eip", "eflags", NULL,
+    "st0", "st1", "st2", "st3", "st4", "st5", "st6", "st7", NULL, NULL,
+    "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7",
+    "mm0", "mm1", "mm2", "mm3", "mm4", "mm5", "mm6", "mm7",
+    "fcw", "fsw", "mxcsr", "es", "cs", "ss", "ds", "fs", "gs", NULL, NULL, "tr", "ldtr"
+};
+
+
+
+
+
+/*
+ * The tables above have gaps, so anything without
+ * a name (including the gaps) prints as UNKNOWN.
+ */
+static char *get_symbol_type_name(unsigned char info)
+{
+    unsigned char type = ELF_ST_TYPE(info);
+
+    if(type <= STT_GNU_IFUNC && symbol_types[type] != NULL)
+        return symbol_types[type];
+
+    return "UNKNOWN";
+}
+
+
+static char *get_symbol_binding_name(unsigned char info)
+{
+    unsigned char binding = ELF_ST_BIND(info);
+
+    if(binding <= STB_GNU_UNIQUE && symbol_bindings[binding] != NULL)
+        return symbol_bindings[binding];
+
+    return "UNKNOWN";
+}
+
+
+
+/*
+ * Gets the name of a relocation type of the given machine, or
+ * NULL if the type (or the machine) is not one with a name.
+ */
+static char *get_relocation_type_name(int machine, uint32_t type)
+{
+    switch(machine)
+    {
+        case EM_X86_64:
+            if(type < sizeof(x86_64_relocation_types)/sizeof(char*))
+                return x86_64_relocation_types[type];
+            return NULL;
+
+        case EM_386:
+            if(type < sizeof(i386_relocation_types)/sizeof(char*))
+                return i386_relocation_types[type];
+            return NULL;
+
+        default:
+            return NULL;
+    }
+}
+
+
+
+/*
+ * Gets the name of a DWARF register number of the given
+ * machine, or NULL if the register has no name.
+ */
+static char *get_register_name(int machine, uint64_t number)
+{
+    switch(machine)
+    {
+        case EM_X86_64:
+            if(number < sizeof(x86_64_registers)/sizeof(char*))
+                return x86_64_registers[number];
+            return NULL;
+
+        case EM_386:
+            if(number < sizeof(i386_registers)/sizeof(char*))
+                return i386_registers[number];
+            return NULL;
+
+        default:
+            return NULL;
+    }
+}
+
+
+
+/*
+ * Gets the name of a DWARF tag, attribute, form, call frame
+ * instruction or operation from the tables above, or NULL if
+ * the value has no name.
+ */
+static char *find_dwarf_name(char **names, size_t num_names, dwarf_name_t *vendor_names, size_t num_vendor_names, uint32_t value)
+{
+    if(value < num_names && names[value] != NULL)
+        return names[value];
+
+    for(size_t i = 0; i < num_vendor_names; i++)
+    {
+        if(vendor_names[i].value == value)
+            return vendor_names[i].name;
+    }
+
+    return NULL;
+}
+
+
+#define FIND_DWARF_NAME(kind, value)    find_dwarf_name(dwarf_##kind, sizeof(dwarf_##kind)/sizeof(char*), \
+                                                        vendor_dwarf_##kind, sizeof(vendor_dwarf_##kind)/sizeof(dwarf_name_t), value)
+
+
+
+/*
+ * Appends the name of a DWARF tag, attribute or form. Values
+ * without a name are written the way readelf writes them.
+ */
+static void stringify_dwarf_tag(output_t *output, uint32_t tag)
+{
+    char *name = FIND_DWARF_NAME(tags, tag);
+
+    if(name != NULL)
+        append_string(output, name);
+    else
+        append_format(output, "Unknown TAG value: %#x", tag);
+}
+
+
+static void stringify_dwarf_attribute(output_t *output, uint32_t attribute, int min_width)
+{
+    char *name = (attribute == 0) ? "DW_AT value: 0" : FIND_DWARF_NAME(attributes, attribute);
+
+    // an unknown name is always longer than the width
+    if(name == NULL)
+    {
+        append_format(output, "Unknown AT value: %x", attribute);
+        return;
+    }
+
+    append_string(output, name);
+    append_padding(output, min_width - (int) strlen(name));
+}
+
+
+static void stringify_dwarf_form(output_t *output, uint32_t form)
+{
+    char *name = (form == 0) ? "DW_FORM value: 0" : FIND_DWARF_NAME(forms, form);
+
+    if(name != NULL)
+        append_string(output, name);
+    else
+        append_format(output, "Unknown FORM value: %x", form);
+}
+
+
+
+/*
+ * Appends a relocation type, padded to a fixed width so the
+ * columns after it line up. Types without a name are written
+ * as their number.
+ */
+static void stringify_relocation_type(output_t *output, int machine, uint32_t type)
+{
+    char *name = get_relocation_type_name(machine, type);
+    size_t length;
+
+    if(name == NULL)
+    {
+        append_string(output, "unknown (");
+        append_decimal(output, type);
+        append_char(output, ')');
+        append_padding(output, 24 - 10 - (type >= 10) - (type >= 100) - (type >= 1000));
+        return;
+    }
+
+    length = strlen(name);
+    append_string(output, name);
+    append_padding(output, 24 - (int) length);
+}
+
+
+
+/*
+ * Appends the title and column headings of a relocation section.
+ */
+static void stringify_relocation_table_title(output_t *output, string_view_t section_name, uint64_t offset, uint64_t num_entries, bool has_addends)
+{
+    append_string(output, "\nRelocation section '");
+    append_bytes(output, section_name.string, section_name.length);
+    append_string(output, "' at offset 0x");
+    append_hex(output, offset, 0);
+    append_string(output, " contains ");
+    append_decimal(output, num_entries);
+    append_string(output, " entries:\n");
+
+    append_string(output, has_addends ? "Offset\t\t\tInfo\t\t\tType\t\t\tSym. Value\t\tSym. Name + Addend\n"
+                                      : "Offset\t\t\tInfo\t\t\tType\t\t\tSym. Value\t\tSym. Name\n");
+    append_string(output, "----------------------------------------------------------------------------------------------------------\n");
+}
+
+
+
+/*
+ * Appends a relocation addend the way it reads in an
+ * expression after the symbol: " + 10" or " - 4".
+ */
+static void stringify_addend(output_t *output, int64_t addend)
+{
+    if(addend < 0)
+    {
+        append_string(output, " - ");
+        append_hex(output, -(uint64_t) addend, 0);
+    }
+    else
+    {
+        append_string(output, " + ");
+        append_hex(output, addend, 0);
+    }
+}
+
+
+
+/*
+ * Appends the section index of a symbol, using the names of
+ * the reserved indices rather than their numbers.
+ */
+static void stringify_symbol_section_index(output_t *output, uint16_t section_index)
+{
+    switch(section_index)
+    {
+        case SHN_UNDEF:
+            append_string(output, "UND");
+            break;
+
+        case SHN_ABS:
+            append_string(output, "ABS");
+            break;
+
+        case SHN_COMMON:
+            append_string(output, "COM");
+            break;
+
+        default:
+            append_decimal(output, section_index);
+            break;
+    }
+}
+
+
+
+/*
+ * Appends the column headings of a table of symbols.
+ */
+static void stringify_symbol_columns(output_t *output, int value_width)
+{
+    append_string(output, (value_width == 16) ? "Number\tValue\t\t\tSize\tType\tBind\tVis\t\tNdx\tName\n"
+                                              : "Number\tValue\t\tSize\tType\tBind\tVis\t\tNdx\tName\n");
+    append_string(output, "----------------------------------------------------------------------------------------------\n");
+}
+
+
+
+/*
+ * Appends the title and column headings of a symbol table.
+ */
+static void stringify_symbol_table_title(output_t *output, string_view_t section_name, uint64_t num_symbols, int value_width)
+{
+    append_string(output, "\nSymbol table '");
+    append_bytes(output, section_name.string, section_name.length);
+    append_string(output, "' contains ");
+    append_decimal(output, num_symbols);
+    append_string(output, " entries:\n");
+
+    stringify_symbol_columns(output, value_width);
+}
+
+
+
+/*
+ * Appends the title and column headings of the results of
+ * looking symbols up by name, saying which table is searched
+ * and how.
+ */
+void stringify_symbol_lookup_title(output_t *output, symbol_index_t *index)
+{
+    static char *methods[] = {
+        [LOOKUP_GNU_HASH] = "the GNU hash table",
+        [LOOKUP_SYSV_HASH] = "the SysV hash table",
+        [LOOKUP_BUILT_HASH] = "a hash table built over it"
+    };
+
+    append_string(output, "\nSymbol lookup in '");
+    append_bytes(output, index->table_name.string, index->table_name.length);
+    append_string(output, "' using ");
+    append_string(output, methods[index->method]);
+    append_string(output, ":\n");
+
+    stringify_symbol_columns(output, (index->file_class == ELFCLASS64) ? 16 : 8);
+}
+
+
+
+/*
+ * Appends the line for a name that was looked up and not found.
+ */
+void stringify_missing_symbol(output_t *output, const char *name, size_t length)
+{
+    append_string(output, "-\t\t\t\t\t\t\t\t");
+    append_bytes(output, name, length);
+    append_string(output, " (not found)\n");
+}
+
+
+
+/*
+ * Appends one set of abbreviations of .debug_abbrev, laid out
+ * the way readelf --debug-dump=abbrev lays it out. Empty sets
+ * are not shown.
+ */
+void stringify_debug_abbrev_table(output_t *output, abbrev_table_t *table)
+{
+    if(table->num_abbrevs == 0)
+        return;
+
+    append_format(output, "  Number TAG (%#lx)\n", (unsigned long) table->offset);
+
+    for(uint64_t i = 0; i < table->num_abbrevs; i++)
+    {
+        abbrev_t *abbrev = &table->abbrevs[i];
+
+        append_string(output, "   ");
+        append_decimal(output, abbrev->code);
+        append_padding(output, 6);
+        stringify_dwarf_tag(output, abbrev->tag);
+        append_string(output, abbrev->has_children ? "    [has children]\n" : "    [no children]\n");
+
+        for(uint32_t j = 0; j < abbrev->num_attributes; j++)
+        {
+            abbrev_attribute_t *attribute = &abbrev->attributes[j];
+
+            append_padding(output, 4);
+            stringify_dwarf_attribute(output, attribute->name, 18);
+            append_char(output, ' ');
+            stringify_dwarf_form(output, attribute->form);
+
+            if(attribute->form == DW_FORM_implicit_const)
+            {
+                append_string(output, ": ");
+                append_signed_decimal(output, attribute->implicit_const);
+            }
+
+            append_char(output, '\n');
+        }
+
+        append_string(output, "    DW_AT value: 0     DW_FORM value: 0\n");
+    }
+}
+
+
+
+/*
+ * Appends an offset the way readelf writes it with "%#lx",
+ * where 0 has no 0x in front.
+ */
+static void stringify_offset(output_t *output, uint64_t offset)
+{
+    if(offset != 0)
+        append_string(output, "0x");
+
+    append_hex(output, offset, 0);
+}
+
+
+
+/*
+ * Appends the header of a unit of .debug_info, the way readelf
+ * --debug-dump=info lays it out.
+ */
+void stringify_debug_unit_header(output_t *output, unit_header_t *unit)
+{
+    append_string(output, "  Compilation Unit @ offset ");
+    stringify_offset(output, unit->offset);
+    append_string(output, ":\n   Length:        0x");
+    append_hex(output, unit->length, 0);
+    append_string(output, (unit->offset_size == 8) ? " (64-bit)\n" : " (32-bit)\n");
+    append_string(output, "   Version:       ");
+    append_decimal(output, unit->version);
+    append_char(output, '\n');
+
+    if(unit->version >= 5)
+    {
+        char *name = (unit->unit_type <= DW_UT_split_type) ? dwarf_unit_types[unit->unit_type] : NULL;
+
+        append_string(output, "   Unit Type:     ");
+        append_string(output, (name != NULL) ? name : "???");
+        append_string(output, " (");
+        append_decimal(output, unit->unit_type);
+        append_string(output, ")\n");
+    }
+
+    append_string(output, "   Abbrev Offset: ");
+    stringify_offset(output, unit->abbrev_offset);
+    append_string(output, "\n   Pointer Size:  ");
+    append_decimal(output, unit->address_size);
+    append_char(output, '\n');
+
+    if(unit->unit_type == DW_UT_type || unit->unit_type == DW_UT_split_type)
+    {
+        append_string(output, "   Signature:     0x");
+        append_hex(output, unit->type_signature, 0);
+        append_string(output, "\n   Type Offset:   0x");
+        append_hex(output, unit->type_offset, 0);
+        append_char(output, '\n');
+    }
+
+    if(unit->unit_type == DW_UT_skeleton || unit->unit_type == DW_UT_split_compile)
+    {
+        append_string(output, "   DWO ID:        0x");
+        append_hex(output, unit->dwo_id, 0);
+        append_char(output, '\n');
+    }
+}
+
+
+
+/*
+ * Appends the line that starts a DIE, or that shows a null entry.
+ */
+void stringify_debug_die(output_t *output, die_t *die)
+{
+    append_string(output, " <");
+    append_decimal(output, die->depth);
+    append_string(output, "><");
+    append_hex(output, die->offset, 0);
+    append_string(output, ">: Abbrev Number: ");
+
+    if(die->abbrev == NULL)
+    {
+        append_string(output, "0\n");
+        return;
+    }
+
+    append_decimal(output, die->abbrev->code);
+    append_string(output, " (");
+    stringify_dwarf_tag(output, die->abbrev->tag);
+    append_string(output, ")\n");
+}
+
+
+
+/*
+ * Appends the header of a set of address ranges in .debug_aranges
+ * and the headings of its ranges.
+ */
+void stringify_debug_aranges_header(output_t *output, aranges_header_t *header)
+{
+    append_string(output, "  Length:                   ");
+    append_decimal(output, header->length);
+    append_string(output, "\n  Version:                  ");
+    append_decimal(output, header->version);
+    append_string(output, "\n  Offset into .debug_info:  ");
+    stringify_offset(output, header->info_offset);
+    append_string(output, "\n  Pointer Size:             ");
+    append_decimal(output, header->address_size);
+    append_string(output, "\n  Segment Size:             ");
+    append_decimal(output, header->segment_size);
+    append_string(output, (header->address_size == 4) ? "\n\n    Address    Length\n" : "\n\n    Address            Length\n");
+}
+
+
+
+/*
+ * Appends one range of a set in .debug_aranges.
+ */
+void stringify_debug_arange(output_t *output, uint64_t address, uint64_t length, int address_size)
+{
+    append_padding(output, 4);
+    append_hex(output, address, 2*address_size);
+    append_char(output, ' ');
+    append_hex(output, length, 2*address_size);
+    append_char(output, '\n');
+}
+
+
+
+/*
+ * Appends a string out of a string section, given by its offset.
+ */
+static void stringify_indirect_string(output_t *output, const unsigned char *section, uint64_t section_size,
+                                      char *section_name, uint64_t offset)
+{
+    if(section == NULL)
+    {
+        append_string(output, "<no ");
+        append_string(output, section_name);
+        append_string(output, " section>");
+        return;
+    }
+
+    if(offset >= section_size)
+    {
+        append_string(output, "<offset is too big>");
+        return;
+    }
+
+    append_bytes(output, (const char*) section + offset, strnlen((const char*) section + offset, section_size - offset));
+}
+
+
+
+/*
+ * Appends one attribute of a DIE, found at the given offset.
+ * Values are written according to their form alone, as readelf
+ * writes them; blocks and location expressions are shown as
+ * their bytes. Indexed strings and addresses are shown as their
+ * index followed by what it resolves to, when the unit's
+ * .debug_str_offsets or .debug_addr entries can be found.
+ */
+void stringify_debug_attribute(output_t *output, uint64_t offset, attribute_value_t *value, debug_strings_t *strings)
+{
+    append_string(output, "    <");
+    append_hex(output, offset, 0);
+    append_string(output, ">   ");
+    stringify_dwarf_attribute(output, value->name, 18);
+    append_string(output, ": ");
+
+    switch(value->form)
+    {
+        case DW_FORM_addr:
+            append_string(output, "0x");
+            append_hex(output, value->value, 0);
+            break;
+
+        case DW_FORM_data1:
+        case DW_FORM_data2:
+        case DW_FORM_data4:
+        case DW_FORM_data8:
+        case DW_FORM_udata:
+        case DW_FORM_flag:
+        case DW_FORM_flag_present:
+            append_decimal(output, value->value);
+            break;
+
+        case DW_FORM_sdata:
+        case DW_FORM_implicit_const:
+            append_signed_decimal(output, (int64_t) value->value);
+            break;
+
+        case DW_FORM_ref1:
+        case DW_FORM_ref2:
+        case DW_FORM_ref4:
+        case DW_FORM_ref8:
+        case DW_FORM_ref_udata:
+        case DW_FORM_ref_addr:
+            append_string(output, "<0x");
+            append_hex(output, value->value, 0);
+            append_char(output, '>');
+            break;
+
+        case DW_FORM_ref_sup4:
+        case DW_FORM_ref_sup8:
+        case DW_FORM_GNU_ref_alt:
+            append_string(output, "<alt 0x");
+            append_hex(output, value->value, 0);
+            append_char(output, '>');
+            break;
+
+        case DW_FORM_ref_sig8:
+            append_string(output, "signature: 0x");
+            append_hex(output, value->value, 0);
+            break;
+
+        case DW_FORM_sec_offset:
+            stringify_offset(output, value->value);
+            break;
+
+        case DW_FORM_string:
+            append_bytes(output, (const char*) value->data, value->value);
+            break;
 
-static char *section_types[] = {
-    [SHT_NULL] = "NULL",
-    [SHT_PROGBITS] = "PROGBITS",
-    [SHT_SYMTAB] = "SYMTAB",
-    [SHT_STRTAB] = "STRTAB",
-    [SHT_RELA] = "RELA",
-    [SHT_HASH] = "HASH",
-    [SHT_DYNAMIC] = "DYNAMIC",
-    [SHT_NOTE] = "NOTE",
-    [SHT_NOBITS] = "NOBITS",
-    [SHT_REL] = "REL",
-    [SHT_SHLIB] = "SHLIB",
-    [SHT_DYNSYM] = "DYNSYM"
-};
+        case DW_FORM_strp:
+            append_string(output, "(indirect string, offset: ");
+            stringify_offset(output, value->value);
+            append_string(output, "): ");
+            stringify_indirect_string(output, strings->str, strings->str_size, ".debug_str", value->value);
+            break;
+
+        case DW_FORM_line_strp:
+            append_string(output, "(indirect line string, offset: ");
+            stringify_offset(output, value->value);
+            append_string(output, "): ");
+            stringify_indirect_string(output, strings->line_str, strings->line_str_size, ".debug_line_str", value->value);
+            break;
+
+        case DW_FORM_strp_sup:
+        case DW_FORM_GNU_strp_alt:
+            append_string(output, "(alt indirect string, offset: ");
+            stringify_offset(output, value->value);
+            append_char(output, ')');
+            break;
+
+        case DW_FORM_strx:
+        case DW_FORM_strx1:
+        case DW_FORM_strx2:
+        case DW_FORM_strx3:
+        case DW_FORM_strx4:
+        case DW_FORM_GNU_str_index:
+        {
+            uint64_t string_offset;
+
+            append_string(output, "(indexed string: ");
+            stringify_offset(output, value->value);
+            append_char(output, ')');
+
+            // without .debug_str_offsets only the index can be shown
+            if(get_indexed_string_offset(strings, value->value, &string_offset))
+            {
+                append_string(output, ": ");
+                stringify_indirect_string(output, strings->str, strings->str_size, ".debug_str", string_offset);
+            }
+
+            break;
+        }
+
+        case DW_FORM_addrx:
+        case DW_FORM_addrx1:
+        case DW_FORM_addrx2:
+        case DW_FORM_addrx3:
+        case DW_FORM_addrx4:
+        case DW_FORM_GNU_addr_index:
+        {
+            uint64_t address;
+
+            append_string(output, "(index: ");
+            stringify_offset(output, value->value);
+            append_char(output, ')');
+
+            // likewise without .debug_addr
+            if(get_indexed_address(strings, value->value, &address))
+            {
+                append_string(output, ": 0x");
+                append_hex(output, address, 0);
+            }
+
+            break;
+        }
+
+        case DW_FORM_loclistx:
+        case DW_FORM_rnglistx:
+            append_string(output, "(index: ");
+            stringify_offset(output, value->value);
+            append_char(output, ')');
+            break;
+
+        default:
+        {
+            // blocks, location expressions and DW_FORM_data16
+            char *bytes;
+            size_t length = 0;
+
+            append_decimal(output, value->value);
+            append_string(output, " byte block: ");
+
+            bytes = reserve_output(output, 3*value->value);
+
+            for(uint64_t i = 0; i < value->value; i++)
+            {
+                length += format_hex(bytes + length, value->data[i], 0);
+                bytes[length++] = ' ';
+            }
+
+            output->size += length;
+            break;
+        }
+    }
+
+    append_char(output, '\n');
+}
 
 
 
 /*
- * Segment types
+ * Appends bytes as two hex digits each, separated by spaces.
  */
-static char *segment_types[] = {
-    [PT_NULL] = "NULL",
-    [PT_LOAD] = "LOAD",
-    [PT_DYNAMIC] = "DYNAMIC",
-    [PT_INTERP] = "INTERP",
-    [PT_NOTE] = "NOTE",
-    [PT_SHLIB] = "SHLIB",
-    [PT_PHDR] = "PHDR"
-};
+static void stringify_byte_list(output_t *output, const unsigned char *bytes, uint64_t num_bytes)
+{
+    for(uint64_t i = 0; i < num_bytes; i++)
+    {
+        if(i > 0)
+            append_char(output, ' ');
+
+        append_hex(output, bytes[i], 2);
+    }
+}
 
 
 
+/*
+ * Appends a signed number with its sign always in front, like
+ * "%+ld".
+ */
+static void stringify_signed_offset(output_t *output, int64_t offset)
+{
+    append_char(output, (offset < 0) ? '-' : '+');
+    append_decimal(output, (offset < 0) ? -(uint64_t) offset : (uint64_t) offset);
+}
 
 
-/************************************
- * This section contains the 32-bit *
- * stringification routines.        *
- ************************************/
 
-char *stringify_ELF32_header(ELF32_Header_t *elf_header)
+/*
+ * Appends a register of the call frame instructions as readelf
+ * writes it, "r7 (rsp)", or just "r7" if it has no name.
+ */
+static void stringify_register(output_t *output, int machine, uint64_t number)
 {
-    /*
-     * Temporary buffer to store strings before they
-     * are concatenated onto the output string.
-     */
-    char buffer[256];
+    char *name = get_register_name(machine, number);
 
+    append_char(output, 'r');
+    append_decimal(output, number);
 
-    /*
-     * For creating output string need to dynamically allocate
-     * memory. However, the ELF header string is continually
-     * growing, so there is a need to allocate enough memory
-     * and then some for the current size of the string. Thus,
-     * max_size gives the size allocated, and current_size gives
-     * the current size of the string, i.e. current_size is how
-     * much of the buffer of max_size is actually taken up by
-     * the string. When adding new text to the string causes
-     * current_size to become greater than max_size, then the
-     * string must be reallocated.
-     */
-    int max_size = 64, current_size = 0;
+    if(name != NULL)
+    {
+        append_string(output, " (");
+        append_string(output, name);
+        append_char(output, ')');
+    }
+}
+
+
+
+/*
+ * Appends the name of a register in a DWARF expression in
+ * parentheses after a space, or nothing if it has no name.
+ */
+static void stringify_register_name(output_t *output, int machine, uint64_t number)
+{
+    char *name = get_register_name(machine, number);
+
+    if(name != NULL)
+    {
+        append_string(output, " (");
+        append_string(output, name);
+        append_char(output, ')');
+    }
+}
+
+
+
+/*
+ * Appends the operations of a DWARF expression, separated by
+ * "; ", as readelf writes them. The expressions of call frame
+ * instructions only ever use the simpler operations; for the
+ * ones whose operands are not decoded here, the name is written
+ * and the rest of the expression is left out, since where the
+ * next operation starts is not known.
+ */
+static void stringify_dwarf_expression(output_t *output, const unsigned char *expression, uint64_t length,
+                                       int address_size, int machine)
+{
+    const unsigned char *position = expression;
+    const unsigned char *end = expression + length;
+
+
+    while(position < end)
+    {
+        uint8_t operation = *position++;
+        uint64_t value, number;
+        int64_t signed_value;
+        bool valid = true;
+        char *name;
+
+        if(position - 1 > expression)
+            append_string(output, "; ");
+
+
+        if(operation >= DW_OP_lit0 && operation <= DW_OP_lit31)
+        {
+            append_string(output, "DW_OP_lit");
+            append_decimal(output, operation - DW_OP_lit0);
+            continue;
+        }
+
+        if(operation >= DW_OP_reg0 && operation <= DW_OP_reg31)
+        {
+            append_string(output, "DW_OP_reg");
+            append_decimal(output, operation - DW_OP_reg0);
+            stringify_register_name(output, machine, operation - DW_OP_reg0);
+            continue;
+        }
+
+        if(operation >= DW_OP_breg0 && operation <= DW_OP_breg31)
+        {
+            if(!read_sleb128(&position, end, &signed_value))
+                return;
+
+            append_string(output, "DW_OP_breg");
+            append_decimal(output, operation - DW_OP_breg0);
+            stringify_register_name(output, machine, operation - DW_OP_breg0);
+            append_string(output, ": ");
+            append_signed_decimal(output, signed_value);
+            continue;
+        }
+
+
+        if((name = FIND_DWARF_NAME(operations, operation)) == NULL)
+        {
+            append_format(output, "(Unknown location op 0x%x)", operation);
+            return;
+        }
+
+        append_string(output, name);
+
+        switch(operation)
+        {
+            case DW_OP_addr:
+                if((valid = read_unsigned(&position, end, address_size, &value)))
+                {
+                    append_string(output, ": ");
+                    append_hex(output, value, 0);
+                }
+                break;
+
+            case DW_OP_const1u:
+            case DW_OP_const2u:
+            case DW_OP_const4u:
+            case DW_OP_const8u:
+                if((valid = read_unsigned(&position, end, 1 << ((operation - DW_OP_const1u) / 2), &value)))
+                {
+                    append_string(output, ": ");
+                    append_decimal(output, value);
+                }
+                break;
+
+            case DW_OP_const1s:
+            case DW_OP_const2s:
+            case DW_OP_const4s:
+            case DW_OP_const8s:
+            {
+                int size = 1 << ((operation - DW_OP_const1s) / 2);
+
+                if((valid = read_unsigned(&position, end, size, &value)))
+                {
+                    // sign-extend from the size of the constant
+                    int shift = 64 - 8*size;
+
+                    append_string(output, ": ");
+                    append_signed_decimal(output, (int64_t) (value << shift) >> shift);
+                }
+                break;
+            }
+
+            case DW_OP_constu:
+            case DW_OP_plus_uconst:
+            case DW_OP_piece:
+                if((valid = read_uleb128(&position, end, &value)))
+                {
+                    append_string(output, ": ");
+                    append_decimal(output, value);
+                }
+                break;
+
+            case DW_OP_consts:
+            case DW_OP_fbreg:
+                if((valid = read_sleb128(&position, end, &signed_value)))
+                {
+                    append_string(output, ": ");
+                    append_signed_decimal(output, signed_value);
+                }
+                break;
+
+            case DW_OP_pick:
+            case DW_OP_deref_size:
+            case DW_OP_xderef_size:
+                if((valid = read_unsigned(&position, end, 1, &value)))
+                {
+                    append_string(output, ": ");
+                    append_decimal(output, value);
+                }
+                break;
+
+            case DW_OP_bra:
+            case DW_OP_skip:
+                if((valid = read_unsigned(&position, end, 2, &value)))
+                {
+                    append_string(output, ": ");
+                    append_signed_decimal(output, (int16_t) value);
+                }
+                break;
+
+            case DW_OP_call2:
+            case DW_OP_call4:
+                if((valid = read_unsigned(&position, end, (operation == DW_OP_call2) ? 2 : 4, &value)))
+                {
+                    append_string(output, ": <0x");
+                    append_hex(output, value, 0);
+                    append_char(output, '>');
+                }
+                break;
+
+            case DW_OP_regx:
+                if((valid = read_uleb128(&position, end, &number)))
+                {
+                    append_string(output, ": ");
+                    append_decimal(output, number);
+                    stringify_register_name(output, machine, number);
+                }
+                break;
+
+            case DW_OP_bregx:
+                if((valid = read_uleb128(&position, end, &number) && read_sleb128(&position, end, &signed_value)))
+                {
+                    append_string(output, ": ");
+                    append_decimal(output, number);
+                    stringify_register_name(output, machine, number);
+                    append_char(output, ' ');
+                    append_signed_decimal(output, signed_value);
+                }
+                break;
+
+            case DW_OP_deref:
+            case DW_OP_dup:
+            case DW_OP_drop:
+            case DW_OP_over:
+            case DW_OP_swap:
+            case DW_OP_rot:
+            case DW_OP_xderef:
+            case DW_OP_abs:
+            case DW_OP_and:
+            case DW_OP_div:
+            case DW_OP_minus:
+            case DW_OP_mod:
+            case DW_OP_mul:
+            case DW_OP_neg:
+            case DW_OP_not:
+            case DW_OP_or:
+            case DW_OP_plus:
+            case DW_OP_shl:
+            case DW_OP_shr:
+            case DW_OP_shra:
+            case DW_OP_xor:
+            case DW_OP_eq:
+            case DW_OP_ge:
+            case DW_OP_gt:
+            case DW_OP_le:
+            case DW_OP_lt:
+            case DW_OP_ne:
+            case DW_OP_nop:
+            case DW_OP_push_object_address:
+            case DW_OP_form_tls_address:
+            case DW_OP_call_frame_cfa:
+            case DW_OP_stack_value:
+            case DW_OP_GNU_push_tls_address:
+            case DW_OP_GNU_uninit:
+                break;
+
+            default:
+                return;
+        }
+
+        if(!valid)
+            return;
+    }
+}
+
+
+
+/*
+ * Appends a CIE of .debug_frame or .eh_frame, without its
+ * instructions, the way readelf --debug-dump=frames lays it out.
+ * address_size is that of the file.
+ */
+void stringify_debug_cie(output_t *output, cie_t *cie, int address_size)
+{
+    append_char(output, '\n');
+    append_hex(output, cie->offset, 8);
+    append_char(output, ' ');
+    append_hex(output, cie->length, 2*address_size);
+    append_char(output, ' ');
+    append_hex(output, cie->id, 8);
+    append_string(output, " CIE\n  Version:               ");
+    append_decimal(output, cie->version);
+    append_string(output, "\n  Augmentation:          \"");
+    append_string(output, cie->augmentation);
+    append_string(output, "\"\n");
+
+    if(cie->version == 4)
+    {
+        append_string(output, "  Pointer Size:          ");
+        append_decimal(output, cie->address_size);
+        append_string(output, "\n  Segment Size:          ");
+        append_decimal(output, cie->segment_size);
+        append_char(output, '\n');
+    }
+
+    append_string(output, "  Code alignment factor: ");
+    append_decimal(output, cie->code_alignment);
+    append_string(output, "\n  Data alignment factor: ");
+    append_signed_decimal(output, cie->data_alignment);
+    append_string(output, "\n  Return address column: ");
+    append_decimal(output, cie->return_address_register);
+    append_char(output, '\n');
+
+    if(cie->augmentation_data_length > 0)
+    {
+        append_string(output, "  Augmentation data:     ");
+        stringify_byte_list(output, cie->augmentation_data, cie->augmentation_data_length);
+    }
+
+    append_char(output, '\n');
+}
+
+
+
+/*
+ * Appends an FDE, without its instructions.
+ */
+void stringify_debug_fde(output_t *output, fde_t *fde, int address_size)
+{
+    append_char(output, '\n');
+    append_hex(output, fde->offset, 8);
+    append_char(output, ' ');
+    append_hex(output, fde->length, 2*address_size);
+    append_char(output, ' ');
+    append_hex(output, fde->cie_pointer, 8);
+    append_string(output, " FDE cie=");
+    append_hex(output, fde->cie_offset, 8);
+    append_string(output, " pc=");
+    append_hex(output, fde->pc_begin, 2*address_size);
+    append_string(output, "..");
+    append_hex(output, fde->pc_begin + fde->pc_range, 2*address_size);
+    append_char(output, '\n');
+
+    if(fde->augmentation_data_length > 0)
+    {
+        append_string(output, "  Augmentation data:     ");
+        stringify_byte_list(output, fde->augmentation_data, fde->augmentation_data_length);
+        append_char(output, '\n');
+    }
+}
+
+
+
+/*
+ * Appends one call frame instruction. Registers are named for
+ * the given machine, and locations are as wide as an address
+ * of the file.
+ */
+void stringify_debug_cfa_instruction(output_t *output, cfa_instruction_t *instruction, int address_size, int machine)
+{
+    append_string(output, "  ");
+    append_string(output, FIND_DWARF_NAME(cfa_instructions, instruction->opcode));
+
+    switch(instruction->opcode)
+    {
+        case DW_CFA_advance_loc:
+        case DW_CFA_advance_loc1:
+        case DW_CFA_advance_loc2:
+        case DW_CFA_advance_loc4:
+            append_string(output, ": ");
+            append_signed_decimal(output, instruction->offset);
+            append_string(output, " to ");
+            append_hex(output, instruction->address, 2*address_size);
+            break;
+
+        case DW_CFA_set_loc:
+            append_string(output, ": ");
+            append_hex(output, instruction->address, 2*address_size);
+            break;
+
+        case DW_CFA_offset:
+        case DW_CFA_offset_extended:
+        case DW_CFA_offset_extended_sf:
+        case DW_CFA_GNU_negative_offset_extended:
+            append_string(output, ": ");
+            stringify_register(output, machine, instruction->register_number);
+            append_string(output, " at cfa");
+            stringify_signed_offset(output, instruction->offset);
+            break;
+
+        case DW_CFA_val_offset:
+        case DW_CFA_val_offset_sf:
+            append_string(output, ": ");
+            stringify_register(output, machine, instruction->register_number);
+            append_string(output, " is cfa");
+            stringify_signed_offset(output, instruction->offset);
+            break;
+
+        case DW_CFA_restore:
+        case DW_CFA_restore_extended:
+        case DW_CFA_undefined:
+        case DW_CFA_same_value:
+        case DW_CFA_def_cfa_register:
+            append_string(output, ": ");
+            stringify_register(output, machine, instruction->register_number);
+            break;
+
+        case DW_CFA_register:
+            append_string(output, ": ");
+            stringify_register(output, machine, instruction->register_number);
+            append_string(output, " in ");
+            stringify_register(output, machine, instruction->second_register);
+            break;
+
+        case DW_CFA_def_cfa:
+        case DW_CFA_def_cfa_sf:
+            append_string(output, ": ");
+            stringify_register(output, machine, instruction->register_number);
+            append_string(output, " ofs ");
+            append_signed_decimal(output, instruction->offset);
+            break;
+
+        case DW_CFA_def_cfa_offset:
+        case DW_CFA_def_cfa_offset_sf:
+        case DW_CFA_GNU_args_size:
+            append_string(output, ": ");
+            append_signed_decimal(output, instruction->offset);
+            break;
+
+        case DW_CFA_def_cfa_expression:
+            append_string(output, " (");
+            stringify_dwarf_expression(output, instruction->expression, instruction->expression_length, address_size, machine);
+            append_char(output, ')');
+            break;
+
+        case DW_CFA_expression:
+        case DW_CFA_val_expression:
+            append_string(output, ": ");
+            stringify_register(output, machine, instruction->register_number);
+            append_string(output, " (");
+            stringify_dwarf_expression(output, instruction->expression, instruction->expression_length, address_size, machine);
+            append_char(output, ')');
+            break;
+    }
+
+    append_char(output, '\n');
+}
+
+
+
+/*
+ * Appends the sorted table of FDE ranges of a section. Every
+ * row has the same width, with the start, end and FDE offset in
+ * fixed-width hex, so the table can be loaded (or searched) by
+ * another program without parsing the section again.
+ */
+void stringify_fde_index(output_t *output, range_index_t *index, const char *section_name, int address_size)
+{
+    append_string(output, "Sorted FDE table of the ");
+    append_string(output, section_name);
+    append_string(output, " section (");
+    append_decimal(output, index->num_ranges);
+    append_string(output, (index->num_ranges == 1) ? " entry):\n" : " entries):\n");
+    append_string(output, (address_size == 4) ? "  Start    End      FDE\n" : "  Start            End              FDE\n");
+
+    for(uint64_t i = 0; i < index->num_ranges; i++)
+    {
+        append_padding(output, 2);
+        append_hex(output, index->starts[i], 2*address_size);
+        append_char(output, ' ');
+        append_hex(output, index->ends[i], 2*address_size);
+        append_char(output, ' ');
+        append_hex(output, index->payloads[i], 8);
+        append_char(output, '\n');
+    }
+
+    append_char(output, '\n');
+}
+
+
+
+/*
+ * Appends the header of a name index of .debug_names, with its
+ * lists of units and its abbreviations. The layout follows the
+ * headers of the other debug sections.
+ */
+void stringify_debug_names_header(output_t *output, names_table_t *table)
+{
+    const char *unit_lists[] = {"  CU table:\n", "  Local TU table:\n", "  Foreign TU table:\n"};
+    const unsigned char *unit_arrays[] = {table->comp_units, table->local_type_units, table->foreign_type_units};
+    uint32_t unit_counts[] = {table->comp_unit_count, table->local_type_unit_count, table->foreign_type_unit_count};
+
+
+    append_string(output, "  Name index @ offset ");
+    stringify_offset(output, table->offset);
+    append_string(output, ":\n   Length:                   0x");
+    append_hex(output, table->length, 0);
+    append_string(output, (table->offset_size == 8) ? " (64-bit)\n" : " (32-bit)\n");
+    append_string(output, "   Version:                  ");
+    append_decimal(output, table->version);
+    append_string(output, "\n   Augmentation:             \"");
+    append_bytes(output, table->augmentation, strnlen(table->augmentation, table->augmentation_size));
+    append_string(output, "\"\n   CU count:                 ");
+    append_decimal(output, table->comp_unit_count);
+    append_string(output, "\n   Local TU count:           ");
+    append_decimal(output, table->local_type_unit_count);
+    append_string(output, "\n   Foreign TU count:         ");
+    append_decimal(output, table->foreign_type_unit_count);
+    append_string(output, "\n   Bucket count:             ");
+    append_decimal(output, table->bucket_count);
+    append_string(output, "\n   Name count:               ");
+    append_decimal(output, table->name_count);
+    append_string(output, "\n   Abbreviation table size:  0x");
+    append_hex(output, table->abbrev_table_size, 0);
+    append_string(output, "\n\n");
+
+    // type units of other files are given by their signatures
+    for(int list = 0; list < 3; list++)
+    {
+        if(unit_counts[list] == 0)
+            continue;
+
+        append_string(output, unit_lists[list]);
+
+        for(uint32_t i = 0; i < unit_counts[list]; i++)
+        {
+            int size = (list == 2) ? 8 : table->offset_size;
+
+            append_format(output, "   [%3u] 0x", i);
+            append_hex(output, get_names_table_value(table, unit_arrays[list], i, size), 0);
+            append_char(output, '\n');
+        }
+
+        append_char(output, '\n');
+    }
+
+
+    append_string(output, "  Abbreviations:\n");
+
+    for(uint64_t i = 0; i < table->num_abbrevs; i++)
+    {
+        names_abbrev_t *abbrev = &table->abbrevs[i];
+
+        append_string(output, "   0x");
+        append_hex(output, abbrev->code, 0);
+        append_char(output, ' ');
+        stringify_dwarf_tag(output, abbrev->tag);
+
+        for(uint32_t j = 0; j < abbrev->num_attributes; j++)
+        {
+            char *name = FIND_DWARF_NAME(name_index_attributes, abbrev->attributes[j].name);
 
+            append_char(output, ' ');
 
+            if(name != NULL)
+                append_string(output, name);
+            else
+                append_format(output, "DW_IDX_%#x", abbrev->attributes[j].name);
+
+            append_char(output, ' ');
+            stringify_dwarf_form(output, abbrev->attributes[j].form);
+        }
+
+        append_char(output, '\n');
+    }
+
+    append_char(output, '\n');
+}
+
+
+
+/*
+ * Appends how full the buckets of a name index are, given how
+ * many of them hold names and the most names one holds.
+ */
+void stringify_debug_names_buckets(output_t *output, names_table_t *table, uint64_t buckets_used, uint64_t longest_bucket)
+{
+    append_string(output, "  Used ");
+    append_decimal(output, buckets_used);
+    append_string(output, " of ");
+    append_decimal(output, table->bucket_count);
+    append_string(output, (table->bucket_count == 1) ? " bucket.\n" : " buckets.\n");
+    append_string(output, "  Out of ");
+    append_decimal(output, table->name_count);
+    append_string(output, " items there are ");
+    append_decimal(output, table->name_count - buckets_used);
+    append_string(output, " bucket clashes (longest of ");
+    append_decimal(output, longest_bucket);
+    append_string(output, " entries).\n\n");
+}
+
+
+
+/*
+ * Appends the start of the line of one name of a name index:
+ * its number, its hash (if the index has them) and the name.
+ */
+void stringify_debug_name(output_t *output, uint64_t number, uint32_t hash, bool has_hash, const char *name, uint64_t length)
+{
+    append_format(output, "   [%3lu] ", (unsigned long) number);
+
+    if(has_hash)
+    {
+        append_char(output, '#');
+        append_hex(output, hash, 8);
+        append_char(output, ' ');
+    }
+
+    append_bytes(output, name, length);
+    append_char(output, ':');
+}
+
+
+
+/*
+ * Appends one entry of a name, on the line of the name: its
+ * offset in the entry pool, its tag and its attributes.
+ */
+void stringify_debug_names_entry(output_t *output, names_entry_t *entry)
+{
+    append_string(output, " <0x");
+    append_hex(output, entry->offset, 0);
+    append_string(output, "> ");
+    stringify_dwarf_tag(output, entry->abbrev->tag);
+
+    if(entry->has_compile_unit)
+    {
+        append_string(output, " DW_IDX_compile_unit=");
+        append_decimal(output, entry->compile_unit);
+    }
+
+    if(entry->has_type_unit)
+    {
+        append_string(output, " DW_IDX_type_unit=");
+        append_decimal(output, entry->type_unit);
+    }
+
+    if(entry->has_die_offset)
+    {
+        append_string(output, " DW_IDX_die_offset=0x");
+        append_hex(output, entry->die_offset, 0);
+    }
+
+    if(entry->has_parent)
+    {
+        append_string(output, " DW_IDX_parent=<0x");
+        append_hex(output, entry->parent, 0);
+        append_char(output, '>');
+    }
+}
+
+
+
+/*
+ * Appends the line for a DIE found by name: the name, the
+ * offset of the DIE in .debug_info, and its tag.
+ */
+void stringify_debug_name_match(output_t *output, const char *name, size_t length, uint64_t die_offset, uint32_t tag)
+{
+    append_bytes(output, name, length);
+    append_string(output, "\t0x");
+    append_hex(output, die_offset, 0);
+    append_char(output, '\t');
+    stringify_dwarf_tag(output, tag);
+    append_char(output, '\n');
+}
+
+
+
+
+
+/************************************
+ * This section contains the 32-bit *
+ * stringification routines.        *
+ ************************************/
+
+int stringify_ELF32_header(output_t *output, ELF32_Header_t *elf_header, ELF32_Section_Header_t *section_header_table)
+{
     char *header_string = "ELF header:\n";
     char *ident = "  ELF Identification bits:\t";
     char *class = "  Class:\t\t\t\t";
@@ -101,313 +2067,614 @@ char *stringify_ELF32_header(ELF32_Header_t *elf_header)
     char *string_table_index = "  Section header string table index:\t";
 
 
-    // allocate an initial buffer of 64 bytes
-    char *output_string = (char*) malloc(max_size*sizeof(char));
-    
-    
-    CONCATENATE_DYNAMIC_STRING(output_string, header_string, max_size, current_size);
-    CONCATENATE_DYNAMIC_STRING(output_string, ident, max_size, current_size)
-
+    append_string(output, header_string);
+    append_string(output, ident);
+
 
     // add the identification bits to the output string
     for(int i = 0; i < EI_NIDENT; i++)
     {
-        char temp[8];
-
-        if(i < EI_NIDENT - 1)
-            sprintf(temp, "%02x ", elf_header->e_ident[i]);
-        else
-            sprintf(temp, "%02x\n", elf_header->e_ident[i]);
-        
-        CONCATENATE_DYNAMIC_STRING(output_string, temp, max_size, current_size);
+        append_hex(output, elf_header->e_ident[i], 2);
+        append_char(output, (i < EI_NIDENT - 1) ? ' ' : '\n');
     }
 
 
     // add ELF file class to output string
-    CONCATENATE_DYNAMIC_STRING(output_string, class, max_size, current_size);
+    append_string(output, class);
 
     switch(elf_header->e_ident[EI_CLASS])
     {
         case ELFCLASS32:
-            sprintf(buffer, "ELF32\n");
+            append_string(output, "ELF32\n");
             break;
         
         case ELFCLASS64:
-            sprintf(buffer, "ELF64\n");
+            append_string(output, "ELF64\n");
             break;
         
         default:
-            sprintf(buffer, "Unrecognized\n");
+            append_string(output, "Unrecognized\n");
     }
     
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
 
     // add ELF data format to output string
-    CONCATENATE_DYNAMIC_STRING(output_string, data, max_size, current_size);
+    append_string(output, data);
 
     switch (elf_header->e_ident[EI_DATA])
     {
     case ELFDATA2LSB:
-        sprintf(buffer, "2's complement, little-endian\n");
+        append_string(output, "2's complement, little-endian\n");
         break;
     
     case ELFDATA2MSB:
-        sprintf(buffer, "2's complement, big-endian");
+        append_string(output, "2's complement, big-endian");
         break;
     
     default:
-        sprintf(buffer, "Unrecognized format");
+        append_string(output, "Unrecognized format");
         break;
     }
 
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
     // add ELF version to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, version, max_size, current_size);
+    append_string(output, version);
 
     switch(elf_header->e_version)
     {
         case EV_CURRENT:
-            sprintf(buffer, "Current\n");
+            append_string(output, "Current\n");
             break;
         
         default:
-            sprintf(buffer, "None\n");
+            append_string(output, "None\n");
             break;
     }
 
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
 
     // add OS/ABI to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, osabi, max_size, current_size);
+    append_string(output, osabi);
 
     switch(elf_header->e_ident[EI_OSABI])
     {
         case ELFOSABI_SYSV:
-            sprintf(buffer, "Unix - System V\n");
+            append_string(output, "Unix - System V\n");
             break;
         
         case ELFOSABI_HPUX:
-            sprintf(buffer, "HP-UX\n");
+            append_string(output, "HP-UX\n");
             break;
         
         case ELFOSABI_STANDALONE:
-            sprintf(buffer, "Standalone (embedded) application\n");
+            append_string(output, "Standalone (embedded) application\n");
             break;
         
         default:
-            sprintf(buffer, "Unrecognized\n");
+            append_string(output, "Unrecognized\n");
             break;
     }
 
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
 
     // add type of object file to output string
-    CONCATENATE_DYNAMIC_STRING(output_string, type, max_size, current_size);
+    append_string(output, type);
 
     switch(elf_header->e_type)
     {
         case ET_NONE:
-            sprintf(buffer, "None\n");
+            append_string(output, "None\n");
             break;
         
         case ET_REL:
-            sprintf(buffer, "REL (Relocatable File)\n");
+            append_string(output, "REL (Relocatable File)\n");
             break;
         
         case ET_EXEC:
-            sprintf(buffer, "EXEC (Executable file)\n");
+            append_string(output, "EXEC (Executable file)\n");
             break;
 
         case ET_DYN:
-            sprintf(buffer, "DYN (Dynamically-linker shared library)\n");
+            append_string(output, "DYN (Dynamically-linker shared library)\n");
             break;
 
         case ET_CORE:
-            sprintf(buffer, "CORE (Core dump file)\n");
+            append_string(output, "CORE (Core dump file)\n");
             break;
 
         default:
-            sprintf(buffer, "Unkown or processor-specific type\n");
+            append_string(output, "Unkown or processor-specific type\n");
             break;
     }
 
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
 
     // add machine type information to output string
-    CONCATENATE_DYNAMIC_STRING(output_string, machine, max_size, current_size);
+    append_string(output, machine);
 
     switch (elf_header->e_machine)
     {
     case EM_NONE:
-        sprintf(buffer, "No machine type\n");
+        append_string(output, "No machine type\n");
         break;
 
     case EM_M32:
-        sprintf(buffer, "AT&T WE 32100\n");
+        append_string(output, "AT&T WE 32100\n");
         break;
 
     case EM_SPARC:
-        sprintf(buffer, "SPARC\n");
+        append_string(output, "SPARC\n");
         break;
     
     case EM_386:
-        sprintf(buffer, "Intel Architecture\n");
+        append_string(output, "Intel Architecture\n");
         break;
     
     case EM_68K:
-        sprintf(buffer, "Motorola 68000\n");
+        append_string(output, "Motorola 68000\n");
         break;
     
     case EM_88K:
-        sprintf(buffer, "Motorola 88000\n");
+        append_string(output, "Motorola 88000\n");
         break;
     
     case EM_860:
-        sprintf(buffer, "Intel 80860\n");
+        append_string(output, "Intel 80860\n");
         break;
     
     case EM_MIPS:
-        sprintf(buffer, "MIPS RS3000 Big-Endian\n");
+        append_string(output, "MIPS RS3000 Big-Endian\n");
         break;
     
     case EM_MIPS_RS4_BE:
-        sprintf(buffer, "MIPS RS4000 Big-Endian\n");
+        append_string(output, "MIPS RS4000 Big-Endian\n");
         break;
     
     case EM_X86_64:
-        sprintf(buffer, "Advanced Micro Devices X86-64\n");
+        append_string(output, "Advanced Micro Devices X86-64\n");
         break;
     
     default:
-        sprintf(buffer, "%d: Unknown machine architecture\n", elf_header->e_machine);
+        append_decimal(output, elf_header->e_machine);
+        append_string(output, ": Unknown machine architecture\n");
         break;
     }
 
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
 
     // add the entry point address to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, entry, max_size, current_size);
-    sprintf(buffer, "0x%x\n", elf_header->e_entry);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, entry);
+    append_string(output, "0x");
+    append_hex(output, elf_header->e_entry, 0);
+    append_char(output, '\n');
 
 
     // add the section header offset to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, section_headers, max_size, current_size);
-    sprintf(buffer, "%u (bytes into the file)\n", elf_header->e_shoff);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, section_headers);
+    append_decimal(output, elf_header->e_shoff);
+    append_string(output, " (bytes into the file)\n");
 
 
     // add the program header offset to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, program_headers, max_size, current_size);
-    sprintf(buffer, "%u (bytes into the file)\n", elf_header->e_phoff);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, program_headers);
+    append_decimal(output, elf_header->e_phoff);
+    append_string(output, " (bytes into the file)\n");
 
     
     // add flags to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, flags, max_size, current_size);
-    sprintf(buffer, "0x%x\n", elf_header->e_flags);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, flags);
+    append_string(output, "0x");
+    append_hex(output, elf_header->e_flags, 0);
+    append_char(output, '\n');
 
 
     // add the ELF header size to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, header_size, max_size, current_size);
-    sprintf(buffer, "%d (bytes)\n", elf_header->e_ehsize);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, header_size);
+    append_decimal(output, elf_header->e_ehsize);
+    append_string(output, " (bytes)\n");
 
 
     // add the section header size to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, section_header_size, max_size, current_size);
-    sprintf(buffer, "%d (bytes)\n", elf_header->e_shentsize);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, section_header_size);
+    append_decimal(output, elf_header->e_shentsize);
+    append_string(output, " (bytes)\n");
 
 
     // add the number of section headers to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, num_section_headers, max_size, current_size);
-    sprintf(buffer, "%d\n", elf_header->e_shnum);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, num_section_headers);
+    append_decimal(output, elf_header->e_shnum);
+
+    if(elf_header->e_shnum == 0 && get_ELF32_num_sections(elf_header, section_header_table) != 0)
+    {
+        append_string(output, " (");
+        append_decimal(output, get_ELF32_num_sections(elf_header, section_header_table));
+        append_char(output, ')');
+    }
+
+    append_char(output, '\n');
 
 
     // add the program header size to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, program_header_size, max_size, current_size);
-    sprintf(buffer, "%d (bytes)\n", elf_header->e_phentsize);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, program_header_size);
+    append_decimal(output, elf_header->e_phentsize);
+    append_string(output, " (bytes)\n");
 
 
     // add the number of program headers to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, num_program_headers, max_size, current_size);
-    sprintf(buffer, "%d\n", elf_header->e_phnum);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, num_program_headers);
+    append_decimal(output, elf_header->e_phnum);
+    append_char(output, '\n');
 
 
     // add the section header string table index to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, string_table_index, max_size, current_size);
-    sprintf(buffer, "%d\n", elf_header->e_shstrndx);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, string_table_index);
+    append_decimal(output, elf_header->e_shstrndx);
+
+    if(elf_header->e_shstrndx == SHN_XINDEX)
+    {
+        append_string(output, " (");
+        append_decimal(output, get_ELF32_section_string_table_index(elf_header, section_header_table));
+        append_char(output, ')');
+    }
+
+    append_char(output, '\n');
 
     
-    return output_string;
+    return RET_OK;
 }
 
 
-char *stringify_ELF32_section_header_table(ELF32_Section_Header_t *section_header_table, ELF32_Header_t *file_header, char **section_header_names)
+int stringify_ELF32_section_header_table(output_t *output, ELF32_Section_Header_t *section_header_table, ELF32_Header_t *file_header, section_name_table_t *section_header_names)
 {
     fprintf(stderr, "TODO: Implement stringification of 32-bit ELF section header table.\n");
-    return NULL;
+    return RET_NOT_OK;
 }
 
 
-char *stringify_ELF32_program_header_table(ELF32_Program_Header_t *program_header_table, ELF32_Header_t *file_header, char ***section_to_segment_mapping)
+/*
+ * Appends the lines before the program header table: the type of
+ * the file, its entry point and where its program headers are.
+ * They are the same for both classes.
+ */
+static void stringify_program_header_preamble(output_t *output, uint16_t type, uint64_t entry, uint64_t num_program_headers,
+                                              uint64_t program_header_offset)
 {
-    fprintf(stderr, "TODO: Implement stringification of 32-bit ELF program header table.\n");
-    return NULL;
+    static char *file_types[] = {
+        [ET_NONE] = "NONE",
+        [ET_REL] = "REL (Relocatable File)",
+        [ET_EXEC] = "EXEC (Executable File)",
+        [ET_DYN] = "DYN (Position Independent executable file)",
+        [ET_CORE] = "CORE (Core Dump file)"
+    };
+
+
+    append_string(output, "\nELF file type is ");
+    append_string(output, (type <= ET_CORE) ? file_types[type] : "UNKNOWN");
+    append_char(output, '\n');
+
+
+    append_string(output, "Entry point is 0x");
+    append_hex(output, entry, 0);
+    append_char(output, '\n');
+
+    append_string(output, "There are ");
+    append_decimal(output, num_program_headers);
+    append_string(output, " section headers starting at offset ");
+    append_decimal(output, program_header_offset);
+    append_string(output, "\n\n");
+
+    append_string(output, "Program Headers:\n");
 }
 
 
 
+/*
+ * Appends the sections each segment holds, after the program
+ * header table of either class.
+ */
+static void stringify_section_to_segment_mapping(output_t *output, int num_segments, section_to_segment_mapping_t *section_to_segment_mapping,
+                                                 section_name_table_t *section_names)
+{
+    append_string(output, "\n\nSection to Segment mapping:\n\n");
+
+    append_string(output, "Segment Number\tSection Name\n");
+
+
+    for(int i = 0; i < num_segments; i++)
+    {
+        append_decimal(output, i);
+        append_string(output, "\t\t");
+
+        /*
+         * The mapping only holds section indices,
+         * so look each name up in the name table.
+         */
+        for(int j = section_to_segment_mapping->segment_start[i]; j < section_to_segment_mapping->segment_start[i+1]; j++)
+        {
+            string_view_t section_name = section_names->names[section_to_segment_mapping->section_indices[j]];
+
+            append_bytes(output, section_name.string, section_name.length);
+            append_char(output, ' ');
+        }
+
+        append_string(output, "\n");
+    }
+}
+
+
+
+/*
+ * Appends the row for one segment. The fields of a 32-bit file
+ * are all 32 bits, so they are printed 8 hex digits wide.
+ */
+static void stringify_ELF32_program_header(output_t *output, ELF32_Program_Header_t *program_header_table, int index)
+{
+    ELF32_Program_Header_t *program_header = &program_header_table[index];
+
+    // types can be very large, like 0x6474e551, so check before indexing
+    char *segment_type = (program_header->p_type <= PT_PHDR) ? segment_types[program_header->p_type] : "UNKNOWN";
+
+
+    append_decimal(output, index);
+    append_char(output, '\t');
+    append_string(output, segment_type);
+    append_string(output, "\t\t");
+    append_hex(output, program_header->p_offset, 8);
+    append_char(output, '\t');
+    append_hex(output, program_header->p_vaddr, 8);
+    append_char(output, '\t');
+    append_hex(output, program_header->p_paddr, 8);
+    append_char(output, '\t');
+    append_hex(output, program_header->p_filesz, 8);
+    append_char(output, '\t');
+    append_hex(output, program_header->p_memsz, 8);
+    append_char(output, '\t');
+    append_decimal(output, program_header->p_flags);
+    append_char(output, '\t');
+    append_decimal(output, program_header->p_align);
+    append_char(output, '\n');
+}
+
+
+
+/*
+ * Turns the program header table of a 32-bit file into text, in
+ * the same form as stringify_ELF64_program_header_table, followed
+ * by the section to segment mapping.
+ */
+int stringify_ELF32_program_header_table(output_t *output, ELF32_Program_Header_t *program_header_table, ELF32_Header_t *file_header,
+                                         section_to_segment_mapping_t *section_to_segment_mapping, section_name_table_t *section_names)
+{
+    /*
+     * Defensive check to prevent segmentation
+     * fault from NULL pointer being passed.
+     */
+    if(program_header_table == NULL || file_header == NULL || section_to_segment_mapping == NULL || section_names == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to stringify_ELF32_program_header_table.\n");
+        return RET_NOT_OK;
+    }
 
-/************************************
- * This section contains the 64-bit *
- * stringification routines.        *
- ************************************/
 
+    stringify_program_header_preamble(output, file_header->e_type, file_header->e_entry, file_header->e_phnum, file_header->e_phoff);
 
-char *stringify_ELF64_header(ELF64_Header_t *elf_header)
+    append_string(output, "Number\tType\t\tOffset\t\tVirtAddr\tPhysAddr\tFileSize\tMemSize\t\tFlags\tAlign\n");
+
+    append_string(output, "-----------------------------------------------------------------------------------------------------\n");
+
+
+    for(int i = 0; i < file_header->e_phnum; i++)
+    {
+        stringify_ELF32_program_header(output, program_header_table, i);
+    }
+
+
+    stringify_section_to_segment_mapping(output, file_header->e_phnum, section_to_segment_mapping, section_names);
+
+
+    return RET_OK;
+}
+
+
+
+
+/*
+ * Appends the row for one symbol of a symbol table.
+ */
+void stringify_ELF32_symbol(output_t *output, symbol_table_t *symbol_table, uint64_t symbol_number)
 {
+    ELF32_Sym_t *symbol = &((ELF32_Sym_t*) symbol_table->symbols)[symbol_number];
+    string_view_t name = get_string_table_entry(symbol_table->string_table, symbol_table->string_table_size, symbol->st_name);
+
+    append_decimal(output, symbol_number);
+    append_char(output, '\t');
+    append_hex(output, symbol->st_value, 8);
+    append_char(output, '\t');
+    append_decimal(output, symbol->st_size);
+    append_char(output, '\t');
+    append_string(output, get_symbol_type_name(symbol->st_info));
+    append_char(output, '\t');
+    append_string(output, get_symbol_binding_name(symbol->st_info));
+    append_char(output, '\t');
+    append_string(output, symbol_visibilities[ELF_ST_VISIBILITY(symbol->st_other)]);
+    append_char(output, '\t');
+    stringify_symbol_section_index(output, symbol->st_shndx);
+    append_char(output, '\t');
+    append_bytes(output, name.string, name.length);
+    append_char(output, '\n');
+}
+
+
 
+/*
+ * Turns a symbol table into text, one row per symbol. The rows
+ * are written straight to the output as the symbols are read out
+ * of the mapping, and the names are written from views into the
+ * string table, so nothing is allocated however many symbols the
+ * table holds.
+ */
+int stringify_ELF32_symbol_table(output_t *output, symbol_table_t *symbol_table, string_view_t section_name)
+{
     /*
-     * Temporary buffer to store strings before they
-     * are concatenated onto the output string.
+     * Defensive check to prevent segmentation
+     * fault from NULL pointer being passed.
      */
-    char buffer[256];
+    if(symbol_table == NULL || symbol_table->symbols == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to stringify_ELF32_symbol_table.\n");
+        return RET_NOT_OK;
+    }
+
+    stringify_symbol_table_title(output, section_name, symbol_table->num_symbols, 8);
+
+
+    for(uint64_t i = 0; i < symbol_table->num_symbols; i++)
+    {
+        stringify_ELF32_symbol(output, symbol_table, i);
+    }
+
+
+    return RET_OK;
+}
+
+
+
+
+/*
+ * Turns a relocation section into text, one row per relocation,
+ * joined with the symbol each one refers to. The relocations are
+ * read in batches: first the symbol index and type of every entry
+ * of the batch are split out of r_info in a tight loop over the
+ * mapped entries, which the compiler can vectorize, and then the
+ * rows of the batch are written straight to the output. Nothing
+ * is allocated however many relocations there are.
+ */
+int stringify_ELF32_relocation_table(output_t *output, relocation_table_t *relocation_table, ELF32_Section_Header_t *section_header,
+                                      string_view_t section_name, int machine, section_name_table_t *section_names)
+{
+    uint32_t symbol_indices[RELOCATION_BATCH_SIZE];
+    uint32_t types[RELOCATION_BATCH_SIZE];
+
+    ELF32_Rel_t *rel_entries;
+    ELF32_Rela_t *rela_entries;
+    ELF32_Sym_t *symbols;
 
 
     /*
-     * For creating output string need to dynamically allocate
-     * memory. However, the ELF header string is continually
-     * growing, so there is a need to allocate enough memory
-     * and then some for the current size of the string. Thus,
-     * max_size gives the size allocated, and current_size gives
-     * the current size of the string, i.e. current_size is how
-     * much of the buffer of max_size is actually taken up by
-     * the string. When adding new text to the string causes
-     * current_size to become greater than max_size, then the
-     * string must be reallocated.
+     * Defensive check to prevent segmentation
+     * fault from NULL pointer being passed.
      */
-    int max_size = 64, current_size = 0;
+    if(relocation_table == NULL || relocation_table->entries == NULL || section_header == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to stringify_ELF32_relocation_table.\n");
+        return RET_NOT_OK;
+    }
+
+    rel_entries = (ELF32_Rel_t*) relocation_table->entries;
+    rela_entries = (ELF32_Rela_t*) relocation_table->entries;
+    symbols = (ELF32_Sym_t*) relocation_table->symbols.symbols;
+
+
+    stringify_relocation_table_title(output, section_name, section_header->sh_offset, relocation_table->num_entries, relocation_table->has_addends);
+
+
+    for(uint64_t start = 0; start < relocation_table->num_entries; start += RELOCATION_BATCH_SIZE)
+    {
+        uint64_t count = relocation_table->num_entries - start;
+
+        if(count > RELOCATION_BATCH_SIZE)
+            count = RELOCATION_BATCH_SIZE;
+
+
+        // decode the whole batch first
+        if(relocation_table->has_addends)
+        {
+            for(uint64_t i = 0; i < count; i++)
+            {
+                symbol_indices[i] = ELF32_R_SYM(rela_entries[start + i].r_info);
+                types[i] = ELF32_R_TYPE(rela_entries[start + i].r_info);
+            }
+        }
+        else
+        {
+            for(uint64_t i = 0; i < count; i++)
+            {
+                symbol_indices[i] = ELF32_R_SYM(rel_entries[start + i].r_info);
+                types[i] = ELF32_R_TYPE(rel_entries[start + i].r_info);
+            }
+        }
+
+
+        for(uint64_t i = 0; i < count; i++)
+        {
+            uint64_t offset = relocation_table->has_addends ? rela_entries[start + i].r_offset : rel_entries[start + i].r_offset;
+            uint64_t info = relocation_table->has_addends ? rela_entries[start + i].r_info : rel_entries[start + i].r_info;
+            bool has_symbol = symbol_indices[i] != STN_UNDEF && relocation_table->has_symbols &&
+                              symbol_indices[i] < relocation_table->symbols.num_symbols;
+
+            append_hex(output, offset, 8);
+            append_char(output, '\t');
+            append_hex(output, info, 8);
+            append_char(output, '\t');
+            stringify_relocation_type(output, machine, types[i]);
+            append_char(output, '\t');
+
+            if(has_symbol)
+            {
+                ELF32_Sym_t *symbol = &symbols[symbol_indices[i]];
+                string_view_t name = get_string_table_entry(relocation_table->symbols.string_table,
+                                                            relocation_table->symbols.string_table_size, symbol->st_name);
+
+                // section symbols are nameless, so use the section's name
+                if(name.length == 0 && ELF_ST_TYPE(symbol->st_info) == STT_SECTION &&
+                   section_names != NULL && symbol->st_shndx < section_names->num_names)
+                {
+                    name = section_names->names[symbol->st_shndx];
+                }
+
+                append_hex(output, symbol->st_value, 8);
+                append_char(output, '\t');
+                append_bytes(output, name.string, name.length);
+            }
+            else
+            {
+                append_padding(output, 8);
+                append_char(output, '\t');
+            }
+
+            if(relocation_table->has_addends)
+            {
+                if(has_symbol)
+                    stringify_addend(output, rela_entries[start + i].r_addend);
+                else
+                    append_hex(output, rela_entries[start + i].r_addend, 0);
+            }
+
+            append_char(output, '\n');
+        }
+    }
+
+
+    return RET_OK;
+}
+
+
+
 
+/************************************
+ * This section contains the 64-bit *
+ * stringification routines.        *
+ ************************************/
 
+
+int stringify_ELF64_header(output_t *output, ELF64_Header_t *elf_header, ELF64_Section_Header_t *section_header_table)
+{
     char *header_string = "ELF header:\n";
     char *ident = "  ELF Identification bits:\t";
     char *class = "  Class:\t\t\t\t";
@@ -428,330 +2695,376 @@ char *stringify_ELF64_header(ELF64_Header_t *elf_header)
     char *string_table_index = "  Section header string table index:\t";
 
 
-    // allocate an initial buffer of 64 bytes
-    char *output_string = (char*) malloc(max_size*sizeof(char));
-    
-    
-    CONCATENATE_DYNAMIC_STRING(output_string, header_string, max_size, current_size);
-    CONCATENATE_DYNAMIC_STRING(output_string, ident, max_size, current_size)
+    append_string(output, header_string);
+    append_string(output, ident);
 
 
     // add the identification bits to the output string
     for(int i = 0; i < EI_NIDENT; i++)
     {
-        char temp[8];
-
-        if(i < EI_NIDENT - 1)
-            sprintf(temp, "%02x ", elf_header->e_ident[i]);
-        else
-            sprintf(temp, "%02x\n", elf_header->e_ident[i]);
-        
-        CONCATENATE_DYNAMIC_STRING(output_string, temp, max_size, current_size);
+        append_hex(output, elf_header->e_ident[i], 2);
+        append_char(output, (i < EI_NIDENT - 1) ? ' ' : '\n');
     }
 
 
     // add ELF file class to output string
-    CONCATENATE_DYNAMIC_STRING(output_string, class, max_size, current_size);
+    append_string(output, class);
 
     switch(elf_header->e_ident[EI_CLASS])
     {
         case ELFCLASS32:
-            sprintf(buffer, "ELF32\n");
+            append_string(output, "ELF32\n");
             break;
         
         case ELFCLASS64:
-            sprintf(buffer, "ELF64\n");
+            append_string(output, "ELF64\n");
             break;
         
         default:
-            sprintf(buffer, "Unrecognized\n");
+            append_string(output, "Unrecognized\n");
     }
     
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
 
     // add ELF data format to output string
-    CONCATENATE_DYNAMIC_STRING(output_string, data, max_size, current_size);
+    append_string(output, data);
 
     switch (elf_header->e_ident[EI_DATA])
     {
     case ELFDATA2LSB:
-        sprintf(buffer, "2's complement, little-endian\n");
+        append_string(output, "2's complement, little-endian\n");
         break;
     
     case ELFDATA2MSB:
-        sprintf(buffer, "2's complement, big-endian");
+        append_string(output, "2's complement, big-endian");
         break;
     
     default:
-        sprintf(buffer, "Unrecognized format");
+        append_string(output, "Unrecognized format");
         break;
     }
 
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
     // add ELF version to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, version, max_size, current_size);
+    append_string(output, version);
 
     switch(elf_header->e_version)
     {
         case EV_CURRENT:
-            sprintf(buffer, "Current\n");
+            append_string(output, "Current\n");
             break;
         
         default:
-            sprintf(buffer, "None\n");
+            append_string(output, "None\n");
             break;
     }
 
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
 
     // add OS/ABI to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, osabi, max_size, current_size);
+    append_string(output, osabi);
 
     switch(elf_header->e_ident[EI_OSABI])
     {
         case ELFOSABI_SYSV:
-            sprintf(buffer, "Unix - System V\n");
+            append_string(output, "Unix - System V\n");
             break;
         
         case ELFOSABI_HPUX:
-            sprintf(buffer, "HP-UX\n");
+            append_string(output, "HP-UX\n");
             break;
         
         case ELFOSABI_STANDALONE:
-            sprintf(buffer, "Standalone (embedded) application\n");
+            append_string(output, "Standalone (embedded) application\n");
             break;
         
         default:
-            sprintf(buffer, "Unrecognized\n");
+            append_string(output, "Unrecognized\n");
             break;
     }
 
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
 
     // add type of object file to output string
-    CONCATENATE_DYNAMIC_STRING(output_string, type, max_size, current_size);
+    append_string(output, type);
 
     switch(elf_header->e_type)
     {
         case ET_NONE:
-            sprintf(buffer, "None\n");
+            append_string(output, "None\n");
             break;
         
         case ET_REL:
-            sprintf(buffer, "REL (Relocatable File)\n");
+            append_string(output, "REL (Relocatable File)\n");
             break;
         
         case ET_EXEC:
-            sprintf(buffer, "EXEC (Executable file)\n");
+            append_string(output, "EXEC (Executable file)\n");
             break;
 
         case ET_DYN:
-            sprintf(buffer, "DYN (Dynamically-linker shared library)\n");
+            append_string(output, "DYN (Dynamically-linker shared library)\n");
             break;
 
         case ET_CORE:
-            sprintf(buffer, "CORE (Core dump file)\n");
+            append_string(output, "CORE (Core dump file)\n");
             break;
 
         default:
-            sprintf(buffer, "Unkown or processor-specific type\n");
+            append_string(output, "Unkown or processor-specific type\n");
             break;
     }
 
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
 
     // add machine type information to output string
-    CONCATENATE_DYNAMIC_STRING(output_string, machine, max_size, current_size);
+    append_string(output, machine);
 
     switch (elf_header->e_machine)
     {
     case EM_NONE:
-        sprintf(buffer, "No machine type\n");
+        append_string(output, "No machine type\n");
         break;
 
     case EM_M32:
-        sprintf(buffer, "AT&T WE 32100\n");
+        append_string(output, "AT&T WE 32100\n");
         break;
 
     case EM_SPARC:
-        sprintf(buffer, "SPARC\n");
+        append_string(output, "SPARC\n");
         break;
     
     case EM_386:
-        sprintf(buffer, "Intel Architecture\n");
+        append_string(output, "Intel Architecture\n");
         break;
     
     case EM_68K:
-        sprintf(buffer, "Motorola 68000\n");
+        append_string(output, "Motorola 68000\n");
         break;
     
     case EM_88K:
-        sprintf(buffer, "Motorola 88000\n");
+        append_string(output, "Motorola 88000\n");
         break;
     
     case EM_860:
-        sprintf(buffer, "Intel 80860\n");
+        append_string(output, "Intel 80860\n");
         break;
     
     case EM_MIPS:
-        sprintf(buffer, "MIPS RS3000 Big-Endian\n");
+        append_string(output, "MIPS RS3000 Big-Endian\n");
         break;
     
     case EM_MIPS_RS4_BE:
-        sprintf(buffer, "MIPS RS4000 Big-Endian\n");
+        append_string(output, "MIPS RS4000 Big-Endian\n");
         break;
     
     case EM_X86_64:
-        sprintf(buffer, "Advanced Micro Devices X86-64\n");
+        append_string(output, "Advanced Micro Devices X86-64\n");
         break;
     
     default:
-        sprintf(buffer, "%d: Unknown machine architecture\n", elf_header->e_machine);
+        append_decimal(output, elf_header->e_machine);
+        append_string(output, ": Unknown machine architecture\n");
         break;
     }
 
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
 
     // add the entry point address to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, entry, max_size, current_size);
-    sprintf(buffer, "0x%lx\n", elf_header->e_entry);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, entry);
+    append_string(output, "0x");
+    append_hex(output, elf_header->e_entry, 0);
+    append_char(output, '\n');
 
 
     // add the section header offset to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, section_headers, max_size, current_size);
-    sprintf(buffer, "%lu (bytes into the file)\n", elf_header->e_shoff);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, section_headers);
+    append_decimal(output, elf_header->e_shoff);
+    append_string(output, " (bytes into the file)\n");
 
 
     // add the program header offset to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, program_headers, max_size, current_size);
-    sprintf(buffer, "%lu (bytes into the file)\n", elf_header->e_phoff);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, program_headers);
+    append_decimal(output, elf_header->e_phoff);
+    append_string(output, " (bytes into the file)\n");
 
     
     // add flags to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, flags, max_size, current_size);
-    sprintf(buffer, "0x%x\n", elf_header->e_flags);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, flags);
+    append_string(output, "0x");
+    append_hex(output, elf_header->e_flags, 0);
+    append_char(output, '\n');
 
 
     // add the ELF header size to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, header_size, max_size, current_size);
-    sprintf(buffer, "%d (bytes)\n", elf_header->e_ehsize);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, header_size);
+    append_decimal(output, elf_header->e_ehsize);
+    append_string(output, " (bytes)\n");
 
 
     // add the section header size to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, section_header_size, max_size, current_size);
-    sprintf(buffer, "%d (bytes)\n", elf_header->e_shentsize);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, section_header_size);
+    append_decimal(output, elf_header->e_shentsize);
+    append_string(output, " (bytes)\n");
 
 
     // add the number of section headers to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, num_section_headers, max_size, current_size);
-    sprintf(buffer, "%d\n", elf_header->e_shnum);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, num_section_headers);
+    append_decimal(output, elf_header->e_shnum);
+
+    if(elf_header->e_shnum == 0 && get_ELF64_num_sections(elf_header, section_header_table) != 0)
+    {
+        append_string(output, " (");
+        append_decimal(output, get_ELF64_num_sections(elf_header, section_header_table));
+        append_char(output, ')');
+    }
+
+    append_char(output, '\n');
 
 
     // add the program header size to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, program_header_size, max_size, current_size);
-    sprintf(buffer, "%d (bytes)\n", elf_header->e_phentsize);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, program_header_size);
+    append_decimal(output, elf_header->e_phentsize);
+    append_string(output, " (bytes)\n");
 
 
     // add the number of program headers to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, num_program_headers, max_size, current_size);
-    sprintf(buffer, "%d\n", elf_header->e_phnum);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, num_program_headers);
+    append_decimal(output, elf_header->e_phnum);
+    append_char(output, '\n');
 
 
     // add the section header string table index to the output string
-    CONCATENATE_DYNAMIC_STRING(output_string, string_table_index, max_size, current_size);
-    sprintf(buffer, "%d\n", elf_header->e_shstrndx);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, string_table_index);
+    append_decimal(output, elf_header->e_shstrndx);
+
+    if(elf_header->e_shstrndx == SHN_XINDEX)
+    {
+        append_string(output, " (");
+        append_decimal(output, get_ELF64_section_string_table_index(elf_header, section_header_table));
+        append_char(output, ')');
+    }
+
+    append_char(output, '\n');
 
     
-    return output_string;
+    return RET_OK;
 }
 
 
 
-void stringify_ELF64_flags(char *flag_buffer, ELF64_Xword_t flags)
+/*
+ * Writes the letters of the flags a section has to flag_buffer,
+ * followed by a NULL, and returns how many letters there are.
+ */
+int stringify_ELF64_flags(char *flag_buffer, ELF64_Xword_t flags)
 {
     int current_index = 0;
 
-    if(flags & SHF_WRITE )
-    {
-        flag_buffer[current_index] = 'W';
-        current_index++;
-    }
+    flag_buffer[current_index] = 'W';
+    current_index += (flags & SHF_WRITE) != 0;
 
-    if((flags & SHF_ALLOC) >> 1)
-    {
-        flag_buffer[current_index] = 'A';
-        current_index++;
-    }
+    flag_buffer[current_index] = 'A';
+    current_index += (flags & SHF_ALLOC) != 0;
 
-    if((flags & SHF_EXECINSTR) >> 2)
-    {
-        flag_buffer[current_index] = 'X';
-        current_index++;
-    }
+    flag_buffer[current_index] = 'X';
+    current_index += (flags & SHF_EXECINSTR) != 0;
 
     flag_buffer[current_index] = '\0';
+
+    return current_index;
 }
 
 
 
-static void stringify_ELF64_section_header(char *buffer, ELF64_Section_Header_t *section_header_table, int section_number, char *section_name, int max_len)
+/*
+ * The longest a row of the section header table can get, apart
+ * from the name and the padding after it: the section number in
+ * brackets, the type, four hex fields of up to 16 digits, the
+ * flags (and the NULL stringify_ELF64_flags writes after them),
+ * three decimal fields, and the tabs and newline between them.
+ * Padding longer than SECTION_HEADER_MAX_PADDING is appended on
+ * its own rather than reserved along with the rest of the row.
+ */
+#define SECTION_HEADER_ROW_MAX_LENGTH   (3 + FORMAT_MAX_DIGITS + 3 + SECTION_TYPE_MAX_LENGTH + 2 + 4*(16 + 1) + 4 + 3*(FORMAT_MAX_DIGITS + 1))
+#define SECTION_HEADER_MAX_PADDING      256
+
+
+
+/*
+ * Appends the row of one section. This is the hot loop of the
+ * section table, so the row is formatted straight into space
+ * reserved for it, with the numbers going through the lookup-table
+ * formatters, rather than appended piece by piece with a check
+ * for room (and a strlen) each time.
+ */
+static void stringify_ELF64_section_header(output_t *output, ELF64_Section_Header_t *section_header, int section_number, string_view_t section_name, int max_len)
 {
+    string_view_t *section_type = &section_types[(section_header->sh_type <= SHT_DYNSYM) ? section_header->sh_type : SHT_DYNSYM + 1];
+    int padding = max_len - (int) section_name.length + 5;
+    char *destination;
 
-    ELF64_Section_Header_t section_header = section_header_table[section_number];
 
-    char buf[256];
-    sprintf(buf, " ");
+    destination = reserve_output(output, 3 + FORMAT_MAX_DIGITS + 3);
 
-    int num_spaces = max_len - strlen(section_name) + 5;
-    for(int i = 1; i < num_spaces; i++)
-    {
-        strcat(buf, " ");
-    }
+    memcpy(destination, "[  ", 3);
+    destination += 3;
+    destination += format_decimal(destination, (uint64_t) section_number);
+    memcpy(destination, "]\t\t", 3);
+    destination += 3;
+
+    output->size = destination - output->buffer;
 
 
-    char flags[16];
+    /*
+     * Pad the name out so that the type column
+     * lines up after the longest name.
+     */
+    append_bytes(output, section_name.string, section_name.length);
 
-    stringify_ELF64_flags(flags, section_header.sh_flags);
+    if(padding > SECTION_HEADER_MAX_PADDING)
+    {
+        append_padding(output, padding);
+        padding = 0;
+    }
 
+    destination = reserve_output(output, ((padding > 0) ? padding : 0) + SECTION_HEADER_ROW_MAX_LENGTH);
 
-    char *section_type = (section_header.sh_type <= SHT_DYNSYM) ? section_types[section_header.sh_type] : "UNKNOWN";
+    if(padding > 0)
+    {
+        memset(destination, ' ', padding);
+        destination += padding;
+    }
 
 
-    sprintf(buffer, "[  %d]\t\t%s%s%s\t\t%016lx\t%08lx\t%016lx\t%016lx\t%s\t%d\t%d\t%lu\n",
-                section_number,
-                section_name,
-                buf,
-                section_type,
-                section_header.sh_addr,
-                section_header.sh_offset,
-                section_header.sh_size,
-                section_header.sh_entsize,
-                flags,
-                section_header.sh_link,
-                section_header.sh_info,
-                section_header.sh_addralign);
+    memcpy(destination, section_type->string, section_type->length);
+    destination += section_type->length;
+    *destination++ = '\t';
+    *destination++ = '\t';
+    destination += format_hex(destination, section_header->sh_addr, 16);
+    *destination++ = '\t';
+    destination += format_hex(destination, section_header->sh_offset, 8);
+    *destination++ = '\t';
+    destination += format_hex(destination, section_header->sh_size, 16);
+    *destination++ = '\t';
+    destination += format_hex(destination, section_header->sh_entsize, 16);
+    *destination++ = '\t';
+    destination += stringify_ELF64_flags(destination, section_header->sh_flags);
+    *destination++ = '\t';
+    destination += format_decimal(destination, section_header->sh_link);
+    *destination++ = '\t';
+    destination += format_decimal(destination, section_header->sh_info);
+    *destination++ = '\t';
+    destination += format_decimal(destination, section_header->sh_addralign);
+    *destination++ = '\n';
+
+    output->size = destination - output->buffer;
 }
 
 
@@ -764,106 +3077,67 @@ static void stringify_ELF64_section_header(char *buffer, ELF64_Section_Header_t
  * of sections in the section header table, as well as the offset to the section header
  * table. The section header names need to be passed in separately since they reside
  * in the string table and this function does not have access to the string table. The
- * section header names list is terminated with a NULL pointer to signify the end of
- * the list.
+ * names are views into the string table, so they are printed by length rather than
+ * relying on NULL termination.
  */
-char *stringify_ELF64_section_header_table(ELF64_Section_Header_t *section_header_table, ELF64_Header_t *file_header, char **section_header_names)
+int stringify_ELF64_section_header_table(output_t *output, ELF64_Section_Header_t *section_header_table, ELF64_Header_t *file_header, section_name_table_t *section_header_names)
 {
 
     /*
      * Defensive check to prevent segmentation
      * fault from NULL pointer being passed.
      */
-    if(section_header_table == NULL || file_header == NULL)
+    if(section_header_table == NULL || file_header == NULL || section_header_names == NULL)
     {
         fprintf(stderr, "NULL pointer passed to stringify_ELF64_section_header_table.\n");
-        return NULL;
+        return RET_NOT_OK;
     }
 
 
-    /*
-     * Temporary buffer to store strings before they
-     * are concatenated onto the output string.
-     */
-    char buffer[1024];
-
-
-    /*
-     * For creating output string need to dynamically allocate
-     * memory. However, the ELF header string is continually
-     * growing, so there is a need to allocate enough memory
-     * and then some for the current size of the string. Thus,
-     * max_size gives the size allocated, and current_size gives
-     * the current size of the string, i.e. current_size is how
-     * much of the buffer of max_size is actually taken up by
-     * the string. When adding new text to the string causes
-     * current_size to become greater than max_size, then the
-     * string must be reallocated.
-     */
-    int max_size = 64, current_size = 0;
-
-
-    // allocate an initial buffer of 64 bytes
-    char *output_string = (char*) malloc(max_size*sizeof(char));
 
 
-    // add the number of section headers and the offset to the output
-    sprintf(buffer, "There are %d section headers, starting at offset 0x%lx\n\n", file_header->e_shnum, file_header->e_shoff);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+// add the number of section headers and the offset to the output
+    append_string(output, "There are ");
+    append_decimal(output, get_ELF64_num_sections(file_header, section_header_table));
+    append_string(output, " section headers, starting at offset 0x");
+    append_hex(output, file_header->e_shoff, 0);
+    append_string(output, "\n\n");
 
 
     // add the title to the output
-    sprintf(buffer, "Section Headers:\n");
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, "Section Headers:\n");
 
 
-    int max_len = 0;
-    // get the length of the section header names
-    for(int i = 0; i < file_header->e_shnum; i++)
-    {        
-        if(strlen(section_header_names[i]) > max_len)
-            max_len = strlen(section_header_names[i]);
-    }
+    // the length of the longest name is cached in the name table
+    int max_len = section_header_names->max_length;
     
     
-    char buf[256];
-    sprintf(buf, " ");
-
-    int num_spaces = max_len - strlen("Name") + 5;
-    for(int i = 1; i < num_spaces; i++)
-    {
-        strcat(buf, " ");
-    }
-
-
     // add the headers of the table to be printed for the section headers
-    sprintf(buffer, "[Number]\tName%sType\t\tAddress\t\t\tOffset\t\tSize\t\t\tEntSize\t\t\tFlags\tLink\tInfo\tAlign\n", buf);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, "[Number]\tName");
+    append_padding(output, max_len - strlen("Name") + 5);
+    append_string(output, "Type\t\tAddress\t\t\tOffset\t\tSize\t\t\tEntSize\t\t\tFlags\tLink\tInfo\tAlign\n");
 
 
-    sprintf(buffer, "-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------\n");
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, "-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------\n");
     
 
     // for each section header add the section header data 
-    for(int i = 0; i < file_header->e_shnum; i++)
+    for(int i = 0; i < section_header_names->num_names; i++)
     {
-        stringify_ELF64_section_header(buffer, section_header_table, i, section_header_names[i], max_len);
-        CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+        stringify_ELF64_section_header(output, &section_header_table[i], i, section_header_names->names[i], max_len);
     }
 
 
-    sprintf(buffer, "\nKey to flags:  (W) Write, (A) alloc, (X) execute.\n");
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    append_string(output, "\nKey to flags:  (W) Write, (A) alloc, (X) execute.\n");
 
 
-    return output_string;
+    return RET_OK;
 }
 
 
 
 
-static void stringify_ELF64_program_header(char *buffer, ELF64_Program_Header_t *program_header_table, int index)
+static void stringify_ELF64_program_header(output_t *output, ELF64_Program_Header_t *program_header_table, int index)
 {
     ELF64_Program_Header_t program_header = program_header_table[index];
 
@@ -877,21 +3151,30 @@ static void stringify_ELF64_program_header(char *buffer, ELF64_Program_Header_t
     char *segment_type = (program_header.p_type <= PT_PHDR) ? segment_types[program_header.p_type] : "UNKNOWN";
 
 
-    sprintf(buffer, "%d\t%s\t\t%016lx\t%016lx\t%016lx\t%016lx\t%016lx\t%d\t%lu\n", 
-                index,
-                segment_type,
-                program_header.p_offset,
-                program_header.p_vaddr,
-                program_header.p_paddr,
-                program_header.p_filesz,
-                program_header.p_memsz,
-                program_header.p_flags,
-                program_header.p_align);
+    append_decimal(output, index);
+    append_char(output, '\t');
+    append_string(output, segment_type);
+    append_string(output, "\t\t");
+    append_hex(output, program_header.p_offset, 16);
+    append_char(output, '\t');
+    append_hex(output, program_header.p_vaddr, 16);
+    append_char(output, '\t');
+    append_hex(output, program_header.p_paddr, 16);
+    append_char(output, '\t');
+    append_hex(output, program_header.p_filesz, 16);
+    append_char(output, '\t');
+    append_hex(output, program_header.p_memsz, 16);
+    append_char(output, '\t');
+    append_decimal(output, program_header.p_flags);
+    append_char(output, '\t');
+    append_decimal(output, program_header.p_align);
+    append_char(output, '\n');
 }
 
 
 
-char *stringify_ELF64_program_header_table(ELF64_Program_Header_t *program_header_table, ELF64_Header_t *file_header, char ***section_to_segment_mapping)
+int stringify_ELF64_program_header_table(output_t *output, ELF64_Program_Header_t *program_header_table, ELF64_Header_t *file_header,
+                                         section_to_segment_mapping_t *section_to_segment_mapping, section_name_table_t *section_names)
 {
 
 
@@ -899,104 +3182,215 @@ char *stringify_ELF64_program_header_table(ELF64_Program_Header_t *program_heade
      * Defensive check to prevent segmentation
      * fault from NULL pointer being passed.
      */
-    if(program_header_table == NULL || file_header == NULL || section_to_segment_mapping == NULL)
+    if(program_header_table == NULL || file_header == NULL || section_to_segment_mapping == NULL || section_names == NULL)
     {
-        fprintf(stderr, "NULL pointer passed to stringify_ELF64_section_header_table.\n");
-        return NULL;
+        fprintf(stderr, "NULL pointer passed to stringify_ELF64_program_header_table.\n");
+        return RET_NOT_OK;
     }
 
 
-    /*
-     * Temporary buffer to store strings before they
-     * are concatenated onto the output string.
-     */
-    char buffer[2048];
 
 
-    /*
-     * For creating output string need to dynamically allocate
-     * memory. However, the ELF header string is continually
-     * growing, so there is a need to allocate enough memory
-     * and then some for the current size of the string. Thus,
-     * max_size gives the size allocated, and current_size gives
-     * the current size of the string, i.e. current_size is how
-     * much of the buffer of max_size is actually taken up by
-     * the string. When adding new text to the string causes
-     * current_size to become greater than max_size, then the
-     * string must be reallocated.
-     */
-    int max_size = 64, current_size = 0;
+    stringify_program_header_preamble(output, file_header->e_type, file_header->e_entry, file_header->e_phnum, file_header->e_phoff);
 
 
-    // allocate an initial buffer of 64 bytes
-    char *output_string = (char*) malloc(max_size*sizeof(char));
+    append_string(output, "Number\tType\t\tOffset\t\t\tVirtAddr\t\tPhysAddr\t\tFileSize\t\tMemSize\t\t\tFlags\tAlign\n");
 
 
+    append_string(output, "-------------------------------------------------------------------------------------------------------------------------------------------------------------\n");
 
-    char *file_types[] = {
-        [ET_NONE] = "NONE",
-        [ET_REL] = "REL (Relocatable File)",
-        [ET_EXEC] = "EXEC (Executable File)",
-        [ET_DYN] = "DYN (Position Independent executable file)",
-        [ET_CORE] = "CORE (Core Dump file)"
-    };
 
+    for(int i = 0; i < file_header->e_phnum; i++)
+    {
+        stringify_ELF64_program_header(output, program_header_table, i);
+    }
 
-    sprintf(buffer, "\nELF file type is %s\n", file_types[file_header->e_type]);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
+    stringify_section_to_segment_mapping(output, file_header->e_phnum, section_to_segment_mapping, section_names);
 
-    sprintf(buffer, "Entry point is 0x%lx\n", file_header->e_entry);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
-    sprintf(buffer, "There are %d section headers starting at offset %lu\n\n", file_header->e_phnum, file_header->e_phoff);
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    return RET_OK;
+}
 
-    sprintf(buffer, "Program Headers:\n");
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
-    sprintf(buffer, "Number\tType\t\tOffset\t\t\tVirtAddr\t\tPhysAddr\t\tFileSize\t\tMemSize\t\t\tFlags\tAlign\n");
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
+/*
+ * Appends the row for one symbol of a symbol table.
+ */
+void stringify_ELF64_symbol(output_t *output, symbol_table_t *symbol_table, uint64_t symbol_number)
+{
+    ELF64_Sym_t *symbol = &((ELF64_Sym_t*) symbol_table->symbols)[symbol_number];
+    string_view_t name = get_string_table_entry(symbol_table->string_table, symbol_table->string_table_size, symbol->st_name);
+
+    append_decimal(output, symbol_number);
+    append_char(output, '\t');
+    append_hex(output, symbol->st_value, 16);
+    append_char(output, '\t');
+    append_decimal(output, symbol->st_size);
+    append_char(output, '\t');
+    append_string(output, get_symbol_type_name(symbol->st_info));
+    append_char(output, '\t');
+    append_string(output, get_symbol_binding_name(symbol->st_info));
+    append_char(output, '\t');
+    append_string(output, symbol_visibilities[ELF_ST_VISIBILITY(symbol->st_other)]);
+    append_char(output, '\t');
+    stringify_symbol_section_index(output, symbol->st_shndx);
+    append_char(output, '\t');
+    append_bytes(output, name.string, name.length);
+    append_char(output, '\n');
+}
 
-    sprintf(buffer, "-------------------------------------------------------------------------------------------------------------------------------------------------------------\n");
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
 
-    for(int i = 0; i < file_header->e_phnum; i++)
+/*
+ * Turns a symbol table into text, one row per symbol. The rows
+ * are written straight to the output as the symbols are read out
+ * of the mapping, and the names are written from views into the
+ * string table, so nothing is allocated however many symbols the
+ * table holds.
+ */
+int stringify_ELF64_symbol_table(output_t *output, symbol_table_t *symbol_table, string_view_t section_name)
+{
+    /*
+     * Defensive check to prevent segmentation
+     * fault from NULL pointer being passed.
+     */
+    if(symbol_table == NULL || symbol_table->symbols == NULL)
     {
-        stringify_ELF64_program_header(buffer, program_header_table, i);
-        CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+        fprintf(stderr, "NULL pointer passed to stringify_ELF64_symbol_table.\n");
+        return RET_NOT_OK;
     }
 
+    stringify_symbol_table_title(output, section_name, symbol_table->num_symbols, 16);
 
-    sprintf(buffer, "\n\nSection to Segment mapping:\n\n");
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
 
-    sprintf(buffer, "Segment Number\tSection Name\n");
-    CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+    for(uint64_t i = 0; i < symbol_table->num_symbols; i++)
+    {
+        stringify_ELF64_symbol(output, symbol_table, i);
+    }
 
 
-    for(int i = 0; i < file_header->e_phnum; i++)
+    return RET_OK;
+}
+
+
+
+
+/*
+ * Turns a relocation section into text, one row per relocation,
+ * joined with the symbol each one refers to. The relocations are
+ * read in batches: first the symbol index and type of every entry
+ * of the batch are split out of r_info in a tight loop over the
+ * mapped entries, which the compiler can vectorize, and then the
+ * rows of the batch are written straight to the output. Nothing
+ * is allocated however many relocations there are.
+ */
+int stringify_ELF64_relocation_table(output_t *output, relocation_table_t *relocation_table, ELF64_Section_Header_t *section_header,
+                                      string_view_t section_name, int machine, section_name_table_t *section_names)
+{
+    uint32_t symbol_indices[RELOCATION_BATCH_SIZE];
+    uint32_t types[RELOCATION_BATCH_SIZE];
+
+    ELF64_Rel_t *rel_entries;
+    ELF64_Rela_t *rela_entries;
+    ELF64_Sym_t *symbols;
+
+
+    /*
+     * Defensive check to prevent segmentation
+     * fault from NULL pointer being passed.
+     */
+    if(relocation_table == NULL || relocation_table->entries == NULL || section_header == NULL)
+    {
+        fprintf(stderr, "NULL pointer passed to stringify_ELF64_relocation_table.\n");
+        return RET_NOT_OK;
+    }
+
+    rel_entries = (ELF64_Rel_t*) relocation_table->entries;
+    rela_entries = (ELF64_Rela_t*) relocation_table->entries;
+    symbols = (ELF64_Sym_t*) relocation_table->symbols.symbols;
+
+
+    stringify_relocation_table_title(output, section_name, section_header->sh_offset, relocation_table->num_entries, relocation_table->has_addends);
+
+
+    for(uint64_t start = 0; start < relocation_table->num_entries; start += RELOCATION_BATCH_SIZE)
     {
-        sprintf(buffer, "%d\t\t", i);
-        CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+        uint64_t count = relocation_table->num_entries - start;
+
+        if(count > RELOCATION_BATCH_SIZE)
+            count = RELOCATION_BATCH_SIZE;
+
 
-        for(int j = 0; section_to_segment_mapping[i][j] != NULL; j++)
+        // decode the whole batch first
+        if(relocation_table->has_addends)
         {
-            CONCATENATE_DYNAMIC_STRING(output_string, section_to_segment_mapping[i][j], max_size, current_size);
-            
-            sprintf(buffer, " ");
-            CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+            for(uint64_t i = 0; i < count; i++)
+            {
+                symbol_indices[i] = ELF64_R_SYM(rela_entries[start + i].r_info);
+                types[i] = ELF64_R_TYPE(rela_entries[start + i].r_info);
+            }
         }
+        else
+        {
+            for(uint64_t i = 0; i < count; i++)
+            {
+                symbol_indices[i] = ELF64_R_SYM(rel_entries[start + i].r_info);
+                types[i] = ELF64_R_TYPE(rel_entries[start + i].r_info);
+            }
+        }
+
 
-        sprintf(buffer, "\n");
-        CONCATENATE_DYNAMIC_STRING(output_string, buffer, max_size, current_size);
+        for(uint64_t i = 0; i < count; i++)
+        {
+            uint64_t offset = relocation_table->has_addends ? rela_entries[start + i].r_offset : rel_entries[start + i].r_offset;
+            uint64_t info = relocation_table->has_addends ? rela_entries[start + i].r_info : rel_entries[start + i].r_info;
+            bool has_symbol = symbol_indices[i] != STN_UNDEF && relocation_table->has_symbols &&
+                              symbol_indices[i] < relocation_table->symbols.num_symbols;
+
+            append_hex(output, offset, 16);
+            append_char(output, '\t');
+            append_hex(output, info, 16);
+            append_char(output, '\t');
+            stringify_relocation_type(output, machine, types[i]);
+            append_char(output, '\t');
+
+            if(has_symbol)
+            {
+                ELF64_Sym_t *symbol = &symbols[symbol_indices[i]];
+                string_view_t name = get_string_table_entry(relocation_table->symbols.string_table,
+                                                            relocation_table->symbols.string_table_size, symbol->st_name);
+
+                // section symbols are nameless, so use the section's name
+                if(name.length == 0 && ELF_ST_TYPE(symbol->st_info) == STT_SECTION &&
+                   section_names != NULL && symbol->st_shndx < section_names->num_names)
+                {
+                    name = section_names->names[symbol->st_shndx];
+                }
+
+                append_hex(output, symbol->st_value, 16);
+                append_char(output, '\t');
+                append_bytes(output, name.string, name.length);
+            }
+            else
+            {
+                append_padding(output, 16);
+                append_char(output, '\t');
+            }
+
+            if(relocation_table->has_addends)
+            {
+                if(has_symbol)
+                    stringify_addend(output, rela_entries[start + i].r_addend);
+                else
+                    append_hex(output, rela_entries[start + i].r_addend, 0);
+            }
+
+            append_char(output, '\n');
+        }
     }
 
 
-    return output_string;
+    return RET_OK;
 }
-
-
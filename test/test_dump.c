@@ -0,0 +1,240 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Tests for the string dump. Each test lays out a buffer by hand
+ * with strings across the boundaries between the chunks of
+ * DUMP_CHUNK_SIZE bytes, and checks that dumping it in chunks on
+ * a pool prints just what dumping it in one go does.
+ */
+
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#include "dump.h"
+#include "output.h"
+#include "pool.h"
+#include "readelf.h"
+
+
+
+static int num_failures = 0;
+
+
+#define CHECK(condition)                                                        \
+    do                                                                          \
+    {                                                                           \
+        if(!(condition))                                                        \
+        {                                                                       \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            num_failures++;                                                     \
+        }                                                                       \
+    } while(0)
+
+
+
+#define TEST_NUM_THREADS        3
+
+static thread_pool_t pool;
+
+
+
+
+/*
+ * Dumps the strings of the buffer in one go and in chunks, both
+ * on the pool and without one, and checks that the text and the
+ * number of lines are the same every time. Returns false if they
+ * are not, so that the caller can say which buffer it was.
+ */
+static bool dumps_match(const unsigned char *data, uint64_t size)
+{
+    output_t expected, chunked, unpooled;
+    uint64_t expected_lines, chunked_lines, unpooled_lines;
+    bool match;
+
+
+    init_memory_output(&expected, MEMORY_OUTPUT_SIZE);
+    init_memory_output(&chunked, MEMORY_OUTPUT_SIZE);
+    init_memory_output(&unpooled, MEMORY_OUTPUT_SIZE);
+
+    expected_lines = string_dump(&expected, data, size);
+    chunked_lines = string_dump_in_parallel(&chunked, data, size, &pool);
+    unpooled_lines = string_dump_in_parallel(&unpooled, data, size, NULL);
+
+    match = chunked_lines == expected_lines && unpooled_lines == expected_lines &&
+            chunked.size == expected.size && unpooled.size == expected.size &&
+            memcmp(chunked.buffer, expected.buffer, expected.size) == 0 &&
+            memcmp(unpooled.buffer, expected.buffer, expected.size) == 0;
+
+    release_output(&expected);
+    release_output(&chunked);
+    release_output(&unpooled);
+
+    return match;
+}
+
+
+
+
+/*
+ * Short runs of bytes that end a string, carry one on or break
+ * one up, each slid across the boundary between the first and
+ * second chunks one byte at a time, so that the boundary falls
+ * before, inside and after every byte of it.
+ */
+typedef struct
+{
+    const char *description;
+    const char *bytes;
+    size_t length;
+
+} test_pattern_t;
+
+
+#define PATTERN(description, bytes)     { description, bytes, sizeof(bytes) - 1 }
+
+static const test_pattern_t test_patterns[] =
+{
+    PATTERN("a string", "abcdefgh\0"),
+    PATTERN("a newline continuation", "abc\ndef\0"),
+    PATTERN("a NUL right after a newline", "abc\n\0def\0"),
+    PATTERN("control bytes after a newline", "abc\n\x01\x02" "def\0"),
+    PATTERN("a control byte in a string", "abc\x01" "def\0"),
+    PATTERN("a high byte in a string", "abc\xff" "def\0"),
+    PATTERN("a string running off the end of a newline", "abc\ndef"),
+};
+
+
+
+
+static void test_patterns_across_boundary(void)
+{
+    uint64_t size = 2*DUMP_CHUNK_SIZE + 64;
+    unsigned char *data = (unsigned char*) malloc(size);
+
+
+    for(size_t p = 0; p < sizeof(test_patterns)/sizeof(test_pattern_t); p++)
+    {
+        const test_pattern_t *pattern = &test_patterns[p];
+
+        for(size_t shift = 0; shift <= pattern->length; shift++)
+        {
+            uint64_t start = DUMP_CHUNK_SIZE - shift;
+
+            // a string ending well before the pattern, and one well after it
+            memset(data, 0, size);
+            memcpy(data + DUMP_CHUNK_SIZE - 32, "before", 6);
+            memcpy(data + DUMP_CHUNK_SIZE + 32, "after", 5);
+            memcpy(data + start, pattern->bytes, pattern->length);
+
+            if(!dumps_match(data, size))
+            {
+                fprintf(stderr, "String dumps differ for %s %zu bytes before a chunk boundary.\n",
+                        pattern->description, shift);
+                num_failures++;
+            }
+        }
+    }
+
+    free(data);
+}
+
+
+
+
+/*
+ * A string longer than a whole chunk, so that a chunk starts and
+ * ends inside it, once with a newline in the middle chunk and
+ * once without. Then a buffer ending in the middle of a string,
+ * and one with no strings at all.
+ */
+static void test_long_strings(void)
+{
+    uint64_t size = 3*DUMP_CHUNK_SIZE + 100;
+    unsigned char *data = (unsigned char*) malloc(size);
+
+
+    memset(data, 0, size);
+    memset(data + DUMP_CHUNK_SIZE - 10, 'x', DUMP_CHUNK_SIZE + 20);
+    CHECK(dumps_match(data, size));
+
+    data[DUMP_CHUNK_SIZE + 100] = '\n';
+    CHECK(dumps_match(data, size));
+
+    memset(data + 2*DUMP_CHUNK_SIZE, 'y', size - 2*DUMP_CHUNK_SIZE);
+    CHECK(dumps_match(data, size));
+
+    memset(data, '\x01', size);
+    CHECK(dumps_match(data, size));
+
+    CHECK(dumps_match(data, 0));
+
+    free(data);
+}
+
+
+
+
+/*
+ * Buffers of bytes picked at random, but mostly printable, with
+ * NULs, newlines, control and high bytes among them, so that
+ * chunk boundaries land on every kind of byte.
+ */
+static void test_random_buffers(void)
+{
+    static const unsigned char specials[] = { '\0', '\0', '\n', '\n', '\x01', '\x1b', '\x7f', '\xff' };
+    uint64_t size = 4*DUMP_CHUNK_SIZE + 17;
+    unsigned char *data = (unsigned char*) malloc(size);
+
+
+    srand(1);
+
+    for(int run = 0; run < 20; run++)
+    {
+        for(uint64_t i = 0; i < size; i++)
+        {
+            int value = rand() % 64;
+
+            data[i] = (value < 8) ? specials[value] : (unsigned char) ('a' + value % 26);
+        }
+
+        if(!dumps_match(data, size))
+        {
+            fprintf(stderr, "String dumps differ for random buffer %d.\n", run);
+            num_failures++;
+        }
+    }
+
+    free(data);
+}
+
+
+
+
+int main(void)
+{
+    if(start_thread_pool(&pool, TEST_NUM_THREADS) != RET_OK)
+    {
+        fprintf(stderr, "Unable to start thread pool.\n");
+        return EXIT_FAILURE;
+    }
+
+    test_patterns_across_boundary();
+    test_long_strings();
+    test_random_buffers();
+
+    join_thread_pool(&pool);
+
+    if(num_failures > 0)
+    {
+        fprintf(stderr, "test_dump: %d checks failed.\n", num_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("test_dump: all checks passed.\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,476 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Tests for looking symbols up. Each test writes a small ELF
+ * file by hand to a temporary file, opens a session over it
+ * and checks what the lookups find in it.
+ */
+
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+#include "elf.h"
+#include "lookup.h"
+#include "readelf.h"
+#include "session.h"
+
+
+
+static int num_failures = 0;
+
+
+#define CHECK(condition)                                                        \
+    do                                                                          \
+    {                                                                           \
+        if(!(condition))                                                        \
+        {                                                                       \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            num_failures++;                                                     \
+        }                                                                       \
+    } while(0)
+
+
+
+
+/*
+ * The dynamic symbols of the test shared object. memcpy comes
+ * in two versions, as it does in glibc: an old one, hidden, at
+ * index 1, and the default one at index 2. old_only has nothing
+ * but a hidden version, and plain is not versioned at all.
+ */
+#define TEST_NUM_SYMBOLS        5
+
+#define TEST_HIDDEN_MEMCPY      1
+#define TEST_DEFAULT_MEMCPY     2
+#define TEST_OLD_ONLY           3
+#define TEST_PLAIN              4
+
+static const char test_dynstr[] = "\0memcpy\0old_only\0plain";
+static const uint32_t test_name_offsets[TEST_NUM_SYMBOLS] = { 0, 1, 1, 8, 17 };
+static const uint16_t test_versions[TEST_NUM_SYMBOLS] = { 0, VERSYM_HIDDEN | 2, 3, VERSYM_HIDDEN | 2, 1 };
+
+
+#define TEST_NUM_DYNAMIC_ENTRIES    6
+
+
+/*
+ * A shared object with no section headers, just a PT_LOAD
+ * segment over the whole file (loaded at address 0, so that
+ * addresses are file offsets) and a PT_DYNAMIC segment. Both
+ * kinds of hash table are laid out; the dynamic section points
+ * at one of them. The GNU table has a single 64-bit Bloom
+ * filter word and a single bucket holding every symbol.
+ */
+typedef struct
+{
+    ELF64_Header_t header;
+    ELF64_Program_Header_t segments[2];
+    ELF64_Dyn_t dynamic[TEST_NUM_DYNAMIC_ENTRIES];
+    ELF64_Sym_t symbols[TEST_NUM_SYMBOLS];
+
+    // header, Bloom filter word, bucket and one chain entry per symbol past the first
+    uint32_t gnu_hash[4 + 2 + 1 + (TEST_NUM_SYMBOLS - 1)];
+
+    // counts, bucket and one chain entry per symbol
+    uint32_t sysv_hash[2 + 1 + TEST_NUM_SYMBOLS];
+
+    uint16_t versions[TEST_NUM_SYMBOLS];
+    char dynstr[sizeof(test_dynstr)];
+
+} shared_object_t;
+
+
+
+
+static uint32_t test_gnu_hash(const char *name)
+{
+    uint32_t hash = 5381;
+
+    for(; *name != '\0'; name++)
+    {
+        hash = hash*33 + (unsigned char) *name;
+    }
+
+    return hash;
+}
+
+
+
+
+/*
+ * Fills in the shared object, with its dynamic section pointing
+ * at the GNU hash table if use_gnu_hash is true and at the SysV
+ * one otherwise.
+ */
+static void build_shared_object(shared_object_t *file, bool use_gnu_hash)
+{
+    uint64_t bloom_word = ~(uint64_t) 0;
+    int num_entries = 0;
+
+
+    memset(file, 0, sizeof(*file));
+
+    file->header.e_ident[0] = ELFMAG0;
+    file->header.e_ident[1] = ELFMAG1;
+    file->header.e_ident[2] = ELFMAG2;
+    file->header.e_ident[3] = ELFMAG3;
+    file->header.e_ident[EI_CLASS] = ELFCLASS64;
+    file->header.e_ident[EI_DATA] = ELFDATA2LSB;
+    file->header.e_ident[EI_VERSION] = EV_CURRENT;
+    file->header.e_type = ET_DYN;
+    file->header.e_machine = EM_X86_64;
+    file->header.e_version = EV_CURRENT;
+    file->header.e_ehsize = sizeof(ELF64_Header_t);
+    file->header.e_phoff = offsetof(shared_object_t, segments);
+    file->header.e_phentsize = sizeof(ELF64_Program_Header_t);
+    file->header.e_phnum = 2;
+
+
+    file->segments[0].p_type = PT_LOAD;
+    file->segments[0].p_filesz = sizeof(*file);
+    file->segments[0].p_memsz = sizeof(*file);
+    file->segments[0].p_align = 8;
+
+    file->segments[1].p_type = PT_DYNAMIC;
+    file->segments[1].p_offset = offsetof(shared_object_t, dynamic);
+    file->segments[1].p_vaddr = offsetof(shared_object_t, dynamic);
+    file->segments[1].p_filesz = sizeof(file->dynamic);
+    file->segments[1].p_memsz = sizeof(file->dynamic);
+    file->segments[1].p_align = 8;
+
+
+    file->dynamic[num_entries].d_tag = use_gnu_hash ? DT_GNU_HASH : DT_HASH;
+    file->dynamic[num_entries++].d_un.d_ptr = use_gnu_hash ? offsetof(shared_object_t, gnu_hash) : offsetof(shared_object_t, sysv_hash);
+    file->dynamic[num_entries].d_tag = DT_SYMTAB;
+    file->dynamic[num_entries++].d_un.d_ptr = offsetof(shared_object_t, symbols);
+    file->dynamic[num_entries].d_tag = DT_STRTAB;
+    file->dynamic[num_entries++].d_un.d_ptr = offsetof(shared_object_t, dynstr);
+    file->dynamic[num_entries].d_tag = DT_STRSZ;
+    file->dynamic[num_entries++].d_un.d_val = sizeof(test_dynstr);
+    file->dynamic[num_entries].d_tag = DT_VERSYM;
+    file->dynamic[num_entries++].d_un.d_ptr = offsetof(shared_object_t, versions);
+    file->dynamic[num_entries].d_tag = DT_NULL;
+
+
+    for(int i = 1; i < TEST_NUM_SYMBOLS; i++)
+    {
+        file->symbols[i].st_name = test_name_offsets[i];
+        file->symbols[i].st_info = ELF_ST_INFO(STB_GLOBAL, STT_FUNC);
+        file->symbols[i].st_shndx = 1;
+        file->symbols[i].st_value = 0x1000 * i;
+        file->symbols[i].st_size = 16;
+    }
+
+
+    // one bucket, whose chain runs from symbol 1 to the last
+    file->gnu_hash[0] = 1;
+    file->gnu_hash[1] = 1;
+    file->gnu_hash[2] = 1;
+    file->gnu_hash[3] = 6;
+    memcpy(&file->gnu_hash[4], &bloom_word, sizeof(bloom_word));
+    file->gnu_hash[6] = 1;
+
+    for(int i = 1; i < TEST_NUM_SYMBOLS; i++)
+    {
+        uint32_t hash = test_gnu_hash(test_dynstr + test_name_offsets[i]) & ~1u;
+
+        file->gnu_hash[7 + i - 1] = (i == TEST_NUM_SYMBOLS - 1) ? (hash | 1) : hash;
+    }
+
+
+    // the same chain, through the SysV table
+    file->sysv_hash[0] = 1;
+    file->sysv_hash[1] = TEST_NUM_SYMBOLS;
+    file->sysv_hash[2] = 1;
+
+    for(int i = 1; i < TEST_NUM_SYMBOLS; i++)
+    {
+        file->sysv_hash[3 + i] = (i == TEST_NUM_SYMBOLS - 1) ? STN_UNDEF : i + 1;
+    }
+
+
+    memcpy(file->versions, test_versions, sizeof(test_versions));
+    memcpy(file->dynstr, test_dynstr, sizeof(test_dynstr));
+}
+
+
+
+
+/*
+ * The symbols of the test executable. Two global aliases start
+ * at 0x100, the shorter one first; two more at 0x200 are the
+ * same in every way but their index.
+ */
+#define TEST_OBJECT_NUM_SYMBOLS     5
+#define TEST_OBJECT_NUM_SECTIONS    4
+
+static const char test_strtab[] = "\0short_alias\0long_alias\0first_alias\0second_alias";
+static const uint32_t test_alias_names[TEST_OBJECT_NUM_SYMBOLS] = { 0, 1, 13, 24, 36 };
+static const char test_shstrtab[] = "\0.text\0.symtab\0.strtab";
+
+
+/*
+ * An executable with section headers (a null section, .text,
+ * .symtab and .strtab) and nothing else of note.
+ */
+typedef struct
+{
+    ELF64_Header_t header;
+    ELF64_Section_Header_t sections[TEST_OBJECT_NUM_SECTIONS + 1];
+    ELF64_Sym_t symbols[TEST_OBJECT_NUM_SYMBOLS];
+    char strtab[sizeof(test_strtab)];
+    char shstrtab[sizeof(test_shstrtab)];
+
+} executable_t;
+
+
+
+
+static void add_test_symbol(executable_t *file, int number, uint32_t name, uint64_t value, uint64_t size)
+{
+    file->symbols[number].st_name = name;
+    file->symbols[number].st_info = ELF_ST_INFO(STB_GLOBAL, STT_FUNC);
+    file->symbols[number].st_shndx = 1;
+    file->symbols[number].st_value = value;
+    file->symbols[number].st_size = size;
+}
+
+
+
+
+static void build_executable(executable_t *file)
+{
+    memset(file, 0, sizeof(*file));
+
+    file->header.e_ident[0] = ELFMAG0;
+    file->header.e_ident[1] = ELFMAG1;
+    file->header.e_ident[2] = ELFMAG2;
+    file->header.e_ident[3] = ELFMAG3;
+    file->header.e_ident[EI_CLASS] = ELFCLASS64;
+    file->header.e_ident[EI_DATA] = ELFDATA2LSB;
+    file->header.e_ident[EI_VERSION] = EV_CURRENT;
+    file->header.e_type = ET_EXEC;
+    file->header.e_machine = EM_X86_64;
+    file->header.e_version = EV_CURRENT;
+    file->header.e_ehsize = sizeof(ELF64_Header_t);
+    file->header.e_shoff = offsetof(executable_t, sections);
+    file->header.e_shentsize = sizeof(ELF64_Section_Header_t);
+    file->header.e_shnum = TEST_OBJECT_NUM_SECTIONS + 1;
+    file->header.e_shstrndx = TEST_OBJECT_NUM_SECTIONS;
+
+
+    file->sections[1].sh_name = 1;
+    file->sections[1].sh_type = SHT_NOBITS;
+    file->sections[1].sh_addr = 0x100;
+    file->sections[1].sh_size = 0x200;
+    file->sections[1].sh_addralign = 16;
+
+    file->sections[2].sh_name = 7;
+    file->sections[2].sh_type = SHT_SYMTAB;
+    file->sections[2].sh_offset = offsetof(executable_t, symbols);
+    file->sections[2].sh_size = sizeof(file->symbols);
+    file->sections[2].sh_link = 3;
+    file->sections[2].sh_info = 1;
+    file->sections[2].sh_entsize = sizeof(ELF64_Sym_t);
+    file->sections[2].sh_addralign = 8;
+
+    file->sections[3].sh_name = 15;
+    file->sections[3].sh_type = SHT_STRTAB;
+    file->sections[3].sh_offset = offsetof(executable_t, strtab);
+    file->sections[3].sh_size = sizeof(test_strtab);
+    file->sections[3].sh_addralign = 1;
+
+    // .shstrtab itself goes unnamed
+    file->sections[4].sh_type = SHT_STRTAB;
+    file->sections[4].sh_offset = offsetof(executable_t, shstrtab);
+    file->sections[4].sh_size = sizeof(test_shstrtab);
+    file->sections[4].sh_addralign = 1;
+
+
+    add_test_symbol(file, 1, test_alias_names[1], 0x100, 8);
+    add_test_symbol(file, 2, test_alias_names[2], 0x100, 32);
+    add_test_symbol(file, 3, test_alias_names[3], 0x200, 16);
+    add_test_symbol(file, 4, test_alias_names[4], 0x200, 16);
+
+    memcpy(file->strtab, test_strtab, sizeof(test_strtab));
+    memcpy(file->shstrtab, test_shstrtab, sizeof(test_shstrtab));
+}
+
+
+
+
+/*
+ * Writes size bytes out to a new temporary file, whose name is
+ * written into filename. Returns RET_NOT_OK if the file could not
+ * be written.
+ */
+static int write_test_file(const void *contents, size_t size, char *filename)
+{
+    int file_descriptor;
+
+    strcpy(filename, "/tmp/test_lookup_XXXXXX");
+
+    if((file_descriptor = mkstemp(filename)) < 0)
+    {
+        perror("mkstemp");
+        return RET_NOT_OK;
+    }
+
+    if(write(file_descriptor, contents, size) != (ssize_t) size)
+    {
+        perror("write");
+        close(file_descriptor);
+        unlink(filename);
+        return RET_NOT_OK;
+    }
+
+    close(file_descriptor);
+
+    return RET_OK;
+}
+
+
+
+
+/*
+ * Looks up a versioned name through either hash table. The
+ * default version must be found however the chain is ordered,
+ * and a name whose only versions are hidden not found at all,
+ * as the dynamic linker would resolve them.
+ */
+static void test_versioned_lookup(bool use_gnu_hash)
+{
+    shared_object_t file;
+    char filename[32];
+    elf_session_t session;
+    symbol_index_t *index;
+
+
+    build_shared_object(&file, use_gnu_hash);
+
+    if(write_test_file(&file, sizeof(file), filename) != RET_OK)
+    {
+        num_failures++;
+        return;
+    }
+
+    if(open_session(&session, filename) != RET_OK)
+    {
+        fprintf(stderr, "Unable to open session over %s.\n", filename);
+        unlink(filename);
+        num_failures++;
+        return;
+    }
+
+
+    index = get_session_symbol_index(&session);
+    CHECK(index != NULL);
+
+    if(index != NULL)
+    {
+        CHECK(index->method == (use_gnu_hash ? LOOKUP_GNU_HASH : LOOKUP_SYSV_HASH));
+        CHECK(index->versions != NULL);
+
+        CHECK(find_symbol(index, "memcpy", 6) == TEST_DEFAULT_MEMCPY);
+        CHECK(find_symbol(index, "old_only", 8) == -1);
+        CHECK(find_symbol(index, "plain", 5) == TEST_PLAIN);
+        CHECK(find_symbol(index, "missing", 7) == -1);
+    }
+
+
+    close_session(&session);
+    unlink(filename);
+}
+
+
+
+
+static bool range_name_is(address_index_t *index, int64_t range, const char *name)
+{
+    string_view_t *range_name;
+
+    if(range < 0)
+    {
+        return false;
+    }
+
+    range_name = &index->names[index->ranges->payloads[range]];
+
+    return range_name->length == strlen(name) && memcmp(range_name->string, name, strlen(name)) == 0;
+}
+
+
+
+
+/*
+ * Of aliases with the same binding at the same address, the
+ * address index must keep the longest and, of those as long as
+ * each other, the one with the lowest index, whatever order
+ * qsort leaves them in.
+ */
+static void test_address_aliases(void)
+{
+    executable_t file;
+    char filename[32];
+    elf_session_t session;
+    address_index_t *index;
+
+
+    build_executable(&file);
+
+    if(write_test_file(&file, sizeof(file), filename) != RET_OK)
+    {
+        num_failures++;
+        return;
+    }
+
+    if(open_session(&session, filename) != RET_OK)
+    {
+        fprintf(stderr, "Unable to open session over %s.\n", filename);
+        unlink(filename);
+        num_failures++;
+        return;
+    }
+
+
+    index = get_session_address_index(&session);
+    CHECK(index != NULL);
+
+    if(index != NULL)
+    {
+        CHECK(index->ranges->num_ranges == 2);
+        CHECK(range_name_is(index, find_range(index->ranges, 0x100), "long_alias"));
+        CHECK(range_name_is(index, find_range(index->ranges, 0x11f), "long_alias"));
+        CHECK(find_range(index->ranges, 0x120) == -1);
+        CHECK(range_name_is(index, find_range(index->ranges, 0x208), "first_alias"));
+    }
+
+
+    close_session(&session);
+    unlink(filename);
+}
+
+
+
+
+int main(void)
+{
+    test_versioned_lookup(true);
+    test_versioned_lookup(false);
+    test_address_aliases();
+
+    if(num_failures > 0)
+    {
+        fprintf(stderr, "test_lookup: %d checks failed.\n", num_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("test_lookup: all checks passed.\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,415 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Tests for looking names up in .debug_names. Each test lays
+ * out a .debug_names section and a .debug_str section by hand
+ * in memory and checks which DIEs the lookups lead to.
+ */
+
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#include "dwarf.h"
+#include "names.h"
+#include "readelf.h"
+
+
+
+static int num_failures = 0;
+
+
+#define CHECK(condition)                                                        \
+    do                                                                          \
+    {                                                                           \
+        if(!(condition))                                                        \
+        {                                                                       \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            num_failures++;                                                     \
+        }                                                                       \
+    } while(0)
+
+
+
+
+/*
+ * A section being laid out, and the values written to it, which
+ * are all little-endian.
+ */
+#define TEST_SECTION_SIZE       1024
+
+typedef struct
+{
+    unsigned char data[TEST_SECTION_SIZE];
+    uint64_t size;
+
+} test_section_t;
+
+
+
+
+static void set_value(test_section_t *section, uint64_t offset, uint64_t value, int size)
+{
+    for(int i = 0; i < size; i++)
+    {
+        section->data[offset + i] = (unsigned char) (value >> 8*i);
+    }
+}
+
+
+
+
+static void put_value(test_section_t *section, uint64_t value, int size)
+{
+    set_value(section, section->size, value, size);
+    section->size += size;
+}
+
+
+
+
+static void put_uleb128(test_section_t *section, uint64_t value)
+{
+    do
+    {
+        unsigned char byte = value & 0x7f;
+
+        value >>= 7;
+        section->data[section->size++] = (value != 0) ? (byte | 0x80) : byte;
+
+    } while(value != 0);
+}
+
+
+
+
+static void put_bytes(test_section_t *section, const void *bytes, uint64_t size)
+{
+    memcpy(section->data + section->size, bytes, size);
+    section->size += size;
+}
+
+
+
+
+/*
+ * Adds a string to .debug_str and returns its offset there.
+ */
+static uint64_t put_string(test_section_t *str, const char *string)
+{
+    uint64_t offset = str->size;
+
+    put_bytes(str, string, strlen(string) + 1);
+
+    return offset;
+}
+
+
+
+
+/*
+ * The names of a test index and their entries. An entry with a
+ * compilation unit uses abbreviation 1 (a subprogram with
+ * DW_IDX_compile_unit and DW_IDX_die_offset), and one without
+ * uses abbreviation 2 (a variable with only DW_IDX_die_offset).
+ */
+#define TEST_MAX_ENTRIES        3
+#define TEST_MAX_NAMES          8
+
+#define NO_UNIT                 -1
+
+typedef struct
+{
+    int compile_unit;
+    uint32_t die_offset;
+
+} test_entry_t;
+
+
+typedef struct
+{
+    const char *name;
+    int num_entries;
+    test_entry_t entries[TEST_MAX_ENTRIES];
+
+} test_name_t;
+
+
+
+
+/*
+ * The hash of .debug_names, worked out here rather than with
+ * hash_debug_name so that the test does not trust what it tests.
+ */
+static uint32_t test_hash(const char *name)
+{
+    uint32_t hash = 5381;
+
+    for(; *name != '\0'; name++)
+    {
+        unsigned char c = (unsigned char) *name;
+
+        if(c >= 'A' && c <= 'Z')
+            c += 'a' - 'A';
+
+        hash = hash*33 + c;
+    }
+
+    return hash;
+}
+
+
+
+
+/*
+ * Appends a DWARF32 name index over the names to .debug_names,
+ * with their strings added to .debug_str. With buckets, the
+ * names are laid out grouped by bucket, as the hash table needs
+ * them; without, in the order given.
+ */
+static void put_names_table(test_section_t *section, test_section_t *str, const uint32_t *unit_offsets, uint32_t num_units,
+                            uint32_t bucket_count, const test_name_t *names, uint32_t num_names)
+{
+    const test_name_t *ordered[TEST_MAX_NAMES];
+    uint32_t buckets[TEST_MAX_NAMES] = {0};
+    uint32_t entry_offsets[TEST_MAX_NAMES];
+    test_section_t abbrevs = {{0}, 0};
+    test_section_t pool = {{0}, 0};
+    uint64_t length_offset;
+    uint32_t num_ordered = 0;
+
+
+    for(uint32_t bucket = 0; bucket < ((bucket_count > 0) ? bucket_count : 1); bucket++)
+    {
+        for(uint32_t i = 0; i < num_names; i++)
+        {
+            if(bucket_count > 0 && test_hash(names[i].name) % bucket_count != bucket)
+                continue;
+
+            if(bucket_count > 0 && buckets[bucket] == 0)
+                buckets[bucket] = num_ordered + 1;
+
+            ordered[num_ordered++] = &names[i];
+        }
+    }
+
+
+    put_uleb128(&abbrevs, 1);
+    put_uleb128(&abbrevs, DW_TAG_subprogram);
+    put_uleb128(&abbrevs, DW_IDX_compile_unit);
+    put_uleb128(&abbrevs, DW_FORM_data1);
+    put_uleb128(&abbrevs, DW_IDX_die_offset);
+    put_uleb128(&abbrevs, DW_FORM_ref4);
+    put_uleb128(&abbrevs, 0);
+    put_uleb128(&abbrevs, 0);
+
+    put_uleb128(&abbrevs, 2);
+    put_uleb128(&abbrevs, DW_TAG_variable);
+    put_uleb128(&abbrevs, DW_IDX_die_offset);
+    put_uleb128(&abbrevs, DW_FORM_ref4);
+    put_uleb128(&abbrevs, 0);
+    put_uleb128(&abbrevs, 0);
+
+    put_uleb128(&abbrevs, 0);
+
+
+    for(uint32_t i = 0; i < num_ordered; i++)
+    {
+        entry_offsets[i] = (uint32_t) pool.size;
+
+        for(int j = 0; j < ordered[i]->num_entries; j++)
+        {
+            const test_entry_t *entry = &ordered[i]->entries[j];
+
+            put_uleb128(&pool, (entry->compile_unit == NO_UNIT) ? 2 : 1);
+
+            if(entry->compile_unit != NO_UNIT)
+                put_value(&pool, (uint64_t) entry->compile_unit, 1);
+
+            put_value(&pool, entry->die_offset, 4);
+        }
+
+        put_uleb128(&pool, 0);
+    }
+
+
+    length_offset = section->size;
+    put_value(section, 0, 4);
+    put_value(section, 5, 2);
+    put_value(section, 0, 2);
+    put_value(section, num_units, 4);
+    put_value(section, 0, 4);
+    put_value(section, 0, 4);
+    put_value(section, bucket_count, 4);
+    put_value(section, num_ordered, 4);
+    put_value(section, abbrevs.size, 4);
+    put_value(section, 0, 4);
+
+    for(uint32_t i = 0; i < num_units; i++)
+        put_value(section, unit_offsets[i], 4);
+
+    for(uint32_t i = 0; i < bucket_count; i++)
+        put_value(section, buckets[i], 4);
+
+    for(uint32_t i = 0; i < num_ordered && bucket_count > 0; i++)
+        put_value(section, test_hash(ordered[i]->name), 4);
+
+    for(uint32_t i = 0; i < num_ordered; i++)
+        put_value(section, put_string(str, ordered[i]->name), 4);
+
+    for(uint32_t i = 0; i < num_ordered; i++)
+        put_value(section, entry_offsets[i], 4);
+
+    put_bytes(section, abbrevs.data, abbrevs.size);
+    put_bytes(section, pool.data, pool.size);
+
+
+    // the length does not count the length field itself
+    set_value(section, length_offset, section->size - length_offset - 4, 4);
+}
+
+
+
+
+/*
+ * Looks a name up in a name index and reads every entry of it,
+ * writing the DIE offset of each to die_offsets, or UINT64_MAX
+ * for an entry that does not lead to a DIE. Returns the number
+ * of entries, or -1 if the index does not have the name.
+ */
+static int find_name_dies(names_table_t *table, test_section_t *str, const char *name, uint64_t *die_offsets)
+{
+    int64_t number = find_debug_name(table, str->data, str->size, name, strlen(name));
+    const unsigned char *position;
+    names_entry_t entry;
+    int num_entries = 0;
+
+
+    if(number < 0)
+    {
+        return -1;
+    }
+
+    position = table->entry_pool + get_names_table_value(table, table->entry_offsets, number - 1, table->offset_size);
+
+    while(read_names_entry(table, &position, &entry) && entry.abbrev != NULL && num_entries < TEST_MAX_ENTRIES)
+    {
+        if(!get_names_entry_die(table, &entry, &die_offsets[num_entries]))
+            die_offsets[num_entries] = UINT64_MAX;
+
+        num_entries++;
+    }
+
+    return num_entries;
+}
+
+
+
+
+/*
+ * Two name indexes, as a linker that does not merge them leaves
+ * them. The first has two compilation units and two buckets.
+ * alpha and Alpha are different names with the same hash, since
+ * the hash ignores case, so only the strings tell them apart;
+ * alpha has an entry in each unit, and beta has an entry with no
+ * DW_IDX_compile_unit, which cannot be placed with two units to
+ * choose from. The second has no buckets and one unit, which
+ * entries without DW_IDX_compile_unit belong to.
+ */
+static const uint32_t bucketed_units[] = { 0x0, 0x100 };
+
+static const test_name_t bucketed_names[] =
+{
+    { "alpha", 2, {{0, 0x20}, {1, 0x30}} },
+    { "Alpha", 1, {{1, 0x40}} },
+    { "beta", 1, {{NO_UNIT, 0x50}} },
+    { "gamma", 1, {{0, 0x60}} },
+};
+
+static const uint32_t unbucketed_units[] = { 0x200 };
+
+static const test_name_t unbucketed_names[] =
+{
+    { "delta", 1, {{NO_UNIT, 0x18}} },
+    { "epsilon", 2, {{0, 0x28}, {NO_UNIT, 0x30}} },
+};
+
+
+
+
+static void test_name_lookup(void)
+{
+    test_section_t section = {{0}, 0};
+    test_section_t str = {{0}, 0};
+    names_index_t *index;
+    uint64_t dies[TEST_MAX_ENTRIES];
+
+
+    put_string(&str, "");
+    put_names_table(&section, &str, bucketed_units, 2, 2, bucketed_names, sizeof(bucketed_names)/sizeof(test_name_t));
+    put_names_table(&section, &str, unbucketed_units, 1, 0, unbucketed_names, sizeof(unbucketed_names)/sizeof(test_name_t));
+
+    CHECK(test_hash("alpha") == test_hash("Alpha"));
+
+
+    index = build_names_index(section.data, section.size);
+    CHECK(index->num_tables == 2);
+
+    if(index->num_tables == 2)
+    {
+        names_table_t *bucketed = &index->tables[0];
+        names_table_t *unbucketed = &index->tables[1];
+
+        CHECK(bucketed->bucket_count == 2 && bucketed->name_count == 4);
+        CHECK(unbucketed->bucket_count == 0 && unbucketed->name_count == 2);
+
+
+        CHECK(find_name_dies(bucketed, &str, "alpha", dies) == 2);
+        CHECK(dies[0] == 0x20 && dies[1] == 0x130);
+
+        CHECK(find_name_dies(bucketed, &str, "Alpha", dies) == 1);
+        CHECK(dies[0] == 0x140);
+
+        CHECK(find_name_dies(bucketed, &str, "gamma", dies) == 1);
+        CHECK(dies[0] == 0x60);
+
+        CHECK(find_name_dies(bucketed, &str, "beta", dies) == 1);
+        CHECK(dies[0] == UINT64_MAX);
+
+        // the same hash as alpha, but not a name of the index
+        CHECK(find_name_dies(bucketed, &str, "ALPHA", dies) == -1);
+        CHECK(find_name_dies(bucketed, &str, "delta", dies) == -1);
+
+
+        CHECK(find_name_dies(unbucketed, &str, "delta", dies) == 1);
+        CHECK(dies[0] == 0x218);
+
+        CHECK(find_name_dies(unbucketed, &str, "epsilon", dies) == 2);
+        CHECK(dies[0] == 0x228 && dies[1] == 0x230);
+
+        CHECK(find_name_dies(unbucketed, &str, "alpha", dies) == -1);
+    }
+
+    release_names_index(index);
+}
+
+
+
+
+int main(void)
+{
+    test_name_lookup();
+
+    if(num_failures > 0)
+    {
+        fprintf(stderr, "test_names: %d checks failed.\n", num_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("test_names: all checks passed.\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,447 @@
+/* Author: Joshua Jacobs-Rebhun
+ * Date: October 16, 2026
+ *
+ *
+ * Tests for reading the ELF file. Each test writes a small
+ * ELF file by hand to a temporary file, opens a session over
+ * it and checks what the readers make of it.
+ */
+
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+#include "elf.h"
+#include "output.h"
+#include "readelf.h"
+#include "session.h"
+#include "stringify.h"
+
+
+
+static int num_failures = 0;
+
+
+#define CHECK(condition)                                                        \
+    do                                                                          \
+    {                                                                           \
+        if(!(condition))                                                        \
+        {                                                                       \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            num_failures++;                                                     \
+        }                                                                       \
+    } while(0)
+
+
+
+
+/*
+ * The layout of the test files: the ELF header, then the
+ * section header table, then the section header string
+ * table, then the contents of .data.
+ */
+#define TEST_NUM_SECTIONS       4
+#define TEST_SHOFF              sizeof(ELF64_Header_t)
+#define TEST_SHSTRTAB_OFFSET    (TEST_SHOFF + TEST_NUM_SECTIONS*sizeof(ELF64_Section_Header_t))
+
+static const char test_shstrtab[] = "\0.data\0.shstrtab\0.bss";
+static const char test_data[] = "data";
+
+
+typedef struct
+{
+    ELF64_Header_t header;
+    ELF64_Section_Header_t sections[TEST_NUM_SECTIONS];
+    char shstrtab[sizeof(test_shstrtab)];
+    char data[sizeof(test_data)];
+
+} test_file_t;
+
+
+
+
+/*
+ * Fills in a relocatable ELF64 file with a null section, .data,
+ * .shstrtab and .bss, in that order. When extended is true the
+ * file uses extended section numbering: e_shnum is 0 and
+ * e_shstrndx is SHN_XINDEX, and the real values are kept in
+ * section 0, as a file with too many sections would have them.
+ */
+static void build_test_file(test_file_t *file, bool extended)
+{
+    memset(file, 0, sizeof(*file));
+
+    file->header.e_ident[0] = ELFMAG0;
+    file->header.e_ident[1] = ELFMAG1;
+    file->header.e_ident[2] = ELFMAG2;
+    file->header.e_ident[3] = ELFMAG3;
+    file->header.e_ident[EI_CLASS] = ELFCLASS64;
+    file->header.e_ident[EI_DATA] = ELFDATA2LSB;
+    file->header.e_ident[EI_VERSION] = EV_CURRENT;
+    file->header.e_type = ET_REL;
+    file->header.e_version = EV_CURRENT;
+    file->header.e_ehsize = sizeof(ELF64_Header_t);
+    file->header.e_shoff = TEST_SHOFF;
+    file->header.e_shentsize = sizeof(ELF64_Section_Header_t);
+
+    if(extended)
+    {
+        file->header.e_shnum = 0;
+        file->header.e_shstrndx = SHN_XINDEX;
+        file->sections[0].sh_size = TEST_NUM_SECTIONS;
+        file->sections[0].sh_link = 2;
+    }
+    else
+    {
+        file->header.e_shnum = TEST_NUM_SECTIONS;
+        file->header.e_shstrndx = 2;
+    }
+
+
+    file->sections[1].sh_name = 1;
+    file->sections[1].sh_type = SHT_PROGBITS;
+    file->sections[1].sh_offset = offsetof(test_file_t, data);
+    file->sections[1].sh_size = sizeof(test_data) - 1;
+    file->sections[1].sh_addralign = 1;
+
+    file->sections[2].sh_name = 7;
+    file->sections[2].sh_type = SHT_STRTAB;
+    file->sections[2].sh_offset = TEST_SHSTRTAB_OFFSET;
+    file->sections[2].sh_size = sizeof(test_shstrtab);
+    file->sections[2].sh_addralign = 1;
+
+    file->sections[3].sh_name = 17;
+    file->sections[3].sh_type = SHT_NOBITS;
+    file->sections[3].sh_size = 16;
+    file->sections[3].sh_addralign = 1;
+
+    memcpy(file->shstrtab, test_shstrtab, sizeof(test_shstrtab));
+    memcpy(file->data, test_data, sizeof(test_data));
+}
+
+
+
+
+/*
+ * Writes size bytes out to a new temporary file, whose name
+ * is written into filename. Returns RET_NOT_OK if the file
+ * could not be written.
+ */
+static int write_test_file(const void *contents, size_t size, char *filename)
+{
+    int file_descriptor;
+
+    strcpy(filename, "/tmp/test_readelf_XXXXXX");
+
+    if((file_descriptor = mkstemp(filename)) < 0)
+    {
+        perror("mkstemp");
+        return RET_NOT_OK;
+    }
+
+    if(write(file_descriptor, contents, size) != (ssize_t) size)
+    {
+        perror("write");
+        close(file_descriptor);
+        unlink(filename);
+        return RET_NOT_OK;
+    }
+
+    close(file_descriptor);
+
+    return RET_OK;
+}
+
+
+
+
+static bool name_is(section_name_table_t *names, int index, const char *name)
+{
+    return names->names[index].length == strlen(name) &&
+           memcmp(names->names[index].string, name, strlen(name)) == 0;
+}
+
+
+
+
+/*
+ * Opens a session over the test file and checks that the
+ * section count, the section header string table index and
+ * the section names all come out the same whichever way the
+ * file stores them.
+ */
+static void test_section_numbering(bool extended)
+{
+    test_file_t file;
+    char filename[32];
+    elf_session_t session;
+    section_name_table_t *names;
+    unsigned char *contents;
+    uint64_t size, address;
+
+
+    build_test_file(&file, extended);
+
+    if(write_test_file(&file, sizeof(file), filename) != RET_OK)
+    {
+        num_failures++;
+        return;
+    }
+
+    if(open_session(&session, filename) != RET_OK)
+    {
+        fprintf(stderr, "Unable to open session over %s.\n", filename);
+        unlink(filename);
+        num_failures++;
+        return;
+    }
+
+
+    CHECK(get_session_ELF64_section_header_table(&session) != NULL);
+    CHECK(get_session_num_sections(&session) == TEST_NUM_SECTIONS);
+    CHECK(get_session_section_string_table_index(&session) == 2);
+
+
+    names = get_session_section_names(&session);
+    CHECK(names != NULL);
+
+    if(names != NULL)
+    {
+        CHECK(names->num_names == TEST_NUM_SECTIONS);
+        CHECK(name_is(names, 0, ""));
+        CHECK(name_is(names, 1, ".data"));
+        CHECK(name_is(names, 2, ".shstrtab"));
+        CHECK(name_is(names, 3, ".bss"));
+    }
+
+
+    contents = get_session_named_section(&session, ".data", &size, &address);
+    CHECK(contents != NULL && size == 4 && memcmp(contents, "data", 4) == 0);
+
+
+    close_session(&session);
+    unlink(filename);
+}
+
+
+
+
+/*
+ * A count in section 0 that would run the section header
+ * table past the end of the file must be rejected rather
+ * than trusted.
+ */
+static void test_section_count_out_of_range(void)
+{
+    test_file_t file;
+    char filename[32];
+    elf_session_t session;
+
+
+    build_test_file(&file, true);
+    file.sections[0].sh_size = 0xffffffff;
+
+    if(write_test_file(&file, sizeof(file), filename) != RET_OK)
+    {
+        num_failures++;
+        return;
+    }
+
+    if(open_session(&session, filename) != RET_OK)
+    {
+        fprintf(stderr, "Unable to open session over %s.\n", filename);
+        unlink(filename);
+        num_failures++;
+        return;
+    }
+
+    CHECK(get_session_ELF64_section_header_table(&session) == NULL);
+    CHECK(get_session_num_sections(&session) == 0);
+    CHECK(get_session_section_names(&session) == NULL);
+
+    close_session(&session);
+    unlink(filename);
+}
+
+
+
+
+/*
+ * A 32-bit executable with two segments, one loading .text from
+ * the file and one holding nothing but .bss, whose place in the
+ * segment is by address rather than by file offset.
+ */
+#define TEST32_NUM_SECTIONS     4
+#define TEST32_TEXT_ADDRESS     0x8049000
+#define TEST32_BSS_ADDRESS      0x804a000
+
+static const char test32_shstrtab[] = "\0.text\0.bss\0.shstrtab";
+
+
+typedef struct
+{
+    ELF32_Header_t header;
+    ELF32_Program_Header_t segments[2];
+    ELF32_Section_Header_t sections[TEST32_NUM_SECTIONS];
+    char shstrtab[sizeof(test32_shstrtab)];
+    unsigned char text[16];
+
+} test32_file_t;
+
+
+
+
+static void build_test32_file(test32_file_t *file)
+{
+    memset(file, 0, sizeof(*file));
+
+    file->header.e_ident[0] = ELFMAG0;
+    file->header.e_ident[1] = ELFMAG1;
+    file->header.e_ident[2] = ELFMAG2;
+    file->header.e_ident[3] = ELFMAG3;
+    file->header.e_ident[EI_CLASS] = ELFCLASS32;
+    file->header.e_ident[EI_DATA] = ELFDATA2LSB;
+    file->header.e_ident[EI_VERSION] = EV_CURRENT;
+    file->header.e_type = ET_EXEC;
+    file->header.e_machine = EM_386;
+    file->header.e_version = EV_CURRENT;
+    file->header.e_entry = TEST32_TEXT_ADDRESS;
+    file->header.e_phoff = offsetof(test32_file_t, segments);
+    file->header.e_shoff = offsetof(test32_file_t, sections);
+    file->header.e_ehsize = sizeof(ELF32_Header_t);
+    file->header.e_phentsize = sizeof(ELF32_Program_Header_t);
+    file->header.e_phnum = 2;
+    file->header.e_shentsize = sizeof(ELF32_Section_Header_t);
+    file->header.e_shnum = TEST32_NUM_SECTIONS;
+    file->header.e_shstrndx = 3;
+
+
+    file->segments[0].p_type = PT_LOAD;
+    file->segments[0].p_offset = offsetof(test32_file_t, text);
+    file->segments[0].p_vaddr = TEST32_TEXT_ADDRESS;
+    file->segments[0].p_paddr = TEST32_TEXT_ADDRESS;
+    file->segments[0].p_filesz = sizeof(file->text);
+    file->segments[0].p_memsz = sizeof(file->text);
+    file->segments[0].p_flags = 0x5;     // read and execute
+    file->segments[0].p_align = 4;
+
+    file->segments[1].p_type = PT_LOAD;
+    file->segments[1].p_offset = sizeof(*file);
+    file->segments[1].p_vaddr = TEST32_BSS_ADDRESS;
+    file->segments[1].p_paddr = TEST32_BSS_ADDRESS;
+    file->segments[1].p_memsz = 32;
+    file->segments[1].p_flags = 0x6;     // read and write
+    file->segments[1].p_align = 4;
+
+
+    file->sections[1].sh_name = 1;
+    file->sections[1].sh_type = SHT_PROGBITS;
+    file->sections[1].sh_flags = SHF_ALLOC | SHF_EXECINSTR;
+    file->sections[1].sh_addr = TEST32_TEXT_ADDRESS;
+    file->sections[1].sh_offset = offsetof(test32_file_t, text);
+    file->sections[1].sh_size = sizeof(file->text);
+    file->sections[1].sh_addralign = 4;
+
+    file->sections[2].sh_name = 7;
+    file->sections[2].sh_type = SHT_NOBITS;
+    file->sections[2].sh_flags = SHF_ALLOC | SHF_WRITE;
+    file->sections[2].sh_addr = TEST32_BSS_ADDRESS;
+    file->sections[2].sh_offset = sizeof(*file);
+    file->sections[2].sh_size = 32;
+    file->sections[2].sh_addralign = 4;
+
+    file->sections[3].sh_name = 12;
+    file->sections[3].sh_type = SHT_STRTAB;
+    file->sections[3].sh_offset = offsetof(test32_file_t, shstrtab);
+    file->sections[3].sh_size = sizeof(test32_shstrtab);
+    file->sections[3].sh_addralign = 1;
+
+    memcpy(file->shstrtab, test32_shstrtab, sizeof(test32_shstrtab));
+}
+
+
+
+
+/*
+ * The section to segment mapping of a 32-bit file must put .text
+ * in the first segment and .bss in the second, and the program
+ * header table must print it.
+ */
+static void test_ELF32_segment_mapping(void)
+{
+    test32_file_t file;
+    char filename[32];
+    elf_session_t session;
+    section_to_segment_mapping_t *mapping;
+    output_t output;
+
+
+    build_test32_file(&file);
+
+    if(write_test_file(&file, sizeof(file), filename) != RET_OK)
+    {
+        num_failures++;
+        return;
+    }
+
+    if(open_session(&session, filename) != RET_OK)
+    {
+        fprintf(stderr, "Unable to open session over %s.\n", filename);
+        unlink(filename);
+        num_failures++;
+        return;
+    }
+
+
+    mapping = get_session_section_to_segment_mapping(&session);
+    CHECK(mapping != NULL);
+
+    if(mapping != NULL)
+    {
+        CHECK(mapping->num_segments == 2);
+        CHECK(mapping->segment_start[1] - mapping->segment_start[0] == 1);
+        CHECK(mapping->section_indices[mapping->segment_start[0]] == 1);
+        CHECK(mapping->segment_start[2] - mapping->segment_start[1] == 1);
+        CHECK(mapping->section_indices[mapping->segment_start[1]] == 2);
+    }
+
+
+    init_memory_output(&output, MEMORY_OUTPUT_SIZE);
+
+    CHECK(stringify_ELF32_program_header_table(&output, get_session_ELF32_program_header_table(&session),
+                                               get_session_ELF32_header(&session), mapping,
+                                               get_session_section_names(&session)) == RET_OK);
+
+    append_char(&output, '\0');
+    CHECK(strstr(output.buffer, "0\t\t.text \n1\t\t.bss \n") != NULL);
+
+    release_output(&output);
+
+
+    close_session(&session);
+    unlink(filename);
+}
+
+
+
+
+int main(void)
+{
+    test_section_numbering(false);
+    test_section_numbering(true);
+    test_section_count_out_of_range();
+    test_ELF32_segment_mapping();
+
+    if(num_failures > 0)
+    {
+        fprintf(stderr, "test_readelf: %d checks failed.\n", num_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("test_readelf: all checks passed.\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,40 @@
+# Makefile for the unit tests of dumpelf. Run from the top
+# level directory with "make tests".
+CC=gcc
+CFLAGS=
+LIBS=-lpthread
+
+
+
+# Commonly used directories and filepaths
+SRC_DIR=src
+INC_DIR=include
+BUILD_DIR=build
+TEST_DIR=test
+TEST_BUILD_DIR=$(BUILD_DIR)/test
+
+
+# everything but main.c, which the test programs replace
+FILENAMES= debug.c frame.c names.c readelf.c commands.c stringify.c session.c output.c format.c pool.c scan.c lookup.c input.c dump.c ranges.c
+
+SOURCE_FILES= $(patsubst %.c, $(SRC_DIR)/%.c, $(FILENAMES))
+
+
+TESTS= test_readelf test_lookup test_names test_dump
+
+TEST_BINARIES= $(patsubst %, $(TEST_BUILD_DIR)/%, $(TESTS))
+
+
+
+# build every test program and run them all, stopping at the first failure
+run_tests: $(TEST_BINARIES)
+	for test in $(TEST_BINARIES); do ./$$test || exit 1; done
+
+
+$(TEST_BINARIES): $(TEST_BUILD_DIR)/%: $(TEST_DIR)/%.c $(SOURCE_FILES)
+	mkdir -p $(TEST_BUILD_DIR)
+	$(CC) $(CFLAGS) -I$(INC_DIR) $< $(SOURCE_FILES) -o $@ $(LIBS)
+
+
+
+.PHONY: run_tests